@@ -104,6 +104,21 @@ def run_dca_cmd(cmd, jsonfile, timeout=5):
     return result
 
 
+def discover_dcas(jsonfile, num_ips, timeout=5):
+    # probe num_ips addresses from the json DCA1000 ip at once
+    try:
+        result = subprocess.run([executables['dca'], "discover", jsonfile, str(num_ips)],
+                                capture_output=True, text=True, timeout=timeout)
+    except subprocess.TimeoutExpired:
+        return []
+    found = []
+    for line in result.stdout.splitlines():
+        if line.startswith("DCA1000EVM found : "):
+            ip, _, version = line[len("DCA1000EVM found : "):].partition(" (FPGA Version : ")
+            found.append((ip, version.rstrip(")")))
+    return found
+
+
 def main(config_files, executables):
     for name in executables:
         if not os.path.exists(os.path.join("bin", name)):
@@ -136,25 +151,22 @@ def setup(config_files, executables):
         config_temp["DCA1000Config"]["ethernetConfig"]["DCA1000IPAddress"] = ip_tmp
         ip_found = None
         print("Checking DCA reachability, please be patient...")
-        for i in range(11):
-            # dump json to temp config and test
-            with open(temp_file_path, 'w') as temp_file:
-                json.dump(config_temp, temp_file, indent=2)
-            printV(f"IP: {ip_tmp}")
-            if len(check_network_address("192.168.33.30")) == 0:
-                print("Waiting for network with fixed ip 192.168.33.30...")
-            while len(check_network_address("192.168.33.30")) == 0:
-                sleep(1)
-            result = run_dca_cmd("reset_fpga", temp_file_path, timeout=2)
-            if result == 0:
-                print(f"found dca on ip: {ip_tmp}")
-                ip_found = ip_tmp
-                break
-            else:
-                pass
-            ip_tmp = ip_tmp.split(".")
-            ip_tmp[-1] = str(int(ip_tmp[-1]) + 1)
-            ip_tmp = ".".join(ip_tmp)
+        # dump json to temp config and probe the whole range at once
+        with open(temp_file_path, 'w') as temp_file:
+            json.dump(config_temp, temp_file, indent=2)
+        if len(check_network_address("192.168.33.30")) == 0:
+            print("Waiting for network with fixed ip 192.168.33.30...")
+        while len(check_network_address("192.168.33.30")) == 0:
+            sleep(1)
+        found = discover_dcas(temp_file_path, 11)
+        for ip, version in found:
+            printV(f"IP: {ip} (FPGA Version : {version})")
+        if len(found) > 1:
+            print(f"Found {len(found)} DCAs, connect a single radar")
+        elif len(found) == 1:
+            ip_tmp = found[0][0]
+            print(f"found dca on ip: {ip_tmp}")
+            ip_found = ip_tmp
             config_temp["DCA1000Config"]["ethernetConfig"]["DCA1000IPAddress"] = ip_tmp
         if ip_found is None:
             print("Could not reach DCA, check connection or repower")
@@ -114,6 +114,9 @@
 /** Event timeout error                                                      */
 #define STS_RFDCCARD_EVENT_TIMEOUT_ERR (-6)
 
+/** Record process is not running in the event trigger mode                  */
+#define STS_RFDCCARD_REC_NOT_TRIGGERED_MODE (-7)
+
 /** Reset FPGA command code                                                  */
 #define CMD_CODE_RESET_FPGA 0x01
 
@@ -198,15 +201,43 @@
 /** Maximum length of a string                                               */
 #define MAX_NAME_LEN 255
 
+/** Maximum number of record data file base paths a record is striped across */
+#define MAX_STRIPE_PATHS 8
+
 /** Maximum length of version info                                           */
 #define MAX_VERSION_BUF_LEN 20
 
 /** Number of data types for record                                          */
 #define NUM_DATA_TYPES 5
 
+/** Maximum number of DCA1000EVM systems recorded from a shared data port    */
+#define MAX_SHARED_PORT_SYSTEMS 8
+
+/** Number of record statistics entries - one per data type (Multi mode) or
+ *  per system of a shared data port (Raw mode), not less than NUM_DATA_TYPES */
+#define NUM_REC_STATS_ENTRIES MAX_SHARED_PORT_SYSTEMS
+
 /** Maximum data bytes in command request                                    */
 #define MAX_DATA_BYTES 504
 
+/** Latency histogram - linear sub buckets per power of two range (~3% error) */
+#define LATENCY_HIST_SUB_BUCKETS 64
+
+/** Latency histogram - sub buckets added by each power of two range         */
+#define LATENCY_HIST_HALF_SUB_BUCKETS (LATENCY_HIST_SUB_BUCKETS / 2)
+
+/** Latency histogram - buckets to cover 0 to (2^32 - 1) micro seconds       */
+#define NUM_LATENCY_HIST_BUCKETS 928
+
+/** Maximum IP addresses probed by one discovery (host part 1 to 254)        */
+#define MAX_DISCOVERY_IPS 254
+
+/** LVDS lanes of the test pattern verification                             */
+#define MAX_PATTERN_LANES 4
+
+/** Test pattern ramps - I and Q channels of each LVDS lane                 */
+#define MAX_PATTERN_SLOTS (2 * MAX_PATTERN_LANES)
+
 ///****************
 /// Enumerations
 ///****************
@@ -283,7 +314,11 @@ enum DLL_ASYNC_STATUS
     STS_INVALID_RESP_PKT_ERR,
 
     /** Record inline buffer allocation failed   */
-    STS_REC_INLINE_BUF_ALLOCATION_ERR
+    STS_REC_INLINE_BUF_ALLOCATION_ERR,
+
+    /** Record files dropped before the retention age, the record
+     *  holds MAX_RETENTION_SEGMENTS files at most */
+    STS_REC_RETENTION_AGE_ERR
 };
 
 /** @enum SYS_CLI_REC_PROC_STATUS
@@ -383,6 +418,57 @@ typedef enum RECORD_STOP_MODE
     NON_STOP
 } RecordStopMode;
 
+/** File writer overflow policy once the spill buffers are exhausted         */
+typedef enum WRITER_OVERFLOW_POLICY
+{
+    /** Pause the data port thread till the file writer catches up */
+    WRITER_OVERFLOW_PAUSE = 1,
+
+    /** Drop whole frames of the record buffer, the file keeps a hole */
+    WRITER_OVERFLOW_DROP_FRAMES
+} WriterOverflowPolicy;
+
+/** File writer backend of the record data (inline processing)               */
+typedef enum WRITER_BACKEND
+{
+    /** Record buffers are written in the files by the file writer thread */
+    WRITER_BACKEND_FWRITE = 1,
+
+    /** Packets are copied to their offset in memory mapped record files */
+    WRITER_BACKEND_MMAP
+} WriterBackend;
+
+/** Record trigger mode of the ADC data (inline processing)                  */
+typedef enum RECORD_TRIGGER_MODE
+{
+    /** All the data is recorded in the file */
+    RECORD_TRIGGER_CONTINUOUS = 1,
+
+    /** Data is kept in a pre-trigger RAM ring, a trigger dumps the data
+     *  around it in the file */
+    RECORD_TRIGGER_EVENT
+} RecordTriggerMode;
+
+/** Latency histograms of the record process (inline processing)             */
+typedef enum LATENCY_HIST_TYPE
+{
+    /** Packet received to packet stored in the record buffer    */
+    LATENCY_RECV_TO_BUFFER = 0,
+
+    /** Record buffer full to buffer written in the file         */
+    LATENCY_BUFFER_TO_DISK,
+
+    /** Frame complete to record buffer handed to the file writer
+     *  (Multi mode only, raw mode has no frame boundaries)      */
+    LATENCY_FRAME_TO_HANDOFF,
+
+    /** Data port thread waiting for the file writer at buffer swap */
+    LATENCY_WRITER_STALL,
+
+    /** Number of latency histograms */
+    NUM_LATENCY_HISTS
+} LatencyHistType;
+
 ///****************
 /// Stucture Declarations
 ///****************
@@ -435,6 +521,83 @@ typedef struct REC_CONFIG_MODE
     UINT16 u16RecDelay;
 } strRecConfigMode;
 
+/** Capture filter configuration - ADC data layout of the frames and the
+ *  frames, RX channels and chirps kept in the record (Raw mode, reordering
+ *  enabled). Each chirp holds the samples of the enabled RX channels in
+ *  turn, the record is expected to start at a frame start                 */
+typedef struct CAPTURE_FILTER_CONFIG
+{
+    /** Capture filter enable/disable                   */
+    bool bFilterEnable;
+
+    /** ADC samples per chirp of each RX channel        */
+    UINT16 u16NumAdcSamples;
+
+    /** ADC output format - 0 real, 1 or 2 complex      */
+    UINT8 u8AdcFmt;
+
+    /** RX channels enabled in the ADC data (bit mask)  */
+    UINT8 u8RxChanEn;
+
+    /** Chirps per frame                                */
+    UINT16 u16NumChirpsPerFrame;
+
+    /** Every n-th frame from the first frame is kept   */
+    UINT32 u32FrameDecimation;
+
+    /** First frame kept                                */
+    UINT32 u32FrameStartIdx;
+
+    /** Last frame kept                                 */
+    UINT32 u32FrameEndIdx;
+
+    /** RX channels kept (bit mask within u8RxChanEn)   */
+    UINT8 u8RxChanSel;
+
+    /** First chirp kept of each frame                  */
+    UINT16 u16ChirpStartIdx;
+
+    /** Last chirp kept of each frame                   */
+    UINT16 u16ChirpEndIdx;
+} strCaptureFilterConfig;
+
+/** Test pattern verification configuration - the ADC data is checked
+ *  against the LVDS test pattern of the radar device instead of being
+ *  recorded (Raw mode). Each LVDS lane sends a 16 bit ramp on its I and Q
+ *  channels, restarted every test pattern packet. The words of the lanes
+ *  are interleaved in the data, I of all the lanes and then Q             */
+typedef struct TEST_PATTERN_CONFIG
+{
+    /** Test pattern verification enable/disable        */
+    bool bVerifyEnable;
+
+    /** ADC output format - 0 real (I only), 1 or 2 complex */
+    UINT8 u8AdcFmt;
+
+    /** Samples per lane of a test pattern packet, 0 for a ramp over the
+     *  whole record                                     */
+    UINT16 u16PktSize;
+
+    /** Ramp of each lane, I of lanes 0 - 3 and then Q. Bits [15:0] start
+     *  offset, bits [31:16] increment of each sample (testPatRxNIcfg and
+     *  testPatRxNQcfg of the radar device in four lane mode) */
+    UINT32 au32LaneCfg[MAX_PATTERN_SLOTS];
+} strTestPatternConfig;
+
+/** Shared data port configuration - several DCA1000EVM systems stream to the
+ *  data port of the connected system and their packets are told apart by
+ *  the source IP address (Raw mode). The start and stop record commands are
+ *  sent to all the systems on the config port of the connected system     */
+typedef struct SHARED_PORT_CONFIG
+{
+    /** Number of systems, the connected system first. 0 to record the
+     *  packets of any source as the connected system   */
+    UINT8 u8NumOfSystems;
+
+    /** IP address of each system                       */
+    UINT8 au8IpAddr[MAX_SHARED_PORT_SYSTEMS][4];
+} strSharedPortConfig;
+
 /** Start record modes configuration                                         */
 typedef struct START_REC_CONFIG_MODE
 {
@@ -473,46 +636,237 @@ typedef struct START_REC_CONFIG_MODE
 
     /** Data LVDS mode                                  */
     ConfigLvdsMode eLvdsMode;
+
+    /** Quiet period in millisec of the data socket drain on record
+     *  completion, 0 for the default                   */
+    UINT16 u16DrainQuietPeriod;
+
+    /** Capture timeout in millisec, no data received for it is reported
+     *  as system disconnected, 0 for the default        */
+    UINT32 u32CaptureTimeout;
+
+    /** Spill capacity in MB for the record buffers handed over while
+     *  the file writer is busy, 0 to disable           */
+    UINT16 u16WriterSpillSize;
+
+    /** File writer overflow policy once the spill capacity is used */
+    WriterOverflowPolicy eWriterOverflowPolicy;
+
+    /** Number of base paths the record buffers are striped across,
+     *  0 or 1 to record in s8FileBasePath only          */
+    UINT8 u8NumOfStripePaths;
+
+    /** Record data file base paths of the stripes, the stripe
+     *  manifest is created in s8FileBasePath            */
+    SINT8 s8StripeBasePath[MAX_STRIPE_PATHS][MAX_NAME_LEN];
+
+    /** Record trigger mode of the ADC data             */
+    RecordTriggerMode eRecordTriggerMode;
+
+    /** Pre-trigger ring capacity in MB (event trigger mode) */
+    UINT16 u16TriggerRingSize;
+
+    /** Data recorded before a trigger in millisec (event trigger mode) */
+    UINT32 u32PreTriggerDuration;
+
+    /** Data recorded after a trigger in millisec (event trigger mode) */
+    UINT32 u32PostTriggerDuration;
+
+    /** Capture filter of the ADC data (Raw mode)       */
+    strCaptureFilterConfig sCaptureFilter;
+
+    /** Record data chunk size in KB of the CRC32C integrity tags,
+     *  0 to disable                                     */
+    UINT16 u16CrcChunkSize;
+
+    /** Test pattern verification of the ADC data (Raw mode), nothing is
+     *  recorded while it is enabled                     */
+    strTestPatternConfig sTestPattern;
+
+    /** Systems sharing the data port (Raw mode), each one is recorded in
+     *  its own record files                             */
+    strSharedPortConfig sSharedPort;
+
+    /** Coalesced receive (UDP GRO) of the ADC data port, left disabled
+     *  where the OS does not have it                    */
+    bool bUdpGroEnable;
+
+    /** File writer backend of the ADC data              */
+    WriterBackend eWriterBackend;
+
+    /** Total size in MB of the record files kept, the oldest ones are
+     *  written over by the next ones (Raw mode), 0 if unbounded */
+    UINT32 u32RetentionSize;
+
+    /** Age in seconds of the record files kept, the older ones are
+     *  written over by the next ones (Raw mode), 0 if unbounded */
+    UINT32 u32RetentionAge;
+
+    /** Watermark of the committed data published while recording, the
+     *  record files are read in progress by the record tail reader */
+    bool bWatermarkEnable;
+
+    /** Frames per record file, the files end at whole frames of the
+     *  capture filter layout (Raw mode), 0 to end them by size */
+    UINT32 u32FramesPerFile;
+
+    /** Duration in millisec of a record file, it ends at the next frame
+     *  of the capture filter layout (Raw mode), 0 to end it by size */
+    UINT32 u32FileDuration;
 } strStartRecConfigMode;
 
-/** Inline processing statistics                                             */
+/** Inline processing statistics, indexed by data type (Multi mode) or by
+ *  system of a shared data port (Raw mode)                                   */
 typedef struct
 {
     /** Data type header ID                         */
-    SINT8 s8HeaderId[NUM_DATA_TYPES][MAX_NAME_LEN];
+    SINT8 s8HeaderId[NUM_REC_STATS_ENTRIES][MAX_NAME_LEN];
 
     /** First packet ID                             */
-    UINT32 u32FirstPktId[NUM_DATA_TYPES];
+    UINT32 u32FirstPktId[NUM_REC_STATS_ENTRIES];
 
     /** Last packet ID                              */
-    UINT32 u32LastPktId[NUM_DATA_TYPES];
+    UINT32 u32LastPktId[NUM_REC_STATS_ENTRIES];
 
     /** Out of sequence count                       */
-    ULONG64 u64OutOfSeqCount[NUM_DATA_TYPES];
+    ULONG64 u64OutOfSeqCount[NUM_REC_STATS_ENTRIES];
 
     /** Received packets count                      */
-    ULONG64 u64NumOfRecvdPackets[NUM_DATA_TYPES];
+    ULONG64 u64NumOfRecvdPackets[NUM_REC_STATS_ENTRIES];
 
     /** Zero filled packets count                   */
-    ULONG64 u64NumOfZeroFilledPackets[NUM_DATA_TYPES];
+    ULONG64 u64NumOfZeroFilledPackets[NUM_REC_STATS_ENTRIES];
 
     /** Zero filled bytes count                     */
-    ULONG64 u64NumOfZeroFilledBytes[NUM_DATA_TYPES];
+    ULONG64 u64NumOfZeroFilledBytes[NUM_REC_STATS_ENTRIES];
 
     /** Packet start timestamp                      */
-    time_t StartTime[NUM_DATA_TYPES];
+    time_t StartTime[NUM_REC_STATS_ENTRIES];
 
     /** Packet end timestamp                        */
-    time_t EndTime[NUM_DATA_TYPES];
+    time_t EndTime[NUM_REC_STATS_ENTRIES];
 
     /** Packet out of sequence seen from offset     */
-    UINT32 u32OutOfSeqPktFromOffset[NUM_DATA_TYPES];
+    UINT32 u32OutOfSeqPktFromOffset[NUM_REC_STATS_ENTRIES];
 
     /** Packet out of sequence seen till offset     */
-    UINT32 u32OutOfSeqPktToOffset[NUM_DATA_TYPES];
+    UINT32 u32OutOfSeqPktToOffset[NUM_REC_STATS_ENTRIES];
+
+    /** Record buffer swaps (inline processing)     */
+    ULONG64 u64NumOfBufSwaps[NUM_REC_STATS_ENTRIES];
+
+    /** Buffer swaps done while the file writer was
+     *  still busy with the previous buffer         */
+    ULONG64 u64NumOfWriterWaits[NUM_REC_STATS_ENTRIES];
+
+    /** Trailing packets recovered by the socket drain
+     *  on record completion                        */
+    ULONG64 u64NumOfDrainedPackets[NUM_REC_STATS_ENTRIES];
+
+    /** Record buffers spilled to RAM while the file
+     *  writer was busy                             */
+    ULONG64 u64NumOfSpilledBufs[NUM_REC_STATS_ENTRIES];
+
+    /** Buffer swaps paused till the file writer
+     *  caught up (spill capacity used)             */
+    ULONG64 u64NumOfWriterPauses[NUM_REC_STATS_ENTRIES];
+
+    /** Frames dropped for the busy file writer     */
+    ULONG64 u64NumOfDroppedFrames[NUM_REC_STATS_ENTRIES];
+
+    /** Bytes dropped for the busy file writer      */
+    ULONG64 u64NumOfDroppedBytes[NUM_REC_STATS_ENTRIES];
+
+    /** Pre-trigger ring dumps written in the record
+     *  file (event trigger mode)                   */
+    ULONG64 u64NumOfTriggerDumps[NUM_REC_STATS_ENTRIES];
+
+    /** Bytes dropped by the capture filter (frame decimation, RX
+     *  channel and chirp selection)                 */
+    ULONG64 u64NumOfFilteredBytes[NUM_REC_STATS_ENTRIES];
+
+    /** Lost packets (zero filled) dropped by the host socket on receive
+     *  buffer overflow, from the socket drop counter    */
+    ULONG64 u64NumOfSockDroppedPackets[NUM_REC_STATS_ENTRIES];
+
+    /** Lost packets (zero filled) not dropped by the host socket, lost
+     *  upstream (DCA1000EVM or network)              */
+    ULONG64 u64NumOfUpstreamLostPackets[NUM_REC_STATS_ENTRIES];
 
 } strRFDCCard_InlineProcStats;
 
+/** Latency histogram in micro seconds with log linear buckets               */
+typedef struct
+{
+    /** Samples per bucket                          */
+    ULONG64 u64Count[NUM_LATENCY_HIST_BUCKETS];
+
+    /** Total samples                               */
+    ULONG64 u64TotalCount;
+
+    /** Sum of all samples in micro seconds         */
+    ULONG64 u64TotalUs;
+
+    /** Maximum sample in micro seconds             */
+    ULONG64 u64MaxUs;
+
+} strRFDCCard_LatencyHist;
+
+/** Latency histograms of the record process for each data type (Multi
+ *  mode) or system of a shared data port (Raw mode)                         */
+typedef struct
+{
+    /** Histograms indexed by \ref LatencyHistType  */
+    strRFDCCard_LatencyHist sHist[NUM_REC_STATS_ENTRIES][NUM_LATENCY_HISTS];
+
+} strRFDCCard_LatencyStats;
+
+/** Test pattern verification statistics of the record process (Raw mode)   */
+typedef struct
+{
+    /** Packets checked                             */
+    ULONG64 u64NumOfCheckedPackets;
+
+    /** Packets with a word not matching the pattern */
+    ULONG64 u64NumOfBadPackets;
+
+    /** 16 bit words checked                        */
+    ULONG64 u64NumOfCheckedWords;
+
+    /** Bit errors of the words of each lane, words holding a value of
+     *  another lane or another sample are not counted here */
+    ULONG64 u64NumOfBitErrors[MAX_PATTERN_LANES];
+
+    /** Corrupted words of each lane                */
+    ULONG64 u64NumOfBadWords[MAX_PATTERN_LANES];
+
+    /** Words of each lane holding the value of another lane of the
+     *  same sample                                  */
+    ULONG64 u64NumOfLaneSwaps[MAX_PATTERN_LANES];
+
+    /** Words of each lane holding the value of the previous or next
+     *  sample of the lane                           */
+    ULONG64 u64NumOfMisalignedWords[MAX_PATTERN_LANES];
+
+} strRFDCCard_PatternStats;
+
+/** DCA1000EVM system found by discovery                                     */
+typedef struct
+{
+    /** FPGA IP address                             */
+    UINT8 au8Dca1000IpAddr[4];
+
+    /** System aliveness command status             */
+    SINT32 s32AlivenessStatus;
+
+    /** Read FPGA version command status            */
+    SINT32 s32FpgaVersion;
+
+    /** FPGA version, "major.minor [Record]"        */
+    SINT8 s8FpgaVersion[MAX_VERSION_BUF_LEN];
+
+} strRFDCCard_DiscoveryInfo;
+
 /** Command request protocol                                                 */
 typedef struct
 {
@@ -548,6 +902,31 @@ typedef struct
     UINT16 u16Footer;
 } DATA_CAPTURE_RESP;
 
+/** Verification status of a record against its CRC32C log                  */
+typedef struct RECORD_VERIFY_STATUS
+{
+    /** Chunks in the CRC32C log                        */
+    UINT32 u32NumOfChunks;
+
+    /** Chunks matching their CRC32C                    */
+    UINT32 u32NumOfGoodChunks;
+
+    /** Chunks not matching their CRC32C                */
+    UINT32 u32NumOfBadChunks;
+
+    /** Chunks missing in the record files (truncated record) */
+    UINT32 u32NumOfMissingChunks;
+
+    /** First chunk not matching or missing, u32NumOfChunks if none */
+    UINT32 u32FirstFailedChunk;
+
+    /** Record data bytes checked                       */
+    ULONG64 u64VerifiedBytes;
+
+    /** Record data bytes after the last chunk of the log */
+    ULONG64 u64UnloggedBytes;
+} strRecordVerifyStatus;
+
 /** Callback typedef for event handling                                      */
 typedef void (*EVENT_HANDLER)(
     /** Command code */
@@ -567,6 +946,21 @@ typedef void (*INLINE_PROC_HANDLER)(
     /** Data type index */
     UINT8 u8DataIndex);
 
+/** Handle of a striped record opened for reading                            */
+typedef void *STRIPE_READER_HANDLE;
+
+/** Handle of a record in progress opened for reading by its watermark      */
+typedef void *RECORD_TAIL_HANDLE;
+
+/** Callback typedef for the trigger detection of the event trigger mode,
+ *  it returns true to trigger a dump of the pre-trigger ring               */
+typedef bool (*RECORD_TRIGGER_HANDLER)(
+    /** ADC data handed to the file writer, before reordering */
+    const SINT8 *s8Data,
+
+    /** Size of data */
+    UINT32 u32Size);
+
 ///*****************
 /// API Declarations
 ///*****************
@@ -665,6 +1059,53 @@ extern "C"
     EXPORT STATUS ConfigureRFDCCard_Eeprom(
         strEthConfigMode sEthConfigMode);
 
+    /** @fn EXPORT STATUS ConfigureRFDCCards_Eeprom(strEthConfigMode *psCurEthConfig, <!--
+     * --> strEthConfigMode *psNewEthConfig, UINT16 u16NumOfCards, <!--
+     * --> STATUS *ps32Status)
+     * @brief This function is to configure the EEPROM of several DCA1000EVM <!--
+     * --> systems at once, see \ref ConfigureRFDCCard_Eeprom. The commands <!--
+     * --> are sent back to back and the responses are matched by the IP <!--
+     * --> address of the system
+     * @param [in] psCurEthConfig [strEthConfigMode *] - Current IP address <!--
+     * --> and config port of each system
+     * @param [in] psNewEthConfig [strEthConfigMode *] - EEPROM config of <!--
+     * --> each system
+     * @param [in] u16NumOfCards [UINT16] - Number of systems
+     * @param [out] ps32Status [STATUS *] - Command status of each system
+     * @pre Application should be connected to DCA1000EVM system using <!--
+     * --> \ref ConnectRFDCCard_ConfigMode API
+     * @return SINT32 value (status of the first failed system)
+     */
+    EXPORT STATUS ConfigureRFDCCards_Eeprom(
+        strEthConfigMode *psCurEthConfig,
+        strEthConfigMode *psNewEthConfig,
+        UINT16 u16NumOfCards,
+        STATUS *ps32Status);
+
+    /** @fn EXPORT STATUS DiscoverRFDCCards(UINT8 *pu8StartIpAddr, <!--
+     * --> UINT16 u16NumOfIps, UINT32 u32TimeoutMs, <!--
+     * --> strRFDCCard_DiscoveryInfo *psCards, UINT16 *pu16NumOfCards)
+     * @brief This function is to find the DCA1000EVM systems in a range of <!--
+     * --> IP addresses. System aliveness and read FPGA version commands are <!--
+     * --> sent to all the addresses at once and the responders are collected <!--
+     * --> within one timeout window
+     * @param [in] pu8StartIpAddr [UINT8 *] - First IP address of the range
+     * @param [in] u16NumOfIps [UINT16] - Number of IP addresses to probe
+     * @param [in] u32TimeoutMs [UINT32] - Response window in millisec
+     * @param [out] psCards [strRFDCCard_DiscoveryInfo *] - Responded systems, <!--
+     * --> array of u16NumOfIps entries
+     * @param [out] pu16NumOfCards [UINT16 *] - Number of responded systems
+     * @pre Application should be connected to DCA1000EVM system using <!--
+     * --> \ref ConnectRFDCCard_ConfigMode API
+     * @return SINT32 value
+     */
+    EXPORT STATUS DiscoverRFDCCards(
+        UINT8 *pu8StartIpAddr,
+        UINT16 u16NumOfIps,
+        UINT32 u32TimeoutMs,
+        strRFDCCard_DiscoveryInfo *psCards,
+        UINT16 *pu16NumOfCards);
+
     /** @fn EXPORT STATUS HandshakeRFDCCard(void)
      * @brief This function is to verify the DCA1000EVM system connectivity
      * @pre Application should be connected to DCA1000EVM system using <!--
@@ -717,6 +1158,27 @@ extern "C"
     EXPORT STATUS StartRecordData(
         strStartRecConfigMode sStartRecConfigMode);
 
+    /** @fn EXPORT STATUS ConfigureAndStartRecordData(strFpgaConfigMode sFpgaConfigMode, <!--
+     * --> strRecConfigMode sRecConfigMode, strStartRecConfigMode sStartRecConfigMode)
+     * @brief This function is to configure the FPGA and the record packet <!--
+     * --> delay and start recording the data with the commands sent back <!--
+     * --> to back. Responses are matched by command code and a config <!--
+     * --> command is sent again on its response timeout
+     * @param [in] sFpgaConfigMode [strFpgaConfigMode] - <!--
+     * --> Structure filled with FPGA config data
+     * @param [in] sRecConfigMode [strRecConfigMode] - <!--
+     * --> Structure filled with record delay config data
+     * @param [in] sStartRecConfigMode [strStartRecConfigMode] - <!--
+     * --> Structure filled with record config data
+     * @pre Application should be connected to DCA1000EVM system using <!--
+     * --> \ref ConnectRFDCCard_RecordMode API
+     * @return SINT32 value (status of the first failed command)
+     */
+    EXPORT STATUS ConfigureAndStartRecordData(
+        strFpgaConfigMode sFpgaConfigMode,
+        strRecConfigMode sRecConfigMode,
+        strStartRecConfigMode sStartRecConfigMode);
+
     /** @fn EXPORT STATUS StopRecordData(void)
      * @brief This function is to send command to FPGA to stop recording the <!--
      * --> data streamed over Ethernet from the DCA1000EVM system
@@ -800,6 +1262,150 @@ extern "C"
     EXPORT STATUS RecInlineProcStats_EventRegister(
         INLINE_PROC_HANDLER RecordStats_Callback);
 
+    /** @fn EXPORT STATUS ReadRFDCCard_LatencyStats(strRFDCCard_LatencyStats *psLatencyStats)
+     * @brief This function is to read the latency histograms of the running <!--
+     * --> or last record process (inline processing)
+     * @param [out] psLatencyStats [strRFDCCard_LatencyStats *] - <!--
+     * --> Structure filled with the latency histograms
+     * @return SINT32 value
+     */
+    EXPORT STATUS ReadRFDCCard_LatencyStats(
+        strRFDCCard_LatencyStats *psLatencyStats);
+
+    /** @fn EXPORT ULONG64 ReadRFDCCard_LatencyPercentile(const strRFDCCard_LatencyHist *psHist, DOUBLE dPercentile)
+     * @brief This function is to get the latency below which the given <!--
+     * --> percentage of the samples in a histogram fall
+     * @param [in] psHist [const strRFDCCard_LatencyHist *] - Latency histogram
+     * @param [in] dPercentile [DOUBLE] - Percentile (0 - 100)
+     * @return ULONG64 value - Latency in micro seconds
+     */
+    EXPORT ULONG64 ReadRFDCCard_LatencyPercentile(
+        const strRFDCCard_LatencyHist *psHist, DOUBLE dPercentile);
+
+    /** @fn EXPORT STATUS ReadRFDCCard_PatternStats(strRFDCCard_PatternStats *psPatternStats)
+     * @brief This function is to read the test pattern verification <!--
+     * --> statistics of the running or last record process
+     * @param [out] psPatternStats [strRFDCCard_PatternStats *] - <!--
+     * --> Structure filled with the verification statistics
+     * @return SINT32 value
+     */
+    EXPORT STATUS ReadRFDCCard_PatternStats(
+        strRFDCCard_PatternStats *psPatternStats);
+
+    /** @fn EXPORT STATUS OpenRecordStripes(SINT8 *s8ManifestFile, <!--
+     * -->                                  STRIPE_READER_HANDLE *phReader)
+     * @brief This function is to open a record striped across several <!--
+     * --> base paths for reading it as one data stream
+     * @param [in] s8ManifestFile [SINT8 *] - Stripe manifest file of the record
+     * @param [out] phReader [STRIPE_READER_HANDLE *] - Reader handle
+     * @return SINT32 value
+     */
+    EXPORT STATUS OpenRecordStripes(SINT8 *s8ManifestFile,
+                                    STRIPE_READER_HANDLE *phReader);
+
+    /** @fn EXPORT SINT32 ReadRecordStripes(STRIPE_READER_HANDLE hReader, <!--
+     * -->                                  SINT8 *s8Buffer, UINT32 u32Size)
+     * @brief This function is to read the next bytes of the data stream <!--
+     * --> of a striped record, the stripes are read in the recorded order
+     * @param [in] hReader [STRIPE_READER_HANDLE] - Reader handle
+     * @param [out] s8Buffer [SINT8 *] - Buffer filled with the data
+     * @param [in] u32Size [UINT32] - Size of buffer
+     * @pre Record should be opened using \ref OpenRecordStripes API
+     * @return SINT32 value - Bytes read, 0 at the end of the record or <!--
+     * --> error status
+     */
+    EXPORT SINT32 ReadRecordStripes(STRIPE_READER_HANDLE hReader,
+                                    SINT8 *s8Buffer, UINT32 u32Size);
+
+    /** @fn EXPORT STATUS CloseRecordStripes(STRIPE_READER_HANDLE hReader)
+     * @brief This function is to close a striped record opened for reading
+     * @param [in] hReader [STRIPE_READER_HANDLE] - Reader handle
+     * @return SINT32 value
+     */
+    EXPORT STATUS CloseRecordStripes(STRIPE_READER_HANDLE hReader);
+
+    /** @fn EXPORT STATUS OpenRecordTail(SINT8 *s8WatermarkFile, <!--
+     * -->                               UINT32 u32FrameSize, bool bFromLatest, <!--
+     * -->                               RECORD_TAIL_HANDLE *phReader)
+     * @brief This function is to open a record in progress by its <!--
+     * --> watermark file for reading its committed frames
+     * @param [in] s8WatermarkFile [SINT8 *] - Watermark file of the record
+     * @param [in] u32FrameSize [UINT32] - Bytes of a frame, 0 for the <!--
+     * --> frame size of the watermark file
+     * @param [in] bFromLatest [bool] - Read from the first frame of the <!--
+     * --> record file written last, else from the oldest record file kept
+     * @param [out] phReader [RECORD_TAIL_HANDLE *] - Reader handle
+     * @return SINT32 value
+     */
+    EXPORT STATUS OpenRecordTail(SINT8 *s8WatermarkFile, UINT32 u32FrameSize,
+                                 bool bFromLatest,
+                                 RECORD_TAIL_HANDLE *phReader);
+
+    /** @fn EXPORT SINT32 ReadRecordTail(RECORD_TAIL_HANDLE hReader, <!--
+     * -->                               SINT8 *s8Buffer, UINT32 u32Size, <!--
+     * -->                               UINT32 u32TimeoutMs, <!--
+     * -->                               ULONG64 *pu64Offset)
+     * @brief This function is to read the next whole frames committed in <!--
+     * --> the record, the watermark is polled till they are committed
+     * @param [in] hReader [RECORD_TAIL_HANDLE] - Reader handle
+     * @param [out] s8Buffer [SINT8 *] - Buffer filled with the data
+     * @param [in] u32Size [UINT32] - Size of buffer, one frame at least
+     * @param [in] u32TimeoutMs [UINT32] - Wait for the data in millisec
+     * @param [out] pu64Offset [ULONG64 *] - Record data offset of the <!--
+     * --> data read, NULL if not needed
+     * @pre Record should be opened using \ref OpenRecordTail API
+     * @return SINT32 value - Bytes read, 0 at the end of a stopped <!--
+     * --> record or error status (STS_RFDCCARD_TIMEOUT_ERR if nothing is <!--
+     * --> committed in time)
+     */
+    EXPORT SINT32 ReadRecordTail(RECORD_TAIL_HANDLE hReader, SINT8 *s8Buffer,
+                                 UINT32 u32Size, UINT32 u32TimeoutMs,
+                                 ULONG64 *pu64Offset);
+
+    /** @fn EXPORT STATUS CloseRecordTail(RECORD_TAIL_HANDLE hReader)
+     * @brief This function is to close a record opened by its watermark
+     * @param [in] hReader [RECORD_TAIL_HANDLE] - Reader handle
+     * @return SINT32 value
+     */
+    EXPORT STATUS CloseRecordTail(RECORD_TAIL_HANDLE hReader);
+
+    /** @fn EXPORT STATUS VerifyRecordCrc(SINT8 *s8CrcLogFile, <!--
+     * -->              UINT32 u32NumOfThreads, strRecordVerifyStatus *psVerifyStatus)
+     * @brief This function is to check the record data against the <!--
+     * --> CRC32C tags of its chunks. The record is read once, the chunks <!--
+     * --> read are checked by the worker threads while the next are read
+     * @param [in] s8CrcLogFile [SINT8 *] - CRC32C log file of the record
+     * @param [in] u32NumOfThreads [UINT32] - Worker threads, 0 for one <!--
+     * --> per processor core
+     * @param [out] psVerifyStatus [strRecordVerifyStatus *] - Verification <!--
+     * --> status
+     * @return SINT32 value
+     */
+    EXPORT STATUS VerifyRecordCrc(SINT8 *s8CrcLogFile, UINT32 u32NumOfThreads,
+                                  strRecordVerifyStatus *psVerifyStatus);
+
+    /** @fn EXPORT STATUS TriggerRecordDump(void)
+     * @brief This function is to trigger a dump of the pre-trigger ring <!--
+     * --> in the record file (event trigger mode). The data from the <!--
+     * --> pre-trigger duration before the trigger till the post-trigger <!--
+     * --> duration after it is recorded. It only latches the trigger <!--
+     * --> time, hence it can be called from a signal handler
+     * @pre Record process should be running using \ref StartRecordData API
+     * @return SINT32 value
+     */
+    EXPORT STATUS TriggerRecordDump(void);
+
+    /** @fn EXPORT STATUS RecordTrigger_EventRegister(RECORD_TRIGGER_HANDLER TriggerDetect_Callback)
+     * @brief This function is to register user callback for detecting <!--
+     * --> triggers in the ADC data (event trigger mode). It is called by <!--
+     * --> the file writer thread with each record buffer, NULL unregisters it
+     * @param [in] TriggerDetect_Callback [RECORD_TRIGGER_HANDLER] - <!--
+     * --> Callback function
+     * @return SINT32 value
+     */
+    EXPORT STATUS RecordTrigger_EventRegister(
+        RECORD_TRIGGER_HANDLER TriggerDetect_Callback);
+
 #ifdef __cplusplus
 }
 #endif
@@ -112,6 +112,12 @@ class osal
     /** Shared memory inline stats update status variable*/
     SINT32 s16StatusInline = SUCCESS_STATUS;
 
+    /** @fn void NotifyRecProcStateChange()
+     * @brief This function is to publish a record process state change <!--
+     * --> and wake up the processes waiting for it
+     */
+    void NotifyRecProcStateChange();
+
 public:
 
     /** @fn osal()
@@ -128,6 +134,18 @@ public:
      */
     SINT32 QueryRecordProcStatus(UINT16 u16ConfigPort, SHM_PROC_STATES *procStates);
 
+    /** @fn SINT32 WaitForRecProcStateChange(UINT16 u16ConfigPort, <!--
+     * --> UINT32 u32StateSeq, UINT32 u32MilliSec)
+     * @brief This function is to wait till the record process state <!--
+     * --> sequence in shared memory differs from the given one
+     * @param [in] u16ConfigPort [UINT16] - Config port
+     * @param [in] u32StateSeq [UINT32] - State sequence read last
+     * @param [in] u32MilliSec [UINT32] - Timeout in milli second
+     * @return SINT32 value
+     */
+    SINT32 WaitForRecProcStateChange(UINT16 u16ConfigPort, UINT32 u32StateSeq,
+                                     UINT32 u32MilliSec);
+
     /** @fn SINT32 WriteDefaultRecordProcStatus(UINT16 u16ConfigPort)
      * @brief This function is to write the default value for the record <!--
      * --> process status in the shared memory when it is created
@@ -199,12 +217,29 @@ public:
                                    bool bOutOfSeqSetFlag,
                                    UINT8 u8DataIndex);
 
+    /** @fn SINT32 WriteRecProcLatencyStats(UINT16 u16ConfigPort, <!--
+     * --> strRFDCCard_LatencyStats *strLatencyStats)
+     * @brief This function is to write the latency histograms of record <!--
+     * --> process in the shared memory
+     * @param [in] u16ConfigPort [UINT16] - Config port
+     * @param [in] strLatencyStats [strRFDCCard_LatencyStats *] - Latency histograms
+     * @return SINT32 value
+     */
+    SINT32 WriteRecProcLatencyStats(UINT16 u16ConfigPort,
+                                    strRFDCCard_LatencyStats *strLatencyStats);
+
     /** @fn  void SleepInMilliSec(UINT32 u32MilliSec)
      * @brief This function is to add delay in milli second
      * @param [in] u32MilliSec [UINT32] - Milli second
      */
     void SleepInMilliSec(UINT32 u32MilliSec);
 
+    /** @fn ULONG64 GetTimeInMicroSec()
+     * @brief This function is to read a monotonic clock in micro second
+     * @return ULONG64 value
+     */
+    ULONG64 GetTimeInMicroSec();
+
     /** @fn SINT32 IsValidDir(SINT8 *s8FileBasePath)
      * @brief This function is to validate the directory path
      * @param [in] s8FileBasePath [SINT8 *] - Directory path
@@ -243,6 +278,16 @@ public:
      */
     SINT32 WaitForSignal(OSAL_SIGNAL_HANDLE_TYPE *event, UINT32 u32Sec);
 
+    /** @fn SINT32 WaitForSignalInMilliSec(OSAL_SIGNAL_HANDLE_TYPE *event, UINT32 u32MilliSec)
+     * @brief This function is to make the event wait for a signal for a <!--
+     * --> defined time in millisec
+     * @param [in] event [OSAL_SIGNAL_HANDLE_TYPE *] - Event
+     * @param [in] u32MilliSec [UINT32] - Millisecond
+     * @return SINT32 value
+     */
+    SINT32 WaitForSignalInMilliSec(OSAL_SIGNAL_HANDLE_TYPE *event,
+                                   UINT32 u32MilliSec);
+
     /** @fn void InitEvent(OSAL_SIGNAL_HANDLE_TYPE *event)
      * @brief This function is to initialize an event
      * @param [in] event [OSAL_SIGNAL_HANDLE_TYPE *] - Event
@@ -55,6 +55,9 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <limits.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
 #include "osal.h"
 #include "../errcodes.h"
 
@@ -197,10 +200,12 @@ SINT32 osal::QueryRecordProcStatus(UINT16 u16ConfigPort, SHM_PROC_STATES *procSt
         }
     }
 
+    procStates->u32StateSeq = __atomic_load_n(&shm_proc_states->u32StateSeq,
+                                              __ATOMIC_SEQ_CST);
     procStates->u16CommandCode = shm_proc_states->u16CommandCode;
     procStates->s32CommandStatus = shm_proc_states->s32CommandStatus;
     procStates->u32AsyncStatus = shm_proc_states->u32AsyncStatus;
-    for(int i = 0; i < NUM_DATA_TYPES; i ++)
+    for(int i = 0; i < NUM_REC_STATS_ENTRIES; i ++)
     {
         strcpy(procStates->strInlineProcStats.s8HeaderId[i],
                 shm_proc_states->strInlineProcStats.s8HeaderId[i]);
@@ -220,11 +225,35 @@ SINT32 osal::QueryRecordProcStatus(UINT16 u16ConfigPort, SHM_PROC_STATES *procSt
                 shm_proc_states->strInlineProcStats.u32OutOfSeqPktFromOffset[i];
         procStates->strInlineProcStats.u32OutOfSeqPktToOffset[i] =
                 shm_proc_states->strInlineProcStats.u32OutOfSeqPktToOffset[i];
+        procStates->strInlineProcStats.u64NumOfBufSwaps[i] =
+                shm_proc_states->strInlineProcStats.u64NumOfBufSwaps[i];
+        procStates->strInlineProcStats.u64NumOfWriterWaits[i] =
+                shm_proc_states->strInlineProcStats.u64NumOfWriterWaits[i];
+        procStates->strInlineProcStats.u64NumOfDrainedPackets[i] =
+                shm_proc_states->strInlineProcStats.u64NumOfDrainedPackets[i];
+        procStates->strInlineProcStats.u64NumOfSpilledBufs[i] =
+                shm_proc_states->strInlineProcStats.u64NumOfSpilledBufs[i];
+        procStates->strInlineProcStats.u64NumOfWriterPauses[i] =
+                shm_proc_states->strInlineProcStats.u64NumOfWriterPauses[i];
+        procStates->strInlineProcStats.u64NumOfDroppedFrames[i] =
+                shm_proc_states->strInlineProcStats.u64NumOfDroppedFrames[i];
+        procStates->strInlineProcStats.u64NumOfDroppedBytes[i] =
+                shm_proc_states->strInlineProcStats.u64NumOfDroppedBytes[i];
+        procStates->strInlineProcStats.u64NumOfTriggerDumps[i] =
+                shm_proc_states->strInlineProcStats.u64NumOfTriggerDumps[i];
+        procStates->strInlineProcStats.u64NumOfFilteredBytes[i] =
+                shm_proc_states->strInlineProcStats.u64NumOfFilteredBytes[i];
+        procStates->strInlineProcStats.u64NumOfSockDroppedPackets[i] =
+                shm_proc_states->strInlineProcStats.u64NumOfSockDroppedPackets[i];
+        procStates->strInlineProcStats.u64NumOfUpstreamLostPackets[i] =
+                shm_proc_states->strInlineProcStats.u64NumOfUpstreamLostPackets[i];
         procStates->strInlineProcStats.StartTime[i] =
                 shm_proc_states->strInlineProcStats.StartTime[i];
         procStates->strInlineProcStats.EndTime[i] =
                 shm_proc_states->strInlineProcStats.EndTime[i];
     }
+    memcpy(&procStates->strLatencyStats, &shm_proc_states->strLatencyStats,
+           sizeof(strRFDCCard_LatencyStats));
 
     // release
     UnmapShm();
@@ -268,7 +297,7 @@ SINT32 osal::WriteDefaultRecordProcStatus(UINT16 u16ConfigPort)
     shm_proc_states->u16CommandCode = CMD_CODE_START_RECORD;
     shm_proc_states->s32CommandStatus = STS_CLI_REC_PROC_STOPPED;
     shm_proc_states->u32AsyncStatus = 0;
-    for(int i = 0; i < NUM_DATA_TYPES; i ++)
+    for(int i = 0; i < NUM_REC_STATS_ENTRIES; i ++)
     {
         strcpy(shm_proc_states->strInlineProcStats.s8HeaderId[i], "");
         shm_proc_states->strInlineProcStats.u32FirstPktId[i] = 0;
@@ -279,9 +308,24 @@ SINT32 osal::WriteDefaultRecordProcStatus(UINT16 u16ConfigPort)
         shm_proc_states->strInlineProcStats.u64NumOfZeroFilledBytes[i] = 0;
         shm_proc_states->strInlineProcStats.u32OutOfSeqPktFromOffset[i] = 0;
         shm_proc_states->strInlineProcStats.u32OutOfSeqPktToOffset[i] = 0;
+        shm_proc_states->strInlineProcStats.u64NumOfBufSwaps[i] = 0;
+        shm_proc_states->strInlineProcStats.u64NumOfWriterWaits[i] = 0;
+        shm_proc_states->strInlineProcStats.u64NumOfDrainedPackets[i] = 0;
+        shm_proc_states->strInlineProcStats.u64NumOfSpilledBufs[i] = 0;
+        shm_proc_states->strInlineProcStats.u64NumOfWriterPauses[i] = 0;
+        shm_proc_states->strInlineProcStats.u64NumOfDroppedFrames[i] = 0;
+        shm_proc_states->strInlineProcStats.u64NumOfDroppedBytes[i] = 0;
+        shm_proc_states->strInlineProcStats.u64NumOfTriggerDumps[i] = 0;
+        shm_proc_states->strInlineProcStats.u64NumOfFilteredBytes[i] = 0;
+        shm_proc_states->strInlineProcStats.u64NumOfSockDroppedPackets[i] = 0;
+        shm_proc_states->strInlineProcStats.u64NumOfUpstreamLostPackets[i] = 0;
         shm_proc_states->strInlineProcStats.StartTime[i] = time(NULL);
         shm_proc_states->strInlineProcStats.EndTime[i] = time(NULL);
     }
+    memset(&shm_proc_states->strLatencyStats, 0,
+           sizeof(strRFDCCard_LatencyStats));
+
+    NotifyRecProcStateChange();
 
     return SUCCESS_STATUS;
 }
@@ -322,6 +366,8 @@ SINT32 osal::WriteRecordProcStatus(UINT16 u16ConfigPort, SINT32 s32CmdStatus)
 
     shm_proc_states->s32CommandStatus = s32CmdStatus;
 
+    NotifyRecProcStateChange();
+
     return SUCCESS_STATUS;
 }
 
@@ -361,9 +407,81 @@ SINT32 osal::WriteRecAsyncStatus(UINT16 u16ConfigPort, UINT32 u32AsyncStatus)
 
     shm_proc_states->u32AsyncStatus |= u32AsyncStatus;
 
+    NotifyRecProcStateChange();
+
     return s16Status;
 }
 
+/** @fn void osal::NotifyRecProcStateChange()
+ * @brief This function is to publish a record process state change <!--
+ * --> and wake up the processes waiting for it
+ */
+void osal::NotifyRecProcStateChange()
+{
+    /** Sequence is updated after the state, a waiter reading the old
+     *  sequence is woken up by the futex wake below                      */
+    __atomic_add_fetch(&shm_proc_states->u32StateSeq, 1, __ATOMIC_SEQ_CST);
+
+    syscall(SYS_futex, &shm_proc_states->u32StateSeq, FUTEX_WAKE, INT_MAX,
+            NULL, NULL, 0);
+}
+
+/** @fn SINT32 osal::WaitForRecProcStateChange(UINT16 u16ConfigPort, <!--
+ * --> UINT32 u32StateSeq, UINT32 u32MilliSec)
+ * @brief This function is to wait till the record process state <!--
+ * --> sequence in shared memory differs from the given one
+ * @param [in] u16ConfigPort [UINT16] - Config port
+ * @param [in] u32StateSeq [UINT32] - State sequence read last
+ * @param [in] u32MilliSec [UINT32] - Timeout in milli second
+ * @return SINT32 value
+ */
+SINT32 osal::WaitForRecProcStateChange(UINT16 u16ConfigPort, UINT32 u32StateSeq,
+                                       UINT32 u32MilliSec)
+{
+    SINT32 s32Status = SUCCESS_STATUS;
+    ULONG64 u64EndTimeUs = GetTimeInMicroSec() +
+                           ((ULONG64)u32MilliSec * MILLI_TO_MICRO_SEC_CONVERSION);
+    ULONG64 u64CurTimeUs = 0;
+    struct timespec sTimeout;
+    bool bMapped = false;
+
+    if(shm_proc_states == NULL)
+    {
+        bMapped = true;
+        s32Status = MapShm(u16ConfigPort);
+        if(s32Status != SUCCESS_STATUS)
+        {
+            return s32Status;
+        }
+    }
+
+    /** Futex wait returns at once if the sequence is already changed, on
+     *  a wake up from the record process, on a signal or on timeout      */
+    while(__atomic_load_n(&shm_proc_states->u32StateSeq, __ATOMIC_SEQ_CST)
+          == u32StateSeq)
+    {
+        u64CurTimeUs = GetTimeInMicroSec();
+        if(u64CurTimeUs >= u64EndTimeUs)
+        {
+            s32Status = STS_RFDCCARD_EVENT_TIMEOUT_ERR;
+            break;
+        }
+        sTimeout.tv_sec = (u64EndTimeUs - u64CurTimeUs) /
+                 (SEC_TO_MILLI_SEC_CONVERSION * MILLI_TO_MICRO_SEC_CONVERSION);
+        sTimeout.tv_nsec = ((u64EndTimeUs - u64CurTimeUs) %
+                 (SEC_TO_MILLI_SEC_CONVERSION * MILLI_TO_MICRO_SEC_CONVERSION))
+                 * MILLI_TO_MICRO_SEC_CONVERSION;
+
+        syscall(SYS_futex, &shm_proc_states->u32StateSeq, FUTEX_WAIT,
+                u32StateSeq, &sTimeout, NULL, 0);
+    }
+
+    if(bMapped)
+        UnmapShm();
+
+    return s32Status;
+}
+
 /** @fn SINT32 osal::WriteRecProcInlineStats(UINT16 u16ConfigPort, <!--
  * --> strRFDCCard_InlineProcStats strInlineStats, bool bOutOfSeqSetFlag <!--
  * --> UINT8 u8DataIndex)
@@ -426,6 +544,28 @@ SINT32 osal::WriteRecProcInlineStats(UINT16 u16ConfigPort,
             strInlineStats->u32OutOfSeqPktFromOffset[u8DataIndex];
     shm_proc_states->strInlineProcStats.u32OutOfSeqPktToOffset[u8DataIndex] =
             strInlineStats->u32OutOfSeqPktToOffset[u8DataIndex];
+    shm_proc_states->strInlineProcStats.u64NumOfBufSwaps[u8DataIndex] =
+            strInlineStats->u64NumOfBufSwaps[u8DataIndex];
+    shm_proc_states->strInlineProcStats.u64NumOfWriterWaits[u8DataIndex] =
+            strInlineStats->u64NumOfWriterWaits[u8DataIndex];
+    shm_proc_states->strInlineProcStats.u64NumOfDrainedPackets[u8DataIndex] =
+            strInlineStats->u64NumOfDrainedPackets[u8DataIndex];
+    shm_proc_states->strInlineProcStats.u64NumOfSpilledBufs[u8DataIndex] =
+            strInlineStats->u64NumOfSpilledBufs[u8DataIndex];
+    shm_proc_states->strInlineProcStats.u64NumOfWriterPauses[u8DataIndex] =
+            strInlineStats->u64NumOfWriterPauses[u8DataIndex];
+    shm_proc_states->strInlineProcStats.u64NumOfDroppedFrames[u8DataIndex] =
+            strInlineStats->u64NumOfDroppedFrames[u8DataIndex];
+    shm_proc_states->strInlineProcStats.u64NumOfDroppedBytes[u8DataIndex] =
+            strInlineStats->u64NumOfDroppedBytes[u8DataIndex];
+    shm_proc_states->strInlineProcStats.u64NumOfTriggerDumps[u8DataIndex] =
+            strInlineStats->u64NumOfTriggerDumps[u8DataIndex];
+    shm_proc_states->strInlineProcStats.u64NumOfFilteredBytes[u8DataIndex] =
+            strInlineStats->u64NumOfFilteredBytes[u8DataIndex];
+    shm_proc_states->strInlineProcStats.u64NumOfSockDroppedPackets[u8DataIndex] =
+            strInlineStats->u64NumOfSockDroppedPackets[u8DataIndex];
+    shm_proc_states->strInlineProcStats.u64NumOfUpstreamLostPackets[u8DataIndex] =
+            strInlineStats->u64NumOfUpstreamLostPackets[u8DataIndex];
     shm_proc_states->strInlineProcStats.StartTime[u8DataIndex] =
             strInlineStats->StartTime[u8DataIndex];
     shm_proc_states->strInlineProcStats.EndTime[u8DataIndex] =
@@ -434,6 +574,48 @@ SINT32 osal::WriteRecProcInlineStats(UINT16 u16ConfigPort,
     return s16StatusInline;
 }
 
+/** @fn SINT32 osal::WriteRecProcLatencyStats(UINT16 u16ConfigPort, <!--
+ * --> strRFDCCard_LatencyStats *strLatencyStats)
+ * @brief This function is to write the latency histograms of record <!--
+ * --> process in the shared memory
+ * @param [in] u16ConfigPort [UINT16] - Config port
+ * @param [in] strLatencyStats [strRFDCCard_LatencyStats *] - Latency histograms
+ * @return SINT32 value
+ */
+SINT32 osal::WriteRecProcLatencyStats(UINT16 u16ConfigPort,
+                                strRFDCCard_LatencyStats *strLatencyStats)
+{
+    s16StatusInline = SUCCESS_STATUS;
+
+    if (hShmem == INVALID_SHM_HANDLE_VALUE)
+    {
+        s16StatusInline = CreateShm(u16ConfigPort);
+        if(s16StatusInline == SUCCESS_STATUS)
+        {
+            s16StatusInline = MapShm(u16ConfigPort);
+            if(s16StatusInline != SUCCESS_STATUS)
+            {
+                return s16StatusInline;
+            }
+        }
+        else
+            return s16StatusInline;
+    }
+    if (shm_proc_states == NULL)
+    {
+        s16StatusInline = MapShm(u16ConfigPort);
+        if(s16StatusInline != SUCCESS_STATUS)
+        {
+            return s16StatusInline;
+        }
+    }
+
+    memcpy(&shm_proc_states->strLatencyStats, strLatencyStats,
+           sizeof(strRFDCCard_LatencyStats));
+
+    return s16StatusInline;
+}
+
 /** @fn SINT32 osal::MapShm(UINT16 u16ConfigPort)
  * @brief This function is to map shared memory for updating record process status
  * @param [in] u16ConfigPort [UINT16] - Config port
@@ -501,6 +683,21 @@ void osal::SleepInMilliSec(UINT32 u32MilliSec)
     usleep(u32MilliSec * MILLI_TO_MICRO_SEC_CONVERSION);
 }
 
+/** @fn ULONG64 osal::GetTimeInMicroSec()
+ * @brief This function is to read a monotonic clock in micro second
+ * @return ULONG64 value
+ */
+ULONG64 osal::GetTimeInMicroSec()
+{
+    struct timespec sTime;
+
+    clock_gettime(CLOCK_MONOTONIC, &sTime);
+
+    return ((ULONG64)sTime.tv_sec * SEC_TO_MILLI_SEC_CONVERSION *
+            MILLI_TO_MICRO_SEC_CONVERSION) +
+            (sTime.tv_nsec / MILLI_TO_MICRO_SEC_CONVERSION);
+}
+
 /** @fn SINT32 osal::IsValidDir(SINT8 *s8FileBasePath)
  * @brief This function is to validate the directory path
  * @param [in] s8FileBasePath [SINT8 *] - Directory path
@@ -570,15 +767,57 @@ SINT32 osal::WaitForSignal(OSAL_SIGNAL_HANDLE_TYPE *event, UINT32 u32Sec)
         abstime.tv_sec = tt + u32Sec;
         abstime.tv_nsec = 0;
 
+        /** Consume a signal raised before the wait started, same as the
+         *  auto reset event on Windows                                      */
         pthread_mutex_lock(&event->mutexVar);
+        while(!event->bSignalled)
+        {
+            if(ETIMEDOUT == pthread_cond_timedwait(&event->condnVar,
+                                                   &event->mutexVar, &abstime))
+            {
+                pthread_mutex_unlock(&event->mutexVar);
+                return STS_RFDCCARD_EVENT_TIMEOUT_ERR;
+            }
+        }
+        event->bSignalled = false;
+        pthread_mutex_unlock(&event->mutexVar);
+    }
+
+    return SUCCESS_STATUS;
+}
+
+/** @fn SINT32 osal::WaitForSignalInMilliSec(OSAL_SIGNAL_HANDLE_TYPE *event, UINT32 u32MilliSec)
+ * @brief This function is to make the event wait for a signal for a <!--
+ * --> defined time in millisec
+ * @param [in] event [OSAL_SIGNAL_HANDLE_TYPE *] - Event
+ * @param [in] u32MilliSec [UINT32] - Millisecond
+ * @return SINT32 value
+ */
+SINT32 osal::WaitForSignalInMilliSec(OSAL_SIGNAL_HANDLE_TYPE *event,
+                                     UINT32 u32MilliSec)
+{
+    struct timespec abstime;
+    clock_gettime(CLOCK_REALTIME, &abstime);
+    abstime.tv_sec += u32MilliSec / SEC_TO_MILLI_SEC_CONVERSION;
+    abstime.tv_nsec += (u32MilliSec % SEC_TO_MILLI_SEC_CONVERSION) * 1000000L;
+    if(abstime.tv_nsec >= 1000000000L)
+    {
+        abstime.tv_sec++;
+        abstime.tv_nsec -= 1000000000L;
+    }
+
+    pthread_mutex_lock(&event->mutexVar);
+    while(!event->bSignalled)
+    {
         if(ETIMEDOUT == pthread_cond_timedwait(&event->condnVar,
                                                &event->mutexVar, &abstime))
         {
             pthread_mutex_unlock(&event->mutexVar);
             return STS_RFDCCARD_EVENT_TIMEOUT_ERR;
         }
-        pthread_mutex_unlock(&event->mutexVar);
     }
+    event->bSignalled = false;
+    pthread_mutex_unlock(&event->mutexVar);
 
     return SUCCESS_STATUS;
 }
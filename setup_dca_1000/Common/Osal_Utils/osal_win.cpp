@@ -57,6 +57,9 @@
 #include "osal.h"
 #include "../errcodes.h"
 
+/** Polling interval in millisec for the record process state sequence,
+ *  a shared memory word can not be waited on across processes        */
+#define MILLI_SEC_TO_POLL_SHM_STATE 1
 
 /** @fn osal::osal()
  * @brief This constructor is used to initialize variables
@@ -207,10 +210,12 @@ SINT32 osal::QueryRecordProcStatus(UINT16 u16ConfigPort, SHM_PROC_STATES *procSt
         }
     }
 
+	procStates->u32StateSeq = InterlockedCompareExchange(
+	            (volatile LONG *)&shm_proc_states->u32StateSeq, 0, 0);
 	procStates->u16CommandCode = shm_proc_states->u16CommandCode;
 	procStates->s32CommandStatus = shm_proc_states->s32CommandStatus;
 	procStates->u32AsyncStatus = shm_proc_states->u32AsyncStatus;
-    for(int i = 0; i < NUM_DATA_TYPES; i ++)
+    for(int i = 0; i < NUM_REC_STATS_ENTRIES; i ++)
     {
         strcpy(procStates->strInlineProcStats.s8HeaderId[i],
                 shm_proc_states->strInlineProcStats.s8HeaderId[i]);
@@ -230,11 +235,35 @@ SINT32 osal::QueryRecordProcStatus(UINT16 u16ConfigPort, SHM_PROC_STATES *procSt
                 shm_proc_states->strInlineProcStats.u32OutOfSeqPktFromOffset[i];
         procStates->strInlineProcStats.u32OutOfSeqPktToOffset[i] =
                 shm_proc_states->strInlineProcStats.u32OutOfSeqPktToOffset[i];
+        procStates->strInlineProcStats.u64NumOfBufSwaps[i] =
+                shm_proc_states->strInlineProcStats.u64NumOfBufSwaps[i];
+        procStates->strInlineProcStats.u64NumOfWriterWaits[i] =
+                shm_proc_states->strInlineProcStats.u64NumOfWriterWaits[i];
+        procStates->strInlineProcStats.u64NumOfDrainedPackets[i] =
+                shm_proc_states->strInlineProcStats.u64NumOfDrainedPackets[i];
+        procStates->strInlineProcStats.u64NumOfSpilledBufs[i] =
+                shm_proc_states->strInlineProcStats.u64NumOfSpilledBufs[i];
+        procStates->strInlineProcStats.u64NumOfWriterPauses[i] =
+                shm_proc_states->strInlineProcStats.u64NumOfWriterPauses[i];
+        procStates->strInlineProcStats.u64NumOfDroppedFrames[i] =
+                shm_proc_states->strInlineProcStats.u64NumOfDroppedFrames[i];
+        procStates->strInlineProcStats.u64NumOfDroppedBytes[i] =
+                shm_proc_states->strInlineProcStats.u64NumOfDroppedBytes[i];
+        procStates->strInlineProcStats.u64NumOfTriggerDumps[i] =
+                shm_proc_states->strInlineProcStats.u64NumOfTriggerDumps[i];
+        procStates->strInlineProcStats.u64NumOfFilteredBytes[i] =
+                shm_proc_states->strInlineProcStats.u64NumOfFilteredBytes[i];
+        procStates->strInlineProcStats.u64NumOfSockDroppedPackets[i] =
+                shm_proc_states->strInlineProcStats.u64NumOfSockDroppedPackets[i];
+        procStates->strInlineProcStats.u64NumOfUpstreamLostPackets[i] =
+                shm_proc_states->strInlineProcStats.u64NumOfUpstreamLostPackets[i];
         procStates->strInlineProcStats.StartTime[i] =
                 shm_proc_states->strInlineProcStats.StartTime[i];
         procStates->strInlineProcStats.EndTime[i] =
                 shm_proc_states->strInlineProcStats.EndTime[i];
     }
+    memcpy(&procStates->strLatencyStats, &shm_proc_states->strLatencyStats,
+           sizeof(strRFDCCard_LatencyStats));
 
     // release
     UnmapShm();
@@ -278,7 +307,7 @@ SINT32 osal::WriteDefaultRecordProcStatus(UINT16 u16ConfigPort)
     shm_proc_states->u16CommandCode = CMD_CODE_START_RECORD;
     shm_proc_states->s32CommandStatus = STS_CLI_REC_PROC_STOPPED;
     shm_proc_states->u32AsyncStatus = 0;
-    for(int i = 0; i < NUM_DATA_TYPES; i ++)
+    for(int i = 0; i < NUM_REC_STATS_ENTRIES; i ++)
     {
         strcpy(shm_proc_states->strInlineProcStats.s8HeaderId[i], "");
         shm_proc_states->strInlineProcStats.u32FirstPktId[i] = 0;
@@ -289,9 +318,24 @@ SINT32 osal::WriteDefaultRecordProcStatus(UINT16 u16ConfigPort)
         shm_proc_states->strInlineProcStats.u64NumOfZeroFilledBytes[i] = 0;
         shm_proc_states->strInlineProcStats.u32OutOfSeqPktFromOffset[i] = 0;
         shm_proc_states->strInlineProcStats.u32OutOfSeqPktToOffset[i] = 0;
+        shm_proc_states->strInlineProcStats.u64NumOfBufSwaps[i] = 0;
+        shm_proc_states->strInlineProcStats.u64NumOfWriterWaits[i] = 0;
+        shm_proc_states->strInlineProcStats.u64NumOfDrainedPackets[i] = 0;
+        shm_proc_states->strInlineProcStats.u64NumOfSpilledBufs[i] = 0;
+        shm_proc_states->strInlineProcStats.u64NumOfWriterPauses[i] = 0;
+        shm_proc_states->strInlineProcStats.u64NumOfDroppedFrames[i] = 0;
+        shm_proc_states->strInlineProcStats.u64NumOfDroppedBytes[i] = 0;
+        shm_proc_states->strInlineProcStats.u64NumOfTriggerDumps[i] = 0;
+        shm_proc_states->strInlineProcStats.u64NumOfFilteredBytes[i] = 0;
+        shm_proc_states->strInlineProcStats.u64NumOfSockDroppedPackets[i] = 0;
+        shm_proc_states->strInlineProcStats.u64NumOfUpstreamLostPackets[i] = 0;
         shm_proc_states->strInlineProcStats.StartTime[i] = time(NULL);
         shm_proc_states->strInlineProcStats.EndTime[i] = time(NULL);
     }
+    memset(&shm_proc_states->strLatencyStats, 0,
+           sizeof(strRFDCCard_LatencyStats));
+
+    NotifyRecProcStateChange();
 
     return SUCCESS_STATUS;
 }
@@ -332,6 +376,8 @@ SINT32 osal::WriteRecordProcStatus(UINT16 u16ConfigPort, SINT32 s32CmdStatus)
 
    	shm_proc_states->s32CommandStatus = s32CmdStatus;
 
+    NotifyRecProcStateChange();
+
     return SUCCESS_STATUS;
 }
 
@@ -371,9 +417,64 @@ SINT32 osal::WriteRecAsyncStatus(UINT16 u16ConfigPort, UINT32 u32AsyncStatus)
 
 	shm_proc_states->u32AsyncStatus |= u32AsyncStatus;
 
+    NotifyRecProcStateChange();
+
     return s16Status;
 }
 
+/** @fn void osal::NotifyRecProcStateChange()
+ * @brief This function is to publish a record process state change <!--
+ * --> and wake up the processes waiting for it
+ */
+void osal::NotifyRecProcStateChange()
+{
+    InterlockedIncrement((volatile LONG *)&shm_proc_states->u32StateSeq);
+}
+
+/** @fn SINT32 osal::WaitForRecProcStateChange(UINT16 u16ConfigPort, <!--
+ * --> UINT32 u32StateSeq, UINT32 u32MilliSec)
+ * @brief This function is to wait till the record process state <!--
+ * --> sequence in shared memory differs from the given one
+ * @param [in] u16ConfigPort [UINT16] - Config port
+ * @param [in] u32StateSeq [UINT32] - State sequence read last
+ * @param [in] u32MilliSec [UINT32] - Timeout in milli second
+ * @return SINT32 value
+ */
+SINT32 osal::WaitForRecProcStateChange(UINT16 u16ConfigPort, UINT32 u32StateSeq,
+                                       UINT32 u32MilliSec)
+{
+    SINT32 s32Status = SUCCESS_STATUS;
+    ULONG64 u64EndTimeUs = GetTimeInMicroSec() +
+                           ((ULONG64)u32MilliSec * MILLI_TO_MICRO_SEC_CONVERSION);
+    bool bMapped = false;
+
+    if(shm_proc_states == NULL)
+    {
+        bMapped = true;
+        s32Status = MapShm(u16ConfigPort);
+        if(s32Status != SUCCESS_STATUS)
+        {
+            return s32Status;
+        }
+    }
+
+    while((UINT32)InterlockedCompareExchange(
+            (volatile LONG *)&shm_proc_states->u32StateSeq, 0, 0) == u32StateSeq)
+    {
+        if(GetTimeInMicroSec() >= u64EndTimeUs)
+        {
+            s32Status = STS_RFDCCARD_EVENT_TIMEOUT_ERR;
+            break;
+        }
+        Sleep(MILLI_SEC_TO_POLL_SHM_STATE);
+    }
+
+    if(bMapped)
+        UnmapShm();
+
+    return s32Status;
+}
+
 /** @fn SINT32 osal::WriteRecProcInlineStats(UINT16 u16ConfigPort, <!--
  * --> strRFDCCard_InlineProcStats strInlineStats, bool bOutOfSeqSetFlag <!--
  * --> UINT8 u8DataIndex)
@@ -436,6 +537,28 @@ SINT32 osal::WriteRecProcInlineStats(UINT16 u16ConfigPort,
             strInlineStats->u32OutOfSeqPktFromOffset[u8DataIndex];
     shm_proc_states->strInlineProcStats.u32OutOfSeqPktToOffset[u8DataIndex] =
             strInlineStats->u32OutOfSeqPktToOffset[u8DataIndex];
+    shm_proc_states->strInlineProcStats.u64NumOfBufSwaps[u8DataIndex] =
+            strInlineStats->u64NumOfBufSwaps[u8DataIndex];
+    shm_proc_states->strInlineProcStats.u64NumOfWriterWaits[u8DataIndex] =
+            strInlineStats->u64NumOfWriterWaits[u8DataIndex];
+    shm_proc_states->strInlineProcStats.u64NumOfDrainedPackets[u8DataIndex] =
+            strInlineStats->u64NumOfDrainedPackets[u8DataIndex];
+    shm_proc_states->strInlineProcStats.u64NumOfSpilledBufs[u8DataIndex] =
+            strInlineStats->u64NumOfSpilledBufs[u8DataIndex];
+    shm_proc_states->strInlineProcStats.u64NumOfWriterPauses[u8DataIndex] =
+            strInlineStats->u64NumOfWriterPauses[u8DataIndex];
+    shm_proc_states->strInlineProcStats.u64NumOfDroppedFrames[u8DataIndex] =
+            strInlineStats->u64NumOfDroppedFrames[u8DataIndex];
+    shm_proc_states->strInlineProcStats.u64NumOfDroppedBytes[u8DataIndex] =
+            strInlineStats->u64NumOfDroppedBytes[u8DataIndex];
+    shm_proc_states->strInlineProcStats.u64NumOfTriggerDumps[u8DataIndex] =
+            strInlineStats->u64NumOfTriggerDumps[u8DataIndex];
+    shm_proc_states->strInlineProcStats.u64NumOfFilteredBytes[u8DataIndex] =
+            strInlineStats->u64NumOfFilteredBytes[u8DataIndex];
+    shm_proc_states->strInlineProcStats.u64NumOfSockDroppedPackets[u8DataIndex] =
+            strInlineStats->u64NumOfSockDroppedPackets[u8DataIndex];
+    shm_proc_states->strInlineProcStats.u64NumOfUpstreamLostPackets[u8DataIndex] =
+            strInlineStats->u64NumOfUpstreamLostPackets[u8DataIndex];
     shm_proc_states->strInlineProcStats.StartTime[u8DataIndex] =
             strInlineStats->StartTime[u8DataIndex];
     shm_proc_states->strInlineProcStats.EndTime[u8DataIndex] =
@@ -444,6 +567,48 @@ SINT32 osal::WriteRecProcInlineStats(UINT16 u16ConfigPort,
     return s16StatusInline;
 }
 
+/** @fn SINT32 osal::WriteRecProcLatencyStats(UINT16 u16ConfigPort, <!--
+ * --> strRFDCCard_LatencyStats *strLatencyStats)
+ * @brief This function is to write the latency histograms of record <!--
+ * --> process in the shared memory
+ * @param [in] u16ConfigPort [UINT16] - Config port
+ * @param [in] strLatencyStats [strRFDCCard_LatencyStats *] - Latency histograms
+ * @return SINT32 value
+ */
+SINT32 osal::WriteRecProcLatencyStats(UINT16 u16ConfigPort,
+                                strRFDCCard_LatencyStats *strLatencyStats)
+{
+    s16StatusInline = SUCCESS_STATUS;
+
+    if (hShmem == NULL)
+    {
+        s16StatusInline = CreateShm(u16ConfigPort);
+        if(s16StatusInline == SUCCESS_STATUS)
+        {
+            s16StatusInline = MapShm(u16ConfigPort);
+            if(s16StatusInline != SUCCESS_STATUS)
+            {
+                return s16StatusInline;
+            }
+        }
+        else
+            return s16StatusInline;
+    }
+    if (shm_proc_states == NULL)
+    {
+        s16StatusInline = MapShm(u16ConfigPort);
+        if(s16StatusInline != SUCCESS_STATUS)
+        {
+            return s16StatusInline;
+        }
+    }
+
+    memcpy(&shm_proc_states->strLatencyStats, strLatencyStats,
+           sizeof(strRFDCCard_LatencyStats));
+
+    return s16StatusInline;
+}
+
 /** @fn SINT32 osal::MapShm(UINT16 u16ConfigPort)
  * @brief This function is to map shared memory for updating record process status
  * @param [in] u16ConfigPort [UINT16] - Config port
@@ -516,6 +681,25 @@ void osal::SleepInMilliSec(UINT32 u32MilliSec)
     Sleep(u32MilliSec);
 }
 
+/** @fn ULONG64 osal::GetTimeInMicroSec()
+ * @brief This function is to read a monotonic clock in micro second
+ * @return ULONG64 value
+ */
+ULONG64 osal::GetTimeInMicroSec()
+{
+    LARGE_INTEGER sFrequency;
+    LARGE_INTEGER sCounter;
+
+    QueryPerformanceFrequency(&sFrequency);
+    QueryPerformanceCounter(&sCounter);
+
+    return (ULONG64)((sCounter.QuadPart / sFrequency.QuadPart) *
+                     SEC_TO_MILLI_SEC_CONVERSION * MILLI_TO_MICRO_SEC_CONVERSION) +
+           (ULONG64)(((sCounter.QuadPart % sFrequency.QuadPart) *
+                     SEC_TO_MILLI_SEC_CONVERSION * MILLI_TO_MICRO_SEC_CONVERSION) /
+                     sFrequency.QuadPart);
+}
+
 /** @fn SINT32 osal::IsValidDir(SINT8 *s8FileBasePath)
  * @brief This function is to validate the directory path
  * @param [in] s8FileBasePath [SINT8 *] - Directory path
@@ -579,6 +763,24 @@ SINT32 osal::WaitForSignal(OSAL_SIGNAL_HANDLE_TYPE *event, UINT32 u32Sec)
     return SUCCESS_STATUS;
 }
 
+/** @fn SINT32 osal::WaitForSignalInMilliSec(OSAL_SIGNAL_HANDLE_TYPE *event, UINT32 u32MilliSec)
+ * @brief This function is to make the event wait for a signal for a <!--
+ * --> defined time in millisec
+ * @param [in] event [OSAL_SIGNAL_HANDLE_TYPE *] - Event
+ * @param [in] u32MilliSec [UINT32] - Millisecond
+ * @return SINT32 value
+ */
+SINT32 osal::WaitForSignalInMilliSec(OSAL_SIGNAL_HANDLE_TYPE *event,
+                                     UINT32 u32MilliSec)
+{
+    if(*event)
+    {
+        if(WAIT_TIMEOUT == WaitForSingleObject(*event, u32MilliSec))
+            return STS_RFDCCARD_EVENT_TIMEOUT_ERR;
+    }
+    return SUCCESS_STATUS;
+}
+
 /** @fn void osal::InitEvent(OSAL_SIGNAL_HANDLE_TYPE *event)
  * @brief This function is to initialize an event
  * @param [in] event [OSAL_SIGNAL_HANDLE_TYPE] - Event
@@ -249,6 +249,208 @@ SINT32 validatePacketDelay(SINT8 *nodeData)
     return SUCCESS_STATUS;
 }
 
+/** @fn SINT32 validateDrainQuietPeriod(SINT8 *nodeData)
+ * @brief This function is to validate socket drain quiet period config <!--
+ * --> in JSON file
+ * @param [in] nodeData [SINT8 *] - Quiet period in millisec of String type
+ * @return SINT32 value
+ */
+SINT32 validateDrainQuietPeriod(SINT8 *nodeData)
+{
+    if((strlen(nodeData) <= 0) || (strlen(nodeData) > 4))
+    {
+        return FAILURE_STATUS;
+    }
+
+    for(SINT32 i = 0; nodeData[i] != '\0'; i ++)
+    {
+        if(!isdigit(nodeData[i]))
+        {
+            return FAILURE_STATUS;
+        }
+    }
+
+    if((atol(nodeData) < MIN_RECORD_DRAIN_QUIET_PERIOD) ||
+            (atol(nodeData) > MAX_RECORD_DRAIN_QUIET_PERIOD))
+    {
+        return FAILURE_STATUS;
+    }
+    return SUCCESS_STATUS;
+}
+
+/** @fn SINT32 validateCaptureTimeout(SINT8 *nodeData)
+ * @brief This function is to validate capture timeout config in JSON file
+ * @param [in] nodeData [SINT8 *] - Capture timeout in millisec of String type
+ * @return SINT32 value
+ */
+SINT32 validateCaptureTimeout(SINT8 *nodeData)
+{
+    if((strlen(nodeData) <= 0) || (strlen(nodeData) > 7))
+    {
+        return FAILURE_STATUS;
+    }
+
+    for(SINT32 i = 0; nodeData[i] != '\0'; i ++)
+    {
+        if(!isdigit(nodeData[i]))
+        {
+            return FAILURE_STATUS;
+        }
+    }
+
+    if((atol(nodeData) < MIN_RECORD_CAPTURE_TIMEOUT) ||
+            (atol(nodeData) > MAX_RECORD_CAPTURE_TIMEOUT))
+    {
+        return FAILURE_STATUS;
+    }
+    return SUCCESS_STATUS;
+}
+
+/** @fn SINT32 validateWriterSpillSize(SINT8 *nodeData)
+ * @brief This function is to validate file writer spill capacity config <!--
+ * --> in JSON file
+ * @param [in] nodeData [SINT8 *] - Spill capacity in MB of String type
+ * @return SINT32 value
+ */
+SINT32 validateWriterSpillSize(SINT8 *nodeData)
+{
+    if((strlen(nodeData) <= 0) || (strlen(nodeData) > 4))
+    {
+        return FAILURE_STATUS;
+    }
+
+    for(SINT32 i = 0; nodeData[i] != '\0'; i ++)
+    {
+        if(!isdigit(nodeData[i]))
+        {
+            return FAILURE_STATUS;
+        }
+    }
+
+    if(atol(nodeData) > MAX_RECORD_WRITER_SPILL_SIZE)
+    {
+        return FAILURE_STATUS;
+    }
+    return SUCCESS_STATUS;
+}
+
+/** @fn SINT32 validateTriggerRingSize(SINT8 *nodeData)
+ * @brief This function is to validate pre-trigger ring capacity config <!--
+ * --> in JSON file
+ * @param [in] nodeData [SINT8 *] - Ring capacity in MB of String type
+ * @return SINT32 value
+ */
+SINT32 validateTriggerRingSize(SINT8 *nodeData)
+{
+    if((strlen(nodeData) <= 0) || (strlen(nodeData) > 5))
+    {
+        return FAILURE_STATUS;
+    }
+
+    for(SINT32 i = 0; nodeData[i] != '\0'; i ++)
+    {
+        if(!isdigit(nodeData[i]))
+        {
+            return FAILURE_STATUS;
+        }
+    }
+
+    if((atol(nodeData) < 1) || (atol(nodeData) > MAX_RECORD_TRIGGER_RING_SIZE))
+    {
+        return FAILURE_STATUS;
+    }
+    return SUCCESS_STATUS;
+}
+
+/** @fn SINT32 validateTriggerDuration(SINT8 *nodeData, UINT32 u32MaxDuration)
+ * @brief This function is to validate pre/post-trigger duration config <!--
+ * --> in JSON file
+ * @param [in] nodeData [SINT8 *] - Duration in millisec of String type
+ * @param [in] u32MaxDuration [UINT32] - Maximum duration in millisec
+ * @return SINT32 value
+ */
+SINT32 validateTriggerDuration(SINT8 *nodeData, UINT32 u32MaxDuration)
+{
+    if((strlen(nodeData) <= 0) || (strlen(nodeData) > 7))
+    {
+        return FAILURE_STATUS;
+    }
+
+    for(SINT32 i = 0; nodeData[i] != '\0'; i ++)
+    {
+        if(!isdigit(nodeData[i]))
+        {
+            return FAILURE_STATUS;
+        }
+    }
+
+    if((ULONG)atol(nodeData) > u32MaxDuration)
+    {
+        return FAILURE_STATUS;
+    }
+    return SUCCESS_STATUS;
+}
+
+/** @fn SINT32 validateCaptureFilterParam(SINT8 *nodeData, ULONG64 u64Min, ULONG64 u64Max)
+ * @brief This function is to validate a capture filter config field <!--
+ * --> in JSON file
+ * @param [in] nodeData [SINT8 *] - Field value of String type
+ * @param [in] u64Min [ULONG64] - Minimum value
+ * @param [in] u64Max [ULONG64] - Maximum value
+ * @return SINT32 value
+ */
+SINT32 validateCaptureFilterParam(SINT8 *nodeData, ULONG64 u64Min,
+                                  ULONG64 u64Max)
+{
+    if((strlen(nodeData) <= 0) || (strlen(nodeData) > 10))
+    {
+        return FAILURE_STATUS;
+    }
+
+    for(SINT32 i = 0; nodeData[i] != '\0'; i ++)
+    {
+        if(!isdigit(nodeData[i]))
+        {
+            return FAILURE_STATUS;
+        }
+    }
+
+    if((strtoull(nodeData, NULL, 10) < u64Min) ||
+       (strtoull(nodeData, NULL, 10) > u64Max))
+    {
+        return FAILURE_STATUS;
+    }
+    return SUCCESS_STATUS;
+}
+
+/** @fn SINT32 validateCrcChunkSize(SINT8 *nodeData)
+ * @brief This function is to validate CRC32C chunk size config in JSON file
+ * @param [in] nodeData [SINT8 *] - Chunk size in KB of String type, 0 to <!--
+ * --> disable
+ * @return SINT32 value
+ */
+SINT32 validateCrcChunkSize(SINT8 *nodeData)
+{
+    if((strlen(nodeData) <= 0) || (strlen(nodeData) > 4))
+    {
+        return FAILURE_STATUS;
+    }
+
+    for(SINT32 i = 0; nodeData[i] != '\0'; i ++)
+    {
+        if(!isdigit(nodeData[i]))
+        {
+            return FAILURE_STATUS;
+        }
+    }
+
+    if(atol(nodeData) > MAX_RECORD_CRC_CHUNK_SIZE)
+    {
+        return FAILURE_STATUS;
+    }
+    return SUCCESS_STATUS;
+}
+
 /** @fn SINT32 validatePortNumsForConflicts(UINT32 u32RecordPort, UINT32 u32ConfigPort)
  * @brief This function is to verify any conflicts between two ports in JSON file
  * @param [in] u32RecordPort [UINT32] - Record port
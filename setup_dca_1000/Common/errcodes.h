@@ -290,4 +290,97 @@
 /** CLI - Json file invalid reorder enable error            */
 #define CLI_JSON_REC_INVALID_EN_REORDER_ERR         -4077
 
+/** CLI - Daemon control socket error                       */
+#define CLI_DAEMON_SOCK_ERR                         -4078
+
+/** CLI - Daemon is not running error                       */
+#define CLI_DAEMON_NOT_RUNNING_ERR                  -4079
+
+/** CLI - Json file ethernet config differs from the daemon */
+#define CLI_DAEMON_ETH_CONFIG_MISMATCH_ERR          -4080
+
+/** CLI - Json file invalid socket drain quiet period error */
+#define CLI_JSON_REC_INVALID_DRAIN_QUIET_PERIOD_ERR -4081
+
+/** CLI - Discovery found no DCA1000EVM system              */
+#define CLI_DISCOVERY_NO_SYSTEM_FOUND_ERR           -4082
+
+/** CLI - Invalid number of IP addresses for discovery      */
+#define CLI_INVALID_DISCOVERY_NUM_OF_IPS_ERR        -4083
+
+/** CLI - Json file invalid writer spill capacity error     */
+#define CLI_JSON_REC_INVALID_WRITER_SPILL_SIZE_ERR  -4084
+
+/** CLI - Json file invalid writer overflow policy error    */
+#define CLI_JSON_REC_INVALID_WRITER_POLICY_ERR      -4085
+
+/** CLI - Json file invalid list of file base paths error   */
+#define CLI_JSON_REC_INVALID_STRIPE_PATHS_ERR       -4086
+
+/** CLI - Invalid stripe manifest of a striped record       */
+#define CLI_REASSEMBLE_MANIFEST_ERR                 -4087
+
+/** CLI - Striped record could not be joined in one file    */
+#define CLI_REASSEMBLE_FILE_ERR                     -4088
+
+/** CLI - Json file invalid record trigger mode error       */
+#define CLI_JSON_REC_INVALID_TRIGGER_MODE_ERR       -4089
+
+/** CLI - Json file invalid pre/post-trigger duration error */
+#define CLI_JSON_REC_INVALID_TRIGGER_DURATION_ERR   -4090
+
+/** CLI - Json file invalid pre-trigger ring capacity error */
+#define CLI_JSON_REC_INVALID_TRIGGER_RING_SIZE_ERR  -4091
+
+/** CLI - Json file invalid capture filter config error     */
+#define CLI_JSON_REC_INVALID_CAPTURE_FILTER_ERR     -4092
+
+/** CLI - Json file invalid CRC32C chunk size error         */
+#define CLI_JSON_REC_INVALID_CRC_CHUNK_SIZE_ERR     -4093
+
+/** CLI - Invalid CRC32C log of a record                    */
+#define CLI_VERIFY_CRC_LOG_ERR                      -4094
+
+/** CLI - Record data does not match its CRC32C log         */
+#define CLI_VERIFY_RECORD_ERR                       -4095
+
+/** CLI - Json file invalid packet delay calibration config */
+#define CLI_JSON_INVALID_CALIBRATION_ERR            -4096
+
+/** CLI - ADC data throughput not reachable by the link     */
+#define CLI_CALIBRATION_THROUGHPUT_ERR              -4097
+
+/** CLI - No ADC data received in a calibration step        */
+#define CLI_CALIBRATION_NO_DATA_ERR                 -4098
+
+/** CLI - Packet loss at every packet delay of the range    */
+#define CLI_CALIBRATION_PKT_LOSS_ERR                -4099
+
+/** CLI - Calibrated packet delay not saved in JSON file    */
+#define CLI_CALIBRATION_JSON_UPDATE_ERR             -4100
+
+/** CLI - Json file invalid test pattern config error       */
+#define CLI_JSON_REC_INVALID_TEST_PATTERN_ERR       -4101
+
+/** CLI - Json file invalid capture timeout error           */
+#define CLI_JSON_REC_INVALID_CAPTURE_TIMEOUT_ERR    -4102
+
+/** CLI - Json file invalid shared data port systems error  */
+#define CLI_JSON_REC_INVALID_SHARED_PORT_ERR        -4103
+
+/** CLI - Json file invalid UDP GRO enable error            */
+#define CLI_JSON_REC_INVALID_UDP_GRO_ERR            -4104
+
+/** CLI - Json file invalid writer backend error            */
+#define CLI_JSON_REC_INVALID_WRITER_BACKEND_ERR     -4105
+
+/** CLI - Json file invalid record retention config error   */
+#define CLI_JSON_REC_INVALID_RETENTION_ERR          -4106
+
+/** CLI - Json file invalid watermark enable error          */
+#define CLI_JSON_REC_INVALID_WATERMARK_ERR          -4107
+
+/** CLI - Json file invalid file rollover config error      */
+#define CLI_JSON_REC_INVALID_FILE_ROLLOVER_ERR      -4108
+
 #endif // ERRCODES_H
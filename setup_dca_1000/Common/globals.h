@@ -110,6 +110,24 @@
 #define CMD_QUERY_SYSTEM_ALIVENESS "query_sys_status"
 #define CMD_RUN_TASK "run"
 
+/** Command - Run as capture daemon holding the record connection           */
+#define CMD_DAEMON "daemon"
+
+/** Command - Send a command to the capture daemon                          */
+#define CMD_DAEMON_CTL "ctl"
+
+/** Command - Discover DCA1000EVM systems in a range of IP addresses       */
+#define CMD_DISCOVER "discover"
+
+/** Command - Join the stripes of a striped record in one file              */
+#define CMD_REASSEMBLE "reassemble"
+
+/** Command - Verify the record data against its CRC32C log                 */
+#define CMD_VERIFY "verify"
+
+/** Command - Calibrate the record packet delay of the host and NIC         */
+#define CMD_CALIBRATE "calibrate"
+
 /** Command - Help in the application                                       */
 #define CMD_HELP_S_CLI_APP "-h"
 
@@ -164,6 +182,128 @@
 /** Maximum duration stop mode  - Record config                             */
 #define MAX_RECORD_DURATION_STOP_MODE 0xFFFFFFFF
 
+/** Minimum socket drain quiet period in millisec - Record config           */
+#define MIN_RECORD_DRAIN_QUIET_PERIOD 1
+
+/** Maximum socket drain quiet period in millisec - Record config           */
+#define MAX_RECORD_DRAIN_QUIET_PERIOD 1000
+
+/** Minimum capture timeout in millisec - Record config                    */
+#define MIN_RECORD_CAPTURE_TIMEOUT 10
+
+/** Maximum capture timeout in millisec - Record config                    */
+#define MAX_RECORD_CAPTURE_TIMEOUT 3600000
+
+/** Maximum file writer spill capacity in MB - Record config               */
+#define MAX_RECORD_WRITER_SPILL_SIZE 1024
+
+/** Default pre-trigger ring capacity in MB - Record config                */
+#define DEFAULT_RECORD_TRIGGER_RING_SIZE 300
+
+/** Maximum pre-trigger ring capacity in MB - Record config                */
+#define MAX_RECORD_TRIGGER_RING_SIZE 16384
+
+/** Default pre-trigger duration in millisec - Record config               */
+#define DEFAULT_RECORD_PRE_TRIGGER_DURATION 1000
+
+/** Maximum pre-trigger duration in millisec - Record config               */
+#define MAX_RECORD_PRE_TRIGGER_DURATION 60000
+
+/** Default post-trigger duration in millisec - Record config              */
+#define DEFAULT_RECORD_POST_TRIGGER_DURATION 1000
+
+/** Maximum post-trigger duration in millisec - Record config              */
+#define MAX_RECORD_POST_TRIGGER_DURATION 3600000
+
+/** Maximum CRC32C chunk size in KB - Record config                        */
+#define MAX_RECORD_CRC_CHUNK_SIZE 4096
+
+/** Maximum total size in MB of the record files kept - Record config    */
+#define MAX_RECORD_RETENTION_SIZE 0xFFFFFFFF
+
+/** Minimum record files held by the retention size, the open one and one
+ *  before it - Record config                                              */
+#define MIN_RECORD_RETENTION_FILES 2
+
+/** Maximum age in seconds of the record files kept - Record config       */
+#define MAX_RECORD_RETENTION_AGE 0xFFFFFFFF
+
+/** Maximum frames per record file - Record config                         */
+#define MAX_RECORD_FRAMES_PER_FILE 0xFFFFFFFF
+
+/** Maximum duration in millisec of a record file - Record config          */
+#define MAX_RECORD_FILE_DURATION 0xFFFFFFFF
+
+/** Number of capture filter config fields in JSON file                     */
+#define CAPTURE_FILTER_NUM_OF_PARAMS 10
+
+/** Maximum ADC samples per chirp - Capture filter config                  */
+#define MAX_CAPTURE_FILTER_ADC_SAMPLES 4096
+
+/** Maximum chirps per frame - Capture filter config                       */
+#define MAX_CAPTURE_FILTER_CHIRPS 65535
+
+/** Maximum ADC output format (complex 2x) - Capture filter config         */
+#define MAX_CAPTURE_FILTER_ADC_FMT 2
+
+/** RX channels bit mask - Capture filter config                           */
+#define CAPTURE_FILTER_RX_CHAN_MASK 0xF
+
+/** Last frame index - Capture filter config                               */
+#define MAX_CAPTURE_FILTER_FRAME_IDX 0xFFFFFFFF
+
+/** Number of test pattern config fields in JSON file                      */
+#define TEST_PATTERN_NUM_OF_PARAMS 10
+
+/** Maximum samples of a test pattern packet, 0 for a ramp over the record */
+#define MAX_TEST_PATTERN_PKT_SIZE 65535
+
+/** Maximum lane config (increment b31:16, offset b15:0) - Test pattern    */
+#define MAX_TEST_PATTERN_LANE_CFG 0xFFFFFFFF
+
+/** Default number of IP addresses probed by discovery                     */
+#define DEFAULT_DISCOVERY_NUM_OF_IPS 11
+
+/** Discovery - response window in millisec                                 */
+#define DISCOVERY_TIMEOUT_MS 2000
+
+/** Reassemble - bytes read from the stripes at once                        */
+#define REASSEMBLE_BUF_SIZE (4 * 1024 * 1024)
+
+/** Number of packet delay calibration config fields in JSON file          */
+#define CALIBRATION_NUM_OF_PARAMS 7
+
+/** Maximum frame periodicity in micro seconds - Calibration config        */
+#define MAX_CALIBRATION_FRAME_PERIOD 10000000
+
+/** Default record duration in millisec of a step - Calibration config     */
+#define DEFAULT_CALIBRATION_STEP_DURATION 2000
+
+/** Minimum record duration in millisec of a step - Calibration config     */
+#define MIN_CALIBRATION_STEP_DURATION 200
+
+/** Maximum record duration in millisec of a step - Calibration config     */
+#define MAX_CALIBRATION_STEP_DURATION 60000
+
+/** Record file name prefix of the calibration steps, the files are
+ *  deleted after each step                                                 */
+#define CALIBRATION_FILE_PREFIX "pktDelayCal"
+
+/** Record file name of the calibration steps (Raw mode) - base path and
+ *  file index                                                              */
+#define CALIBRATION_FILE_NAME_FMT "%s/" CALIBRATION_FILE_PREFIX "_Raw_%u.bin"
+
+/** Status polling interval in millisec of a calibration step              */
+#define CALIBRATION_POLL_INTERVAL_MS 10
+
+/** ADC data bytes in a record packet (1470 bytes less the sequence number
+ *  and byte count header)                                                  */
+#define CALIBRATION_PKT_DATA_BYTES 1456
+
+/** Time in nano seconds to send a record packet on the 1 Gbps link
+ *  (packet, UDP/IP/ethernet headers, preamble and inter-packet gap)        */
+#define CALIBRATION_PKT_WIRE_TIME_NS 12288
+
 /** Fpga config - Timer value                                               */
 #define FPGA_CONFIG_DEFAULT_TIMER 30
 
@@ -198,6 +338,11 @@
 /** Shared Memory - Reading states of record               */
 typedef struct
 {
+    /** State change sequence, incremented on every command or async
+     *  status update. Kept first in the (packed) structure so that it is
+     *  4 byte aligned for waiting on it as a futex word                  */
+    UINT32 u32StateSeq;
+
     /** Command Code of the record command                 */
     UINT16 u16CommandCode;
 
@@ -212,6 +357,9 @@ typedef struct
     /** Inline process summary                             */
     strRFDCCard_InlineProcStats strInlineProcStats;
 
+    /** Latency histograms of the record process           */
+    strRFDCCard_LatencyStats strLatencyStats;
+
 } SHM_PROC_STATES;
 
 #endif // GLOBALS_H
@@ -84,9 +84,21 @@
 /** C++11 thread header include */
 #include <thread>
 
+/** C++11 atomic header include */
+#include <atomic>
+
+/** C++11 clock header include  */
+#include <chrono>
+
+/** Integer limits header       */
+#include <climits>
+
 /** String manipulation header  */
 #include <string>
 
+/** C++ vector header include   */
+#include <vector>
+
 /** Math manipulation header    */
 #include <math.h>
 
@@ -125,10 +137,13 @@
 /** Size for inline processing buffer                                        */
 #define INLINE_BUF_SIZE                     (75 * 1000000) // 75 MB
 
+/** Size for inline processing buffer of the low rate data ports (MULTI mode)*/
+#define INLINE_MULTI_PORT_BUF_SIZE          (2 * 1000000) // 2 MB
+
 /** Size for inline processing log buffer                                    */
 #define INLINE_LOG_BUF_SIZE                 (12 * 100000) // 1.2 MB
 
-/** Capture thread timeout duration in sec                                   */
+/** Default capture timeout duration in sec                                  */
 #define CAPTURE_TIMEOUT_DURATION_SEC        80
 
 /** Socket timeout duration for record mode in sec                           */
@@ -147,6 +162,17 @@
 /** Log dropped packets offset                                               */
 #define LOG_DROPPED_PKTS_OFFSET
 
+/** Record latency histograms of the record process (inline processing)      */
+#define LATENCY_HISTOGRAMS
+
+/** Latency histogram names in \ref LatencyHistType order                    */
+#define LATENCY_HIST_NAMES  { "Packet to buffer", "Buffer to disk", \
+                              "Frame to handoff", "Writer stall" }
+
+/** Share the config port with a DCA1000EVM emulator running on the same
+    host (SO_REUSEADDR), enabled by the DCA1000_EMULATOR_TESTING cmake option */
+//#define EMULATOR_PORT_SHARING
+
 ///****************
 /// Stucture Declarations
 ///****************
@@ -182,6 +208,15 @@ typedef struct RFDCCARD_SOCKInfo
     /** Raw data socket - To read over the data ports                        */
     SINT32 s32DataSock[NUM_DATA_TYPES];
 
+    /** Receive buffer size of the data sockets granted by the OS            */
+    SINT32 s32DataSockRecvBuf[NUM_DATA_TYPES];
+
+    /** Data sockets count the packets dropped on receive buffer overflow    */
+    bool bSockDropCount;
+
+    /** ADC data socket receives coalesced packets (UDP GRO)                 */
+    bool bUdpGro;
+
 }strRFDCCard_SockInfo;
 
 ///*****************
@@ -233,17 +268,109 @@ STATUS SendConfigCmdRequest(SINT8 *s8Data, UINT16 u16PacketLen);
  */
 STATUS GetConfigCmdResponse(const SINT8 *s8Cmd);
 
-/** @fn void startDurationStopModeTimer()
- * @brief This function is to initiate timer to handle duration stop mode <!--
- * --> of data recording
+/** @fn STATUS FpgaConfigCmdPacket(strFpgaConfigMode sConfigMode, <!--
+ * --> SINT8 *s8Data, UINT16 *pu16PacketLen)
+ * @brief This function is to validate the FPGA config and fill the <!--
+ * --> configure FPGA command packet
+ * @param [in] sConfigMode [strFpgaConfigMode] - Structure filled with config data
+ * @param [out] s8Data [SINT8 *] - Command packet
+ * @param [out] pu16PacketLen [UINT16 *] - Command packet size
+ * @return SINT32 value
+ */
+STATUS FpgaConfigCmdPacket(strFpgaConfigMode sConfigMode, SINT8 *s8Data,
+                           UINT16 *pu16PacketLen);
+
+/** @fn UINT16 RecordConfigCmdPacket(strRecConfigMode sRecConfigMode, SINT8 *s8Data)
+ * @brief This function is to fill the configure record packet delay <!--
+ * --> command packet
+ * @param [in] sRecConfigMode [strRecConfigMode] - <!--
+ * --> Structure filled with config data
+ * @param [out] s8Data [SINT8 *] - Command packet
+ * @return UINT16 value (command packet size)
+ */
+UINT16 RecordConfigCmdPacket(strRecConfigMode sRecConfigMode, SINT8 *s8Data);
+
+/** @fn STATUS EepromConfigCmdPacket(strEthConfigMode sEthConfigMode, <!--
+ * --> SINT8 *s8Data, UINT16 *pu16PacketLen)
+ * @brief This function is to validate the EEPROM config and fill the <!--
+ * --> configure EEPROM command packet
+ * @param [in] sEthConfigMode [strEthConfigMode] - <!--
+ * --> Structure filled with config data
+ * @param [out] s8Data [SINT8 *] - Command packet
+ * @param [out] pu16PacketLen [UINT16 *] - Command packet size
+ * @return SINT32 value
+ */
+STATUS EepromConfigCmdPacket(strEthConfigMode sEthConfigMode, SINT8 *s8Data,
+                             UINT16 *pu16PacketLen);
+
+/** @fn SINT32 RecvConfigCmdResponseUntil(ULONG64 u64DeadlineUs, <!--
+ * --> DATA_CAPTURE_RESP *psResp, struct sockaddr_in *psSenderAddr)
+ * @brief This function is to receive a command response of any <!--
+ * --> DCA1000EVM system over the config port till the deadline
+ * @param [in] u64DeadlineUs [ULONG64] - Deadline in micro seconds
+ * @param [out] psResp [DATA_CAPTURE_RESP *] - Command response
+ * @param [out] psSenderAddr [struct sockaddr_in *] - Sender address
+ * @return SINT32 value (bytes received, 0 on deadline)
+ */
+SINT32 RecvConfigCmdResponseUntil(ULONG64 u64DeadlineUs,
+                                  DATA_CAPTURE_RESP *psResp,
+                                  struct sockaddr_in *psSenderAddr);
+
+#ifdef ENABLE_DEBUG
+/** @fn void DebugStartRecordConfig(strStartRecConfigMode sStartRecConfigMode)
+ * @brief This function is to write the start record config in the debug <!--
+ * --> file, for the start record and the pipelined start paths
+ * @param [in] sStartRecConfigMode [strStartRecConfigMode] - <!--
+ * --> Structure filled with record config data
+ */
+void DebugStartRecordConfig(strStartRecConfigMode sStartRecConfigMode);
+#endif
+
+/** @fn STATUS PrepareRecordProcess(strStartRecConfigMode sStartRecConfigMode)
+ * @brief This function is to validate the start record config, reset the <!--
+ * --> record stats and start the config port and record threads ahead of <!--
+ * --> the start record command
+ * @param [in] sStartRecConfigMode [strStartRecConfigMode] - <!--
+ * --> Structure filled with record config data
+ * @return SINT32 value
+ */
+STATUS PrepareRecordProcess(strStartRecConfigMode sStartRecConfigMode);
+
+/** @fn void StopRecordReceivers(void)
+ * @brief This function is to stop the record threads of a record <!--
+ * --> process which failed to start. Sockets stay open for the next one
+ */
+void StopRecordReceivers(void);
+
+/** @fn STATUS ConfigureDataSockRecv(UINT8 u8DataTypeId)
+ * @brief This function is to read the receive buffer size granted to a <!--
+ * --> data socket and to enable its drop counter (packets dropped on <!--
+ * --> receive buffer overflow), where the OS has one
+ * @param [in] u8DataTypeId [UINT8] - Data type index of the socket
+ * @return SINT32 value
+ */
+STATUS ConfigureDataSockRecv(UINT8 u8DataTypeId);
+
+/** @fn STATUS StartSharedPortSystems(void)
+ * @brief This function is to send the start record command to the other <!--
+ * --> systems of a shared data port, the systems started are stopped <!--
+ * --> again if one of them fails
+ * @return SINT32 value
+ */
+STATUS StartSharedPortSystems(void);
+
+/** @fn STATUS StopSharedPortSystems(void)
+ * @brief This function is to send the stop record command to the other <!--
+ * --> systems of a shared data port
+ * @return SINT32 value
  */
-void startDurationStopModeTimer();
+STATUS StopSharedPortSystems(void);
 
-/** @fn void handleCaptureThreadTimeout()
- * @brief This function is to handle capture timeout when the system is  <!--
- * --> disconnected during capture process
+/** @fn void StartCaptureTimeout()
+ * @brief This function is to start the capture timeout of the record <!--
+ * --> process, the duration stop mode timer is started by the first packet
  */
-void handleCaptureThreadTimeout();
+void StartCaptureTimeout();
 
 /** @fn void UpdateInlineStatus(bool bOutOfSeqFlag, UINT8 u8DataIndex)
  * @brief This function is to update status of data capture based on data index
@@ -0,0 +1,753 @@
+/**
+ * @file capturebench.cpp
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains the capture benchmark which records the
+ * emulated DCA1000EVM stream through the record API at increasing rates
+ * and reports throughput, loss, writer backlog and CPU cost per case
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+///****************
+/// Includes
+///****************
+
+/** System headers are included ahead of the API headers (pragma pack(1))   */
+#include <dirent.h>
+#include <fcntl.h>
+#include <time.h>
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+
+#include "capturebench.h"
+#include "../RF_API/extern.h"
+#include "../Common/Validate_Utils/validate_params.h"
+
+///****************
+/// Variable declarations
+///****************
+
+/** Record completed async status received (record process)                 */
+static std::atomic<bool> gbBenchRecCompleted(false);
+
+/** @fn void BenchEventCallback(UINT16 u16CmdCode, UINT16 u16Status)
+ * @brief This function is the record API event callback of the record <!--
+ * --> process. It flags the record completed async status
+ * @param [in] u16CmdCode [UINT16] - Command code
+ * @param [in] u16Status [UINT16] - Command status
+ */
+static void BenchEventCallback(UINT16 u16CmdCode, UINT16 u16Status)
+{
+    if ((u16CmdCode == CMD_CODE_SYSTEM_ASYNC_STATUS) &&
+        (u16Status == STS_REC_COMPLETED))
+        gbBenchRecCompleted = true;
+}
+
+/** @fn void BenchInlineStatsCallback(strRFDCCard_InlineProcStats <!--
+ * -->                 strInlineProcStats, bool bOutOfSeqFlag, UINT8 u8DataIndex)
+ * @brief This function is the inline processing callback of the record <!--
+ * --> process. Statistics are read once the case is over, so nothing is <!--
+ * --> done per packet
+ * @param [in] strInlineProcStats [strRFDCCard_InlineProcStats] - Statistics
+ * @param [in] bOutOfSeqFlag [bool] - Out of sequence set flag
+ * @param [in] u8DataIndex [UINT8] - Data type index
+ */
+static void BenchInlineStatsCallback(strRFDCCard_InlineProcStats strInlineProcStats,
+                                     bool bOutOfSeqFlag, UINT8 u8DataIndex)
+{
+    (void)strInlineProcStats;
+    (void)bOutOfSeqFlag;
+    (void)u8DataIndex;
+}
+
+/** @fn UINT32 BenchElapsedMs(const struct timespec *psFrom, <!--
+ * -->                       const struct timespec *psTo)
+ * @brief This function is to compute the time between two monotonic timestamps
+ * @param [in] psFrom [const struct timespec *] - Start time
+ * @param [in] psTo [const struct timespec *] - End time
+ * @return UINT32 value (millisec)
+ */
+static UINT32 BenchElapsedMs(const struct timespec *psFrom,
+                             const struct timespec *psTo)
+{
+    return (UINT32)((psTo->tv_sec - psFrom->tv_sec) * 1000 +
+                    (psTo->tv_nsec - psFrom->tv_nsec) / 1000000);
+}
+
+/** @fn SINT32 ParseBenchOnOffList(const SINT8 *s8Value, const SINT8 *s8Off, <!--
+ * -->                             const SINT8 *s8On, UINT32 *pu32Mask)
+ * @brief This function is to parse a comma separated list of two settings
+ * @param [in] s8Value [const SINT8 *] - Option value
+ * @param [in] s8Off [const SINT8 *] - Name of the BENCH_OPT_BIT_OFF setting
+ * @param [in] s8On [const SINT8 *] - Name of the BENCH_OPT_BIT_ON setting
+ * @param [out] pu32Mask [UINT32 *] - Settings bit mask
+ * @return SINT32 value
+ */
+static SINT32 ParseBenchOnOffList(const SINT8 *s8Value, const SINT8 *s8Off,
+                                  const SINT8 *s8On, UINT32 *pu32Mask)
+{
+    SINT8 s8List[MAX_PARAMS_LEN];
+    SINT8 *s8SavePtr = NULL;
+
+    strncpy(s8List, s8Value, MAX_PARAMS_LEN - 1);
+    s8List[MAX_PARAMS_LEN - 1] = '\0';
+    *pu32Mask = 0;
+
+    for (SINT8 *s8Item = strtok_r(s8List, ",", &s8SavePtr); s8Item != NULL;
+         s8Item = strtok_r(NULL, ",", &s8SavePtr))
+    {
+        if (strcmp(s8Item, s8Off) == 0)
+            *pu32Mask |= BENCH_OPT_BIT_OFF;
+        else if (strcmp(s8Item, s8On) == 0)
+            *pu32Mask |= BENCH_OPT_BIT_ON;
+        else
+            return FAILURE_STATUS;
+    }
+
+    return (*pu32Mask != 0) ? SUCCESS_STATUS : FAILURE_STATUS;
+}
+
+/** @fn SINT32 ParseBenchRates(const SINT8 *s8Value, <!--
+ * -->                         strCaptureBenchConfig *psConfig)
+ * @brief This function is to parse the comma separated rates of the sweep
+ * @param [in] s8Value [const SINT8 *] - Option value
+ * @param [out] psConfig [strCaptureBenchConfig *] - Configuration structure
+ * @return SINT32 value
+ */
+static SINT32 ParseBenchRates(const SINT8 *s8Value, strCaptureBenchConfig *psConfig)
+{
+    SINT8 s8List[MAX_PARAMS_LEN];
+    SINT8 *s8SavePtr = NULL;
+    SINT8 *s8End = NULL;
+
+    strncpy(s8List, s8Value, MAX_PARAMS_LEN - 1);
+    s8List[MAX_PARAMS_LEN - 1] = '\0';
+    psConfig->u32NumOfRates = 0;
+
+    for (SINT8 *s8Item = strtok_r(s8List, ",", &s8SavePtr); s8Item != NULL;
+         s8Item = strtok_r(NULL, ",", &s8SavePtr))
+    {
+        if (psConfig->u32NumOfRates >= BENCH_MAX_RATES)
+            return FAILURE_STATUS;
+
+        DOUBLE dRate = strtod(s8Item, &s8End);
+        if ((s8End == s8Item) || (*s8End != '\0') || (dRate < 0))
+            return FAILURE_STATUS;
+
+        psConfig->dRatesMBps[psConfig->u32NumOfRates++] = dRate;
+    }
+
+    return (psConfig->u32NumOfRates != 0) ? SUCCESS_STATUS : FAILURE_STATUS;
+}
+
+/** @fn void ListOfCaptureBenchOptions()
+ * @brief This function is to list the capture benchmark options
+ */
+void ListOfCaptureBenchOptions()
+{
+    printf("\n%s <list>\t\t%s", BENCH_OPT_RATES,
+           "Total rates in MB/s, 0 for unpaced (default " BENCH_DEFAULT_RATES ")");
+    printf("\n%s <bytes>\t\t%s (default %llu)", BENCH_OPT_BYTES,
+           "Payload bytes streamed per case", BENCH_DEFAULT_BYTES_PER_CASE);
+    printf("\n%s <list>\t\t%s", BENCH_OPT_MODES,
+           "Capture modes raw,multi (default both)");
+    printf("\n%s <list>\t%s", BENCH_OPT_REORDER,
+           "Reorder settings 0,1 (default both)");
+    printf("\n%s <list>\t\t%s", BENCH_OPT_SEQ,
+           "Sequence number settings 0,1 (default both)");
+    printf("\n%s <file>\t\t%s", BENCH_OPT_OUT,
+           "CSV results file (default " BENCH_DEFAULT_OUT_FILE ")");
+    printf("\n%s <dir>\t\t%s", BENCH_OPT_PATH,
+           "Record file base path (default " BENCH_DEFAULT_BASE_PATH ")");
+    printf("\n%s\t\t\t%s", BENCH_OPT_KEEP, "Keep the record files of every case");
+    printf("\n%s\t\t\t%s", BENCH_OPT_GRO,
+           "Receive the ADC data with UDP GRO (coalesced packets)");
+    printf("\n%s\t\t\t%s", BENCH_OPT_MMAP,
+           "Write the record files through memory maps");
+    printf("\n%s <addr>\t\t%s", EMU_OPT_DCA_IP,
+           "Emulated DCA1000EVM address (default " EMU_DEFAULT_DCA_IP_ADDR ")");
+    printf("\n%s <port>\t%s (default %d)", EMU_OPT_CONFIG_PORT,
+           "Config port", EMU_DEFAULT_CONFIG_PORT);
+    printf("\n%s <port>\t%s (default %d)", BENCH_OPT_RECORD_PORT,
+           "Record port", EMU_DEFAULT_DATA_PORT);
+}
+
+/** @fn SINT32 ParseCaptureBenchOption(SINT32 argc, SINT8 *argv[], <!--
+ * -->                         SINT32 *ps32Index, strCaptureBenchConfig *psConfig)
+ * @brief This function is to parse one capture benchmark option <!--
+ * --> (and its value) from the command line
+ * @param [in] argc [SINT32] - Number of arguments
+ * @param [in] argv [SINT8 *[]] - Arguments
+ * @param [in,out] ps32Index [SINT32 *] - Index of option, moved to its value
+ * @param [out] psConfig [strCaptureBenchConfig *] - Configuration structure
+ * @return SINT32 value (same as \ref ParseDataEmuOption)
+ */
+SINT32 ParseCaptureBenchOption(SINT32 argc, SINT8 *argv[], SINT32 *ps32Index,
+                               strCaptureBenchConfig *psConfig)
+{
+    SINT32 i = *ps32Index;
+    const SINT8 *s8Option = argv[i];
+    SINT32 s32Status = SUCCESS_STATUS;
+
+    if (strcmp(s8Option, BENCH_OPT_KEEP) == 0)
+    {
+        psConfig->bKeepFiles = true;
+        return SUCCESS_STATUS;
+    }
+
+    if (strcmp(s8Option, BENCH_OPT_GRO) == 0)
+    {
+        psConfig->bUdpGroEnable = true;
+        return SUCCESS_STATUS;
+    }
+
+    if (strcmp(s8Option, BENCH_OPT_MMAP) == 0)
+    {
+        psConfig->bMmapWriter = true;
+        return SUCCESS_STATUS;
+    }
+
+    if ((strcmp(s8Option, BENCH_OPT_RATES) != 0) &&
+        (strcmp(s8Option, BENCH_OPT_BYTES) != 0) &&
+        (strcmp(s8Option, BENCH_OPT_MODES) != 0) &&
+        (strcmp(s8Option, BENCH_OPT_REORDER) != 0) &&
+        (strcmp(s8Option, BENCH_OPT_SEQ) != 0) &&
+        (strcmp(s8Option, BENCH_OPT_OUT) != 0) &&
+        (strcmp(s8Option, BENCH_OPT_PATH) != 0) &&
+        (strcmp(s8Option, EMU_OPT_DCA_IP) != 0) &&
+        (strcmp(s8Option, EMU_OPT_CONFIG_PORT) != 0) &&
+        (strcmp(s8Option, BENCH_OPT_RECORD_PORT) != 0))
+        return FAILURE_STATUS;
+
+    if ((i + 1) >= argc)
+    {
+        printf("\nMissing value for option %s\n", s8Option);
+        return STS_RFDCCARD_INVALID_INPUT_PARAMS;
+    }
+    const SINT8 *s8Value = argv[++i];
+    *ps32Index = i;
+
+    if (strcmp(s8Option, BENCH_OPT_RATES) == 0)
+        s32Status = ParseBenchRates(s8Value, psConfig);
+    else if (strcmp(s8Option, BENCH_OPT_BYTES) == 0)
+        psConfig->u64BytesPerCase = strtoull(s8Value, NULL, 0);
+    else if (strcmp(s8Option, BENCH_OPT_MODES) == 0)
+        s32Status = ParseBenchOnOffList(s8Value, "raw", "multi",
+                                        &psConfig->u32ModeMask);
+    else if (strcmp(s8Option, BENCH_OPT_REORDER) == 0)
+        s32Status = ParseBenchOnOffList(s8Value, "0", "1",
+                                        &psConfig->u32ReorderMask);
+    else if (strcmp(s8Option, BENCH_OPT_SEQ) == 0)
+        s32Status = ParseBenchOnOffList(s8Value, "0", "1",
+                                        &psConfig->u32SeqMask);
+    else if (strcmp(s8Option, BENCH_OPT_OUT) == 0)
+        strncpy(psConfig->s8OutFile, s8Value, MAX_NAME_LEN - 1);
+    else if (strcmp(s8Option, BENCH_OPT_PATH) == 0)
+        strncpy(psConfig->s8FileBasePath, s8Value, MAX_NAME_LEN - 1);
+    else if (strcmp(s8Option, EMU_OPT_DCA_IP) == 0)
+        strncpy(psConfig->s8DcaIpAddr, s8Value, IP_ADDR_MAX_SIZE_BYTES - 1);
+    else if (strcmp(s8Option, EMU_OPT_CONFIG_PORT) == 0)
+        psConfig->u32ConfigPort = (UINT32)atol(s8Value);
+    else
+        psConfig->u32RecordPort = (UINT32)atol(s8Value);
+
+    if (SUCCESS_STATUS != s32Status)
+    {
+        printf("\nInvalid value for option %s\n", s8Option);
+        return STS_RFDCCARD_INVALID_INPUT_PARAMS;
+    }
+
+    return SUCCESS_STATUS;
+}
+
+/** @fn cCaptureBenchmark::cCaptureBenchmark()
+ * @brief This constructor function is to initialize the class member variables
+ */
+cCaptureBenchmark::cCaptureBenchmark()
+{
+    setDefaultConfig(&sConfig);
+}
+
+/** @fn void cCaptureBenchmark::setDefaultConfig(strCaptureBenchConfig *psConfig)
+ * @brief This function is to fill the benchmark configuration with <!--
+ * --> default values
+ * @param [out] psConfig [strCaptureBenchConfig *] - Configuration structure
+ */
+void cCaptureBenchmark::setDefaultConfig(strCaptureBenchConfig *psConfig)
+{
+    memset(psConfig, 0, sizeof(strCaptureBenchConfig));
+    strcpy(psConfig->s8DcaIpAddr, EMU_DEFAULT_DCA_IP_ADDR);
+    psConfig->u32ConfigPort = EMU_DEFAULT_CONFIG_PORT;
+    psConfig->u32RecordPort = EMU_DEFAULT_DATA_PORT;
+    strcpy(psConfig->s8FileBasePath, BENCH_DEFAULT_BASE_PATH);
+    strcpy(psConfig->s8OutFile, BENCH_DEFAULT_OUT_FILE);
+    ParseBenchRates(BENCH_DEFAULT_RATES, psConfig);
+    psConfig->u64BytesPerCase = BENCH_DEFAULT_BYTES_PER_CASE;
+    psConfig->u32ModeMask = BENCH_OPT_BIT_OFF | BENCH_OPT_BIT_ON;
+    psConfig->u32ReorderMask = BENCH_OPT_BIT_OFF | BENCH_OPT_BIT_ON;
+    psConfig->u32SeqMask = BENCH_OPT_BIT_OFF | BENCH_OPT_BIT_ON;
+}
+
+/** @fn STATUS cCaptureBenchmark::setConfig(const strCaptureBenchConfig *psConfig)
+ * @brief This function is to validate and store the benchmark configuration
+ * @param [in] psConfig [const strCaptureBenchConfig *] - Configuration structure
+ * @return SINT32 value
+ */
+STATUS cCaptureBenchmark::setConfig(const strCaptureBenchConfig *psConfig)
+{
+    SINT8 s8IpAddr[IP_ADDR_MAX_SIZE_BYTES];
+
+    strcpy(s8IpAddr, psConfig->s8DcaIpAddr);
+    if ((SUCCESS_STATUS != validateIpAddress(s8IpAddr)) ||
+        (SUCCESS_STATUS != validatePortNumber(psConfig->u32ConfigPort)) ||
+        (SUCCESS_STATUS != validatePortNumber(psConfig->u32RecordPort +
+                                              NUM_DATA_TYPES - 1)) ||
+        (psConfig->u64BytesPerCase < (NUM_DATA_TYPES * PAYLOAD_BYTES_PER_PACKET)))
+    {
+        printf("\nCaptureBenchmark: Invalid address, port or bytes per case");
+        return STS_RFDCCARD_INVALID_INPUT_PARAMS;
+    }
+
+    DIR *pDir = opendir(psConfig->s8FileBasePath);
+    if (NULL == pDir)
+    {
+        printf("\nCaptureBenchmark: Invalid record file base path %s",
+               psConfig->s8FileBasePath);
+        return STS_RFDCCARD_INVALID_INPUT_PARAMS;
+    }
+    closedir(pDir);
+
+    memcpy(&sConfig, psConfig, sizeof(strCaptureBenchConfig));
+    return STS_RFDCCARD_SUCCESS;
+}
+
+/** @fn STATUS cCaptureBenchmark::run()
+ * @brief This function is to run every case of the sweep and write <!--
+ * --> one CSV row per case
+ * @return SINT32 value (failure if any case failed)
+ */
+STATUS cCaptureBenchmark::run()
+{
+    strCaptureBenchResult sResult;
+    STATUS s32Status = STS_RFDCCARD_SUCCESS;
+    UINT32 u32CaseNum = 0;
+
+    FILE *pCsvFile = fopen(sConfig.s8OutFile, "w");
+    if (NULL == pCsvFile)
+    {
+        printf("\nCaptureBenchmark: Unable to create %s", sConfig.s8OutFile);
+        return STS_RFDCCARD_OS_ERR;
+    }
+
+    fprintf(pCsvFile, "mode,reorder,seq,rate_mbps,sent_pkts,recvd_pkts,"
+                      "loss_pct,zero_filled_pkts,zero_filled_bytes,out_of_seq,"
+                      "elapsed_sec,mbps,pkts_per_sec,buf_swaps,writer_waits,"
+                      "writer_backlog_pct,cpu_sec,cpu_sec_per_gb,rec_completed,"
+                      "status,recv_to_buf_p99_us,recv_to_buf_p999_us,"
+                      "buf_to_disk_p99_us,buf_to_disk_p999_us,"
+                      "frame_to_handoff_p99_us,frame_to_handoff_p999_us,"
+                      "writer_stall_p99_us,writer_stall_p999_us\n");
+    fflush(pCsvFile);
+
+    for (UINT32 u32Mode = BENCH_OPT_BIT_OFF; u32Mode <= BENCH_OPT_BIT_ON; u32Mode <<= 1)
+    {
+        if (!(sConfig.u32ModeMask & u32Mode))
+            continue;
+        for (UINT32 u32Reorder = BENCH_OPT_BIT_OFF; u32Reorder <= BENCH_OPT_BIT_ON;
+             u32Reorder <<= 1)
+        {
+            if (!(sConfig.u32ReorderMask & u32Reorder))
+                continue;
+            for (UINT32 u32Seq = BENCH_OPT_BIT_OFF; u32Seq <= BENCH_OPT_BIT_ON;
+                 u32Seq <<= 1)
+            {
+                if (!(sConfig.u32SeqMask & u32Seq))
+                    continue;
+                for (UINT32 u32Rate = 0; u32Rate < sConfig.u32NumOfRates; u32Rate++)
+                {
+                    memset(&sResult, 0, sizeof(sResult));
+                    sResult.eLogMode = (u32Mode == BENCH_OPT_BIT_ON) ?
+                                       MULTI_MODE : RAW_MODE;
+                    sResult.bReorderEnable = (u32Reorder == BENCH_OPT_BIT_ON);
+                    sResult.bSequenceNumberEnable = (u32Seq == BENCH_OPT_BIT_ON);
+                    sResult.dRateMBps = sConfig.dRatesMBps[u32Rate];
+
+                    printf("\nCase %u: %s reorder %d seq %d rate %.1f MB/s\n",
+                           u32CaseNum,
+                           (sResult.eLogMode == MULTI_MODE) ? "multi" : "raw",
+                           sResult.bReorderEnable, sResult.bSequenceNumberEnable,
+                           sResult.dRateMBps);
+
+                    if (STS_RFDCCARD_SUCCESS != runCase(&sResult, u32CaseNum))
+                        s32Status = STS_RFDCCARD_OS_ERR;
+                    else if (STS_RFDCCARD_SUCCESS != sResult.sRecv.s32Status)
+                        s32Status = sResult.sRecv.s32Status;
+
+                    writeCsvRow(pCsvFile, &sResult);
+                    if (!sConfig.bKeepFiles)
+                        removeCaseFiles(u32CaseNum);
+                    u32CaseNum++;
+                }
+            }
+        }
+    }
+
+    fclose(pCsvFile);
+    printf("\nResults of %u cases written to %s\n", u32CaseNum, sConfig.s8OutFile);
+    return s32Status;
+}
+
+/** @fn STATUS cCaptureBenchmark::runCase(strCaptureBenchResult *psResult, <!--
+ * -->                                   UINT32 u32CaseNum)
+ * @brief This function is to start the emulator, fork the record <!--
+ * --> process and collect the result of one case
+ * @param [in,out] psResult [strCaptureBenchResult *] - Case settings <!--
+ * --> in, result out
+ * @param [in] u32CaseNum [UINT32] - Case number (record file prefix)
+ * @return SINT32 value
+ */
+STATUS cCaptureBenchmark::runCase(strCaptureBenchResult *psResult,
+                                  UINT32 u32CaseNum)
+{
+    strConfigEmuConfig sEmuConfig;
+    cConfigPortEmulator objConfigEmu;
+    strDataEmuStats sDataStats;
+    struct rusage recUsage;
+    SINT32 s32Pipe[2];
+    SINT32 s32WaitStatus = 0;
+    UINT32 u32NumOfPorts = (psResult->eLogMode == MULTI_MODE) ? NUM_DATA_TYPES : 1;
+
+    psResult->sRecv.s32Status = STS_RFDCCARD_OS_ERR;
+
+    /** Total rate and bytes are shared by the data ports of MULTI mode */
+    cConfigPortEmulator::setDefaultConfig(&sEmuConfig);
+    strcpy(sEmuConfig.s8DcaIpAddr, sConfig.s8DcaIpAddr);
+    sEmuConfig.u32ConfigPort = sConfig.u32ConfigPort;
+    sEmuConfig.bRecCompletedOnStreamEnd = true;
+    sEmuConfig.u32NumOfDataPorts = u32NumOfPorts;
+    sEmuConfig.sDataConfig.u32DestPort = sConfig.u32RecordPort;
+    sEmuConfig.sDataConfig.dRateMBps = psResult->dRateMBps / u32NumOfPorts;
+    sEmuConfig.sDataConfig.u64BytesToSend = sConfig.u64BytesPerCase / u32NumOfPorts;
+
+    if (STS_RFDCCARD_SUCCESS != objConfigEmu.open(&sEmuConfig))
+        return STS_RFDCCARD_INVALID_INPUT_PARAMS;
+
+    if (pipe(s32Pipe) != 0)
+    {
+        printf("\nCaptureBenchmark: pipe failed (%s)", strerror(errno));
+        return STS_RFDCCARD_OS_ERR;
+    }
+
+    /** Emulator thread is started after fork, the record process is single
+     *  threaded when it enters the record API                               */
+    fflush(stdout);
+    pid_t recPid = fork();
+    if (recPid < 0)
+    {
+        printf("\nCaptureBenchmark: fork failed (%s)", strerror(errno));
+        close(s32Pipe[0]);
+        close(s32Pipe[1]);
+        return STS_RFDCCARD_OS_ERR;
+    }
+
+    if (recPid == 0)
+    {
+        strCaptureBenchRecvResult sRecv;
+
+        /** Record API reports every status on the console */
+        SINT32 s32NullFd = ::open("/dev/null", O_WRONLY);
+        if (s32NullFd >= 0)
+            dup2(s32NullFd, STDOUT_FILENO);
+
+        close(s32Pipe[0]);
+        recordCase(psResult, u32CaseNum, &sRecv);
+        if (write(s32Pipe[1], &sRecv, sizeof(sRecv)) != sizeof(sRecv))
+            _exit(FAILURE_STATUS);
+        _exit(SUCCESS_STATUS);
+    }
+
+    close(s32Pipe[1]);
+    std::thread tConfigEmu([&]
+                           { objConfigEmu.run(); });
+
+    /** Blocks till the record process reports or exits */
+    if (read(s32Pipe[0], &psResult->sRecv, sizeof(strCaptureBenchRecvResult)) !=
+        sizeof(strCaptureBenchRecvResult))
+    {
+        printf("\nCaptureBenchmark: Record process of case %u failed", u32CaseNum);
+        psResult->sRecv.s32Status = STS_RFDCCARD_OS_ERR;
+    }
+    close(s32Pipe[0]);
+
+    memset(&recUsage, 0, sizeof(recUsage));
+    wait4(recPid, &s32WaitStatus, 0, &recUsage);
+    psResult->dCpuSec = recUsage.ru_utime.tv_sec + recUsage.ru_stime.tv_sec +
+                        (recUsage.ru_utime.tv_usec + recUsage.ru_stime.tv_usec) / 1e6;
+
+    objConfigEmu.stop();
+    tConfigEmu.join();
+
+    for (UINT32 i = 0; i < u32NumOfPorts; i++)
+    {
+        if (STS_RFDCCARD_SUCCESS == objConfigEmu.getDataStats(i, &sDataStats))
+            psResult->u64NumOfSentPackets += sDataStats.u64NumOfSentPackets;
+    }
+
+    return STS_RFDCCARD_SUCCESS;
+}
+
+/** @fn void cCaptureBenchmark::recordCase(const strCaptureBenchResult *psCase, <!--
+ * -->                 UINT32 u32CaseNum, strCaptureBenchRecvResult *psRecv)
+ * @brief This function is to record one case through the record API. <!--
+ * --> It runs in the forked record process
+ * @param [in] psCase [const strCaptureBenchResult *] - Case settings
+ * @param [in] u32CaseNum [UINT32] - Case number (record file prefix)
+ * @param [out] psRecv [strCaptureBenchRecvResult *] - Receiver result
+ */
+void cCaptureBenchmark::recordCase(const strCaptureBenchResult *psCase,
+                                   UINT32 u32CaseNum,
+                                   strCaptureBenchRecvResult *psRecv)
+{
+    strEthConfigMode sEthConfig;
+    strStartRecConfigMode sStartRecConfig;
+    struct in_addr dcaAddr;
+    struct timespec firstRecvTime;
+    struct timespec lastRecvTime;
+    struct timespec curTime;
+    ULONG64 u64RecvdPackets = 0;
+
+    memset(psRecv, 0, sizeof(strCaptureBenchRecvResult));
+    gbBenchRecCompleted = false;
+
+    StatusRFDCCard_EventRegister(BenchEventCallback);
+    RecInlineProcStats_EventRegister(BenchInlineStatsCallback);
+
+    memset(&sEthConfig, 0, sizeof(sEthConfig));
+    inet_pton(AF_INET, sConfig.s8DcaIpAddr, &dcaAddr);
+    memcpy(sEthConfig.au8Dca1000IpAddr, &dcaAddr, sizeof(sEthConfig.au8Dca1000IpAddr));
+    sEthConfig.u32ConfigPortNo = sConfig.u32ConfigPort;
+    sEthConfig.u32RecordPortNo = sConfig.u32RecordPort;
+
+    psRecv->s32Status = ConnectRFDCCard_RecordMode(sEthConfig);
+    if (STS_RFDCCARD_SUCCESS != psRecv->s32Status)
+        return;
+
+    memset(&sStartRecConfig, 0, sizeof(sStartRecConfig));
+    strcpy(sStartRecConfig.s8FileBasePath, sConfig.s8FileBasePath);
+    sprintf(sStartRecConfig.s8FilePrefix, "%s%u", BENCH_FILE_PREFIX, u32CaseNum);
+    sStartRecConfig.bSequenceNumberEnable = psCase->bSequenceNumberEnable;
+    sStartRecConfig.bReorderEnable = psCase->bReorderEnable;
+    sStartRecConfig.u16MaxRecFileSize = BENCH_MAX_REC_FILE_SIZE_MB;
+    sStartRecConfig.eRecordStopMode = NON_STOP;
+    sStartRecConfig.eRecordTriggerMode = RECORD_TRIGGER_CONTINUOUS;
+    sStartRecConfig.eConfigLogMode = psCase->eLogMode;
+    sStartRecConfig.eLvdsMode = FOUR_LANE;
+    sStartRecConfig.bUdpGroEnable = sConfig.bUdpGroEnable;
+    sStartRecConfig.eWriterBackend = sConfig.bMmapWriter ?
+                                     WRITER_BACKEND_MMAP : WRITER_BACKEND_FWRITE;
+
+    clock_gettime(CLOCK_MONOTONIC, &firstRecvTime);
+    lastRecvTime = firstRecvTime;
+    psRecv->s32Status = StartRecordData(sStartRecConfig);
+    if (STS_RFDCCARD_SUCCESS != psRecv->s32Status)
+        return;
+
+    /** The stream is over once record completed is received and the
+     *  receivers drained the socket buffers                                 */
+    while (true)
+    {
+        usleep(BENCH_POLL_INTERVAL_MS * 1000);
+        clock_gettime(CLOCK_MONOTONIC, &curTime);
+
+        ULONG64 u64Count = 0;
+        for (UINT32 i = 0; i < NUM_DATA_TYPES; i++)
+            u64Count += sRFDCCard_InlineStats.u64NumOfRecvdPackets[i];
+
+        if (u64Count != u64RecvdPackets)
+        {
+            /** Buffer allocation of start record is not part of the rate */
+            if (u64RecvdPackets == 0)
+                firstRecvTime = curTime;
+            u64RecvdPackets = u64Count;
+            lastRecvTime = curTime;
+        }
+        else if (gbBenchRecCompleted &&
+                 (BenchElapsedMs(&lastRecvTime, &curTime) >= BENCH_QUIET_PERIOD_MS))
+            break;
+        else if (BenchElapsedMs(&lastRecvTime, &curTime) >= BENCH_IDLE_TIMEOUT_MS)
+        {
+            psRecv->s32Status = STS_RFDCCARD_TIMEOUT_ERR;
+            break;
+        }
+    }
+
+    psRecv->bRecCompleted = gbBenchRecCompleted;
+    STATUS s32StopStatus = StopRecordData();
+    if (STS_RFDCCARD_SUCCESS == psRecv->s32Status)
+        psRecv->s32Status = s32StopStatus;
+
+    for (UINT32 i = 0; i < NUM_DATA_TYPES; i++)
+    {
+        psRecv->u64NumOfRecvdPackets += sRFDCCard_InlineStats.u64NumOfRecvdPackets[i];
+        psRecv->u64NumOfZeroFilledPackets +=
+            sRFDCCard_InlineStats.u64NumOfZeroFilledPackets[i];
+        psRecv->u64NumOfZeroFilledBytes += sRFDCCard_InlineStats.u64NumOfZeroFilledBytes[i];
+        psRecv->u64OutOfSeqCount += sRFDCCard_InlineStats.u64OutOfSeqCount[i];
+        psRecv->u64NumOfBufSwaps += sRFDCCard_InlineStats.u64NumOfBufSwaps[i];
+        psRecv->u64NumOfWriterWaits += sRFDCCard_InlineStats.u64NumOfWriterWaits[i];
+    }
+    psRecv->dElapsedSec = BenchElapsedMs(&firstRecvTime, &lastRecvTime) / 1000.0;
+
+    /** Merge the latency histograms of all data ports */
+    strRFDCCard_LatencyHist sHist;
+    for (UINT32 j = 0; j < NUM_LATENCY_HISTS; j++)
+    {
+        memset(&sHist, 0, sizeof(sHist));
+        for (UINT32 i = 0; i < NUM_DATA_TYPES; i++)
+        {
+            const strRFDCCard_LatencyHist *psPortHist =
+                &sRFDCCard_LatencyStats.sHist[i][j];
+
+            for (UINT32 k = 0; k < NUM_LATENCY_HIST_BUCKETS; k++)
+                sHist.u64Count[k] += psPortHist->u64Count[k];
+            sHist.u64TotalCount += psPortHist->u64TotalCount;
+            sHist.u64TotalUs += psPortHist->u64TotalUs;
+            if (psPortHist->u64MaxUs > sHist.u64MaxUs)
+                sHist.u64MaxUs = psPortHist->u64MaxUs;
+        }
+        psRecv->u64LatencyP99Us[j] = ReadRFDCCard_LatencyPercentile(&sHist, 99);
+        psRecv->u64LatencyP999Us[j] = ReadRFDCCard_LatencyPercentile(&sHist, 99.9);
+    }
+}
+
+/** @fn void cCaptureBenchmark::removeCaseFiles(UINT32 u32CaseNum)
+ * @brief This function is to delete the record and log files of a case
+ * @param [in] u32CaseNum [UINT32] - Case number (record file prefix)
+ */
+void cCaptureBenchmark::removeCaseFiles(UINT32 u32CaseNum)
+{
+    SINT8 s8Prefix[MAX_NAME_LEN];
+    SINT8 s8FilePath[MAX_FILE_UPDATE_LEN];
+    struct dirent *pEntry = NULL;
+
+    /** Record API appends _Raw_ / _hdr_ to the prefix */
+    sprintf(s8Prefix, "%s%u_", BENCH_FILE_PREFIX, u32CaseNum);
+
+    DIR *pDir = opendir(sConfig.s8FileBasePath);
+    if (NULL == pDir)
+        return;
+
+    while (NULL != (pEntry = readdir(pDir)))
+    {
+        if (strncmp(pEntry->d_name, s8Prefix, strlen(s8Prefix)) == 0)
+        {
+            snprintf(s8FilePath, sizeof(s8FilePath), "%s/%s",
+                     sConfig.s8FileBasePath, pEntry->d_name);
+            unlink(s8FilePath);
+        }
+    }
+    closedir(pDir);
+}
+
+/** @fn void cCaptureBenchmark::writeCsvRow(FILE *pFile, <!--
+ * -->                                      const strCaptureBenchResult *psResult)
+ * @brief This function is to write the metrics of one case as CSV
+ * @param [in] pFile [FILE *] - CSV file
+ * @param [in] psResult [const strCaptureBenchResult *] - Case result
+ */
+void cCaptureBenchmark::writeCsvRow(FILE *pFile, const strCaptureBenchResult *psResult)
+{
+    const strCaptureBenchRecvResult *psRecv = &psResult->sRecv;
+    DOUBLE dRecvdBytes = (DOUBLE)psRecv->u64NumOfRecvdPackets * PAYLOAD_BYTES_PER_PACKET;
+    DOUBLE dLossPercent = 0;
+    DOUBLE dMBps = 0;
+    DOUBLE dPktsPerSec = 0;
+    DOUBLE dBacklogPercent = 0;
+    DOUBLE dCpuPerGB = 0;
+
+    if (psResult->u64NumOfSentPackets > psRecv->u64NumOfRecvdPackets)
+        dLossPercent = EMU_PERCENT_SCALE *
+                       (psResult->u64NumOfSentPackets - psRecv->u64NumOfRecvdPackets) /
+                       psResult->u64NumOfSentPackets;
+    if (psRecv->dElapsedSec > 0)
+    {
+        dMBps = dRecvdBytes / EMU_BYTES_PER_MB / psRecv->dElapsedSec;
+        dPktsPerSec = psRecv->u64NumOfRecvdPackets / psRecv->dElapsedSec;
+    }
+    if (psRecv->u64NumOfBufSwaps > 0)
+        dBacklogPercent = EMU_PERCENT_SCALE * psRecv->u64NumOfWriterWaits /
+                          psRecv->u64NumOfBufSwaps;
+    if (dRecvdBytes > 0)
+        dCpuPerGB = psResult->dCpuSec * BENCH_BYTES_PER_GB / dRecvdBytes;
+
+    fprintf(pFile, "%s,%d,%d,%.1f,%llu,%llu,%.4f,%llu,%llu,%llu,%.3f,%.2f,%.0f,"
+                   "%llu,%llu,%.2f,%.3f,%.3f,%d,%d,%llu,%llu,%llu,%llu,%llu,%llu,"
+                   "%llu,%llu\n",
+            (psResult->eLogMode == MULTI_MODE) ? "multi" : "raw",
+            psResult->bReorderEnable, psResult->bSequenceNumberEnable,
+            psResult->dRateMBps, psResult->u64NumOfSentPackets,
+            psRecv->u64NumOfRecvdPackets, dLossPercent,
+            psRecv->u64NumOfZeroFilledPackets, psRecv->u64NumOfZeroFilledBytes,
+            psRecv->u64OutOfSeqCount, psRecv->dElapsedSec, dMBps, dPktsPerSec,
+            psRecv->u64NumOfBufSwaps, psRecv->u64NumOfWriterWaits,
+            dBacklogPercent, psResult->dCpuSec, dCpuPerGB,
+            psRecv->bRecCompleted, psRecv->s32Status,
+            psRecv->u64LatencyP99Us[LATENCY_RECV_TO_BUFFER],
+            psRecv->u64LatencyP999Us[LATENCY_RECV_TO_BUFFER],
+            psRecv->u64LatencyP99Us[LATENCY_BUFFER_TO_DISK],
+            psRecv->u64LatencyP999Us[LATENCY_BUFFER_TO_DISK],
+            psRecv->u64LatencyP99Us[LATENCY_FRAME_TO_HANDOFF],
+            psRecv->u64LatencyP999Us[LATENCY_FRAME_TO_HANDOFF],
+            psRecv->u64LatencyP99Us[LATENCY_WRITER_STALL],
+            psRecv->u64LatencyP999Us[LATENCY_WRITER_STALL]);
+    fflush(pFile);
+
+    printf("\n%s: %.2f MB/s, %.0f pkts/s, loss %.4f %%, zero filled %llu bytes, "
+           "writer backlog %.2f %%, %.3f CPU sec/GB, "
+           "packet to buffer p99.9 %llu us\n",
+           (psRecv->s32Status == STS_RFDCCARD_SUCCESS) ? "Done" : "Failed",
+           dMBps, dPktsPerSec, dLossPercent, psRecv->u64NumOfZeroFilledBytes,
+           dBacklogPercent, dCpuPerGB,
+           psRecv->u64LatencyP999Us[LATENCY_RECV_TO_BUFFER]);
+}
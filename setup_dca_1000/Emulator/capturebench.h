@@ -0,0 +1,352 @@
+/**
+ * @file capturebench.h
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains the capture benchmark which records the
+ * emulated DCA1000EVM stream through the record API at increasing rates
+ * and reports throughput, loss, writer backlog and CPU cost per case
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+#ifndef CAPTUREBENCH_H
+#define CAPTUREBENCH_H
+
+///****************
+/// Includes
+///****************
+
+#include "configemulator.h"
+#include "../Common/globals.h"
+
+///****************
+/// Defines
+///****************
+
+/** Maximum number of rates in one sweep                                     */
+#define BENCH_MAX_RATES                     16
+
+/** Default rates of the sweep in MB/s (0 for unpaced)                       */
+#define BENCH_DEFAULT_RATES                 "25,50,100,0"
+
+/** Default payload bytes streamed per case                                  */
+#define BENCH_DEFAULT_BYTES_PER_CASE        100000000ULL
+
+/** Default record file base path                                            */
+#define BENCH_DEFAULT_BASE_PATH             "/tmp"
+
+/** Default CSV results file                                                 */
+#define BENCH_DEFAULT_OUT_FILE              "capture_bench.csv"
+
+/** Record file name prefix, followed by the case number                     */
+#define BENCH_FILE_PREFIX                   "capture_bench_"
+
+/** Maximum record file size in MB (largest allowed, fewer file switches)    */
+#define BENCH_MAX_REC_FILE_SIZE_MB          MAX_RECORD_FILE_SIZE
+
+/** Poll interval of the received packet count in millisec                   */
+#define BENCH_POLL_INTERVAL_MS              10
+
+/** Received count has to be stable this long after record completed        */
+#define BENCH_QUIET_PERIOD_MS               200
+
+/** Case is aborted if nothing is received for this long in millisec         */
+#define BENCH_IDLE_TIMEOUT_MS               5000
+
+/** Bytes per gigabyte used for the CPU cost                                 */
+#define BENCH_BYTES_PER_GB                  1000000000.0
+
+/** Option bit - RAW mode / reorder off / sequence number off                */
+#define BENCH_OPT_BIT_OFF                   0x1
+
+/** Option bit - MULTI mode / reorder on / sequence number on                */
+#define BENCH_OPT_BIT_ON                    0x2
+
+/** Option - Rates of the sweep in MB/s                                     */
+#define BENCH_OPT_RATES "--rates"
+
+/** Option - Payload bytes streamed per case                                */
+#define BENCH_OPT_BYTES "--bytes"
+
+/** Option - Capture modes                                                  */
+#define BENCH_OPT_MODES "--modes"
+
+/** Option - Reorder settings                                               */
+#define BENCH_OPT_REORDER "--reorder"
+
+/** Option - Sequence number settings                                       */
+#define BENCH_OPT_SEQ "--seq"
+
+/** Option - CSV results file                                               */
+#define BENCH_OPT_OUT "--out"
+
+/** Option - Record file base path                                          */
+#define BENCH_OPT_PATH "--path"
+
+/** Option - Keep the record files of every case                            */
+#define BENCH_OPT_KEEP "--keep"
+
+/** Option - Receive the ADC data with UDP GRO (coalesced packets)          */
+#define BENCH_OPT_GRO "--gro"
+
+/** Option - Write the record files through memory maps                     */
+#define BENCH_OPT_MMAP "--mmap"
+
+/** Option - Record (data) port                                             */
+#define BENCH_OPT_RECORD_PORT "--record-port"
+
+///****************
+/// Stucture Declarations
+///****************
+
+/** Capture benchmark configuration                                          */
+typedef struct
+{
+    /** Address of the emulated DCA1000EVM config port                       */
+    SINT8 s8DcaIpAddr[IP_ADDR_MAX_SIZE_BYTES];
+
+    /** Config port                                                          */
+    UINT32 u32ConfigPort;
+
+    /** Record (data) port                                                   */
+    UINT32 u32RecordPort;
+
+    /** Record file base path                                                */
+    SINT8 s8FileBasePath[MAX_NAME_LEN];
+
+    /** CSV results file                                                     */
+    SINT8 s8OutFile[MAX_NAME_LEN];
+
+    /** Total payload rates of the sweep in MB/s (0 for unpaced)             */
+    DOUBLE dRatesMBps[BENCH_MAX_RATES];
+
+    /** Number of rates                                                      */
+    UINT32 u32NumOfRates;
+
+    /** Total payload bytes streamed per case                                */
+    ULONG64 u64BytesPerCase;
+
+    /** Capture modes (BENCH_OPT_BIT_OFF - RAW, BENCH_OPT_BIT_ON - MULTI)    */
+    UINT32 u32ModeMask;
+
+    /** Reorder settings (BENCH_OPT_BIT_OFF / BENCH_OPT_BIT_ON)              */
+    UINT32 u32ReorderMask;
+
+    /** Sequence number settings (BENCH_OPT_BIT_OFF / BENCH_OPT_BIT_ON)      */
+    UINT32 u32SeqMask;
+
+    /** Keep the record files of every case                                  */
+    bool bKeepFiles;
+
+    /** Receive the ADC data with UDP GRO (coalesced packets)                */
+    bool bUdpGroEnable;
+
+    /** Write the record files through memory maps                           */
+    bool bMmapWriter;
+
+}strCaptureBenchConfig;
+
+/** Receiver side result of one case (sent from the record process)          */
+typedef struct
+{
+    /** Record API status of the case                                        */
+    STATUS s32Status;
+
+    /** Record completed async status was received                           */
+    bool bRecCompleted;
+
+    /** Received packets (all data ports)                                    */
+    ULONG64 u64NumOfRecvdPackets;
+
+    /** Zero filled packets (all data ports)                                 */
+    ULONG64 u64NumOfZeroFilledPackets;
+
+    /** Zero filled bytes (all data ports)                                   */
+    ULONG64 u64NumOfZeroFilledBytes;
+
+    /** Out of sequence packets (all data ports)                             */
+    ULONG64 u64OutOfSeqCount;
+
+    /** Record buffer swaps (all data ports)                                 */
+    ULONG64 u64NumOfBufSwaps;
+
+    /** Buffer swaps done while the writer was busy (all data ports)         */
+    ULONG64 u64NumOfWriterWaits;
+
+    /** Time from the first to the last received packet in sec (polled)    */
+    DOUBLE dElapsedSec;
+
+    /** 99th percentile latency in micro seconds (all data ports), indexed
+     *  by \ref LatencyHistType                                              */
+    ULONG64 u64LatencyP99Us[NUM_LATENCY_HISTS];
+
+    /** 99.9th percentile latency in micro seconds (all data ports)          */
+    ULONG64 u64LatencyP999Us[NUM_LATENCY_HISTS];
+
+}strCaptureBenchRecvResult;
+
+/** Result of one case                                                       */
+typedef struct
+{
+    /** Capture mode                                                         */
+    ConfigLogMode eLogMode;
+
+    /** Reordering enabled                                                   */
+    bool bReorderEnable;
+
+    /** Sequence number enabled                                              */
+    bool bSequenceNumberEnable;
+
+    /** Total payload rate requested in MB/s (0 for unpaced)                 */
+    DOUBLE dRateMBps;
+
+    /** Packets handed to the kernel by the emulator (all data ports)        */
+    ULONG64 u64NumOfSentPackets;
+
+    /** Receiver side result                                                 */
+    strCaptureBenchRecvResult sRecv;
+
+    /** User + system CPU time of the record process in sec                  */
+    DOUBLE dCpuSec;
+
+}strCaptureBenchResult;
+
+///*****************
+/// API Declarations
+///*****************
+
+/** @fn void ListOfCaptureBenchOptions()
+ * @brief This function is to list the capture benchmark options
+ */
+void ListOfCaptureBenchOptions();
+
+/** @fn SINT32 ParseCaptureBenchOption(SINT32 argc, SINT8 *argv[], <!--
+ * -->                         SINT32 *ps32Index, strCaptureBenchConfig *psConfig)
+ * @brief This function is to parse one capture benchmark option <!--
+ * --> (and its value) from the command line
+ * @param [in] argc [SINT32] - Number of arguments
+ * @param [in] argv [SINT8 *[]] - Arguments
+ * @param [in,out] ps32Index [SINT32 *] - Index of option, moved to its value
+ * @param [out] psConfig [strCaptureBenchConfig *] - Configuration structure
+ * @return SINT32 value (same as \ref ParseDataEmuOption)
+ */
+SINT32 ParseCaptureBenchOption(SINT32 argc, SINT8 *argv[], SINT32 *ps32Index,
+                               strCaptureBenchConfig *psConfig);
+
+/** @class cCaptureBenchmark
+ * @brief This class records the emulated DCA1000EVM stream with <!--
+ * --> \ref StartRecordData for every combination of capture mode, <!--
+ * --> reorder and sequence number settings at every rate of the sweep. <!--
+ * --> Each case runs in a fresh record process so the record API globals, <!--
+ * --> sockets and threads never leak into the next case
+ */
+class cCaptureBenchmark
+{
+public:
+
+    /** @fn cCaptureBenchmark()
+     * @brief This constructor function is to initialize the class member variables
+     */
+    cCaptureBenchmark();
+
+    /** @fn void setDefaultConfig(strCaptureBenchConfig *psConfig)
+     * @brief This function is to fill the benchmark configuration with <!--
+     * --> default values
+     * @param [out] psConfig [strCaptureBenchConfig *] - Configuration structure
+     */
+    static void setDefaultConfig(strCaptureBenchConfig *psConfig);
+
+    /** @fn STATUS setConfig(const strCaptureBenchConfig *psConfig)
+     * @brief This function is to validate and store the benchmark configuration
+     * @param [in] psConfig [const strCaptureBenchConfig *] - Configuration structure
+     * @return SINT32 value
+     */
+    STATUS setConfig(const strCaptureBenchConfig *psConfig);
+
+    /** @fn STATUS run()
+     * @brief This function is to run every case of the sweep and write <!--
+     * --> one CSV row per case
+     * @return SINT32 value (failure if any case failed)
+     */
+    STATUS run();
+
+private:
+
+    /** @fn STATUS runCase(strCaptureBenchResult *psResult, UINT32 u32CaseNum)
+     * @brief This function is to start the emulator, fork the record <!--
+     * --> process and collect the result of one case
+     * @param [in,out] psResult [strCaptureBenchResult *] - Case settings <!--
+     * --> in, result out
+     * @param [in] u32CaseNum [UINT32] - Case number (record file prefix)
+     * @return SINT32 value
+     */
+    STATUS runCase(strCaptureBenchResult *psResult, UINT32 u32CaseNum);
+
+    /** @fn void recordCase(const strCaptureBenchResult *psCase, <!--
+     * -->                 UINT32 u32CaseNum, strCaptureBenchRecvResult *psRecv)
+     * @brief This function is to record one case through the record API. <!--
+     * --> It runs in the forked record process
+     * @param [in] psCase [const strCaptureBenchResult *] - Case settings
+     * @param [in] u32CaseNum [UINT32] - Case number (record file prefix)
+     * @param [out] psRecv [strCaptureBenchRecvResult *] - Receiver result
+     */
+    void recordCase(const strCaptureBenchResult *psCase, UINT32 u32CaseNum,
+                    strCaptureBenchRecvResult *psRecv);
+
+    /** @fn void removeCaseFiles(UINT32 u32CaseNum)
+     * @brief This function is to delete the record and log files of a case
+     * @param [in] u32CaseNum [UINT32] - Case number (record file prefix)
+     */
+    void removeCaseFiles(UINT32 u32CaseNum);
+
+    /** @fn void writeCsvRow(FILE *pFile, const strCaptureBenchResult *psResult)
+     * @brief This function is to write the metrics of one case as CSV
+     * @param [in] pFile [FILE *] - CSV file
+     * @param [in] psResult [const strCaptureBenchResult *] - Case result
+     */
+    void writeCsvRow(FILE *pFile, const strCaptureBenchResult *psResult);
+
+    /** Benchmark configuration             */
+    strCaptureBenchConfig sConfig;
+};
+
+#endif // CAPTUREBENCH_H
@@ -0,0 +1,625 @@
+/**
+ * @file configemulator.cpp
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains definitions for emulating the DCA1000EVM
+ * config port protocol (command responses and async status)
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+///****************
+/// Includes
+///****************
+
+#include <errno.h>
+#include <time.h>
+
+#include "configemulator.h"
+#include "../Common/Validate_Utils/validate_params.h"
+
+/** @fn void ListOfConfigEmuOptions()
+ * @brief This function is to list the config port emulator options
+ */
+void ListOfConfigEmuOptions()
+{
+    printf("\n%s <addr>\t\t%s", EMU_OPT_DCA_IP,
+           "Config port address (default " EMU_DEFAULT_DCA_IP_ADDR ")");
+    printf("\n%s <port>\t%s (default %d)", EMU_OPT_CONFIG_PORT,
+           "Config port", EMU_DEFAULT_CONFIG_PORT);
+    printf("\n%s <ms>\t%s", EMU_OPT_RESP_DELAY, "Command response delay");
+    printf("\n%s <code>\t%s", EMU_OPT_FAIL_CMD,
+           "Answer the command code with failure status");
+    printf("\n%s <code>\t%s", EMU_OPT_DROP_CMD,
+           "Leave the command code unanswered");
+    printf("\n%s\t\t%s", EMU_OPT_REC_COMPLETED,
+           "Send record completed status when the stream ends");
+    printf("\n%s <ms>:<bit>\t%s", EMU_OPT_ASYNC_AFTER,
+           "Send async status bit after start record");
+    printf("\n%s\t\t%s", EMU_OPT_PLAYBACK, "Report playback FPGA bitfile");
+    printf("\n%s <n>\t%s", EMU_OPT_DATA_PORTS,
+           "Stream to n consecutive data ports (MULTI mode, default 1)");
+}
+
+/** @fn SINT32 ParseConfigEmuOption(SINT32 argc, SINT8 *argv[], <!--
+ * -->                           SINT32 *ps32Index, strConfigEmuConfig *psConfig)
+ * @brief This function is to parse one config port emulator option <!--
+ * --> (and its value) from the command line
+ * @param [in] argc [SINT32] - Number of arguments
+ * @param [in] argv [SINT8 *[]] - Arguments
+ * @param [in,out] ps32Index [SINT32 *] - Index of option, moved to its value
+ * @param [out] psConfig [strConfigEmuConfig *] - Configuration structure
+ * @return SINT32 value (same as \ref ParseDataEmuOption)
+ */
+SINT32 ParseConfigEmuOption(SINT32 argc, SINT8 *argv[], SINT32 *ps32Index,
+                            strConfigEmuConfig *psConfig)
+{
+    SINT32 i = *ps32Index;
+    const SINT8 *s8Option = argv[i];
+
+    if (strcmp(s8Option, EMU_OPT_REC_COMPLETED) == 0)
+    {
+        psConfig->bRecCompletedOnStreamEnd = true;
+        return SUCCESS_STATUS;
+    }
+    if (strcmp(s8Option, EMU_OPT_PLAYBACK) == 0)
+    {
+        psConfig->bPlaybackBitfile = true;
+        return SUCCESS_STATUS;
+    }
+
+    if ((strcmp(s8Option, EMU_OPT_DCA_IP) != 0) &&
+        (strcmp(s8Option, EMU_OPT_CONFIG_PORT) != 0) &&
+        (strcmp(s8Option, EMU_OPT_RESP_DELAY) != 0) &&
+        (strcmp(s8Option, EMU_OPT_FAIL_CMD) != 0) &&
+        (strcmp(s8Option, EMU_OPT_DROP_CMD) != 0) &&
+        (strcmp(s8Option, EMU_OPT_ASYNC_AFTER) != 0) &&
+        (strcmp(s8Option, EMU_OPT_DATA_PORTS) != 0))
+    {
+        /** Data stream options */
+        if (strcmp(s8Option, EMU_OPT_DEST_IP) == 0)
+            psConfig->bDataDestIpSet = true;
+        return ParseDataEmuOption(argc, argv, ps32Index, &psConfig->sDataConfig);
+    }
+
+    if ((i + 1) >= argc)
+    {
+        printf("\nMissing value for option %s\n", s8Option);
+        return STS_RFDCCARD_INVALID_INPUT_PARAMS;
+    }
+    const SINT8 *s8Value = argv[++i];
+    *ps32Index = i;
+
+    if (strcmp(s8Option, EMU_OPT_DCA_IP) == 0)
+        strncpy(psConfig->s8DcaIpAddr, s8Value, IP_ADDR_MAX_SIZE_BYTES - 1);
+    else if (strcmp(s8Option, EMU_OPT_CONFIG_PORT) == 0)
+        psConfig->u32ConfigPort = (UINT32)atol(s8Value);
+    else if (strcmp(s8Option, EMU_OPT_RESP_DELAY) == 0)
+        psConfig->u32RespDelayMs = (UINT32)atol(s8Value);
+    else if (strcmp(s8Option, EMU_OPT_FAIL_CMD) == 0)
+        psConfig->u16FailCmdCode = (UINT16)strtoul(s8Value, NULL, 0);
+    else if (strcmp(s8Option, EMU_OPT_DROP_CMD) == 0)
+        psConfig->u16DropCmdCode = (UINT16)strtoul(s8Value, NULL, 0);
+    else if (strcmp(s8Option, EMU_OPT_DATA_PORTS) == 0)
+        psConfig->u32NumOfDataPorts = (UINT32)atol(s8Value);
+    else
+    {
+        SINT8 *s8End = NULL;
+        psConfig->u32AsyncAfterMs = (UINT32)strtoul(s8Value, &s8End, 10);
+        if ((NULL == s8End) || (*s8End != ':'))
+        {
+            printf("\nInvalid value for option %s (<ms>:<bit>)\n", s8Option);
+            return STS_RFDCCARD_INVALID_INPUT_PARAMS;
+        }
+        psConfig->u16AsyncAfterStatus = (UINT16)atol(s8End + 1);
+    }
+
+    return SUCCESS_STATUS;
+}
+
+/** @fn cConfigPortEmulator::cConfigPortEmulator()
+ * @brief This constructor function is to initialize the class member variables
+ */
+cConfigPortEmulator::cConfigPortEmulator()
+{
+    setDefaultConfig(&sConfig);
+    s32ConfigSock = -1;
+    memset(&hostAddr, 0, sizeof(hostAddr));
+    bHostAddrValid = false;
+    bRecording = false;
+    bStreamEnded = false;
+    u32NumOfStreamsRunning = 0;
+    bAsyncAfterPending = false;
+    u32PendingAsyncStatus = 0;
+    bStreamStopRequested = false;
+    bStopRequested = false;
+    memset(u8FpgaConfig, 0, sizeof(u8FpgaConfig));
+    memset(u64NumOfCmds, 0, sizeof(u64NumOfCmds));
+    u64NumOfInvalidPkts = 0;
+    u64NumOfAsyncSent = 0;
+}
+
+/** @fn cConfigPortEmulator::~cConfigPortEmulator()
+ * @brief This destructor function is to stop the data stream and <!--
+ * --> release the socket
+ */
+cConfigPortEmulator::~cConfigPortEmulator()
+{
+    stopDataStream();
+    if (s32ConfigSock >= 0)
+        close(s32ConfigSock);
+}
+
+/** @fn void cConfigPortEmulator::setDefaultConfig(strConfigEmuConfig *psConfig)
+ * @brief This function is to fill the emulator configuration with <!--
+ * --> default values
+ * @param [out] psConfig [strConfigEmuConfig *] - Configuration structure
+ */
+void cConfigPortEmulator::setDefaultConfig(strConfigEmuConfig *psConfig)
+{
+    memset(psConfig, 0, sizeof(strConfigEmuConfig));
+    strcpy(psConfig->s8DcaIpAddr, EMU_DEFAULT_DCA_IP_ADDR);
+    psConfig->u32ConfigPort = EMU_DEFAULT_CONFIG_PORT;
+    psConfig->u32NumOfDataPorts = 1;
+    cDataStreamEmulator::setDefaultConfig(&psConfig->sDataConfig);
+}
+
+/** @fn STATUS cConfigPortEmulator::open(const strConfigEmuConfig *psConfig)
+ * @brief This function is to validate the configuration and bind the <!--
+ * --> config port
+ * @param [in] psConfig [const strConfigEmuConfig *] - Configuration structure
+ * @return SINT32 value
+ */
+STATUS cConfigPortEmulator::open(const strConfigEmuConfig *psConfig)
+{
+    struct sockaddr_in dcaAddr;
+    struct timeval pollTimeout;
+    SINT8 s8IpAddr[IP_ADDR_MAX_SIZE_BYTES];
+    SINT32 s32ReuseAddr = 1;
+
+    strcpy(s8IpAddr, psConfig->s8DcaIpAddr);
+    if ((SUCCESS_STATUS != validateIpAddress(s8IpAddr)) ||
+        (SUCCESS_STATUS != validatePortNumber(psConfig->u32ConfigPort)) ||
+        (psConfig->u16AsyncAfterStatus >= MAX_SYSTEM_STATUS) ||
+        (psConfig->u32NumOfDataPorts == 0) ||
+        (psConfig->u32NumOfDataPorts > NUM_DATA_TYPES))
+    {
+        printf("\nConfigPortEmulator: Invalid config port settings");
+        return STS_RFDCCARD_INVALID_INPUT_PARAMS;
+    }
+
+    /** Validate the data stream settings up front */
+    if ((STS_RFDCCARD_SUCCESS != objDataEmu[0].setConfig(&psConfig->sDataConfig)) ||
+        (SUCCESS_STATUS != validatePortNumber(psConfig->sDataConfig.u32DestPort +
+                                              psConfig->u32NumOfDataPorts - 1)))
+        return STS_RFDCCARD_INVALID_INPUT_PARAMS;
+
+    memcpy(&sConfig, psConfig, sizeof(strConfigEmuConfig));
+
+    s32ConfigSock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (s32ConfigSock < 0)
+    {
+        printf("\nConfigPortEmulator: Socket creation failed : %d", errno);
+        return STS_RFDCCARD_OS_ERR;
+    }
+
+    /** Record PC binds the same port on 0.0.0.0 when run on this host */
+    setsockopt(s32ConfigSock, SOL_SOCKET, SO_REUSEADDR,
+               (SINT8 *)&s32ReuseAddr, sizeof(s32ReuseAddr));
+
+    memset(&dcaAddr, 0, sizeof(dcaAddr));
+    dcaAddr.sin_family = AF_INET;
+    dcaAddr.sin_addr.s_addr = inet_addr(sConfig.s8DcaIpAddr);
+    dcaAddr.sin_port = htons((UINT16)sConfig.u32ConfigPort);
+
+    if (bind(s32ConfigSock, (struct sockaddr *)&dcaAddr, sizeof(dcaAddr)) < 0)
+    {
+        printf("\nConfigPortEmulator: Bind failed (%s:%u) : %d",
+               sConfig.s8DcaIpAddr, sConfig.u32ConfigPort, errno);
+        close(s32ConfigSock);
+        s32ConfigSock = -1;
+        return STS_RFDCCARD_OS_ERR;
+    }
+
+    /** Short receive timeout to serve queued async status and stop request */
+    pollTimeout.tv_sec = 0;
+    pollTimeout.tv_usec = EMU_CONFIG_POLL_INTERVAL_MS *
+                          MILLI_TO_MICRO_SEC_CONVERSION;
+    setsockopt(s32ConfigSock, SOL_SOCKET, SO_RCVTIMEO,
+               (SINT8 *)&pollTimeout, sizeof(pollTimeout));
+
+    return STS_RFDCCARD_SUCCESS;
+}
+
+/** @fn void cConfigPortEmulator::stop()
+ * @brief This function is to request the config port loop to exit
+ */
+void cConfigPortEmulator::stop()
+{
+    bStopRequested = true;
+}
+
+/** @fn void cConfigPortEmulator::requestAsyncStatus(UINT16 u16StatusBit)
+ * @brief This function is to queue an async status to the record PC. <!--
+ * --> It is safe to call from signal handlers and other threads
+ * @param [in] u16StatusBit [UINT16] - Status bit (SYS_ASYNC_STATUS)
+ */
+void cConfigPortEmulator::requestAsyncStatus(UINT16 u16StatusBit)
+{
+    if (u16StatusBit < MAX_SYSTEM_STATUS)
+        u32PendingAsyncStatus |= (1U << u16StatusBit);
+}
+
+/** @fn void cConfigPortEmulator::requestStreamStop()
+ * @brief This function is to stop the data stream without a stop <!--
+ * --> record command (emulates the LVDS data stopping)
+ */
+void cConfigPortEmulator::requestStreamStop()
+{
+    bStreamStopRequested = true;
+}
+
+/** @fn void cConfigPortEmulator::sendResponse(UINT16 u16CmdCode, UINT16 u16Status)
+ * @brief This function is to send a DATA_CAPTURE_RESP packet to the <!--
+ * --> record PC
+ * @param [in] u16CmdCode [UINT16] - Command code
+ * @param [in] u16Status [UINT16] - Command status
+ */
+void cConfigPortEmulator::sendResponse(UINT16 u16CmdCode, UINT16 u16Status)
+{
+    DATA_CAPTURE_RESP sResp;
+
+    if (!bHostAddrValid)
+    {
+        printf("\nConfigPortEmulator: Record PC not known yet, "
+               "response 0x%02X dropped", u16CmdCode);
+        return;
+    }
+
+    sResp.u16Header = HEADER_START_BYTES;
+    sResp.u16CmdCode = u16CmdCode;
+    sResp.u16Status = u16Status;
+    sResp.u16Footer = FOOTER_STOP_BYTES;
+
+    if (sendto(s32ConfigSock, (SINT8 *)&sResp, sizeof(sResp), 0,
+               (struct sockaddr *)&hostAddr, sizeof(hostAddr)) < 0)
+    {
+        printf("\nConfigPortEmulator: UDP write failed : %d", errno);
+    }
+}
+
+/** @fn void cConfigPortEmulator::startDataStream()
+ * @brief This function is to start one data stream emulator thread <!--
+ * --> per data port
+ */
+void cConfigPortEmulator::startDataStream()
+{
+    strDataEmuConfig sDataConfig;
+
+    stopDataStream();
+
+    memcpy(&sDataConfig, &sConfig.sDataConfig, sizeof(strDataEmuConfig));
+    if (!sConfig.bDataDestIpSet)
+        strcpy(sDataConfig.s8DestIpAddr, inet_ntoa(hostAddr.sin_addr));
+
+    /** Data is streamed from the address of the emulated system */
+    if (strlen(sDataConfig.s8SrcIpAddr) == 0)
+        strcpy(sDataConfig.s8SrcIpAddr, sConfig.s8DcaIpAddr);
+
+    /** One stream per data port, each with its own impairment sequence */
+    for (UINT32 i = 0; i < sConfig.u32NumOfDataPorts; i++)
+    {
+        if (STS_RFDCCARD_SUCCESS != objDataEmu[i].setConfig(&sDataConfig))
+            return;
+        sDataConfig.u32DestPort++;
+        sDataConfig.u32Seed++;
+    }
+
+    printf("\nConfigPortEmulator: Streaming to %s:%u (%u port(s))",
+           sDataConfig.s8DestIpAddr, sConfig.sDataConfig.u32DestPort,
+           sConfig.u32NumOfDataPorts);
+
+    bStreamEnded = false;
+    u32NumOfStreamsRunning = sConfig.u32NumOfDataPorts;
+    for (UINT32 i = 0; i < sConfig.u32NumOfDataPorts; i++)
+    {
+        dataThread[i] = std::thread([this, i]
+                                    {
+                                        objDataEmu[i].run();
+                                        if (--u32NumOfStreamsRunning == 0)
+                                            bStreamEnded = true;
+                                    });
+    }
+    bRecording = true;
+    bAsyncAfterPending = (sConfig.u32AsyncAfterMs != 0);
+    clock_gettime(CLOCK_MONOTONIC, &recStartTime);
+}
+
+/** @fn void cConfigPortEmulator::stopDataStream()
+ * @brief This function is to stop and join the data stream emulator threads
+ */
+void cConfigPortEmulator::stopDataStream()
+{
+    for (UINT32 i = 0; i < NUM_DATA_TYPES; i++)
+    {
+        if (dataThread[i].joinable())
+        {
+            objDataEmu[i].stop();
+            dataThread[i].join();
+            objDataEmu[i].printStats();
+        }
+    }
+    bRecording = false;
+    bAsyncAfterPending = false;
+}
+
+/** @fn STATUS cConfigPortEmulator::getDataStats(UINT32 u32PortIndex, strDataEmuStats *psStats)
+ * @brief This function is to read the statistics of the last data <!--
+ * --> stream sent to one of the data ports
+ * @param [in] u32PortIndex [UINT32] - Data port index (0 - data port)
+ * @param [out] psStats [strDataEmuStats *] - Statistics structure
+ * @return SINT32 value
+ */
+STATUS cConfigPortEmulator::getDataStats(UINT32 u32PortIndex,
+                                         strDataEmuStats *psStats)
+{
+    if (u32PortIndex >= NUM_DATA_TYPES)
+        return STS_RFDCCARD_INVALID_INPUT_PARAMS;
+
+    objDataEmu[u32PortIndex].getStats(psStats);
+    return STS_RFDCCARD_SUCCESS;
+}
+
+/** @fn void cConfigPortEmulator::processPendingEvents()
+ * @brief This function is to send queued / scheduled async status and <!--
+ * --> handle the end of the data stream
+ */
+void cConfigPortEmulator::processPendingEvents()
+{
+    struct timespec now;
+    UINT32 u32Status = u32PendingAsyncStatus.exchange(0);
+
+    if (bStreamStopRequested.exchange(false))
+    {
+        for (UINT32 i = 0; i < NUM_DATA_TYPES; i++)
+            objDataEmu[i].stop();
+    }
+
+    if (bAsyncAfterPending)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        if (((now.tv_sec - recStartTime.tv_sec) * SEC_TO_MILLI_SEC_CONVERSION +
+             (now.tv_nsec - recStartTime.tv_nsec) / 1000000) >=
+            (SLONG)sConfig.u32AsyncAfterMs)
+        {
+            u32Status |= (1U << sConfig.u16AsyncAfterStatus);
+            bAsyncAfterPending = false;
+        }
+    }
+
+    /** Data stream ended by itself (bytes/duration/end of file/stop request) */
+    if (bRecording && bStreamEnded)
+    {
+        stopDataStream();
+        if (sConfig.bRecCompletedOnStreamEnd)
+            u32Status |= (1U << STS_REC_COMPLETED);
+    }
+
+    if (u32Status != 0)
+    {
+        printf("\nConfigPortEmulator: Async status 0x%04X", u32Status);
+        sendResponse(CMD_CODE_SYSTEM_ASYNC_STATUS, (UINT16)u32Status);
+        u64NumOfAsyncSent++;
+    }
+}
+
+/** @fn void cConfigPortEmulator::handleRequest(UINT8 *pu8Buf, SINT32 s32Len)
+ * @brief This function is to decode one command request and respond
+ * @param [in] pu8Buf [UINT8 *] - Request packet
+ * @param [in] s32Len [SINT32] - Request packet length
+ */
+void cConfigPortEmulator::handleRequest(UINT8 *pu8Buf, SINT32 s32Len)
+{
+    UINT16 u16Header = 0;
+    UINT16 u16CmdCode = 0;
+    UINT16 u16DataSize = 0;
+    UINT16 u16Footer = 0;
+    UINT16 u16Status = SUCCESS_STATUS;
+    UINT16 u16Data = 0;
+    UINT8 *pu8Data = &pu8Buf[PACKET_FIXED_SIZE_EXC_FOOTER];
+
+    /** Validate header, data size and footer */
+    if (s32Len < FIXED_PACKET_SIZE)
+    {
+        u64NumOfInvalidPkts++;
+        return;
+    }
+    memcpy(&u16Header, &pu8Buf[0], UINT16_DATA_SIZE);
+    memcpy(&u16CmdCode, &pu8Buf[2], UINT16_DATA_SIZE);
+    memcpy(&u16DataSize, &pu8Buf[4], UINT16_DATA_SIZE);
+    if ((u16Header != HEADER_START_BYTES) ||
+        (u16DataSize > MAX_DATA_BYTES) ||
+        (s32Len < (FIXED_PACKET_SIZE + u16DataSize)))
+    {
+        u64NumOfInvalidPkts++;
+        return;
+    }
+    memcpy(&u16Footer, &pu8Data[u16DataSize], UINT16_DATA_SIZE);
+    if (u16Footer != FOOTER_STOP_BYTES)
+    {
+        u64NumOfInvalidPkts++;
+        return;
+    }
+
+    if (u16CmdCode < EMU_NUM_OF_CMD_CODES)
+        u64NumOfCmds[u16CmdCode]++;
+
+    printf("\nConfigPortEmulator: Command 0x%02X (%u bytes)", u16CmdCode,
+           u16DataSize);
+
+    if (u16CmdCode == sConfig.u16DropCmdCode)
+        return;
+
+    if (sConfig.u32RespDelayMs != 0)
+        usleep(sConfig.u32RespDelayMs * MILLI_TO_MICRO_SEC_CONVERSION);
+
+    switch (u16CmdCode)
+    {
+    case CMD_CODE_RESET_FPGA:
+        stopDataStream();
+        break;
+    case CMD_CODE_RESET_AR_DEV:
+    case CMD_CODE_SYSTEM_ALIVENESS:
+    case CMD_CODE_CONFIG_AR_DEV:
+    case CMD_CODE_START_PLAYBACK:
+    case CMD_CODE_STOP_PLAYBACK:
+    case CMD_CODE_INIT_FPGA_PLAYBACK:
+        break;
+    case CMD_CODE_CONFIG_FPGA:
+        if (u16DataSize != EMU_FPGA_CONFIG_DATA_SIZE)
+        {
+            u16Status = FAILURE_STATUS;
+            break;
+        }
+        memcpy(u8FpgaConfig, pu8Data, EMU_FPGA_CONFIG_DATA_SIZE);
+        printf("\nConfigPortEmulator: Log mode %u, LVDS mode %u, "
+               "transfer mode %u, capture mode %u, format %u",
+               u8FpgaConfig[0], u8FpgaConfig[1], u8FpgaConfig[2],
+               u8FpgaConfig[3], u8FpgaConfig[4]);
+        break;
+    case CMD_CODE_CONFIG_EEPROM:
+        if (u16DataSize != EMU_EEPROM_CONFIG_DATA_SIZE)
+        {
+            u16Status = FAILURE_STATUS;
+            break;
+        }
+        /** Record port of the next stream follows the EEPROM update */
+        memcpy(&u16Data, &pu8Data[EMU_EEPROM_RECORD_PORT_OFFSET],
+               UINT16_DATA_SIZE);
+        sConfig.sDataConfig.u32DestPort = u16Data;
+        break;
+    case CMD_CODE_CONFIG_RECORD:
+        if (u16DataSize < (2 * UINT16_DATA_SIZE))
+        {
+            u16Status = FAILURE_STATUS;
+            break;
+        }
+        memcpy(&u16Data, &pu8Data[UINT16_DATA_SIZE], UINT16_DATA_SIZE);
+        printf("\nConfigPortEmulator: Packet delay %u us",
+               u16Data * FPGA_CLK_PERIOD_IN_NANO_SEC /
+                   FPGA_CLK_CONVERSION_FACTOR);
+        break;
+    case CMD_CODE_START_RECORD:
+    case CMD_CODE_STOP_RECORD:
+        break;
+    case CMD_CODE_READ_FPGA_VERSION:
+        u16Status = EMU_FPGA_MAJOR_VERSION |
+                    (EMU_FPGA_MINOR_VERSION << VERSION_NUM_OF_BITS);
+        if (sConfig.bPlaybackBitfile)
+            u16Status |= PLAYBACK_BIT_DECODE;
+        break;
+    default:
+        u16Status = FAILURE_STATUS;
+        break;
+    }
+
+    if (u16CmdCode == sConfig.u16FailCmdCode)
+        u16Status = FAILURE_STATUS;
+
+    /** Stop the stream before confirming stop record */
+    if ((u16CmdCode == CMD_CODE_STOP_RECORD) && (u16Status == SUCCESS_STATUS))
+        stopDataStream();
+
+    sendResponse(u16CmdCode, u16Status);
+
+    /** Data follows the start record response */
+    if ((u16CmdCode == CMD_CODE_START_RECORD) && (u16Status == SUCCESS_STATUS))
+        startDataStream();
+}
+
+/** @fn void cConfigPortEmulator::run()
+ * @brief This function is to serve the config port till stop is requested
+ */
+void cConfigPortEmulator::run()
+{
+    UINT8 u8RecvBuf[sizeof(DATA_CAPTURE_REQ)];
+    struct sockaddr_in senderAddr;
+    socklen_t senderAddrSize;
+    SINT32 s32RecvSize = 0;
+
+    bStopRequested = false;
+
+    while (!bStopRequested)
+    {
+        senderAddrSize = sizeof(senderAddr);
+        s32RecvSize = recvfrom(s32ConfigSock, (SINT8 *)u8RecvBuf,
+                               sizeof(u8RecvBuf), 0,
+                               (struct sockaddr *)&senderAddr,
+                               &senderAddrSize);
+        if (s32RecvSize > 0)
+        {
+            memcpy(&hostAddr, &senderAddr, sizeof(hostAddr));
+            bHostAddrValid = true;
+            handleRequest(u8RecvBuf, s32RecvSize);
+        }
+
+        processPendingEvents();
+    }
+
+    stopDataStream();
+}
+
+/** @fn void cConfigPortEmulator::printStats()
+ * @brief This function is to print the command and stream statistics
+ */
+void cConfigPortEmulator::printStats()
+{
+    printf("\nConfig port emulator summary :");
+    for (UINT16 u16CmdCode = 0; u16CmdCode < EMU_NUM_OF_CMD_CODES; u16CmdCode++)
+    {
+        if (u64NumOfCmds[u16CmdCode] != 0)
+            printf("\nCommand 0x%02X - %llu", u16CmdCode,
+                   u64NumOfCmds[u16CmdCode]);
+    }
+    printf("\nInvalid packets - %llu", u64NumOfInvalidPkts);
+    printf("\nAsync status sent - %llu\n", u64NumOfAsyncSent);
+}
@@ -0,0 +1,361 @@
+/**
+ * @file configemulator.h
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains declarations for emulating the DCA1000EVM
+ * config port protocol (command responses and async status)
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+#ifndef CONFIGEMULATOR_H
+#define CONFIGEMULATOR_H
+
+///****************
+/// Includes
+///****************
+
+#include "dataemulator.h"
+
+///****************
+/// Defines
+///****************
+
+/** Default address the emulated DCA1000EVM config port is bound to. A
+ * loopback alias is used so that the record PC can bind the same port on
+ * 0.0.0.0 (see EMULATOR_PORT_SHARING)                                       */
+#define EMU_DEFAULT_DCA_IP_ADDR             "127.0.0.2"
+
+/** Default config port (same as DCA1000ConfigPort in JSON)                  */
+#define EMU_DEFAULT_CONFIG_PORT             4096
+
+/** Emulated FPGA major version                                              */
+#define EMU_FPGA_MAJOR_VERSION              2
+
+/** Emulated FPGA minor version                                              */
+#define EMU_FPGA_MINOR_VERSION              8
+
+/** Config port poll interval in millisec (pending async status / stop)      */
+#define EMU_CONFIG_POLL_INTERVAL_MS         20
+
+/** Number of command codes tracked in the statistics                        */
+#define EMU_NUM_OF_CMD_CODES                (CMD_CODE_READ_FPGA_VERSION + 1)
+
+/** FPGA config command payload size (log, lvds, xfer, capture, format, timer)*/
+#define EMU_FPGA_CONFIG_DATA_SIZE           6
+
+/** EEPROM config command payload size (IPs, MAC, config and record port)     */
+#define EMU_EEPROM_CONFIG_DATA_SIZE         18
+
+/** EEPROM config command - offset of the record port                        */
+#define EMU_EEPROM_RECORD_PORT_OFFSET       16
+
+/** Option - Address the config port is bound to                            */
+#define EMU_OPT_DCA_IP "--dca-ip"
+
+/** Option - Config port                                                    */
+#define EMU_OPT_CONFIG_PORT "--config-port"
+
+/** Option - Command response delay in millisec                             */
+#define EMU_OPT_RESP_DELAY "--resp-delay"
+
+/** Option - Command code answered with failure status                      */
+#define EMU_OPT_FAIL_CMD "--fail-cmd"
+
+/** Option - Command code left unanswered (command timeout)                 */
+#define EMU_OPT_DROP_CMD "--drop-cmd"
+
+/** Option - Send record completed async status when the stream ends       */
+#define EMU_OPT_REC_COMPLETED "--rec-completed"
+
+/** Option - Send an async status bit a delay after start record            */
+#define EMU_OPT_ASYNC_AFTER "--async-after"
+
+/** Option - Playback FPGA bitfile reported in the version                  */
+#define EMU_OPT_PLAYBACK "--playback"
+
+/** Option - Number of consecutive data ports streamed on start record      */
+#define EMU_OPT_DATA_PORTS "--data-ports"
+
+/** Console - Send async status bit                                         */
+#define EMU_CONSOLE_ASYNC "async"
+
+/** Console - Stop the data stream                                          */
+#define EMU_CONSOLE_STOP_STREAM "stop"
+
+/** Console - Print statistics                                              */
+#define EMU_CONSOLE_STATS "stats"
+
+/** Console - Exit the emulator                                             */
+#define EMU_CONSOLE_QUIT "quit"
+
+///****************
+/// Stucture Declarations
+///****************
+
+/** Config port emulator configuration                                       */
+typedef struct
+{
+    /** Address the config port is bound to (DCA1000IPAddress in JSON)       */
+    SINT8 s8DcaIpAddr[IP_ADDR_MAX_SIZE_BYTES];
+
+    /** Config port                                                          */
+    UINT32 u32ConfigPort;
+
+    /** Report playback FPGA bitfile in the version response                 */
+    bool bPlaybackBitfile;
+
+    /** Delay before every command response in millisec                      */
+    UINT32 u32RespDelayMs;
+
+    /** Command code answered with failure status (0 for none)               */
+    UINT16 u16FailCmdCode;
+
+    /** Command code left unanswered (0 for none)                            */
+    UINT16 u16DropCmdCode;
+
+    /** Send STS_REC_COMPLETED when the data stream ends by itself           */
+    bool bRecCompletedOnStreamEnd;
+
+    /** Delay after start record before the async status is sent (0 - off)   */
+    UINT32 u32AsyncAfterMs;
+
+    /** Async status bit (SYS_ASYNC_STATUS) sent after u32AsyncAfterMs       */
+    UINT16 u16AsyncAfterStatus;
+
+    /** Data stream started on start record. Destination IP is taken from
+     *  the command sender unless set explicitly                             */
+    strDataEmuConfig sDataConfig;
+
+    /** Destination IP of the data stream was set explicitly                 */
+    bool bDataDestIpSet;
+
+    /** Number of consecutive data ports streamed from the data port, one
+     *  stream per port (1 - RAW mode, NUM_DATA_TYPES - MULTI mode)          */
+    UINT32 u32NumOfDataPorts;
+
+}strConfigEmuConfig;
+
+///*****************
+/// API Declarations
+///*****************
+
+/** @fn void ListOfConfigEmuOptions()
+ * @brief This function is to list the config port emulator options
+ */
+void ListOfConfigEmuOptions();
+
+/** @fn SINT32 ParseConfigEmuOption(SINT32 argc, SINT8 *argv[], <!--
+ * -->                           SINT32 *ps32Index, strConfigEmuConfig *psConfig)
+ * @brief This function is to parse one config port emulator option <!--
+ * --> (and its value) from the command line
+ * @param [in] argc [SINT32] - Number of arguments
+ * @param [in] argv [SINT8 *[]] - Arguments
+ * @param [in,out] ps32Index [SINT32 *] - Index of option, moved to its value
+ * @param [out] psConfig [strConfigEmuConfig *] - Configuration structure
+ * @return SINT32 value (same as \ref ParseDataEmuOption)
+ */
+SINT32 ParseConfigEmuOption(SINT32 argc, SINT8 *argv[], SINT32 *ps32Index,
+                            strConfigEmuConfig *psConfig);
+
+/** @class cConfigPortEmulator
+ * @brief This class emulates the DCA1000EVM config port. It answers every <!--
+ * --> command code, injects async status and drives the data stream <!--
+ * --> emulator on start/stop record
+ */
+class cConfigPortEmulator
+{
+public:
+
+    /** @fn cConfigPortEmulator()
+     * @brief This constructor function is to initialize the class member variables
+     */
+    cConfigPortEmulator();
+
+    /** @fn ~cConfigPortEmulator()
+     * @brief This destructor function is to stop the data stream and <!--
+     * --> release the socket
+     */
+    ~cConfigPortEmulator();
+
+    /** @fn void setDefaultConfig(strConfigEmuConfig *psConfig)
+     * @brief This function is to fill the emulator configuration with <!--
+     * --> default values
+     * @param [out] psConfig [strConfigEmuConfig *] - Configuration structure
+     */
+    static void setDefaultConfig(strConfigEmuConfig *psConfig);
+
+    /** @fn STATUS open(const strConfigEmuConfig *psConfig)
+     * @brief This function is to validate the configuration and bind the <!--
+     * --> config port
+     * @param [in] psConfig [const strConfigEmuConfig *] - Configuration structure
+     * @return SINT32 value
+     */
+    STATUS open(const strConfigEmuConfig *psConfig);
+
+    /** @fn void run()
+     * @brief This function is to serve the config port till stop is requested
+     */
+    void run();
+
+    /** @fn void stop()
+     * @brief This function is to request the config port loop to exit
+     */
+    void stop();
+
+    /** @fn void requestAsyncStatus(UINT16 u16StatusBit)
+     * @brief This function is to queue an async status to the record PC. <!--
+     * --> It is safe to call from signal handlers and other threads
+     * @param [in] u16StatusBit [UINT16] - Status bit (SYS_ASYNC_STATUS)
+     */
+    void requestAsyncStatus(UINT16 u16StatusBit);
+
+    /** @fn void requestStreamStop()
+     * @brief This function is to stop the data stream without a stop <!--
+     * --> record command (emulates the LVDS data stopping)
+     */
+    void requestStreamStop();
+
+    /** @fn STATUS getDataStats(UINT32 u32PortIndex, strDataEmuStats *psStats)
+     * @brief This function is to read the statistics of the last data <!--
+     * --> stream sent to one of the data ports
+     * @param [in] u32PortIndex [UINT32] - Data port index (0 - data port)
+     * @param [out] psStats [strDataEmuStats *] - Statistics structure
+     * @return SINT32 value
+     */
+    STATUS getDataStats(UINT32 u32PortIndex, strDataEmuStats *psStats);
+
+    /** @fn void printStats()
+     * @brief This function is to print the command and stream statistics
+     */
+    void printStats();
+
+private:
+
+    /** @fn void handleRequest(UINT8 *pu8Buf, SINT32 s32Len)
+     * @brief This function is to decode one command request and respond
+     * @param [in] pu8Buf [UINT8 *] - Request packet
+     * @param [in] s32Len [SINT32] - Request packet length
+     */
+    void handleRequest(UINT8 *pu8Buf, SINT32 s32Len);
+
+    /** @fn void sendResponse(UINT16 u16CmdCode, UINT16 u16Status)
+     * @brief This function is to send a DATA_CAPTURE_RESP packet to the <!--
+     * --> record PC
+     * @param [in] u16CmdCode [UINT16] - Command code
+     * @param [in] u16Status [UINT16] - Command status
+     */
+    void sendResponse(UINT16 u16CmdCode, UINT16 u16Status);
+
+    /** @fn void startDataStream()
+     * @brief This function is to start one data stream emulator thread <!--
+     * --> per data port
+     */
+    void startDataStream();
+
+    /** @fn void stopDataStream()
+     * @brief This function is to stop and join the data stream emulator threads
+     */
+    void stopDataStream();
+
+    /** @fn void processPendingEvents()
+     * @brief This function is to send queued / scheduled async status and <!--
+     * --> handle the end of the data stream
+     */
+    void processPendingEvents();
+
+    /** Emulator configuration              */
+    strConfigEmuConfig sConfig;
+
+    /** Config port socket                  */
+    SINT32 s32ConfigSock;
+
+    /** Address of the last command sender (record PC) */
+    struct sockaddr_in hostAddr;
+
+    /** Command sender address is known     */
+    bool bHostAddrValid;
+
+    /** Data stream emulator per data port  */
+    cDataStreamEmulator objDataEmu[NUM_DATA_TYPES];
+
+    /** Data stream thread per data port    */
+    std::thread dataThread[NUM_DATA_TYPES];
+
+    /** Number of data streams not yet returned */
+    std::atomic<UINT32> u32NumOfStreamsRunning;
+
+    /** Data stream is started by start record */
+    bool bRecording;
+
+    /** All data stream threads returned    */
+    std::atomic<bool> bStreamEnded;
+
+    /** Start record time for the scheduled async status */
+    struct timespec recStartTime;
+
+    /** Scheduled async status is pending   */
+    bool bAsyncAfterPending;
+
+    /** Queued async status bits            */
+    std::atomic<UINT32> u32PendingAsyncStatus;
+
+    /** Stream stop request from console    */
+    std::atomic<bool> bStreamStopRequested;
+
+    /** Stop request flag                   */
+    std::atomic<bool> bStopRequested;
+
+    /** Last FPGA config command payload    */
+    UINT8 u8FpgaConfig[EMU_FPGA_CONFIG_DATA_SIZE];
+
+    /** Number of requests per command code */
+    ULONG64 u64NumOfCmds[EMU_NUM_OF_CMD_CODES];
+
+    /** Number of invalid request packets   */
+    ULONG64 u64NumOfInvalidPkts;
+
+    /** Number of async status packets sent */
+    ULONG64 u64NumOfAsyncSent;
+};
+
+#endif // CONFIGEMULATOR_H
@@ -0,0 +1,667 @@
+/**
+ * @file dataemulator.cpp
+ *
+ * @author JP
+ *
+ * @version 0.2
+ *
+ * @brief This file contains definitions for emulating the DCA1000EVM
+ * data port stream (sequence number, byte counter and payload) over UDP
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+/// 0.2            19 Oct 2026       JP          Option parsing shared with
+///                                              config port emulator
+///*****************************************************************************
+
+///****************
+/// Includes
+///****************
+
+#include <errno.h>
+#include <time.h>
+
+#include "dataemulator.h"
+#include "../Common/Validate_Utils/validate_params.h"
+
+/** @fn DOUBLE elapsedSec(const struct timespec *psStart)
+ * @brief This function is to compute the seconds elapsed since the given <!--
+ * --> monotonic time
+ * @param [in] psStart [const struct timespec *] - Start time
+ * @return DOUBLE value
+ */
+static DOUBLE elapsedSec(const struct timespec *psStart)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (DOUBLE)(now.tv_sec - psStart->tv_sec) +
+           ((DOUBLE)(now.tv_nsec - psStart->tv_nsec) / 1e9);
+}
+
+/** @fn void ListOfDataEmuOptions()
+ * @brief This function is to list the data stream emulator options
+ */
+void ListOfDataEmuOptions()
+{
+    printf("\n%s <addr>\t\t%s", EMU_OPT_DEST_IP,
+           "Destination IP address (default " EMU_DEFAULT_DEST_IP_ADDR ")");
+    printf("\n%s <addr>\t\t%s", EMU_OPT_SRC_IP,
+           "Source IP address (default any local address)");
+    printf("\n%s <port>\t\t%s (default %d)", EMU_OPT_DEST_PORT,
+           "Destination data port", EMU_DEFAULT_DATA_PORT);
+    printf("\n%s <path>\t\t%s", EMU_OPT_REPLAY_FILE,
+           "Replay recorded .bin file (default synthetic 16 bit ramp)");
+    printf("\n%s\t\t\t%s", EMU_OPT_LOOP, "Loop the replay file");
+    printf("\n%s <bytes>\t\t%s (default %d)", EMU_OPT_PAYLOAD_SIZE,
+           "Payload bytes per packet", PAYLOAD_BYTES_PER_PACKET);
+    printf("\n%s <MB/s>\t\t%s", EMU_OPT_RATE, "Payload rate (default unpaced)");
+    printf("\n%s <bytes>\t\t%s", EMU_OPT_BYTES, "Payload bytes to send");
+    printf("\n%s <ms>\t\t%s", EMU_OPT_DURATION, "Streaming duration");
+    printf("\n%s <num>\t\t%s (default %d)", EMU_OPT_START_SEQ,
+           "First sequence number", EMU_FIRST_SEQ_NUM);
+    printf("\n%s <%%>\t\t%s", EMU_OPT_LOSS, "Packet loss probability");
+    printf("\n%s <%%>\t\t%s", EMU_OPT_REORDER, "Packet reorder probability");
+    printf("\n%s <num>\t%s", EMU_OPT_REORDER_DIST,
+           "Packets a reordered packet is delayed by (default 1)");
+    printf("\n%s <%%>\t\t%s", EMU_OPT_DUPLICATE,
+           "Packet duplication probability");
+    printf("\n%s <num>\t\t%s", EMU_OPT_SEED, "Impairment random seed");
+    printf("\n%s <num>\t\t%s (default %d)", EMU_OPT_BATCH,
+           "Datagrams per sendmmsg call", EMU_DEFAULT_BATCH_SIZE);
+}
+
+/** @fn SINT32 ParseDataEmuOption(SINT32 argc, SINT8 *argv[], <!--
+ * -->                           SINT32 *ps32Index, strDataEmuConfig *psConfig)
+ * @brief This function is to parse one data stream emulator option <!--
+ * --> (and its value) from the command line
+ * @param [in] argc [SINT32] - Number of arguments
+ * @param [in] argv [SINT8 *[]] - Arguments
+ * @param [in,out] ps32Index [SINT32 *] - Index of option, moved to its value
+ * @param [out] psConfig [strDataEmuConfig *] - Configuration structure
+ * @return SINT32 value (SUCCESS_STATUS if parsed, FAILURE_STATUS if <!--
+ * --> not a data stream option, STS_RFDCCARD_INVALID_INPUT_PARAMS if <!--
+ * --> the value is missing)
+ */
+SINT32 ParseDataEmuOption(SINT32 argc, SINT8 *argv[], SINT32 *ps32Index,
+                          strDataEmuConfig *psConfig)
+{
+    SINT32 i = *ps32Index;
+    const SINT8 *s8Option = argv[i];
+
+    if (strcmp(s8Option, EMU_OPT_LOOP) == 0)
+    {
+        psConfig->bLoopReplay = true;
+        return SUCCESS_STATUS;
+    }
+
+    if ((strcmp(s8Option, EMU_OPT_DEST_IP) != 0) &&
+        (strcmp(s8Option, EMU_OPT_SRC_IP) != 0) &&
+        (strcmp(s8Option, EMU_OPT_DEST_PORT) != 0) &&
+        (strcmp(s8Option, EMU_OPT_REPLAY_FILE) != 0) &&
+        (strcmp(s8Option, EMU_OPT_PAYLOAD_SIZE) != 0) &&
+        (strcmp(s8Option, EMU_OPT_RATE) != 0) &&
+        (strcmp(s8Option, EMU_OPT_BYTES) != 0) &&
+        (strcmp(s8Option, EMU_OPT_DURATION) != 0) &&
+        (strcmp(s8Option, EMU_OPT_START_SEQ) != 0) &&
+        (strcmp(s8Option, EMU_OPT_LOSS) != 0) &&
+        (strcmp(s8Option, EMU_OPT_REORDER) != 0) &&
+        (strcmp(s8Option, EMU_OPT_REORDER_DIST) != 0) &&
+        (strcmp(s8Option, EMU_OPT_DUPLICATE) != 0) &&
+        (strcmp(s8Option, EMU_OPT_SEED) != 0) &&
+        (strcmp(s8Option, EMU_OPT_BATCH) != 0))
+    {
+        return FAILURE_STATUS;
+    }
+
+    /** All remaining options take a value */
+    if ((i + 1) >= argc)
+    {
+        printf("\nMissing value for option %s\n", s8Option);
+        return STS_RFDCCARD_INVALID_INPUT_PARAMS;
+    }
+    const SINT8 *s8Value = argv[++i];
+    *ps32Index = i;
+
+    if (strcmp(s8Option, EMU_OPT_DEST_IP) == 0)
+        strncpy(psConfig->s8DestIpAddr, s8Value, IP_ADDR_MAX_SIZE_BYTES - 1);
+    else if (strcmp(s8Option, EMU_OPT_SRC_IP) == 0)
+        strncpy(psConfig->s8SrcIpAddr, s8Value, IP_ADDR_MAX_SIZE_BYTES - 1);
+    else if (strcmp(s8Option, EMU_OPT_DEST_PORT) == 0)
+        psConfig->u32DestPort = (UINT32)atol(s8Value);
+    else if (strcmp(s8Option, EMU_OPT_REPLAY_FILE) == 0)
+        strncpy(psConfig->s8ReplayFile, s8Value, MAX_NAME_LEN - 1);
+    else if (strcmp(s8Option, EMU_OPT_PAYLOAD_SIZE) == 0)
+        psConfig->u16PayloadSize = (UINT16)atol(s8Value);
+    else if (strcmp(s8Option, EMU_OPT_RATE) == 0)
+        psConfig->dRateMBps = atof(s8Value);
+    else if (strcmp(s8Option, EMU_OPT_BYTES) == 0)
+        psConfig->u64BytesToSend = strtoull(s8Value, NULL, 10);
+    else if (strcmp(s8Option, EMU_OPT_DURATION) == 0)
+        psConfig->u32DurationMs = (UINT32)atol(s8Value);
+    else if (strcmp(s8Option, EMU_OPT_START_SEQ) == 0)
+        psConfig->u32StartSeqNum = (UINT32)strtoul(s8Value, NULL, 10);
+    else if (strcmp(s8Option, EMU_OPT_LOSS) == 0)
+        psConfig->dLossPercent = atof(s8Value);
+    else if (strcmp(s8Option, EMU_OPT_REORDER) == 0)
+        psConfig->dReorderPercent = atof(s8Value);
+    else if (strcmp(s8Option, EMU_OPT_REORDER_DIST) == 0)
+        psConfig->u32ReorderDistance = (UINT32)atol(s8Value);
+    else if (strcmp(s8Option, EMU_OPT_DUPLICATE) == 0)
+        psConfig->dDuplicatePercent = atof(s8Value);
+    else if (strcmp(s8Option, EMU_OPT_SEED) == 0)
+        psConfig->u32Seed = (UINT32)strtoul(s8Value, NULL, 10);
+    else
+        psConfig->u32BatchSize = (UINT32)atol(s8Value);
+
+    return SUCCESS_STATUS;
+}
+
+/** @fn cDataStreamEmulator::cDataStreamEmulator()
+ * @brief This constructor function is to initialize the class member variables
+ */
+cDataStreamEmulator::cDataStreamEmulator()
+{
+    setDefaultConfig(&sConfig);
+    memset(&sStats, 0, sizeof(strDataEmuStats));
+    s32DataSock = -1;
+    pReplayFile = NULL;
+    u16PatternSample = 0;
+    bStopRequested = false;
+    bRunning = false;
+}
+
+/** @fn cDataStreamEmulator::~cDataStreamEmulator()
+ * @brief This destructor function is to release the socket and file
+ */
+cDataStreamEmulator::~cDataStreamEmulator()
+{
+    if (s32DataSock >= 0)
+        close(s32DataSock);
+    if (NULL != pReplayFile)
+        fclose(pReplayFile);
+}
+
+/** @fn void cDataStreamEmulator::setDefaultConfig(strDataEmuConfig *psConfig)
+ * @brief This function is to fill the emulator configuration with <!--
+ * --> default values
+ * @param [out] psConfig [strDataEmuConfig *] - Configuration structure
+ */
+void cDataStreamEmulator::setDefaultConfig(strDataEmuConfig *psConfig)
+{
+    memset(psConfig, 0, sizeof(strDataEmuConfig));
+    strcpy(psConfig->s8DestIpAddr, EMU_DEFAULT_DEST_IP_ADDR);
+    psConfig->u32DestPort = EMU_DEFAULT_DATA_PORT;
+    psConfig->u16PayloadSize = PAYLOAD_BYTES_PER_PACKET;
+    psConfig->u32StartSeqNum = EMU_FIRST_SEQ_NUM;
+    psConfig->u32ReorderDistance = 1;
+    psConfig->u32Seed = 1;
+    psConfig->u32BatchSize = EMU_DEFAULT_BATCH_SIZE;
+}
+
+/** @fn STATUS cDataStreamEmulator::setConfig(const strDataEmuConfig *psConfig)
+ * @brief This function is to validate and store the emulator configuration
+ * @param [in] psConfig [const strDataEmuConfig *] - Configuration structure
+ * @return SINT32 value
+ */
+STATUS cDataStreamEmulator::setConfig(const strDataEmuConfig *psConfig)
+{
+    SINT8 s8IpAddr[IP_ADDR_MAX_SIZE_BYTES];
+
+    if (bRunning)
+        return STS_RFDCCARD_INVALID_INPUT_PARAMS;
+
+    strcpy(s8IpAddr, psConfig->s8DestIpAddr);
+    if ((SUCCESS_STATUS != validateIpAddress(s8IpAddr)) ||
+        (SUCCESS_STATUS != validatePortNumber(psConfig->u32DestPort)))
+    {
+        printf("\nDataStreamEmulator: Invalid destination %s:%u",
+               psConfig->s8DestIpAddr, psConfig->u32DestPort);
+        return STS_RFDCCARD_INVALID_INPUT_PARAMS;
+    }
+
+    strcpy(s8IpAddr, psConfig->s8SrcIpAddr);
+    if ((strlen(s8IpAddr) > 0) &&
+        (SUCCESS_STATUS != validateIpAddress(s8IpAddr)))
+    {
+        printf("\nDataStreamEmulator: Invalid source %s",
+               psConfig->s8SrcIpAddr);
+        return STS_RFDCCARD_INVALID_INPUT_PARAMS;
+    }
+
+    if ((psConfig->u16PayloadSize == 0) ||
+        (psConfig->u16PayloadSize > PAYLOAD_BYTES_PER_PACKET))
+    {
+        printf("\nDataStreamEmulator: Invalid payload size %u (1 - %u)",
+               psConfig->u16PayloadSize, PAYLOAD_BYTES_PER_PACKET);
+        return STS_RFDCCARD_INVALID_INPUT_PARAMS;
+    }
+
+    if ((psConfig->u32BatchSize == 0) ||
+        (psConfig->u32BatchSize > EMU_MAX_BATCH_SIZE))
+    {
+        printf("\nDataStreamEmulator: Invalid batch size %u (1 - %u)",
+               psConfig->u32BatchSize, EMU_MAX_BATCH_SIZE);
+        return STS_RFDCCARD_INVALID_INPUT_PARAMS;
+    }
+
+    if ((psConfig->dRateMBps < 0) ||
+        (psConfig->dLossPercent < 0) ||
+        (psConfig->dLossPercent > EMU_PERCENT_SCALE) ||
+        (psConfig->dReorderPercent < 0) ||
+        (psConfig->dReorderPercent > EMU_PERCENT_SCALE) ||
+        (psConfig->dDuplicatePercent < 0) ||
+        (psConfig->dDuplicatePercent > EMU_PERCENT_SCALE) ||
+        (psConfig->u32ReorderDistance == 0))
+    {
+        printf("\nDataStreamEmulator: Invalid rate or impairment settings");
+        return STS_RFDCCARD_INVALID_INPUT_PARAMS;
+    }
+
+    memcpy(&sConfig, psConfig, sizeof(strDataEmuConfig));
+    return STS_RFDCCARD_SUCCESS;
+}
+
+/** @fn void cDataStreamEmulator::stop()
+ * @brief This function is to request the streaming loop to exit
+ */
+void cDataStreamEmulator::stop()
+{
+    bStopRequested = true;
+}
+
+/** @fn bool cDataStreamEmulator::isRunning()
+ * @brief This function is to read the streaming state
+ * @return boolean value
+ */
+bool cDataStreamEmulator::isRunning()
+{
+    return bRunning;
+}
+
+/** @fn void cDataStreamEmulator::getStats(strDataEmuStats *psStats)
+ * @brief This function is to read the streaming statistics
+ * @param [out] psStats [strDataEmuStats *] - Statistics structure
+ */
+void cDataStreamEmulator::getStats(strDataEmuStats *psStats)
+{
+    memcpy(psStats, &sStats, sizeof(strDataEmuStats));
+}
+
+/** @fn void cDataStreamEmulator::printStats()
+ * @brief This function is to print the streaming statistics in the console
+ */
+void cDataStreamEmulator::printStats()
+{
+    DOUBLE dRate = 0;
+
+    if (sStats.dElapsedSec > 0)
+        dRate = sStats.u64NumOfPayloadBytes / sStats.dElapsedSec /
+                EMU_BYTES_PER_MB;
+
+    printf("\nData stream emulator summary :");
+    printf("\nGenerated packets - %llu", sStats.u64NumOfGeneratedPackets);
+    printf("\nSent datagrams - %llu", sStats.u64NumOfSentPackets);
+    printf("\nPayload bytes - %llu", sStats.u64NumOfPayloadBytes);
+    printf("\nWire bytes - %llu", sStats.u64NumOfWireBytes);
+    printf("\nDropped packets - %llu", sStats.u64NumOfDroppedPackets);
+    printf("\nReordered packets - %llu", sStats.u64NumOfReorderedPackets);
+    printf("\nDuplicated packets - %llu", sStats.u64NumOfDuplicatedPackets);
+    printf("\nsendmmsg calls - %llu", sStats.u64NumOfSendCalls);
+    printf("\nLast sequence number - %u", sStats.u32LastSeqNum);
+    printf("\nDuration(sec) - %.3f", sStats.dElapsedSec);
+    printf("\nPayload rate(MB/s) - %.2f\n", dRate);
+}
+
+/** @fn bool cDataStreamEmulator::fillPayload(UINT8 *pu8Payload, UINT16 *pu16Size)
+ * @brief This function is to fill the payload of next packet from the <!--
+ * --> replay file or synthetic pattern
+ * @param [out] pu8Payload [UINT8 *] - Payload buffer
+ * @param [out] pu16Size [UINT16 *] - Payload size
+ * @return boolean value
+ */
+bool cDataStreamEmulator::fillPayload(UINT8 *pu8Payload, UINT16 *pu16Size)
+{
+    UINT16 u16Size = sConfig.u16PayloadSize;
+    size_t readSize = 0;
+
+    /** Trim the last packet to the configured number of bytes */
+    if (sConfig.u64BytesToSend != 0)
+    {
+        if (sStats.u64NumOfPayloadBytes >= sConfig.u64BytesToSend)
+            return false;
+        if ((sConfig.u64BytesToSend - sStats.u64NumOfPayloadBytes) < u16Size)
+            u16Size = (UINT16)(sConfig.u64BytesToSend -
+                               sStats.u64NumOfPayloadBytes);
+    }
+
+    if (NULL != pReplayFile)
+    {
+        readSize = fread(pu8Payload, 1, u16Size, pReplayFile);
+        if ((readSize == 0) && sConfig.bLoopReplay)
+        {
+            rewind(pReplayFile);
+            readSize = fread(pu8Payload, 1, u16Size, pReplayFile);
+        }
+        if (readSize == 0)
+            return false;
+        *pu16Size = (UINT16)readSize;
+    }
+    else
+    {
+        /** Synthetic pattern - 16 bit ramp continued across packets */
+        for (UINT16 u16Index = 0; u16Index < u16Size; u16Index += UINT16_DATA_SIZE)
+        {
+            pu8Payload[u16Index] = (UINT8)(u16PatternSample & 0xFF);
+            if ((u16Index + 1) < u16Size)
+                pu8Payload[u16Index + 1] = (UINT8)(u16PatternSample >> 8);
+            u16PatternSample++;
+        }
+        *pu16Size = u16Size;
+    }
+
+    return true;
+}
+
+/** @fn bool cDataStreamEmulator::generatePacket(strDataEmuPacket *psPacket)
+ * @brief This function is to build the next packet (sequence number, <!--
+ * --> byte counter and payload)
+ * @param [out] psPacket [strDataEmuPacket *] - Packet
+ * @return boolean value
+ */
+bool cDataStreamEmulator::generatePacket(strDataEmuPacket *psPacket)
+{
+    UINT16 u16PayloadSize = 0;
+    UINT32 u32SeqNum = sConfig.u32StartSeqNum +
+                       (UINT32)sStats.u64NumOfGeneratedPackets;
+
+    if (!fillPayload(&psPacket->u8Data[RECORD_DATA_BUF_INDEX], &u16PayloadSize))
+        return false;
+
+    /** Byte counter is the number of payload bytes sent before this packet */
+    memcpy(&psPacket->u8Data[0], &u32SeqNum, UINT32_DATA_SIZE);
+    memcpy(&psPacket->u8Data[UINT32_DATA_SIZE], &sStats.u64NumOfPayloadBytes,
+           EMU_BYTE_COUNT_FIELD_SIZE);
+    psPacket->u16Len = RECORD_DATA_BUF_INDEX + u16PayloadSize;
+
+    sStats.u64NumOfGeneratedPackets++;
+    sStats.u64NumOfPayloadBytes += u16PayloadSize;
+    sStats.u32LastSeqNum = u32SeqNum;
+    return true;
+}
+
+/** @fn bool cDataStreamEmulator::isImpaired(DOUBLE dPercent)
+ * @brief This function is to decide randomly if an impairment is applied
+ * @param [in] dPercent [DOUBLE] - Probability in percent
+ * @return boolean value
+ */
+bool cDataStreamEmulator::isImpaired(DOUBLE dPercent)
+{
+    if (dPercent <= 0)
+        return false;
+
+    std::uniform_real_distribution<DOUBLE> dist(0, EMU_PERCENT_SCALE);
+    return (dist(randGen) < dPercent);
+}
+
+/** @fn void cDataStreamEmulator::paceBatch()
+ * @brief This function is to wait till the configured rate allows the <!--
+ * --> bytes generated so far to be sent
+ */
+void cDataStreamEmulator::paceBatch()
+{
+    if (sConfig.dRateMBps <= 0)
+        return;
+
+    DOUBLE dDeadlineSec = sStats.u64NumOfPayloadBytes /
+                          (sConfig.dRateMBps * EMU_BYTES_PER_MB);
+    DOUBLE dAheadSec = dDeadlineSec - elapsedSec(&startTime);
+
+    /** Sleep for coarse waits and spin for the last few microseconds */
+    while (dAheadSec > 0)
+    {
+        if (dAheadSec * 1e6 > EMU_PACING_SLEEP_THRESHOLD_US)
+            usleep((useconds_t)(dAheadSec * 1e6) - EMU_PACING_SLEEP_THRESHOLD_US);
+        dAheadSec = dDeadlineSec - elapsedSec(&startTime);
+    }
+}
+
+/** @fn STATUS cDataStreamEmulator::sendBatch(UINT32 u32NumOfPackets)
+ * @brief This function is to send the batched packets with sendmmsg
+ * @param [in] u32NumOfPackets [UINT32] - Number of packets in the batch
+ * @return SINT32 value
+ */
+STATUS cDataStreamEmulator::sendBatch(UINT32 u32NumOfPackets)
+{
+    struct sockaddr_in destAddr;
+    struct mmsghdr msgs[EMU_MAX_BATCH_SIZE];
+    struct iovec iovecs[EMU_MAX_BATCH_SIZE];
+    UINT32 u32Sent = 0;
+    UINT32 u32Chunk = 0;
+    SINT32 s32Result = 0;
+
+    memset(&destAddr, 0, sizeof(destAddr));
+    destAddr.sin_family = AF_INET;
+    destAddr.sin_port = htons((UINT16)sConfig.u32DestPort);
+    destAddr.sin_addr.s_addr = inet_addr(sConfig.s8DestIpAddr);
+
+    while (u32Sent < u32NumOfPackets)
+    {
+        u32Chunk = u32NumOfPackets - u32Sent;
+        if (u32Chunk > EMU_MAX_BATCH_SIZE)
+            u32Chunk = EMU_MAX_BATCH_SIZE;
+
+        memset(msgs, 0, u32Chunk * sizeof(struct mmsghdr));
+        for (UINT32 i = 0; i < u32Chunk; i++)
+        {
+            iovecs[i].iov_base = batchPackets[u32Sent + i].u8Data;
+            iovecs[i].iov_len = batchPackets[u32Sent + i].u16Len;
+            msgs[i].msg_hdr.msg_iov = &iovecs[i];
+            msgs[i].msg_hdr.msg_iovlen = 1;
+            msgs[i].msg_hdr.msg_name = &destAddr;
+            msgs[i].msg_hdr.msg_namelen = sizeof(destAddr);
+        }
+
+        s32Result = sendmmsg(s32DataSock, msgs, u32Chunk, 0);
+        sStats.u64NumOfSendCalls++;
+
+        if (s32Result < 0)
+        {
+            /** Socket send buffer full - let the kernel drain and retry */
+            if ((errno == ENOBUFS) || (errno == EAGAIN) || (errno == EINTR))
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            printf("\nDataStreamEmulator: sendmmsg failed : %d", errno);
+            return STS_RFDCCARD_UDP_WRITE_ERR;
+        }
+
+        for (SINT32 i = 0; i < s32Result; i++)
+            sStats.u64NumOfWireBytes += msgs[i].msg_len;
+        sStats.u64NumOfSentPackets += s32Result;
+        u32Sent += s32Result;
+    }
+
+    return STS_RFDCCARD_SUCCESS;
+}
+
+/** @fn STATUS cDataStreamEmulator::run()
+ * @brief This function is to stream the data packets till the configured <!--
+ * --> bytes/duration is reached, the replay file ends or stop is requested
+ * @return SINT32 value
+ */
+STATUS cDataStreamEmulator::run()
+{
+    STATUS s32Status = STS_RFDCCARD_SUCCESS;
+    strDataEmuPacket sPacket;
+    bool bEndOfStream = false;
+    SINT32 s32SendBufSize = SOCK_SEND_BUF_SIZE;
+
+    memset(&sStats, 0, sizeof(strDataEmuStats));
+    u16PatternSample = 0;
+    heldPackets.clear();
+    batchPackets.clear();
+    batchPackets.reserve(2 * sConfig.u32BatchSize + 1);
+    randGen.seed(sConfig.u32Seed);
+    bStopRequested = false;
+
+    if (sConfig.s8ReplayFile[0] != '\0')
+    {
+        pReplayFile = fopen(sConfig.s8ReplayFile, "rb");
+        if (NULL == pReplayFile)
+        {
+            printf("\nDataStreamEmulator: Unable to open %s",
+                   sConfig.s8ReplayFile);
+            return STS_RFDCCARD_INVALID_INPUT_PARAMS;
+        }
+    }
+
+    s32DataSock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (s32DataSock < 0)
+    {
+        printf("\nDataStreamEmulator: Socket creation failed : %d", errno);
+        return STS_RFDCCARD_OS_ERR;
+    }
+    setsockopt(s32DataSock, SOL_SOCKET, SO_SNDBUF,
+               (SINT8 *)&s32SendBufSize, sizeof(s32SendBufSize));
+
+    /** Emulated systems sharing a data port are told apart by source IP */
+    if (strlen(sConfig.s8SrcIpAddr) > 0)
+    {
+        struct sockaddr_in srcAddr;
+        memset(&srcAddr, 0, sizeof(srcAddr));
+        srcAddr.sin_family = AF_INET;
+        srcAddr.sin_addr.s_addr = inet_addr(sConfig.s8SrcIpAddr);
+        if (bind(s32DataSock, (struct sockaddr *)&srcAddr, sizeof(srcAddr)) < 0)
+        {
+            printf("\nDataStreamEmulator: Bind to %s failed : %d",
+                   sConfig.s8SrcIpAddr, errno);
+            close(s32DataSock);
+            s32DataSock = -1;
+            return STS_RFDCCARD_OS_ERR;
+        }
+    }
+
+    bRunning = true;
+    clock_gettime(CLOCK_MONOTONIC, &startTime);
+
+    while (!bStopRequested && !bEndOfStream)
+    {
+        batchPackets.clear();
+
+        /** Build one batch, applying loss / reorder / duplicate impairments */
+        while (batchPackets.size() < sConfig.u32BatchSize)
+        {
+            if ((sConfig.u32DurationMs != 0) &&
+                (elapsedSec(&startTime) * SEC_TO_MILLI_SEC_CONVERSION >=
+                 sConfig.u32DurationMs))
+            {
+                bEndOfStream = true;
+                break;
+            }
+
+            if (!generatePacket(&sPacket))
+            {
+                bEndOfStream = true;
+                break;
+            }
+
+            if (isImpaired(sConfig.dLossPercent))
+            {
+                sStats.u64NumOfDroppedPackets++;
+                continue;
+            }
+
+            if (isImpaired(sConfig.dReorderPercent))
+            {
+                heldPackets.push_back(std::make_pair(
+                    sConfig.u32ReorderDistance, sPacket));
+                sStats.u64NumOfReorderedPackets++;
+                continue;
+            }
+
+            batchPackets.push_back(sPacket);
+            if (isImpaired(sConfig.dDuplicatePercent))
+            {
+                batchPackets.push_back(sPacket);
+                sStats.u64NumOfDuplicatedPackets++;
+            }
+
+            /** Release the held packets once enough newer packets went out */
+            for (size_t i = 0; i < heldPackets.size(); i++)
+                heldPackets[i].first--;
+            while (!heldPackets.empty() && (heldPackets.front().first == 0))
+            {
+                batchPackets.push_back(heldPackets.front().second);
+                heldPackets.pop_front();
+            }
+        }
+
+        /** Flush the held packets at end of stream */
+        if (bEndOfStream || bStopRequested)
+        {
+            while (!heldPackets.empty())
+            {
+                batchPackets.push_back(heldPackets.front().second);
+                heldPackets.pop_front();
+            }
+        }
+
+        if (batchPackets.empty())
+            continue;
+
+        paceBatch();
+
+        s32Status = sendBatch((UINT32)batchPackets.size());
+        if (s32Status != STS_RFDCCARD_SUCCESS)
+            break;
+    }
+
+    sStats.dElapsedSec = elapsedSec(&startTime);
+
+    close(s32DataSock);
+    s32DataSock = -1;
+    if (NULL != pReplayFile)
+    {
+        fclose(pReplayFile);
+        pReplayFile = NULL;
+    }
+
+    bRunning = false;
+    return s32Status;
+}
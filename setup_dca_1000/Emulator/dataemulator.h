@@ -0,0 +1,420 @@
+/**
+ * @file dataemulator.h
+ *
+ * @author JP
+ *
+ * @version 0.2
+ *
+ * @brief This file contains declarations for emulating the DCA1000EVM
+ * data port stream (sequence number, byte counter and payload) over UDP
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+/// 0.2            19 Oct 2026       JP          Option parsing shared with
+///                                              config port emulator
+///*****************************************************************************
+
+#ifndef DATAEMULATOR_H
+#define DATAEMULATOR_H
+
+///****************
+/// Includes
+///****************
+
+/** System headers are included ahead of the API headers, which set
+ * pragma pack(1); sendmmsg structures must keep the kernel layout           */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <atomic>
+#include <deque>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "../Common/rf_api_internal.h"
+#include "../RF_API/defines.h"
+
+///****************
+/// Defines
+///****************
+
+/** Default destination IP address of the emulated data stream               */
+#define EMU_DEFAULT_DEST_IP_ADDR            "127.0.0.1"
+
+/** Default destination data port (same as DCA1000DataPort in JSON)          */
+#define EMU_DEFAULT_DATA_PORT               4098
+
+/** Default number of datagrams handed to the kernel per sendmmsg call       */
+#define EMU_DEFAULT_BATCH_SIZE              32
+
+/** Maximum number of datagrams handed to the kernel per sendmmsg call       */
+#define EMU_MAX_BATCH_SIZE                  1024
+
+/** Size of the byte counter field in the data packet header                 */
+#define EMU_BYTE_COUNT_FIELD_SIZE           6
+
+/** First sequence number sent by the DCA1000EVM FPGA                        */
+#define EMU_FIRST_SEQ_NUM                   1
+
+/** Sleep instead of spinning if the pacing deadline is further than this    */
+#define EMU_PACING_SLEEP_THRESHOLD_US       200
+
+/** Bytes per megabyte used for the configured rate (MB/s)                   */
+#define EMU_BYTES_PER_MB                    1000000.0
+
+/** Percentage scale used for the impairment probabilities                   */
+#define EMU_PERCENT_SCALE                   100.0
+
+/** Option - Destination IP address                                         */
+#define EMU_OPT_DEST_IP "--ip"
+
+/** Option - Source IP address of the stream                               */
+#define EMU_OPT_SRC_IP "--src-ip"
+
+/** Option - Destination data port                                          */
+#define EMU_OPT_DEST_PORT "--port"
+
+/** Option - Recorded file to replay                                        */
+#define EMU_OPT_REPLAY_FILE "--file"
+
+/** Option - Loop the replay file                                           */
+#define EMU_OPT_LOOP "--loop"
+
+/** Option - Payload bytes per packet                                       */
+#define EMU_OPT_PAYLOAD_SIZE "--size"
+
+/** Option - Payload rate in MB/s                                           */
+#define EMU_OPT_RATE "--rate"
+
+/** Option - Payload bytes to send                                          */
+#define EMU_OPT_BYTES "--bytes"
+
+/** Option - Streaming duration in millisec                                 */
+#define EMU_OPT_DURATION "--duration"
+
+/** Option - First sequence number                                          */
+#define EMU_OPT_START_SEQ "--seq"
+
+/** Option - Packet loss in percent                                         */
+#define EMU_OPT_LOSS "--loss"
+
+/** Option - Packet reordering in percent                                   */
+#define EMU_OPT_REORDER "--reorder"
+
+/** Option - Packet reordering distance                                     */
+#define EMU_OPT_REORDER_DIST "--reorder-dist"
+
+/** Option - Packet duplication in percent                                  */
+#define EMU_OPT_DUPLICATE "--dup"
+
+/** Option - Random seed                                                    */
+#define EMU_OPT_SEED "--seed"
+
+/** Option - Datagrams per sendmmsg call                                    */
+#define EMU_OPT_BATCH "--batch"
+
+/** Option - Help                                                           */
+#define EMU_OPT_HELP "-h"
+
+///****************
+/// Stucture Declarations
+///****************
+
+/** Data stream emulator configuration                                       */
+typedef struct
+{
+    /** Destination IP address of the record PC                              */
+    SINT8 s8DestIpAddr[IP_ADDR_MAX_SIZE_BYTES];
+
+    /** Destination data port                                                */
+    UINT32 u32DestPort;
+
+    /** Source IP address of the stream (empty for any local address)        */
+    SINT8 s8SrcIpAddr[IP_ADDR_MAX_SIZE_BYTES];
+
+    /** Recorded .bin file to replay (empty for synthetic pattern)           */
+    SINT8 s8ReplayFile[MAX_NAME_LEN];
+
+    /** Restart the replay file from the beginning at end of file            */
+    bool bLoopReplay;
+
+    /** Payload bytes per packet (1 - PAYLOAD_BYTES_PER_PACKET)              */
+    UINT16 u16PayloadSize;
+
+    /** Payload rate in MB/s (0 for unpaced)                                 */
+    DOUBLE dRateMBps;
+
+    /** Payload bytes to send (0 for no limit)                               */
+    ULONG64 u64BytesToSend;
+
+    /** Streaming duration in millisec (0 for no limit)                      */
+    UINT32 u32DurationMs;
+
+    /** Sequence number of the first packet                                  */
+    UINT32 u32StartSeqNum;
+
+    /** Probability of dropping a packet in percent                          */
+    DOUBLE dLossPercent;
+
+    /** Probability of delaying a packet in percent                          */
+    DOUBLE dReorderPercent;
+
+    /** Number of packets a reordered packet is delayed by                   */
+    UINT32 u32ReorderDistance;
+
+    /** Probability of sending a packet twice in percent                     */
+    DOUBLE dDuplicatePercent;
+
+    /** Seed for the impairment random generator                             */
+    UINT32 u32Seed;
+
+    /** Number of datagrams per sendmmsg call                                */
+    UINT32 u32BatchSize;
+
+}strDataEmuConfig;
+
+/** Data stream emulator statistics                                          */
+typedef struct
+{
+    /** Number of packets generated (including the dropped ones)             */
+    ULONG64 u64NumOfGeneratedPackets;
+
+    /** Number of datagrams handed to the kernel                             */
+    ULONG64 u64NumOfSentPackets;
+
+    /** Number of payload bytes generated (byte counter of next packet)      */
+    ULONG64 u64NumOfPayloadBytes;
+
+    /** Number of bytes handed to the kernel including packet headers        */
+    ULONG64 u64NumOfWireBytes;
+
+    /** Number of packets dropped on purpose                                 */
+    ULONG64 u64NumOfDroppedPackets;
+
+    /** Number of packets sent out of order on purpose                       */
+    ULONG64 u64NumOfReorderedPackets;
+
+    /** Number of packets sent twice on purpose                              */
+    ULONG64 u64NumOfDuplicatedPackets;
+
+    /** Number of sendmmsg calls                                             */
+    ULONG64 u64NumOfSendCalls;
+
+    /** Sequence number of the last generated packet                         */
+    UINT32 u32LastSeqNum;
+
+    /** Elapsed streaming time in sec                                        */
+    DOUBLE dElapsedSec;
+
+}strDataEmuStats;
+
+/** Emulated data packet (header followed by payload)                         */
+typedef struct
+{
+    /** Packet length in bytes                                               */
+    UINT16 u16Len;
+
+    /** Packet data                                                          */
+    UINT8 u8Data[MAX_BYTES_PER_PACKET];
+
+}strDataEmuPacket;
+
+///*****************
+/// API Declarations
+///*****************
+
+/** @fn void ListOfDataEmuOptions()
+ * @brief This function is to list the data stream emulator options
+ */
+void ListOfDataEmuOptions();
+
+/** @fn SINT32 ParseDataEmuOption(SINT32 argc, SINT8 *argv[], <!--
+ * -->                           SINT32 *ps32Index, strDataEmuConfig *psConfig)
+ * @brief This function is to parse one data stream emulator option <!--
+ * --> (and its value) from the command line
+ * @param [in] argc [SINT32] - Number of arguments
+ * @param [in] argv [SINT8 *[]] - Arguments
+ * @param [in,out] ps32Index [SINT32 *] - Index of option, moved to its value
+ * @param [out] psConfig [strDataEmuConfig *] - Configuration structure
+ * @return SINT32 value (SUCCESS_STATUS if parsed, FAILURE_STATUS if <!--
+ * --> not a data stream option, STS_RFDCCARD_INVALID_INPUT_PARAMS if <!--
+ * --> the value is missing)
+ */
+SINT32 ParseDataEmuOption(SINT32 argc, SINT8 *argv[], SINT32 *ps32Index,
+                          strDataEmuConfig *psConfig);
+
+/** @class cDataStreamEmulator
+ * @brief This class emulates the DCA1000EVM data port by streaming <!--
+ * --> sequence numbered packets with byte counter over UDP
+ */
+class cDataStreamEmulator
+{
+public:
+
+    /** @fn cDataStreamEmulator()
+     * @brief This constructor function is to initialize the class member variables
+     */
+    cDataStreamEmulator();
+
+    /** @fn ~cDataStreamEmulator()
+     * @brief This destructor function is to release the socket and file
+     */
+    ~cDataStreamEmulator();
+
+    /** @fn void setDefaultConfig(strDataEmuConfig *psConfig)
+     * @brief This function is to fill the emulator configuration with <!--
+     * --> default values
+     * @param [out] psConfig [strDataEmuConfig *] - Configuration structure
+     */
+    static void setDefaultConfig(strDataEmuConfig *psConfig);
+
+    /** @fn STATUS setConfig(const strDataEmuConfig *psConfig)
+     * @brief This function is to validate and store the emulator configuration
+     * @param [in] psConfig [const strDataEmuConfig *] - Configuration structure
+     * @return SINT32 value
+     */
+    STATUS setConfig(const strDataEmuConfig *psConfig);
+
+    /** @fn STATUS run()
+     * @brief This function is to stream the data packets till the configured <!--
+     * --> bytes/duration is reached, the replay file ends or stop is requested
+     * @return SINT32 value
+     */
+    STATUS run();
+
+    /** @fn void stop()
+     * @brief This function is to request the streaming loop to exit
+     */
+    void stop();
+
+    /** @fn bool isRunning()
+     * @brief This function is to read the streaming state
+     * @return boolean value
+     */
+    bool isRunning();
+
+    /** @fn void getStats(strDataEmuStats *psStats)
+     * @brief This function is to read the streaming statistics
+     * @param [out] psStats [strDataEmuStats *] - Statistics structure
+     */
+    void getStats(strDataEmuStats *psStats);
+
+    /** @fn void printStats()
+     * @brief This function is to print the streaming statistics in the console
+     */
+    void printStats();
+
+private:
+
+    /** @fn bool fillPayload(UINT8 *pu8Payload, UINT16 *pu16Size)
+     * @brief This function is to fill the payload of next packet from the <!--
+     * --> replay file or synthetic pattern
+     * @param [out] pu8Payload [UINT8 *] - Payload buffer
+     * @param [out] pu16Size [UINT16 *] - Payload size
+     * @return boolean value
+     */
+    bool fillPayload(UINT8 *pu8Payload, UINT16 *pu16Size);
+
+    /** @fn bool generatePacket(strDataEmuPacket *psPacket)
+     * @brief This function is to build the next packet (sequence number, <!--
+     * --> byte counter and payload)
+     * @param [out] psPacket [strDataEmuPacket *] - Packet
+     * @return boolean value
+     */
+    bool generatePacket(strDataEmuPacket *psPacket);
+
+    /** @fn bool isImpaired(DOUBLE dPercent)
+     * @brief This function is to decide randomly if an impairment is applied
+     * @param [in] dPercent [DOUBLE] - Probability in percent
+     * @return boolean value
+     */
+    bool isImpaired(DOUBLE dPercent);
+
+    /** @fn STATUS sendBatch(UINT32 u32NumOfPackets)
+     * @brief This function is to send the batched packets with sendmmsg
+     * @param [in] u32NumOfPackets [UINT32] - Number of packets in the batch
+     * @return SINT32 value
+     */
+    STATUS sendBatch(UINT32 u32NumOfPackets);
+
+    /** @fn void paceBatch()
+     * @brief This function is to wait till the configured rate allows the <!--
+     * --> bytes generated so far to be sent
+     */
+    void paceBatch();
+
+    /** Emulator configuration              */
+    strDataEmuConfig sConfig;
+
+    /** Emulator statistics                 */
+    strDataEmuStats sStats;
+
+    /** UDP socket connected to the record PC */
+    SINT32 s32DataSock;
+
+    /** Replay file handle                  */
+    FILE *pReplayFile;
+
+    /** Synthetic pattern sample counter    */
+    UINT16 u16PatternSample;
+
+    /** Stop request flag                   */
+    std::atomic<bool> bStopRequested;
+
+    /** Streaming state flag                */
+    std::atomic<bool> bRunning;
+
+    /** Impairment random generator         */
+    std::mt19937 randGen;
+
+    /** Packets held back for reordering with their release count */
+    std::deque<std::pair<UINT32, strDataEmuPacket> > heldPackets;
+
+    /** Packets of the current batch        */
+    std::vector<strDataEmuPacket> batchPackets;
+
+    /** Start time of streaming             */
+    struct timespec startTime;
+};
+
+#endif // DATAEMULATOR_H
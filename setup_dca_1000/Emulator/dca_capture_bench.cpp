@@ -0,0 +1,102 @@
+/**
+ * @file dca_capture_bench.cpp
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains the command line application which measures
+ * the capture throughput and loss of the record API against the emulated
+ * DCA1000EVM and writes the results as CSV
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+///****************
+/// Includes
+///****************
+
+#include "capturebench.h"
+
+///****************
+/// Variable declarations
+///****************
+
+/** Capture benchmark class object              */
+cCaptureBenchmark objCaptureBench;
+
+/** @fn void ListOfOptions()
+ * @brief This function is to list options supported by capture benchmark
+ */
+void ListOfOptions()
+{
+    printf("dca_capture_bench [options]");
+    printf("\n\nOptions:");
+    ListOfCaptureBenchOptions();
+    printf("\n%s\t\t\t%s\n", EMU_OPT_HELP, "List of options supported");
+}
+
+SINT32 main(SINT32 argc, SINT8 *argv[])
+{
+    strCaptureBenchConfig sConfig;
+
+    cCaptureBenchmark::setDefaultConfig(&sConfig);
+
+    for (SINT32 i = 1; i < argc; i++)
+    {
+        if (SUCCESS_STATUS != ParseCaptureBenchOption(argc, argv, &i, &sConfig))
+        {
+            if (strcmp(argv[i], EMU_OPT_HELP) != 0)
+                printf("\nInvalid option %s\n", argv[i]);
+            ListOfOptions();
+            return FAILURE_STATUS;
+        }
+    }
+
+    if (STS_RFDCCARD_SUCCESS != objCaptureBench.setConfig(&sConfig))
+    {
+        printf("\n");
+        return FAILURE_STATUS;
+    }
+
+    setvbuf(stdout, NULL, _IOLBF, 0);
+    STATUS s32Status = objCaptureBench.run();
+
+    return (s32Status == STS_RFDCCARD_SUCCESS) ? SUCCESS_STATUS : FAILURE_STATUS;
+}
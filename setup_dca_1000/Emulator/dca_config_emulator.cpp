@@ -0,0 +1,172 @@
+/**
+ * @file dca_config_emulator.cpp
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains the command line application which emulates
+ * the DCA1000EVM config port and data stream, so that the CLI control
+ * flow can be run against localhost
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+///****************
+/// Includes
+///****************
+
+#include <signal.h>
+
+#include "configemulator.h"
+
+///****************
+/// Variable declarations
+///****************
+
+/** Config port emulator class object           */
+cConfigPortEmulator objConfigEmu;
+
+/** @fn void ListOfOptions()
+ * @brief This function is to list options supported by config port emulator
+ */
+void ListOfOptions()
+{
+    printf("dca_config_emulator [options]");
+    printf("\n\nConfig port options:");
+    ListOfConfigEmuOptions();
+    printf("\n\nData stream options (started on start record):");
+    ListOfDataEmuOptions();
+    printf("\n%s\t\t\t%s", EMU_OPT_HELP, "List of options supported");
+    printf("\n\nConsole commands:");
+    printf("\n%s <bit>\t\t%s", EMU_CONSOLE_ASYNC,
+           "Send async status bit (8 - record completed)");
+    printf("\n%s\t\t\t%s", EMU_CONSOLE_STOP_STREAM, "Stop the data stream");
+    printf("\n%s\t\t\t%s", EMU_CONSOLE_STATS, "Print statistics");
+    printf("\n%s\t\t\t%s", EMU_CONSOLE_QUIT, "Exit");
+    printf("\n\nSIGUSR1 sends record completed, SIGUSR2 sends no LVDS data\n");
+}
+
+/** @fn void SignalHandler(SINT32 s32Signal)
+ * @brief This function is to exit on Ctrl+C and inject async status <!--
+ * --> on SIGUSR1 / SIGUSR2
+ * @param [in] s32Signal [SINT32] - Signal number
+ */
+void SignalHandler(SINT32 s32Signal)
+{
+    if (s32Signal == SIGUSR1)
+        objConfigEmu.requestAsyncStatus(STS_REC_COMPLETED);
+    else if (s32Signal == SIGUSR2)
+        objConfigEmu.requestAsyncStatus(STS_NO_LVDS_DATA);
+    else
+        objConfigEmu.stop();
+}
+
+/** @fn void ConsoleThread()
+ * @brief This function is a thread process to read console commands
+ */
+void ConsoleThread()
+{
+    SINT8 s8Line[MAX_PARAMS_LEN];
+    SINT8 s8Command[MAX_PARAMS_LEN];
+    UINT32 u32Value = 0;
+
+    while (NULL != fgets(s8Line, sizeof(s8Line), stdin))
+    {
+        if (sscanf(s8Line, "%99s %u", s8Command, &u32Value) < 1)
+            continue;
+
+        if (strcmp(s8Command, EMU_CONSOLE_ASYNC) == 0)
+            objConfigEmu.requestAsyncStatus((UINT16)u32Value);
+        else if (strcmp(s8Command, EMU_CONSOLE_STOP_STREAM) == 0)
+            objConfigEmu.requestStreamStop();
+        else if (strcmp(s8Command, EMU_CONSOLE_STATS) == 0)
+            objConfigEmu.printStats();
+        else if (strcmp(s8Command, EMU_CONSOLE_QUIT) == 0)
+        {
+            objConfigEmu.stop();
+            break;
+        }
+        else
+            printf("\nUnknown console command %s", s8Command);
+    }
+}
+
+SINT32 main(SINT32 argc, SINT8 *argv[])
+{
+    strConfigEmuConfig sConfig;
+
+    cConfigPortEmulator::setDefaultConfig(&sConfig);
+
+    for (SINT32 i = 1; i < argc; i++)
+    {
+        if (SUCCESS_STATUS != ParseConfigEmuOption(argc, argv, &i, &sConfig))
+        {
+            if (strcmp(argv[i], EMU_OPT_HELP) != 0)
+                printf("\nInvalid option %s\n", argv[i]);
+            ListOfOptions();
+            return FAILURE_STATUS;
+        }
+    }
+
+    if (STS_RFDCCARD_SUCCESS != objConfigEmu.open(&sConfig))
+    {
+        printf("\n");
+        return FAILURE_STATUS;
+    }
+
+    signal(SIGINT, SignalHandler);
+    signal(SIGTERM, SignalHandler);
+    signal(SIGUSR1, SignalHandler);
+    signal(SIGUSR2, SignalHandler);
+
+    /** Console is optional - the thread exits at end of stdin */
+    std::thread tConsole([&]
+                         { ConsoleThread(); });
+    tConsole.detach();
+
+    printf("DCA1000EVM emulator listening on %s:%u\n", sConfig.s8DcaIpAddr,
+           sConfig.u32ConfigPort);
+    setvbuf(stdout, NULL, _IOLBF, 0);
+
+    objConfigEmu.run();
+    objConfigEmu.printStats();
+
+    return SUCCESS_STATUS;
+}
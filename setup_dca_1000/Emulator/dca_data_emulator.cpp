@@ -0,0 +1,118 @@
+/**
+ * @file dca_data_emulator.cpp
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains the command line application which emulates
+ * the DCA1000EVM data port by replaying a recorded file or a synthetic
+ * pattern as a live UDP stream
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+///****************
+/// Includes
+///****************
+
+#include <signal.h>
+
+#include "dataemulator.h"
+
+///****************
+/// Variable declarations
+///****************
+
+/** Data stream emulator class object           */
+cDataStreamEmulator objDataEmu;
+
+/** @fn void ListOfOptions()
+ * @brief This function is to list options supported by data stream emulator
+ */
+void ListOfOptions()
+{
+    printf("dca_data_emulator [options]");
+    printf("\n\nOptions:");
+    ListOfDataEmuOptions();
+    printf("\n%s\t\t\t%s\n", EMU_OPT_HELP, "List of options supported");
+}
+
+/** @fn void SignalHandler(SINT32 s32Signal)
+ * @brief This function is to stop streaming on Ctrl+C
+ * @param [in] s32Signal [SINT32] - Signal number
+ */
+void SignalHandler(SINT32 s32Signal)
+{
+    (void)s32Signal;
+    objDataEmu.stop();
+}
+
+SINT32 main(SINT32 argc, SINT8 *argv[])
+{
+    strDataEmuConfig sConfig;
+
+    cDataStreamEmulator::setDefaultConfig(&sConfig);
+
+    for (SINT32 i = 1; i < argc; i++)
+    {
+        if (SUCCESS_STATUS != ParseDataEmuOption(argc, argv, &i, &sConfig))
+        {
+            if (strcmp(argv[i], EMU_OPT_HELP) != 0)
+                printf("\nInvalid option %s\n", argv[i]);
+            ListOfOptions();
+            return FAILURE_STATUS;
+        }
+    }
+
+    if (STS_RFDCCARD_SUCCESS != objDataEmu.setConfig(&sConfig))
+    {
+        printf("\n");
+        return FAILURE_STATUS;
+    }
+
+    signal(SIGINT, SignalHandler);
+    signal(SIGTERM, SignalHandler);
+
+    printf("Streaming to %s:%u\n", sConfig.s8DestIpAddr, sConfig.u32DestPort);
+    STATUS s32Status = objDataEmu.run();
+    objDataEmu.printStats();
+
+    return (s32Status == STS_RFDCCARD_SUCCESS) ? SUCCESS_STATUS : FAILURE_STATUS;
+}
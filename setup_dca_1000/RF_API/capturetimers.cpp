@@ -0,0 +1,304 @@
+/**
+ * @file capturetimers.cpp
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains the timers of the duration stop mode and the
+ * capture timeout handled in the capture event loop
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+///****************
+/// Includes
+///****************
+
+#ifndef _WIN32
+#include <sys/timerfd.h>
+#include <unistd.h>
+#endif
+
+#include "capturetimers.h"
+
+/** @fn cCaptureTimers::cCaptureTimers()
+ * @brief This constructor function is to create the timers
+ */
+cCaptureTimers::cCaptureTimers()
+{
+#ifndef _WIN32
+    s32DurationTimerFd = timerfd_create(CLOCK_MONOTONIC,
+                                        TFD_NONBLOCK | TFD_CLOEXEC);
+    s32TimeoutTimerFd = timerfd_create(CLOCK_MONOTONIC,
+                                       TFD_NONBLOCK | TFD_CLOEXEC);
+#endif
+    u64DurationEndUs = 0;
+    bDurationDone = false;
+    u64TimeoutUs = 0;
+    u64LastDataUs = 0;
+    u64TimeoutCheckUs = 0;
+}
+
+/** @fn cCaptureTimers::~cCaptureTimers()
+ * @brief This destructor function is to close the timers
+ */
+cCaptureTimers::~cCaptureTimers()
+{
+#ifndef _WIN32
+    if(s32DurationTimerFd >= 0)
+        close(s32DurationTimerFd);
+    if(s32TimeoutTimerFd >= 0)
+        close(s32TimeoutTimerFd);
+#endif
+}
+
+#ifndef _WIN32
+/** @fn SINT32 cCaptureTimers::getDurationTimerFd()
+ * @brief This function is to get the duration stop mode timer to <!--
+ * --> wait on in the capture event loop
+ * @return SINT32 value
+ */
+SINT32 cCaptureTimers::getDurationTimerFd()
+{
+    return s32DurationTimerFd;
+}
+
+/** @fn SINT32 cCaptureTimers::getTimeoutTimerFd()
+ * @brief This function is to get the capture timeout timer to wait <!--
+ * --> on in the capture event loop
+ * @return SINT32 value
+ */
+SINT32 cCaptureTimers::getTimeoutTimerFd()
+{
+    return s32TimeoutTimerFd;
+}
+
+/** @fn void cCaptureTimers::armTimer(SINT32 s32TimerFd, ULONG64 u64DelayUs)
+ * @brief This function is to set a timer to expire once after a delay
+ * @param [in] s32TimerFd [SINT32] - Timer file descriptor
+ * @param [in] u64DelayUs [ULONG64] - Delay in micro seconds, 0 to stop
+ */
+void cCaptureTimers::armTimer(SINT32 s32TimerFd, ULONG64 u64DelayUs)
+{
+    struct itimerspec sTimerSpec;
+
+    memset(&sTimerSpec, 0, sizeof(sTimerSpec));
+    sTimerSpec.it_value.tv_sec = (time_t)(u64DelayUs /
+                                          MILLI_TO_MICRO_SEC_CONVERSION /
+                                          SEC_TO_MILLI_SEC_CONVERSION);
+    sTimerSpec.it_value.tv_nsec = (long)((u64DelayUs %
+                                          (MILLI_TO_MICRO_SEC_CONVERSION *
+                                           SEC_TO_MILLI_SEC_CONVERSION)) *
+                                         SEC_TO_MILLI_SEC_CONVERSION);
+    timerfd_settime(s32TimerFd, 0, &sTimerSpec, NULL);
+}
+#endif
+
+/** @fn void cCaptureTimers::reset()
+ * @brief This function is to stop the timers of a record process
+ */
+void cCaptureTimers::reset()
+{
+    u64DurationEndUs = 0;
+    bDurationDone = false;
+    u64TimeoutUs = 0;
+    u64TimeoutCheckUs = 0;
+#ifndef _WIN32
+    armTimer(s32DurationTimerFd, 0);
+    armTimer(s32TimeoutTimerFd, 0);
+#endif
+}
+
+/** @fn void cCaptureTimers::startDuration()
+ * @brief This function is to start the duration stop mode timer on <!--
+ * --> the first packet received in any of the data ports
+ */
+void cCaptureTimers::startDuration()
+{
+    ULONG64 u64DurationUs = (ULONG64)sRFDCCard_StartRecConfig.u32DurationToCapture *
+                            MILLI_TO_MICRO_SEC_CONVERSION;
+    ULONG64 u64NoEndUs = 0;
+
+    /** The data port receiving the first packet starts it */
+    if(!u64DurationEndUs.compare_exchange_strong(u64NoEndUs,
+                        osalObj_api.GetTimeInMicroSec() + u64DurationUs))
+        return;
+
+#ifndef _WIN32
+    armTimer(s32DurationTimerFd, u64DurationUs);
+#endif
+}
+
+/** @fn void cCaptureTimers::endDuration()
+ * @brief This function is to end the duration stop mode now, the <!--
+ * --> record is completed without more data
+ */
+void cCaptureTimers::endDuration()
+{
+    u64DurationEndUs = osalObj_api.GetTimeInMicroSec();
+
+#ifndef _WIN32
+    /** Expires at once, a zero delay stops the timer */
+    armTimer(s32DurationTimerFd, 1);
+#endif
+}
+
+/** @fn bool cCaptureTimers::isDurationOver()
+ * @brief This function is to check whether the duration of the <!--
+ * --> duration stop mode is over, the data received after it is not <!--
+ * --> recorded
+ * @return boolean value
+ */
+bool cCaptureTimers::isDurationOver()
+{
+    ULONG64 u64EndUs = u64DurationEndUs.load(std::memory_order_relaxed);
+
+    return ((u64EndUs != 0) && (osalObj_api.GetTimeInMicroSec() >= u64EndUs));
+}
+
+/** @fn void cCaptureTimers::startTimeout(UINT32 u32TimeoutMs)
+ * @brief This function is to start the capture timeout timer
+ * @param [in] u32TimeoutMs [UINT32] - Capture timeout in millisec
+ */
+void cCaptureTimers::startTimeout(UINT32 u32TimeoutMs)
+{
+    ULONG64 u64NowUs = osalObj_api.GetTimeInMicroSec();
+    ULONG64 u64DelayUs = (ULONG64)u32TimeoutMs * MILLI_TO_MICRO_SEC_CONVERSION;
+
+    u64LastDataUs = u64NowUs;
+    u64TimeoutCheckUs = u64NowUs + u64DelayUs;
+    u64TimeoutUs = u64DelayUs;
+
+#ifndef _WIN32
+    armTimer(s32TimeoutTimerFd, u64DelayUs);
+#endif
+}
+
+/** @fn void cCaptureTimers::dataReceived()
+ * @brief This function is to note the time data is received in any <!--
+ * --> of the data ports
+ */
+void cCaptureTimers::dataReceived()
+{
+    u64LastDataUs.store(osalObj_api.GetTimeInMicroSec(),
+                        std::memory_order_relaxed);
+}
+
+/** @fn void cCaptureTimers::handleTimers()
+ * @brief This function is to handle the expired timers in the <!--
+ * --> capture event loop
+ */
+void cCaptureTimers::handleTimers()
+{
+    ULONG64 u64NowUs = osalObj_api.GetTimeInMicroSec();
+    ULONG64 u64EndUs = u64DurationEndUs;
+    ULONG64 u64TimeoutDelayUs = u64TimeoutUs;
+
+#ifndef _WIN32
+    ULONG64 u64Expirations = 0;
+
+    /** Clear the expiry of the timers waited on */
+    if(read(s32DurationTimerFd, &u64Expirations, sizeof(u64Expirations)) < 0)
+        u64Expirations = 0;
+    if(read(s32TimeoutTimerFd, &u64Expirations, sizeof(u64Expirations)) < 0)
+        u64Expirations = 0;
+#endif
+
+    /** Duration stop mode - Send the record completed status unless
+     *  stop command is sent                                          */
+    if((u64EndUs != 0) && (!bDurationDone))
+    {
+        if(u64NowUs >= u64EndUs)
+        {
+            bDurationDone = true;
+            if(!gbRecStopCmdSent)
+                RFDCARD_Callback(CMD_CODE_SYSTEM_ASYNC_STATUS,
+                                 STS_REC_COMPLETED);
+        }
+#ifndef _WIN32
+        else
+            armTimer(s32DurationTimerFd, u64EndUs - u64NowUs);
+#endif
+    }
+
+    /** Capture timeout - No data received for the timeout, it is
+     *  reported again after each timeout without data               */
+    if((u64TimeoutDelayUs != 0) && (u64NowUs >= u64TimeoutCheckUs))
+    {
+        ULONG64 u64LastUs = u64LastDataUs.load(std::memory_order_relaxed);
+        if((u64NowUs - u64LastUs) >= u64TimeoutDelayUs)
+        {
+            if(!gbRecStopCmdSent)
+                RFDCARD_Callback(STS_CAPTURE_THREAD_TIMEOUT, 0);
+            u64LastUs = u64NowUs;
+        }
+        u64TimeoutCheckUs = u64LastUs + u64TimeoutDelayUs;
+#ifndef _WIN32
+        armTimer(s32TimeoutTimerFd, u64LastUs + u64TimeoutDelayUs - u64NowUs);
+#endif
+    }
+}
+
+#ifdef _WIN32
+/** @fn UINT32 cCaptureTimers::getWaitMs()
+ * @brief This function is to get the wait of the capture event loop <!--
+ * --> till the next timer expiry, bounded by \ref CAPTURE_LOOP_WAIT_TIMEOUT_MS
+ * @return UINT32 value
+ */
+UINT32 cCaptureTimers::getWaitMs()
+{
+    ULONG64 u64NowUs = osalObj_api.GetTimeInMicroSec();
+    ULONG64 u64WaitUs = (ULONG64)CAPTURE_LOOP_WAIT_TIMEOUT_MS *
+                        MILLI_TO_MICRO_SEC_CONVERSION;
+    ULONG64 u64EndUs = u64DurationEndUs;
+    ULONG64 u64CheckUs = u64TimeoutCheckUs;
+
+    if((u64EndUs != 0) && (!bDurationDone))
+        u64WaitUs = (u64EndUs > u64NowUs) ?
+                    std::min(u64WaitUs, u64EndUs - u64NowUs) : 0;
+    if(u64TimeoutUs != 0)
+        u64WaitUs = (u64CheckUs > u64NowUs) ?
+                    std::min(u64WaitUs, u64CheckUs - u64NowUs) : 0;
+
+    /** Round up, a wait ending before the expiry is repeated */
+    return (UINT32)((u64WaitUs + MILLI_TO_MICRO_SEC_CONVERSION - 1) /
+                    MILLI_TO_MICRO_SEC_CONVERSION);
+}
+#endif
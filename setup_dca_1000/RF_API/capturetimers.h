@@ -0,0 +1,193 @@
+/**
+ * @file capturetimers.h
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains the timers of the duration stop mode and the
+ * capture timeout handled in the capture event loop
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+#ifndef CAPTURETIMERS_H
+#define CAPTURETIMERS_H
+
+///****************
+/// Includes
+///****************
+
+#include <algorithm>
+#include <atomic>
+
+#include "../Common/rf_api_internal.h"
+
+#include "defines.h"
+#include "extern.h"
+
+/** The times are shared by the data port threads and the capture event
+ *  loop, hence keep them aligned for the atomic access                  */
+#pragma pack(push, 8)
+
+/** @class cCaptureTimers
+ * @brief This class provides support APIs to handle the duration stop <!--
+ * --> mode and the capture timeout in the capture event loop. On Linux <!--
+ * --> each timer is a timerfd waited on with the data socket, elsewhere <!--
+ * --> the wait of the loop is bounded by the next expiry
+ */
+class cCaptureTimers
+{
+#ifndef _WIN32
+    /** Duration stop mode timer file descriptor            */
+    SINT32 s32DurationTimerFd;
+
+    /** Capture timeout timer file descriptor               */
+    SINT32 s32TimeoutTimerFd;
+#endif
+
+    /** End of the duration stop mode in micro seconds, 0 till the first
+     *  packet is received                                   */
+    std::atomic<ULONG64> u64DurationEndUs;
+
+    /** Record completed status is sent for the duration    */
+    std::atomic<bool> bDurationDone;
+
+    /** Capture timeout in micro seconds, 0 if not running  */
+    std::atomic<ULONG64> u64TimeoutUs;
+
+    /** Time in micro seconds of the last data received     */
+    std::atomic<ULONG64> u64LastDataUs;
+
+    /** Time in micro seconds of the next capture timeout check */
+    std::atomic<ULONG64> u64TimeoutCheckUs;
+
+public:
+    /** @fn cCaptureTimers()
+     * @brief This constructor function is to create the timers
+     */
+    cCaptureTimers();
+
+    /** @fn ~cCaptureTimers()
+     * @brief This destructor function is to close the timers
+     */
+    ~cCaptureTimers();
+
+#ifndef _WIN32
+    /** @fn SINT32 getDurationTimerFd()
+     * @brief This function is to get the duration stop mode timer to <!--
+     * --> wait on in the capture event loop
+     * @return SINT32 value
+     */
+    SINT32 getDurationTimerFd();
+
+    /** @fn SINT32 getTimeoutTimerFd()
+     * @brief This function is to get the capture timeout timer to wait <!--
+     * --> on in the capture event loop
+     * @return SINT32 value
+     */
+    SINT32 getTimeoutTimerFd();
+#endif
+
+    /** @fn void reset()
+     * @brief This function is to stop the timers of a record process
+     */
+    void reset();
+
+    /** @fn void startDuration()
+     * @brief This function is to start the duration stop mode timer on <!--
+     * --> the first packet received in any of the data ports
+     */
+    void startDuration();
+
+    /** @fn void endDuration()
+     * @brief This function is to end the duration stop mode now, the <!--
+     * --> record is completed without more data
+     */
+    void endDuration();
+
+    /** @fn bool isDurationOver()
+     * @brief This function is to check whether the duration of the <!--
+     * --> duration stop mode is over, the data received after it is not <!--
+     * --> recorded
+     * @return boolean value
+     */
+    bool isDurationOver();
+
+    /** @fn void startTimeout(UINT32 u32TimeoutMs)
+     * @brief This function is to start the capture timeout timer
+     * @param [in] u32TimeoutMs [UINT32] - Capture timeout in millisec
+     */
+    void startTimeout(UINT32 u32TimeoutMs);
+
+    /** @fn void dataReceived()
+     * @brief This function is to note the time data is received in any <!--
+     * --> of the data ports
+     */
+    void dataReceived();
+
+    /** @fn void handleTimers()
+     * @brief This function is to handle the expired timers in the <!--
+     * --> capture event loop
+     */
+    void handleTimers();
+
+#ifdef _WIN32
+    /** @fn UINT32 getWaitMs()
+     * @brief This function is to get the wait of the capture event loop <!--
+     * --> till the next timer expiry, bounded by \ref CAPTURE_LOOP_WAIT_TIMEOUT_MS
+     * @return UINT32 value
+     */
+    UINT32 getWaitMs();
+#endif
+
+#ifndef _WIN32
+private:
+    /** @fn void armTimer(SINT32 s32TimerFd, ULONG64 u64DelayUs)
+     * @brief This function is to set a timer to expire once after a delay
+     * @param [in] s32TimerFd [SINT32] - Timer file descriptor
+     * @param [in] u64DelayUs [ULONG64] - Delay in micro seconds, 0 to stop
+     */
+    void armTimer(SINT32 s32TimerFd, ULONG64 u64DelayUs);
+#endif
+};
+
+#pragma pack(pop)
+
+#endif // CAPTURETIMERS_H
@@ -0,0 +1,248 @@
+/**
+ * @file cmdpipeline.cpp
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains the command pipeline which sends configuration
+ * commands back to back and matches the responses by command code
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+///****************
+/// Includes
+///****************
+
+#include "cmdpipeline.h"
+#include "extern.h"
+
+/** @fn cCmdPipeline::cCmdPipeline()
+ * @brief This constructor function is to initialize the class member variables
+ */
+cCmdPipeline::cCmdPipeline()
+{
+    u16NumOfCmds = 0;
+    bExecuting = false;
+}
+
+/** @fn void cCmdPipeline::reset()
+ * @brief This function is to remove all the commands of the pipeline
+ */
+void cCmdPipeline::reset()
+{
+    u16NumOfCmds = 0;
+}
+
+/** @fn STATUS cCmdPipeline::addCommand(UINT16 u16CmdCode, SINT8 *s8Data, <!--
+ * --> UINT16 u16PacketLen, UINT32 u32TimeoutMs, UINT16 u16Retries)
+ * @brief This function is to add a command to the pipeline. Commands <!--
+ * --> are sent in the order they are added
+ * @param [in] u16CmdCode [UINT16] - Command code of the packet
+ * @param [in] s8Data [SINT8 *] - Command packet
+ * @param [in] u16PacketLen [UINT16] - Command packet size
+ * @param [in] u32TimeoutMs [UINT32] - Response timeout in millisec
+ * @param [in] u16Retries [UINT16] - Number of times the command is <!--
+ * --> sent again on response timeout
+ * @return SINT32 value
+ */
+STATUS cCmdPipeline::addCommand(UINT16 u16CmdCode, SINT8 *s8Data,
+                                UINT16 u16PacketLen, UINT32 u32TimeoutMs,
+                                UINT16 u16Retries)
+{
+    if ((u16NumOfCmds >= MAX_PIPELINE_CMDS) ||
+        (u16PacketLen > sizeof(DATA_CAPTURE_REQ)))
+        return STS_RFDCCARD_INVALID_INPUT_PARAMS;
+
+    strPipelineCmd *psCmd = &sCmds[u16NumOfCmds++];
+    psCmd->u16CmdCode = u16CmdCode;
+    memcpy(psCmd->s8Data, s8Data, u16PacketLen);
+    psCmd->u16PacketLen = u16PacketLen;
+    psCmd->u32TimeoutMs = u32TimeoutMs;
+    psCmd->u16RetriesLeft = u16Retries;
+    psCmd->u64DeadlineUs = 0;
+    psCmd->bResponded = false;
+    psCmd->s32Status = STS_RFDCCARD_TIMEOUT_ERR;
+
+    return SUCCESS_STATUS;
+}
+
+/** @fn bool cCmdPipeline::setResponse(UINT16 u16CmdCode, UINT16 u16Status)
+ * @brief This function is to hand over a command response received <!--
+ * --> by the config port thread
+ * @param [in] u16CmdCode [UINT16] - Command code of the response
+ * @param [in] u16Status [UINT16] - Status of the response
+ * @return boolean value (true if the response belongs to the pipeline)
+ */
+bool cCmdPipeline::setResponse(UINT16 u16CmdCode, UINT16 u16Status)
+{
+    if (!bExecuting)
+        return false;
+
+    for (UINT16 i = 0; i < u16NumOfCmds; i++)
+    {
+        if (sCmds[i].u16CmdCode != u16CmdCode)
+            continue;
+
+        /** A response of a command sent again is dropped            */
+        if (!sCmds[i].bResponded)
+        {
+            sCmds[i].s32Status = u16Status;
+            sCmds[i].bResponded = true;
+            osalObj_api.SignalEvent(&sgnCmdPipelineWaitEvent);
+        }
+        return true;
+    }
+
+    return false;
+}
+
+/** @fn STATUS cCmdPipeline::execute()
+ * @brief This function is to send all the commands and wait till <!--
+ * --> every command is responded or out of retries. The config port <!--
+ * --> thread should be running and \ref sgnCmdPipelineWaitEvent <!--
+ * --> initialized
+ * @return SINT32 value (status of the first failed command)
+ */
+STATUS cCmdPipeline::execute()
+{
+    ULONG64 u64CurTimeUs = 0;
+    ULONG64 u64NextDeadlineUs = 0;
+    bool bPending = true;
+    UINT16 i = 0;
+
+#ifdef ENABLE_DEBUG
+    SINT8 s8DebugMsgs[MAX_NAME_LEN];
+#endif
+
+    /** Clear a response signal left by the previous execution       */
+    osalObj_api.WaitForSignalInMilliSec(&sgnCmdPipelineWaitEvent, 0);
+    bExecuting = true;
+
+    /** Send all the commands back to back                            */
+    for (i = 0; i < u16NumOfCmds; i++)
+    {
+        if (SendConfigCmdRequest(sCmds[i].s8Data, sCmds[i].u16PacketLen) <=
+            SOCKET_ERROR)
+        {
+            sCmds[i].s32Status = STS_RFDCCARD_UDP_WRITE_ERR;
+            continue;
+        }
+        sCmds[i].u64DeadlineUs = osalObj_api.GetTimeInMicroSec() +
+                                 ((ULONG64)sCmds[i].u32TimeoutMs *
+                                  MILLI_TO_MICRO_SEC_CONVERSION);
+    }
+
+    while (bPending)
+    {
+        bPending = false;
+        u64NextDeadlineUs = 0;
+        u64CurTimeUs = osalObj_api.GetTimeInMicroSec();
+
+        for (i = 0; i < u16NumOfCmds; i++)
+        {
+            /** Responded, failed to send or out of retries             */
+            if (sCmds[i].bResponded || (sCmds[i].u64DeadlineUs == 0))
+                continue;
+
+            if (u64CurTimeUs >= sCmds[i].u64DeadlineUs)
+            {
+                if (sCmds[i].u16RetriesLeft == 0)
+                {
+                    sCmds[i].u64DeadlineUs = 0;
+                    continue;
+                }
+
+#ifdef ENABLE_DEBUG
+                sprintf(s8DebugMsgs, "\n\nPipeline command 0x%02X: "
+                                     "Response timeout, sent again",
+                        sCmds[i].u16CmdCode);
+                DEBUG_FILE_WRITE(s8DebugMsgs);
+#endif
+                sCmds[i].u16RetriesLeft--;
+                SendConfigCmdRequest(sCmds[i].s8Data, sCmds[i].u16PacketLen);
+                sCmds[i].u64DeadlineUs = u64CurTimeUs +
+                                         ((ULONG64)sCmds[i].u32TimeoutMs *
+                                          MILLI_TO_MICRO_SEC_CONVERSION);
+            }
+
+            if ((!bPending) || (sCmds[i].u64DeadlineUs < u64NextDeadlineUs))
+                u64NextDeadlineUs = sCmds[i].u64DeadlineUs;
+            bPending = true;
+        }
+
+        /** Wait for the next response or the earliest deadline      */
+        if (bPending)
+        {
+            osalObj_api.WaitForSignalInMilliSec(&sgnCmdPipelineWaitEvent,
+                (UINT32)((u64NextDeadlineUs - u64CurTimeUs) /
+                         MILLI_TO_MICRO_SEC_CONVERSION) + 1);
+        }
+    }
+
+    bExecuting = false;
+
+    /** Commands are executed by the FPGA in order, the first failure
+     *  is returned                                                    */
+    for (i = 0; i < u16NumOfCmds; i++)
+    {
+        if (sCmds[i].s32Status != SUCCESS_STATUS)
+            return sCmds[i].s32Status;
+    }
+
+    return SUCCESS_STATUS;
+}
+
+/** @fn STATUS cCmdPipeline::getStatus(UINT16 u16CmdCode)
+ * @brief This function is to read the status of a command after <!--
+ * --> \ref execute
+ * @param [in] u16CmdCode [UINT16] - Command code
+ * @return SINT32 value
+ */
+STATUS cCmdPipeline::getStatus(UINT16 u16CmdCode)
+{
+    for (UINT16 i = 0; i < u16NumOfCmds; i++)
+    {
+        if (sCmds[i].u16CmdCode == u16CmdCode)
+            return sCmds[i].s32Status;
+    }
+
+    return STS_RFDCCARD_INVALID_INPUT_PARAMS;
+}
@@ -0,0 +1,166 @@
+/**
+ * @file cmdpipeline.h
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains the command pipeline which sends configuration
+ * commands back to back and matches the responses by command code
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+#ifndef CMDPIPELINE_H
+#define CMDPIPELINE_H
+
+///****************
+/// Includes
+///****************
+
+#include "../Common/rf_api_internal.h"
+#include "defines.h"
+
+///****************
+/// Structure declarations
+///****************
+
+/** Outstanding command of the pipeline                                     */
+typedef struct PIPELINE_CMD
+{
+    /** Command code the response is matched with                           */
+    UINT16 u16CmdCode;
+
+    /** Command packet                                                      */
+    SINT8 s8Data[sizeof(DATA_CAPTURE_REQ)];
+
+    /** Command packet size                                                 */
+    UINT16 u16PacketLen;
+
+    /** Response timeout in millisec                                        */
+    UINT32 u32TimeoutMs;
+
+    /** Number of times the command can be sent again                       */
+    UINT16 u16RetriesLeft;
+
+    /** Time in micro seconds the command response is due                   */
+    ULONG64 u64DeadlineUs;
+
+    /** Response received flag, set by the config port thread               */
+    volatile bool bResponded;
+
+    /** Response status or timeout error                                    */
+    SINT32 s32Status;
+
+}strPipelineCmd;
+
+/** @class cCmdPipeline
+ * @brief This class provides support APIs to send several configuration <!--
+ * --> commands without waiting for the response of each one. The config <!--
+ * --> port thread hands the responses over by command code
+ */
+class cCmdPipeline
+{
+public:
+
+    /** @fn cCmdPipeline()
+     * @brief This constructor function is to initialize the class member variables
+     */
+    cCmdPipeline();
+
+    /** @fn void reset()
+     * @brief This function is to remove all the commands of the pipeline
+     */
+    void reset();
+
+    /** @fn STATUS addCommand(UINT16 u16CmdCode, SINT8 *s8Data, <!--
+     * --> UINT16 u16PacketLen, UINT32 u32TimeoutMs, UINT16 u16Retries)
+     * @brief This function is to add a command to the pipeline. Commands <!--
+     * --> are sent in the order they are added
+     * @param [in] u16CmdCode [UINT16] - Command code of the packet
+     * @param [in] s8Data [SINT8 *] - Command packet
+     * @param [in] u16PacketLen [UINT16] - Command packet size
+     * @param [in] u32TimeoutMs [UINT32] - Response timeout in millisec
+     * @param [in] u16Retries [UINT16] - Number of times the command is <!--
+     * --> sent again on response timeout
+     * @return SINT32 value
+     */
+    STATUS addCommand(UINT16 u16CmdCode, SINT8 *s8Data, UINT16 u16PacketLen,
+                      UINT32 u32TimeoutMs, UINT16 u16Retries);
+
+    /** @fn bool setResponse(UINT16 u16CmdCode, UINT16 u16Status)
+     * @brief This function is to hand over a command response received <!--
+     * --> by the config port thread
+     * @param [in] u16CmdCode [UINT16] - Command code of the response
+     * @param [in] u16Status [UINT16] - Status of the response
+     * @return boolean value (true if the response belongs to the pipeline)
+     */
+    bool setResponse(UINT16 u16CmdCode, UINT16 u16Status);
+
+    /** @fn STATUS execute()
+     * @brief This function is to send all the commands and wait till <!--
+     * --> every command is responded or out of retries. The config port <!--
+     * --> thread should be running and \ref sgnCmdPipelineWaitEvent <!--
+     * --> initialized
+     * @return SINT32 value (status of the first failed command)
+     */
+    STATUS execute();
+
+    /** @fn STATUS getStatus(UINT16 u16CmdCode)
+     * @brief This function is to read the status of a command after <!--
+     * --> \ref execute
+     * @param [in] u16CmdCode [UINT16] - Command code
+     * @return SINT32 value
+     */
+    STATUS getStatus(UINT16 u16CmdCode);
+
+private:
+
+    /** Commands of the pipeline                                            */
+    strPipelineCmd sCmds[MAX_PIPELINE_CMDS];
+
+    /** Number of commands of the pipeline                                  */
+    UINT16 u16NumOfCmds;
+
+    /** Responses are handed over while the pipeline is executing           */
+    std::atomic<bool> bExecuting;
+
+};
+
+#endif // CMDPIPELINE_H
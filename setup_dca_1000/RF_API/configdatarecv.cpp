@@ -62,6 +62,15 @@
 
 #include "configdatarecv.h"
 #include "recorddatarecv.h"
+#include "multiportrecv.h"
+#include "cmdpipeline.h"
+#include "capturetimers.h"
+#include "sharedportdemux.h"
+
+#ifndef _WIN32
+#include <sys/epoll.h>
+#include <sys/ioctl.h>
+#endif
 
 ///****************
 /// Externs
@@ -82,9 +91,21 @@ extern cUdpDataReceiver		objUdpR4fDataRecv;
 /** DSP data record process -  class object             */
 extern cUdpDataReceiver		objUdpDspDataRecv;
 
+/** CP, CQ, R4F and DSP data ports thread -  class object */
+extern cUdpMultiPortReceiver objUdpMultiPortRecv;
+
 /** Command response structure - Start record command   */
 extern DATA_CAPTURE_RESP    configResp;
 
+/** Pipelined config commands - class object            */
+extern cCmdPipeline         objCmdPipeline;
+
+/** Duration stop mode and capture timeout - class object */
+extern cCaptureTimers       objCaptureTimers;
+
+/** Systems sharing the ADC data port -  class object  */
+extern cSharedPortDemux     objSharedPortDemux;
+
 /** Start record command timeout wait event
  * Separate thread will be running for handling config port response packets,
  * hence start record command responses will be handled using the wait event
@@ -147,9 +168,6 @@ void cUdpReceiver::readConfigDatagrams()
     SINT32		s32RecvSize_cfg = 0;
     UINT16		u16Data = 0;
     UINT16      u16SysStatus = 0;
-    SINT32      s32Result = 0;
-    fd_set readset;
-    struct timeval       timeout;
 
 #ifdef ENABLE_DEBUG
     SINT8       s8DebugMsgs[MAX_NAME_LEN];
@@ -168,19 +186,25 @@ void cUdpReceiver::readConfigDatagrams()
             if((configResp.u16Header == HEADER_START_BYTES) &&
                 (configResp.u16Footer == FOOTER_STOP_BYTES))
 			{
+                /** Start and stop record responses of the other systems
+                 *  of a shared data port                                 */
+                if(objSharedPortDemux.setResponse(
+                        SenderAddr_cfg.sin_addr.s_addr, configResp.u16CmdCode,
+                        configResp.u16Status))
+                    continue;
 
 				switch(configResp.u16CmdCode)
                 {
                 case CMD_CODE_START_RECORD:
-                    osalObj_api.SignalEvent(&sgnCmdTimeoutWaitEvent);
+                    if (!objCmdPipeline.setResponse(configResp.u16CmdCode,
+                                                    configResp.u16Status))
+                        osalObj_api.SignalEvent(&sgnCmdTimeoutWaitEvent);
 
 					if(configResp.u16Status != SUCCESS_STATUS)
 					{
                         objUdpDataRecv.setThreadStop();
-                        objUdpCpDataRecv.setThreadStop();
-                        objUdpCqDataRecv.setThreadStop();
-                        objUdpR4fDataRecv.setThreadStop();
-                        objUdpDspDataRecv.setThreadStop();
+                        objUdpMultiPortRecv.setThreadStop();
+                        objSharedPortDemux.setThreadStop();
 					}
 #ifdef ENABLE_DEBUG
         sprintf(s8DebugMsgs, "\n\nRECORD_START_CMD_CODE: Received");
@@ -191,7 +215,9 @@ void cUdpReceiver::readConfigDatagrams()
                     RFDCARD_Callback(CMD_CODE_CLI_ASYNC_RECORD_STOP, 0);
                     break;
                 case CMD_CODE_STOP_RECORD:
-                    osalObj_api.SignalEvent(&sgnCmdTimeoutWaitEvent);
+                    if (!objCmdPipeline.setResponse(configResp.u16CmdCode,
+                                                    configResp.u16Status))
+                        osalObj_api.SignalEvent(&sgnCmdTimeoutWaitEvent);
 
 #ifdef ENABLE_DEBUG
         sprintf(s8DebugMsgs, "\n\nRECORD_STOP_CMD_CODE: Received");
@@ -214,9 +240,7 @@ void cUdpReceiver::readConfigDatagrams()
                                 if(sRFDCCard_StartRecConfig.eRecordStopMode ==
                                         DURATION)
                                 {
-                                    sRFDCCard_StartRecConfig.u32DurationToCapture = 1;
-                                    osalObj_api.SignalEvent(&
-                                                sgnDurationStopModeWaitEvent);
+                                    objCaptureTimers.endDuration();
                                 }
 
 #ifdef ENABLE_DEBUG
@@ -231,9 +255,7 @@ void cUdpReceiver::readConfigDatagrams()
                                 if(sRFDCCard_StartRecConfig.eRecordStopMode ==
                                         DURATION)
                                 {
-                                    sRFDCCard_StartRecConfig.u32DurationToCapture = 1;
-                                    osalObj_api.SignalEvent(&
-                                                sgnDurationStopModeWaitEvent);
+                                    objCaptureTimers.endDuration();
                                 }
 
 #ifdef ENABLE_DEBUG
@@ -290,76 +312,19 @@ void cUdpReceiver::readConfigDatagrams()
 #endif
                                 break;
                             case STS_REC_COMPLETED:
+                                /** Shared data port - the record is
+                                 *  completed once all systems are done */
+                                if(!objSharedPortDemux.setCompleted(
+                                        objSharedPortDemux.getSystemIndex(
+                                            SenderAddr_cfg.sin_addr.s_addr)))
+                                    break;
+
 #ifdef ENABLE_DEBUG
         sprintf(s8DebugMsgs, "\n\nValidating socket buffer empty");
         DEBUG_FILE_WRITE(s8DebugMsgs);
 #endif
 
-                                /** Raw socket buffer                                                    */
-                                do
-                                {
-                                    FD_ZERO(&readset);
-                                    FD_SET(sRFDCCard_SockInfo.s32DataSock[RAW_DATA_INDEX],
-                                           &readset);
-                                    timeout.tv_sec  = 0;
-                                    timeout.tv_usec = 0;
-                                    s32Result = select(0, &readset, NULL, NULL,
-                                                       &timeout);
-                                } while ((s32Result > 0));
-
-                                /** CP socket buffer                                                    */
-                                do
-                                {
-                                    FD_ZERO(&readset);
-                                    FD_SET(sRFDCCard_SockInfo.s32DataSock[CP_DATA_1_INDEX],
-                                           &readset);
-                                    timeout.tv_sec  = 0;
-                                    timeout.tv_usec = 0;
-                                    s32Result = select(0, &readset, NULL, NULL,
-                                                       &timeout);
-                                } while ((s32Result > 0));
-
-                                /** CQ socket buffer                                                    */
-                                do
-                                {
-                                    FD_ZERO(&readset);
-                                    FD_SET(sRFDCCard_SockInfo.s32DataSock[CQ_DATA_2_INDEX],
-                                           &readset);
-                                    timeout.tv_sec  = 0;
-                                    timeout.tv_usec = 0;
-                                    s32Result = select(0, &readset, NULL, NULL,
-                                                       &timeout);
-                                } while ((s32Result > 0));
-
-                                /** R4f socket buffer                                                   */
-                                do
-                                {
-                                    FD_ZERO(&readset);
-                                    FD_SET(sRFDCCard_SockInfo.s32DataSock[R4F_DATA_3_INDEX],
-                                           &readset);
-                                    timeout.tv_sec  = 0;
-                                    timeout.tv_usec = 0;
-                                    s32Result = select(0, &readset, NULL, NULL,
-                                                       &timeout);
-                                } while ((s32Result > 0));
-
-                                /** Dsp socket buffer                                                   */
-                                do
-                                {
-                                    FD_ZERO(&readset);
-                                    FD_SET(sRFDCCard_SockInfo.s32DataSock[DSP_DATA_4_INDEX],
-                                           &readset);
-                                    timeout.tv_sec  = 0;
-                                    timeout.tv_usec = 0;
-                                    s32Result = select(0, &readset, NULL, NULL,
-                                                       &timeout);
-                                } while ((s32Result > 0));
-
-                        #ifdef ENABLE_DEBUG
-                                sprintf(s8DebugMsgs, "\n\ns32Result = %d",
-                                        s32Result);
-                                DEBUG_FILE_WRITE(s8DebugMsgs);
-                        #endif
+                                drainDataSockets();
 
                                 if(!gbRecStopCmdSent)
                                 {
@@ -370,9 +335,7 @@ void cUdpReceiver::readConfigDatagrams()
                                 if(sRFDCCard_StartRecConfig.eRecordStopMode ==
                                         DURATION)
                                 {
-                                    sRFDCCard_StartRecConfig.u32DurationToCapture = 1;
-                                    osalObj_api.SignalEvent(&
-                                                sgnDurationStopModeWaitEvent);
+                                    objCaptureTimers.endDuration();
                                 }
 
 #ifdef ENABLE_DEBUG
@@ -393,6 +356,13 @@ void cUdpReceiver::readConfigDatagrams()
 					}
 
 					break;
+                default:
+                    /** Response of a config command sent while the record
+                     *  process holds the config port, single or pipelined   */
+                    if (!objCmdPipeline.setResponse(configResp.u16CmdCode,
+                                                    configResp.u16Status))
+                        osalObj_api.SignalEvent(&sgnCmdTimeoutWaitEvent);
+                    break;
 				}
 			}
 			else
@@ -403,8 +373,163 @@ void cUdpReceiver::readConfigDatagrams()
         sprintf(s8DebugMsgs, "\n\nINVALID_RESP_PKT_ERROR_CODE: Received");
         DEBUG_FILE_WRITE(s8DebugMsgs);
 #endif
-				break;
 			}
 		}
     }
 }
+
+/** @fn void cUdpReceiver::drainDataSockets()
+ * @brief This function is to wait till the record threads drained <!--
+ * --> the data sockets on record completion. The wait ends once no <!--
+ * --> packet is queued, arrived or read by the record threads for the <!--
+ * --> quiet period, bounded by MAX_DRAIN_DURATION_MS
+ */
+void cUdpReceiver::drainDataSockets()
+{
+    cUdpDataReceiver *pDataRecv[NUM_DATA_TYPES] = { &objUdpDataRecv,
+                        &objUdpCpDataRecv, &objUdpCqDataRecv,
+                        &objUdpR4fDataRecv, &objUdpDspDataRecv };
+    ULONG64     u64RecvdPackets[NUM_REC_STATS_ENTRIES];
+    ULONG64     u64LastRecvdPackets[NUM_REC_STATS_ENTRIES];
+    ULONG64     u64QuietPeriodUs = 0;
+    ULONG64     u64StartTimeUs = osalObj_api.GetTimeInMicroSec();
+    ULONG64     u64LastActiveTimeUs = u64StartTimeUs;
+    ULONG64     u64CurTimeUs = u64StartTimeUs;
+    SINT32      s32WaitMs = 0;
+    bool        bActive = false;
+    UINT8       i = 0;
+#ifdef _WIN32
+    u_long      u32QueuedBytes = 0;
+    fd_set      readset;
+    struct timeval timeout;
+#else
+    SINT32      s32QueuedBytes = 0;
+    SINT32      s32EpollFd = -1;
+    SINT32      s32NumOfEvents = 0;
+    struct epoll_event sEvent;
+    struct epoll_event sEvents[NUM_DATA_TYPES];
+#endif
+
+#ifdef ENABLE_DEBUG
+    SINT8       s8DebugMsgs[MAX_NAME_LEN];
+#endif
+
+    u64QuietPeriodUs = (sRFDCCard_StartRecConfig.u16DrainQuietPeriod == 0) ?
+                        DEFAULT_DRAIN_QUIET_PERIOD_MS :
+                        sRFDCCard_StartRecConfig.u16DrainQuietPeriod;
+    u64QuietPeriodUs *= MILLI_TO_MICRO_SEC_CONVERSION;
+
+    for(i = 0; i < NUM_REC_STATS_ENTRIES; i ++)
+    {
+        u64RecvdPackets[i] = sRFDCCard_InlineStats.u64NumOfRecvdPackets[i];
+        u64LastRecvdPackets[i] = u64RecvdPackets[i];
+    }
+
+#ifndef _WIN32
+    /** One wait over the data sockets read by record threads. It is
+     *  edge triggered, a packet arrival wakes it while the record
+     *  threads read the packets queued before                       */
+    s32EpollFd = epoll_create1(0);
+    for(i = 0; i < NUM_DATA_TYPES; i ++)
+    {
+        if(pDataRecv[i]->getSocketStatus())
+        {
+            sEvent.events = EPOLLIN | EPOLLET;
+            sEvent.data.u32 = i;
+            epoll_ctl(s32EpollFd, EPOLL_CTL_ADD,
+                      sRFDCCard_SockInfo.s32DataSock[i], &sEvent);
+        }
+    }
+#endif
+
+    while(1)
+    {
+        /** Packets read by the record threads since the last check      */
+        for(i = 0; i < NUM_REC_STATS_ENTRIES; i ++)
+        {
+            if(sRFDCCard_InlineStats.u64NumOfRecvdPackets[i] !=
+               u64LastRecvdPackets[i])
+            {
+                u64LastRecvdPackets[i] =
+                        sRFDCCard_InlineStats.u64NumOfRecvdPackets[i];
+                bActive = true;
+            }
+        }
+
+        /** Packets still queued are being read by the record threads    */
+        for(i = 0; i < NUM_DATA_TYPES; i ++)
+        {
+            if(!pDataRecv[i]->getSocketStatus())
+                continue;
+#ifdef _WIN32
+            u32QueuedBytes = 0;
+            ioctlsocket(sRFDCCard_SockInfo.s32DataSock[i], FIONREAD,
+                        &u32QueuedBytes);
+            if(u32QueuedBytes > 0)
+                bActive = true;
+#else
+            s32QueuedBytes = 0;
+            ioctl(sRFDCCard_SockInfo.s32DataSock[i], FIONREAD,
+                  &s32QueuedBytes);
+            if(s32QueuedBytes > 0)
+                bActive = true;
+#endif
+        }
+
+        u64CurTimeUs = osalObj_api.GetTimeInMicroSec();
+        if(bActive)
+            u64LastActiveTimeUs = u64CurTimeUs;
+        else if((u64CurTimeUs - u64LastActiveTimeUs) >= u64QuietPeriodUs)
+            break;
+        bActive = false;
+
+        if((u64CurTimeUs - u64StartTimeUs) >= ((ULONG64)MAX_DRAIN_DURATION_MS *
+                                               MILLI_TO_MICRO_SEC_CONVERSION))
+        {
+#ifdef ENABLE_DEBUG
+            sprintf(s8DebugMsgs, "\n\nSocket drain deadline reached");
+            DEBUG_FILE_WRITE(s8DebugMsgs);
+#endif
+            break;
+        }
+
+        /** Wait for a trailing packet till the end of the quiet period   */
+        s32WaitMs = (SINT32)((u64QuietPeriodUs - (u64CurTimeUs -
+                    u64LastActiveTimeUs)) / MILLI_TO_MICRO_SEC_CONVERSION) + 1;
+#ifdef _WIN32
+        FD_ZERO(&readset);
+        for(i = 0; i < NUM_DATA_TYPES; i ++)
+        {
+            if(pDataRecv[i]->getSocketStatus())
+                FD_SET(sRFDCCard_SockInfo.s32DataSock[i], &readset);
+        }
+        timeout.tv_sec  = s32WaitMs / SEC_TO_MILLI_SEC_CONVERSION;
+        timeout.tv_usec = (s32WaitMs % SEC_TO_MILLI_SEC_CONVERSION) *
+                          MILLI_TO_MICRO_SEC_CONVERSION;
+        if(select(0, &readset, NULL, NULL, &timeout) > 0)
+            bActive = true;
+#else
+        s32NumOfEvents = epoll_wait(s32EpollFd, sEvents, NUM_DATA_TYPES,
+                                    s32WaitMs);
+        if(s32NumOfEvents > 0)
+            bActive = true;
+#endif
+    }
+
+#ifndef _WIN32
+    close(s32EpollFd);
+#endif
+
+    for(i = 0; i < NUM_REC_STATS_ENTRIES; i ++)
+    {
+        sRFDCCard_InlineStats.u64NumOfDrainedPackets[i] =
+                sRFDCCard_InlineStats.u64NumOfRecvdPackets[i] -
+                u64RecvdPackets[i];
+    }
+
+#ifdef ENABLE_DEBUG
+    sprintf(s8DebugMsgs, "\n\nSocket drain done in %llu us",
+            osalObj_api.GetTimeInMicroSec() - u64StartTimeUs);
+    DEBUG_FILE_WRITE(s8DebugMsgs);
+#endif
+}
@@ -101,6 +101,12 @@ public:
      */
     void readConfigDatagrams();
 
+    /** @fn void drainDataSockets()
+     * @brief This function is to wait till the record threads drained <!--
+     * --> the data sockets on record completion
+     */
+    void drainDataSockets();
+
 };
 
 #endif // CONFIGDATARECV_H
@@ -0,0 +1,345 @@
+/**
+ * @file crc32c.cpp
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains the CRC32C (Castagnoli) calculation of the
+ * integrity tags of record data. SSE4.2 crc32 instructions are used
+ * when the processor has them
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+///****************
+/// Includes
+///****************
+
+#include "crc32c.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define CRC32C_HW_X64
+#include <nmmintrin.h>
+#ifdef _WIN32
+#include <intrin.h>
+#endif
+#endif
+
+///****************
+/// Defines
+///****************
+
+/** Instruction set of the crc32 instructions, enabled per function since
+ *  the rest of the tool is built for any processor                        */
+#if defined(__GNUC__)
+#define CRC32C_HW_TARGET __attribute__((target("sse4.2")))
+#else
+#define CRC32C_HW_TARGET
+#endif
+
+/** CRC32C polynomial (bit reflected)                          */
+#define CRC32C_POLYNOMIAL 0x82F63B78
+
+/** Bytes of each of the three data streams the crc32 instructions
+ *  interleave, their CRCs are folded in one at the end of a block   */
+#define CRC32C_LANE_BYTES 8192
+
+/** Zero bytes continued at once for a file hole               */
+#define CRC32C_ZERO_BLOCK_BYTES 65536
+
+///****************
+/// Globals
+///****************
+
+/** Slicing by 8 tables of the software CRC                    */
+static UINT32 au32Crc32cTable[8][256];
+
+/** Tables to shift a CRC over \ref CRC32C_LANE_BYTES zero bytes, per byte
+ *  of the CRC                                                        */
+static UINT32 au32Crc32cLaneShift[4][256];
+
+/** Zero bytes of the file holes                               */
+static const UINT8 au8Crc32cZeros[CRC32C_ZERO_BLOCK_BYTES] = {0};
+
+/** @fn UINT32 crc32cSoftware(UINT32 u32Crc, const UINT8 *pu8Data, ULONG64 u64Size)
+ * @brief This function is to continue the CRC register over bytes, <!--
+ * --> 8 bytes at a time by table lookups
+ * @param [in] u32Crc [UINT32] - CRC register
+ * @param [in] pu8Data [const UINT8 *] - Data bytes
+ * @param [in] u64Size [ULONG64] - Number of bytes
+ * @return UINT32 value
+ */
+static UINT32 crc32cSoftware(UINT32 u32Crc, const UINT8 *pu8Data,
+                             ULONG64 u64Size)
+{
+    UINT32 u32Low = 0;
+    UINT32 u32High = 0;
+
+    while(u64Size >= 8)
+    {
+        u32Low = u32Crc ^ ((UINT32)pu8Data[0] | ((UINT32)pu8Data[1] << 8) |
+                           ((UINT32)pu8Data[2] << 16) |
+                           ((UINT32)pu8Data[3] << 24));
+        u32High = (UINT32)pu8Data[4] | ((UINT32)pu8Data[5] << 8) |
+                  ((UINT32)pu8Data[6] << 16) | ((UINT32)pu8Data[7] << 24);
+        u32Crc = au32Crc32cTable[7][u32Low & 0xFF] ^
+                 au32Crc32cTable[6][(u32Low >> 8) & 0xFF] ^
+                 au32Crc32cTable[5][(u32Low >> 16) & 0xFF] ^
+                 au32Crc32cTable[4][u32Low >> 24] ^
+                 au32Crc32cTable[3][u32High & 0xFF] ^
+                 au32Crc32cTable[2][(u32High >> 8) & 0xFF] ^
+                 au32Crc32cTable[1][(u32High >> 16) & 0xFF] ^
+                 au32Crc32cTable[0][u32High >> 24];
+        pu8Data += 8;
+        u64Size -= 8;
+    }
+
+    while(u64Size > 0)
+    {
+        u32Crc = au32Crc32cTable[0][(u32Crc ^ *pu8Data) & 0xFF] ^ (u32Crc >> 8);
+        pu8Data ++;
+        u64Size --;
+    }
+
+    return u32Crc;
+}
+
+#ifdef CRC32C_HW_X64
+
+/** @fn UINT32 crc32cLaneShift(UINT32 u32Crc)
+ * @brief This function is to shift a CRC register over <!--
+ * --> \ref CRC32C_LANE_BYTES zero bytes
+ * @param [in] u32Crc [UINT32] - CRC register
+ * @return UINT32 value
+ */
+static inline UINT32 crc32cLaneShift(UINT32 u32Crc)
+{
+    return au32Crc32cLaneShift[0][u32Crc & 0xFF] ^
+           au32Crc32cLaneShift[1][(u32Crc >> 8) & 0xFF] ^
+           au32Crc32cLaneShift[2][(u32Crc >> 16) & 0xFF] ^
+           au32Crc32cLaneShift[3][u32Crc >> 24];
+}
+
+/** @fn UINT32 crc32cHardware(UINT32 u32Crc, const UINT8 *pu8Data, ULONG64 u64Size)
+ * @brief This function is to continue the CRC register over bytes by <!--
+ * --> the crc32 instructions. A crc32 instruction takes three cycles, <!--
+ * --> so three data streams are interleaved and folded per block
+ * @param [in] u32Crc [UINT32] - CRC register
+ * @param [in] pu8Data [const UINT8 *] - Data bytes
+ * @param [in] u64Size [ULONG64] - Number of bytes
+ * @return UINT32 value
+ */
+CRC32C_HW_TARGET
+static UINT32 crc32cHardware(UINT32 u32Crc, const UINT8 *pu8Data,
+                             ULONG64 u64Size)
+{
+    ULONG64 u64Crc0 = u32Crc;
+    ULONG64 u64Crc1 = 0;
+    ULONG64 u64Crc2 = 0;
+    ULONG64 u64Word0 = 0;
+    ULONG64 u64Word1 = 0;
+    ULONG64 u64Word2 = 0;
+    UINT32 i = 0;
+
+    while((u64Size > 0) && ((((uintptr_t)pu8Data) & 7) != 0))
+    {
+        u64Crc0 = _mm_crc32_u8((UINT32)u64Crc0, *pu8Data);
+        pu8Data ++;
+        u64Size --;
+    }
+
+    while(u64Size >= (3 * CRC32C_LANE_BYTES))
+    {
+        u64Crc1 = 0;
+        u64Crc2 = 0;
+        for(i = 0; i < CRC32C_LANE_BYTES; i += 8)
+        {
+            memcpy(&u64Word0, &pu8Data[i], 8);
+            memcpy(&u64Word1, &pu8Data[CRC32C_LANE_BYTES + i], 8);
+            memcpy(&u64Word2, &pu8Data[(2 * CRC32C_LANE_BYTES) + i], 8);
+            u64Crc0 = _mm_crc32_u64(u64Crc0, u64Word0);
+            u64Crc1 = _mm_crc32_u64(u64Crc1, u64Word1);
+            u64Crc2 = _mm_crc32_u64(u64Crc2, u64Word2);
+        }
+
+        /** CRC(A B) = CRC(A) shifted over B, xor CRC(B) from zero */
+        u64Crc0 = crc32cLaneShift((UINT32)u64Crc0) ^ (UINT32)u64Crc1;
+        u64Crc0 = crc32cLaneShift((UINT32)u64Crc0) ^ (UINT32)u64Crc2;
+        pu8Data += 3 * CRC32C_LANE_BYTES;
+        u64Size -= 3 * CRC32C_LANE_BYTES;
+    }
+
+    while(u64Size >= 8)
+    {
+        memcpy(&u64Word0, pu8Data, 8);
+        u64Crc0 = _mm_crc32_u64(u64Crc0, u64Word0);
+        pu8Data += 8;
+        u64Size -= 8;
+    }
+
+    while(u64Size > 0)
+    {
+        u64Crc0 = _mm_crc32_u8((UINT32)u64Crc0, *pu8Data);
+        pu8Data ++;
+        u64Size --;
+    }
+
+    return (UINT32)u64Crc0;
+}
+
+#endif
+
+/** @fn bool crc32cInitTables()
+ * @brief This function is to build the CRC tables and detect the <!--
+ * --> crc32 instructions of the processor
+ * @return boolean value
+ */
+static bool crc32cInitTables()
+{
+    UINT32 au32Basis[32];
+    UINT32 u32Crc = 0;
+    UINT32 i = 0;
+    UINT32 j = 0;
+
+    for(i = 0; i < 256; i ++)
+    {
+        u32Crc = i;
+        for(j = 0; j < 8; j ++)
+            u32Crc = (u32Crc >> 1) ^ ((u32Crc & 1) ? CRC32C_POLYNOMIAL : 0);
+        au32Crc32cTable[0][i] = u32Crc;
+    }
+    for(i = 0; i < 256; i ++)
+    {
+        for(j = 1; j < 8; j ++)
+        {
+            u32Crc = au32Crc32cTable[j - 1][i];
+            au32Crc32cTable[j][i] = (u32Crc >> 8) ^
+                                    au32Crc32cTable[0][u32Crc & 0xFF];
+        }
+    }
+
+    /** The shift over zero bytes is linear, a table entry is the xor of
+     *  the shifted bits of its CRC byte                                 */
+    for(i = 0; i < 32; i ++)
+        au32Basis[i] = crc32cSoftware(1U << i, au8Crc32cZeros,
+                                      CRC32C_LANE_BYTES);
+    for(i = 0; i < 4; i ++)
+    {
+        for(j = 0; j < 256; j ++)
+        {
+            u32Crc = 0;
+            for(UINT32 k = 0; k < 8; k ++)
+            {
+                if(j & (1U << k))
+                    u32Crc ^= au32Basis[(i * 8) + k];
+            }
+            au32Crc32cLaneShift[i][j] = u32Crc;
+        }
+    }
+
+#if defined(CRC32C_HW_X64) && defined(_WIN32)
+    SINT32 as32CpuInfo[4];
+    __cpuid(as32CpuInfo, 1);
+    return ((as32CpuInfo[2] >> 20) & 1) != 0;
+#elif defined(CRC32C_HW_X64)
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse4.2") != 0;
+#else
+    return false;
+#endif
+}
+
+/** @fn bool Crc32cHardwareSupport(void)
+ * @brief This function is to check if the CRC32C is calculated by the <!--
+ * --> processor crc32 instructions
+ * @return boolean value
+ */
+bool Crc32cHardwareSupport(void)
+{
+    /** Tables are built once by the first caller of any thread */
+    static const bool bHwSupport = crc32cInitTables();
+
+    return bHwSupport;
+}
+
+/** @fn UINT32 Crc32cUpdate(UINT32 u32Crc, const void *pData, ULONG64 u64Size)
+ * @brief This function is to continue the CRC32C of a data stream with <!--
+ * --> the next bytes. The CRC of the first bytes is continued from 0
+ * @param [in] u32Crc [UINT32] - CRC32C of the bytes before
+ * @param [in] pData [const void *] - Next bytes of the data stream
+ * @param [in] u64Size [ULONG64] - Number of bytes
+ * @return UINT32 value
+ */
+UINT32 Crc32cUpdate(UINT32 u32Crc, const void *pData, ULONG64 u64Size)
+{
+    /** Also builds the tables of the software CRC */
+    bool bHwSupport = Crc32cHardwareSupport();
+
+#ifdef CRC32C_HW_X64
+    if(bHwSupport)
+        return ~crc32cHardware(~u32Crc, (const UINT8 *)pData, u64Size);
+#else
+    (void)bHwSupport;
+#endif
+
+    return ~crc32cSoftware(~u32Crc, (const UINT8 *)pData, u64Size);
+}
+
+/** @fn UINT32 Crc32cUpdateZeros(UINT32 u32Crc, ULONG64 u64Size)
+ * @brief This function is to continue the CRC32C of a data stream with <!--
+ * --> zero bytes, as the file hole of dropped frames reads
+ * @param [in] u32Crc [UINT32] - CRC32C of the bytes before
+ * @param [in] u64Size [ULONG64] - Number of zero bytes
+ * @return UINT32 value
+ */
+UINT32 Crc32cUpdateZeros(UINT32 u32Crc, ULONG64 u64Size)
+{
+    ULONG64 u64Chunk = 0;
+
+    while(u64Size > 0)
+    {
+        u64Chunk = (u64Size > CRC32C_ZERO_BLOCK_BYTES) ?
+                            CRC32C_ZERO_BLOCK_BYTES : u64Size;
+        u32Crc = Crc32cUpdate(u32Crc, au8Crc32cZeros, u64Chunk);
+        u64Size -= u64Chunk;
+    }
+
+    return u32Crc;
+}
@@ -0,0 +1,90 @@
+/**
+ * @file crc32c.h
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains the CRC32C (Castagnoli) calculation of the
+ * integrity tags of record data. SSE4.2 crc32 instructions are used
+ * when the processor has them
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+#ifndef CRC32C_H
+#define CRC32C_H
+
+///****************
+/// Includes
+///****************
+
+#include "../Common/rf_api_internal.h"
+
+///*****************
+/// API Declarations
+///*****************
+
+/** @fn UINT32 Crc32cUpdate(UINT32 u32Crc, const void *pData, ULONG64 u64Size)
+ * @brief This function is to continue the CRC32C of a data stream with <!--
+ * --> the next bytes. The CRC of the first bytes is continued from 0
+ * @param [in] u32Crc [UINT32] - CRC32C of the bytes before
+ * @param [in] pData [const void *] - Next bytes of the data stream
+ * @param [in] u64Size [ULONG64] - Number of bytes
+ * @return UINT32 value
+ */
+UINT32 Crc32cUpdate(UINT32 u32Crc, const void *pData, ULONG64 u64Size);
+
+/** @fn UINT32 Crc32cUpdateZeros(UINT32 u32Crc, ULONG64 u64Size)
+ * @brief This function is to continue the CRC32C of a data stream with <!--
+ * --> zero bytes, as the file hole of dropped frames reads
+ * @param [in] u32Crc [UINT32] - CRC32C of the bytes before
+ * @param [in] u64Size [ULONG64] - Number of zero bytes
+ * @return UINT32 value
+ */
+UINT32 Crc32cUpdateZeros(UINT32 u32Crc, ULONG64 u64Size);
+
+/** @fn bool Crc32cHardwareSupport(void)
+ * @brief This function is to check if the CRC32C is calculated by the <!--
+ * --> processor crc32 instructions
+ * @return boolean value
+ */
+bool Crc32cHardwareSupport(void);
+
+#endif // CRC32C_H
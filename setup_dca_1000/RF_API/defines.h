@@ -74,15 +74,105 @@
 /** DSP data index                                                           */
 #define DSP_DATA_4_INDEX					4
 
+/** Number of low rate data ports (CP, CQ, R4F, DSP) in MULTI mode          */
+#define NUM_MULTI_PORT_DATA_TYPES           (NUM_DATA_TYPES - CP_DATA_1_INDEX)
+
+/** Wait timeout of the MULTI mode data ports thread in millisec             */
+#define MULTI_PORT_WAIT_TIMEOUT_MS          100
+
+/** Wait timeout of the capture event loop of the ADC data port in
+ *  millisec, the socket state is checked after it                      */
+#define CAPTURE_LOOP_WAIT_TIMEOUT_MS        100
+
+/** Packets read from the ADC data port at once before the timers of the
+ *  capture event loop are checked again                                */
+#define CAPTURE_LOOP_MAX_PACKETS            64
+
+/** Receive buffer of the ADC data port, coalesced packets (UDP GRO) come
+ *  in one datagram of up to 64 KB                                       */
+#define GRO_RECV_BUF_SIZE                   65535
+
+/** Events waited on by the capture event loop (data socket and timers)  */
+#define CAPTURE_LOOP_NUM_OF_EVENTS          3
+
 /** Raw Mode file name                                                       */
 #define RAW_MODE_FILE_NAME                  "_Raw_"
 
+/** Raw Mode file name of the other systems of a shared data port, followed
+ *  by the system index                                                       */
+#define SHARED_PORT_FILE_NAME               "_Raw_Sys"
+
 /** MULTI Mode file name                                                       */
 #define MULTI_MODE_FILE_NAME                "_hdr_"
 
 /** Record data file extension                                               */
 #define REC_DATA_FILE_EXTENSION             ".bin"
 
+/** Stripe manifest file name of a record striped across several paths      */
+#define STRIPE_MANIFEST_FILE_NAME           "Stripes.csv"
+
+/** Stripe manifest first line                                               */
+#define STRIPE_MANIFEST_TITLE               "Stripe manifest"
+
+/** Trigger log file name of a record in the event trigger mode             */
+#define TRIGGER_LOG_FILE_NAME               "Triggers.csv"
+
+/** Trigger log first line                                                   */
+#define TRIGGER_LOG_TITLE                   "Trigger log"
+
+/** CRC32C log file name of a record with integrity tags                  */
+#define CRC_LOG_FILE_NAME                   "Crc32c.csv"
+
+/** CRC32C log first line                                                    */
+#define CRC_LOG_TITLE                       "CRC32C log"
+
+/** Bytes per KB of the CRC32C chunk size                                    */
+#define CRC_CHUNK_BYTES_PER_KB              1024
+
+/** Record data read at once by the verification of a CRC32C log, the
+ *  chunks read are checked by the worker threads while the next are read  */
+#define VERIFY_BATCH_SIZE                   (64 * 1024 * 1024)
+
+/** Segment index file name of a record kept within a total size or age    */
+#define SEGMENT_INDEX_FILE_NAME             "Segments.csv"
+
+/** Segment index first line                                                 */
+#define SEGMENT_INDEX_TITLE                 "Segment index"
+
+/** Extension of the segment index while it is written                      */
+#define SEGMENT_INDEX_TEMP_EXTENSION        ".tmp"
+
+/** Record files of a record kept within a total size or age               */
+#define MAX_RETENTION_SEGMENTS              4096
+
+/** Bytes per MB of the retention size, as of the maximum file size        */
+#define RETENTION_BYTES_PER_MB              (1024 * 1024)
+
+/** Micro seconds per second of the retention age                          */
+#define RETENTION_AGE_US_PER_SEC            1000000
+
+/** Zeros written at once over a hole of a recycled record file            */
+#define RETENTION_ZERO_BUF_SIZE             (64 * 1024)
+
+/** Watermark file name of a record, its committed data is read while it
+ *  is in progress                                                           */
+#define WATERMARK_FILE_NAME                 "Watermark.csv"
+
+/** Watermark file first line                                                */
+#define WATERMARK_TITLE                     "Record watermark"
+
+/** Extension of the watermark file while it is written                     */
+#define WATERMARK_TEMP_EXTENSION            ".tmp"
+
+/** Watermark state of a record in progress                                 */
+#define WATERMARK_STATE_RECORDING           "Recording"
+
+/** Watermark state of a stopped record                                     */
+#define WATERMARK_STATE_COMPLETE            "Complete"
+
+/** Interval in millisec of the watermark poll of a record tail reader      */
+#define RECORD_TAIL_POLL_INTERVAL_MS        10
+
 /** Record data file extension characters length                             */
 #define REC_FILE_EXTN_CHARACTERS			4
 
@@ -95,6 +185,26 @@
 /** Maximum bytes to be recorded in the file  (1GB)                         */
 #define MAX_BYTES_PER_REC_DATA_FILE         1073741824
 
+/** Record files kept mapped by the memory mapped writer, late packets of
+ *  the previous file still land in it                                      */
+#define MMAP_NUM_OF_MAPPED_FILES            2
+
+/** Record files unmapped and waiting for the flush thread to close them,
+ *  the receiver waits only when all of them are in use                    */
+#define MMAP_MAX_RETIRED_FILES              8
+
+/** Memory mapped record data this far after the end of the written data is
+ *  made writable ahead by the flush thread, the receiver copies the data
+ *  without page faults                                                     */
+#define MMAP_PREFAULT_BYTES                 (16 * 1024 * 1024)
+
+/** Interval in millisec of the write back of the memory mapped record files */
+#define MMAP_FLUSH_INTERVAL_MS              100
+
+/** Data this close to the end of the memory mapped record data is not
+ *  written back yet, late packets are still expected there                 */
+#define MMAP_FLUSH_LAG_BYTES                (4 * 1024 * 1024)
+
 /** Maximum bytes in the data packet                                         */
 #define MAX_BYTES_PER_PACKET				1470
 
@@ -116,6 +226,24 @@
 /** Command timeout duration in millisec                                     */
 #define CMD_TIMEOUT_DURATION_MS             10000
 
+/** Default quiet period in millisec of the data socket drain on record
+ *  completion                                                               */
+#define DEFAULT_DRAIN_QUIET_PERIOD_MS       20
+
+/** Maximum duration in millisec of the data socket drain on record
+ *  completion                                                               */
+#define MAX_DRAIN_DURATION_MS               2000
+
+/** Maximum number of commands in flight in a command pipeline              */
+#define MAX_PIPELINE_CMDS                   4
+
+/** Response timeout in millisec of a pipelined command before it is sent
+ *  again                                                                    */
+#define PIPELINE_CMD_RESP_TIMEOUT_MS        1000
+
+/** Number of times a pipelined command is sent again on response timeout   */
+#define PIPELINE_CMD_MAX_RETRIES            2
+
 /** Playback FPGA bitfile identifier bit                                    */
 #define PLAYBACK_BIT_DECODE                 0x4000
 
@@ -134,11 +262,46 @@
 /** Socket receive buffer size                                              */
 #define SOCK_RECV_BUF_SIZE                  0x7FFFFFFF
 
+/** Time in nano seconds to send a record packet on the 1 Gbps link
+ *  (packet, UDP/IP/ethernet headers, preamble and inter-packet gap)        */
+#define REC_PKT_WIRE_TIME_NS                12288
+
+/** Socket receive buffer holding less than this duration of data at the
+ *  peak record data rate is reported as too small                          */
+#define MIN_SOCK_RECV_BUF_DURATION_MS       100
+
 /** Socket send buffer size                                                 */
 #define SOCK_SEND_BUF_SIZE                  0xFFFFF
 
 /** Reordering buffer size for the purpose of swapping bytes algorithm      */
 #define MAX_BYTES_FOR_REORDERING            8
 
+/** Maximum number of record buffers spilled to RAM while the file writer
+ *  is busy (spill capacity is rounded up to record buffers)                */
+#define MAX_WRITER_SPILL_BUFS               16
+
+/** Bytes per MB of the file writer spill capacity                          */
+#define WRITER_SPILL_BYTES_PER_MB           1000000
+
+/** Bytes per MB of the pre-trigger ring capacity                           */
+#define TRIGGER_RING_BYTES_PER_MB           1000000
+
+/** Time marks of the pre-trigger ring, the latest half of them is searched
+ *  for the dump boundaries                                                 */
+#define MAX_TRIGGER_RING_MARKS              131072
+
+/** Minimum interval in micro seconds between the time marks of the
+ *  pre-trigger ring                                                        */
+#define TRIGGER_RING_MARK_INTERVAL_US       1000
+
+/** RX channels of the radar device in the ADC data                         */
+#define NUM_OF_RX_CHANNELS                  4
+
+/** Bytes of a real ADC sample                                              */
+#define ADC_REAL_SAMPLE_BYTES               2
+
+/** Bytes of a complex ADC sample                                           */
+#define ADC_COMPLEX_SAMPLE_BYTES            4
+
 #endif // DEFINES_H
 
@@ -72,12 +72,21 @@ extern EVENT_HANDLER        RFDCARD_Callback;
 /** Callback event handler - Inline processing summary  */
 extern INLINE_PROC_HANDLER RecordInlineProc_Callback;
 
+/** Callback handler - Trigger detection of the pre-trigger ring */
+extern RECORD_TRIGGER_HANDLER RecordTrigger_Callback;
+
 /** Start record config structure                       */
 extern strStartRecConfigMode sRFDCCard_StartRecConfig;
 
 /** Packets dropped count structure                     */
 extern strRFDCCard_InlineProcStats sRFDCCard_InlineStats;
 
+/** Latency histograms structure                        */
+extern strRFDCCard_LatencyStats sRFDCCard_LatencyStats;
+
+/** Test pattern verification stats structure           */
+extern strRFDCCard_PatternStats sRFDCCard_PatternStats;
+
 /** Maximum file size to capture                        */
 extern UINT32 u32MaxFileSizeToCapture;
 
@@ -96,15 +105,11 @@ extern UINT8 u8LaneNumber;
 /** Inline process log file pointer                     */
 extern FILE *pInlineLogFile;
 
-/** Duration stop mode timeout wait event
- * Thread and wait event enabled when duration stop mode config is set for recording
- */
-extern OSAL_SIGNAL_HANDLE_TYPE sgnDurationStopModeWaitEvent;
+/** Pipelined config commands response wait event       */
+extern OSAL_SIGNAL_HANDLE_TYPE sgnCmdPipelineWaitEvent;
 
-/** Capture timeout wait event.
- *  To handle system disconnect/idleness while recording
- */
-extern OSAL_SIGNAL_HANDLE_TYPE sgnCaptureTimeoutWaitEvent;
+/** Shared data port systems command response wait event */
+extern OSAL_SIGNAL_HANDLE_TYPE sgnSharedPortWaitEvent;
 
 
 #endif // EXTERN_H
@@ -0,0 +1,98 @@
+/**
+ * @file latencyhist.h
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains the log linear latency histogram used to
+ * measure the record process latencies (inline processing)
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+#ifndef LATENCYHIST_H
+#define LATENCYHIST_H
+
+///****************
+/// Includes
+///****************
+
+#include "../Common/rf_api_internal.h"
+
+///*****************
+/// API Declarations
+///*****************
+
+/** @fn UINT32 LatencyHistBucketIndex(ULONG64 u64LatencyUs)
+ * @brief This function is to get the histogram bucket of a latency. <!--
+ * --> Latencies below \ref LATENCY_HIST_SUB_BUCKETS have a bucket each, <!--
+ * --> every power of two range above is split in <!--
+ * --> \ref LATENCY_HIST_HALF_SUB_BUCKETS linear buckets
+ * @param [in] u64LatencyUs [ULONG64] - Latency in micro seconds
+ * @return UINT32 value
+ */
+UINT32 LatencyHistBucketIndex(ULONG64 u64LatencyUs);
+
+/** @fn ULONG64 LatencyHistBucketHighUs(UINT32 u32Index)
+ * @brief This function is to get the highest latency counted in a <!--
+ * --> histogram bucket
+ * @param [in] u32Index [UINT32] - Bucket index
+ * @return ULONG64 value
+ */
+ULONG64 LatencyHistBucketHighUs(UINT32 u32Index);
+
+/** @fn void LatencyHistRecord(strRFDCCard_LatencyHist *psHist, ULONG64 u64LatencyUs)
+ * @brief This function is to add a latency sample in the histogram
+ * @param [in] psHist [strRFDCCard_LatencyHist *] - Latency histogram
+ * @param [in] u64LatencyUs [ULONG64] - Latency in micro seconds
+ */
+void LatencyHistRecord(strRFDCCard_LatencyHist *psHist, ULONG64 u64LatencyUs);
+
+/** @fn ULONG64 LatencyHistPercentile(const strRFDCCard_LatencyHist *psHist, DOUBLE dPercentile)
+ * @brief This function is to get the latency below which the given <!--
+ * --> percentage of the samples fall, rounded up to the bucket bound
+ * @param [in] psHist [const strRFDCCard_LatencyHist *] - Latency histogram
+ * @param [in] dPercentile [DOUBLE] - Percentile (0 - 100)
+ * @return ULONG64 value
+ */
+ULONG64 LatencyHistPercentile(const strRFDCCard_LatencyHist *psHist,
+                              DOUBLE dPercentile);
+
+#endif // LATENCYHIST_H
@@ -0,0 +1,723 @@
+/**
+ * @file mmapwriter.cpp
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains the memory mapped writer of the record files
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+///****************
+/// Includes
+///****************
+
+#include "mmapwriter.h"
+
+#include "extern.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
+/** @fn cMmapWriter::cMmapWriter()
+ * @brief This constructor function is to initialize the class member <!--
+ * --> variables
+ */
+cMmapWriter::cMmapWriter()
+{
+    strMmapFilePath[0] = '\0';
+    u64FileSize = 0;
+    for(UINT8 i = 0; i < MMAP_NUM_OF_MAPPED_FILES; i ++)
+    {
+        ps8FileMap[i] = NULL;
+        s32FileFd[i] = -1;
+        u32MapFileCount[i] = 0;
+    }
+    ps8SpareMap = NULL;
+    s32SpareFd = -1;
+    u32SpareFileCount = 0;
+    u32NumOfFilesClaimed = 0;
+    u32NumOfFiles = 0;
+    for(UINT8 i = 0; i < MMAP_MAX_RETIRED_FILES; i ++)
+    {
+        ps8RetiredMap[i] = NULL;
+        s32RetiredFd[i] = -1;
+    }
+    u64HighWater = 0;
+    u64FlushedOffset = 0;
+    u64SyncedOffset = 0;
+    bOpen = false;
+    u32NumOfWriters = 0;
+    bFileError = false;
+    bFlusherActive = false;
+    pWatermark = NULL;
+}
+
+/** @fn cMmapWriter::~cMmapWriter()
+ * @brief This destructor function is to close the record files
+ */
+cMmapWriter::~cMmapWriter()
+{
+    close();
+}
+
+/** @fn bool cMmapWriter::open(const SINT8 *s8FilePath, UINT32 u32MaxFileSize)
+ * @brief This function is to create the first record file and start <!--
+ * --> the flush thread. The file count and extension are appended to <!--
+ * --> the path
+ * @param [in] s8FilePath [const SINT8 *] - File path without the count
+ * @param [in] u32MaxFileSize [UINT32] - Maximum file size
+ * @return boolean value
+ */
+bool cMmapWriter::open(const SINT8 *s8FilePath, UINT32 u32MaxFileSize)
+{
+    SINT8 *ps8Map = NULL;
+    SINT32 s32Fd = -1;
+
+    strcpy(strMmapFilePath, s8FilePath);
+
+    /** Files end at a packet boundary as the files written by the file
+     *  writer do, to avoid i,q conflicts in multiple files            */
+    u64FileSize = (u32MaxFileSize / PAYLOAD_BYTES_PER_PACKET) *
+                  PAYLOAD_BYTES_PER_PACKET;
+    if(u64FileSize == 0)
+        u64FileSize = PAYLOAD_BYTES_PER_PACKET;
+    u32SpareFileCount = 0;
+    u64HighWater = 0;
+    u64FlushedOffset = 0;
+    u64SyncedOffset = 0;
+    u32NumOfWriters = 0;
+    bFileError = false;
+
+    if(!createFile(0, &ps8Map, &s32Fd))
+    {
+        bFileError = true;
+        return false;
+    }
+    ps8FileMap[0] = ps8Map;
+    s32FileFd[0] = s32Fd;
+    u32MapFileCount[0] = 1;
+    u32NumOfFilesClaimed = 1;
+    u32NumOfFiles = 1;
+
+    bFlusherActive = true;
+    osalObj_api.InitEvent(&sgnFlushWaitEvent);
+    osalObj_api.InitEvent(&sgnFlushCompletionWaitEvent);
+
+    std::thread tFlushData([this] { Thread_FlushFiles(); });
+    tFlushData.detach();
+
+    bOpen = true;
+    return true;
+}
+
+/** @fn void cMmapWriter::setWatermark(cRecordWatermark *pWatermarkArg)
+ * @brief This function is to set the watermark published with the <!--
+ * --> write back of the record files, before they are opened
+ * @param [in] pWatermarkArg [cRecordWatermark *] - Watermark, NULL <!--
+ * --> if not published
+ */
+void cMmapWriter::setWatermark(cRecordWatermark *pWatermarkArg)
+{
+    pWatermark = pWatermarkArg;
+}
+
+/** @fn bool cMmapWriter::writeData(ULONG64 u64Offset, const SINT8 *s8Buffer, UINT32 u32Size)
+ * @brief This function is to copy data to its record file offset, the <!--
+ * --> record files up to the offset are taken. Data older than the <!--
+ * --> mapped files is not written
+ * @param [in] u64Offset [ULONG64] - Record file offset of the data
+ * @param [in] s8Buffer [const SINT8 *] - Data
+ * @param [in] u32Size [UINT32] - Size of data
+ * @return boolean value
+ */
+bool cMmapWriter::writeData(ULONG64 u64Offset, const SINT8 *s8Buffer,
+                            UINT32 u32Size)
+{
+    ULONG64 u64FileOffset = 0;
+    UINT32 u32FileCount = 0;
+    UINT32 u32Chunk = 0;
+    UINT32 u32ByteIndex = 0;
+    SINT8 *ps8Map = NULL;
+    bool bStatus = true;
+
+    /** The files are not unmapped by the record stop while data is
+     *  copied, the stop waits for the writers after closing them    */
+    u32NumOfWriters ++;
+    if(!bOpen)
+    {
+        u32NumOfWriters --;
+        return false;
+    }
+
+    while(u32ByteIndex < u32Size)
+    {
+        u32FileCount = (UINT32)(u64Offset / u64FileSize);
+        u64FileOffset = u64Offset % u64FileSize;
+        u32Chunk = u32Size - u32ByteIndex;
+        if(u32Chunk > (u64FileSize - u64FileOffset))
+            u32Chunk = (UINT32)(u64FileSize - u64FileOffset);
+
+        ps8Map = getFileMap(u32FileCount);
+        if(ps8Map == NULL)
+        {
+            bStatus = false;
+            break;
+        }
+        memcpy(&ps8Map[u64FileOffset], &s8Buffer[u32ByteIndex], u32Chunk);
+
+        u64Offset += u32Chunk;
+        u32ByteIndex += u32Chunk;
+    }
+
+    if(u64Offset > u64HighWater)
+        u64HighWater = u64Offset;
+
+    u32NumOfWriters --;
+    return bStatus;
+}
+
+/** @fn void cMmapWriter::close()
+ * @brief This function is to stop the flush thread, write the rest of <!--
+ * --> the data back to disk and close the record files. The last file <!--
+ * --> is cut to the written data, an unused next file is removed
+ */
+void cMmapWriter::close()
+{
+    SINT8 s8FileName[MAX_NAME_LEN * 3];
+    ULONG64 u64FileStart = 0;
+    ULONG64 u64Used = 0;
+    SINT32 s32Fd = -1;
+
+    bOpen = false;
+    while(u32NumOfWriters > 0)
+        osalObj_api.SleepInMilliSec(1);
+
+    /** Let the flush thread close the retired files and exit before its
+     *  events are released                                            */
+    if(bFlusherActive)
+    {
+        bFlusherActive = false;
+        osalObj_api.SignalEvent(&sgnFlushWaitEvent);
+        osalObj_api.WaitForSignal(&sgnFlushCompletionWaitEvent, NON_STOP);
+
+        osalObj_api.DeInitEvent(&sgnFlushCompletionWaitEvent);
+        osalObj_api.DeInitEvent(&sgnFlushWaitEvent);
+    }
+
+    if(u32SpareFileCount != 0)
+    {
+        getFileName(u32SpareFileCount - 1, s8FileName);
+#ifndef _WIN32
+        munmap(ps8SpareMap, u64FileSize);
+        ::close(s32SpareFd);
+        unlink(s8FileName);
+#endif
+        ps8SpareMap = NULL;
+        s32SpareFd = -1;
+        u32SpareFileCount = 0;
+    }
+
+    for(UINT8 i = 0; i < MMAP_NUM_OF_MAPPED_FILES; i ++)
+    {
+        if(u32MapFileCount[i] == 0)
+            continue;
+
+        u64FileStart = (ULONG64)(u32MapFileCount[i] - 1) * u64FileSize;
+        u64Used = (u64HighWater > u64FileStart) ?
+                  (u64HighWater - u64FileStart) : 0;
+        if(u64Used > u64FileSize)
+            u64Used = u64FileSize;
+        s32Fd = s32FileFd[i];
+
+#ifndef _WIN32
+        if(u64Used > 0)
+            msync(ps8FileMap[i], u64Used, MS_SYNC);
+        munmap(ps8FileMap[i], u64FileSize);
+
+        /** Preallocated space after the written data is given back */
+        if(u64Used < u64FileSize)
+        {
+            if(ftruncate(s32Fd, u64Used) != 0)
+                RFDCARD_Callback(CMD_CODE_SYSTEM_ASYNC_STATUS,
+                                 STS_REC_FILE_CREATION_ERR);
+        }
+        ::close(s32Fd);
+#endif
+
+        ps8FileMap[i] = NULL;
+        s32FileFd[i] = -1;
+        u32MapFileCount[i] = 0;
+    }
+
+    /** Rest of the data is committed with the record stop */
+    if(pWatermark != NULL)
+    {
+        publishWatermark(u64HighWater, true);
+        pWatermark = NULL;
+    }
+}
+
+/** @fn SINT8 *cMmapWriter::getFileMap(UINT32 u32FileCount)
+ * @brief This function is to get the mapped record file of a file <!--
+ * --> count, the files up to it are taken
+ * @param [in] u32FileCount [UINT32] - File count
+ * @return SINT8 pointer, NULL if the file is not mapped
+ */
+SINT8 *cMmapWriter::getFileMap(UINT32 u32FileCount)
+{
+    UINT8 u8Slot = u32FileCount % MMAP_NUM_OF_MAPPED_FILES;
+
+    if(u32MapFileCount[u8Slot] == (u32FileCount + 1))
+        return ps8FileMap[u8Slot];
+
+    /** Data of a retired file is too late, data after a failed file
+     *  creation is not written, error is already reported             */
+    if((u32FileCount < u32NumOfFiles) || bFileError)
+        return NULL;
+
+    /** Files skipped over by lost packets are taken as well, they keep
+     *  the zeros of the preallocated space                            */
+    while(u32NumOfFiles <= u32FileCount)
+    {
+        if(!takeNextFile())
+        {
+            bFileError = true;
+            return NULL;
+        }
+    }
+
+    return ps8FileMap[u8Slot];
+}
+
+/** @fn bool cMmapWriter::takeNextFile()
+ * @brief This function is to map the next record file in its slot, <!--
+ * --> the file created ahead by the flush thread is taken if ready
+ * @return boolean value
+ */
+bool cMmapWriter::takeNextFile()
+{
+    UINT32 u32FileCount = u32NumOfFiles;
+    UINT32 u32Claimed = 0;
+    UINT8 u8Slot = u32FileCount % MMAP_NUM_OF_MAPPED_FILES;
+    SINT8 *ps8Map = NULL;
+    SINT32 s32Fd = -1;
+
+    /** The file is created here only if the flush thread did not claim
+     *  it, else its creation by the flush thread is waited for        */
+    while(true)
+    {
+        if(u32SpareFileCount == (u32FileCount + 1))
+        {
+            ps8Map = ps8SpareMap;
+            s32Fd = s32SpareFd;
+            u32SpareFileCount = 0;
+            break;
+        }
+
+        u32Claimed = u32FileCount;
+        if(u32NumOfFilesClaimed.compare_exchange_strong(u32Claimed,
+                                                       u32FileCount + 1))
+        {
+            if(!createFile(u32FileCount, &ps8Map, &s32Fd))
+                return false;
+            break;
+        }
+
+        if(bFileError)
+            return false;
+        osalObj_api.SleepInMilliSec(1);
+    }
+
+    if(u32MapFileCount[u8Slot] != 0)
+        retireFile(u8Slot);
+
+    /** The flush thread reads the map of the slot only while the file
+     *  count matches                                                  */
+    ps8FileMap[u8Slot] = ps8Map;
+    s32FileFd[u8Slot] = s32Fd;
+    u32MapFileCount[u8Slot] = u32FileCount + 1;
+    u32NumOfFiles ++;
+
+    /** Wake up the flush thread to create the next file */
+    osalObj_api.SignalEvent(&sgnFlushWaitEvent);
+    return true;
+}
+
+/** @fn void cMmapWriter::prepareNextFile()
+ * @brief This function is to create the next record file ahead, <!--
+ * --> unless it is taken or created already
+ */
+void cMmapWriter::prepareNextFile()
+{
+    UINT32 u32FileCount = u32NumOfFiles;
+    UINT32 u32Claimed = u32FileCount;
+    SINT8 *ps8Map = NULL;
+    SINT32 s32Fd = -1;
+
+    if(bFileError || (u32SpareFileCount != 0))
+        return;
+
+    if(!u32NumOfFilesClaimed.compare_exchange_strong(u32Claimed,
+                                                    u32FileCount + 1))
+        return;
+
+    if(!createFile(u32FileCount, &ps8Map, &s32Fd))
+    {
+        bFileError = true;
+        return;
+    }
+    ps8SpareMap = ps8Map;
+    s32SpareFd = s32Fd;
+    u32SpareFileCount = u32FileCount + 1;
+}
+
+/** @fn void cMmapWriter::getFileName(UINT32 u32FileCount, SINT8 *s8FileName)
+ * @brief This function is to get the record file name of a file count
+ * @param [in] u32FileCount [UINT32] - File count
+ * @param [out] s8FileName [SINT8 *] - File name
+ */
+void cMmapWriter::getFileName(UINT32 u32FileCount, SINT8 *s8FileName)
+{
+    strcpy(s8FileName, strMmapFilePath);
+    strcat(s8FileName, std::to_string(u32FileCount).c_str());
+    strcat(s8FileName, REC_DATA_FILE_EXTENSION);
+}
+
+/** @fn bool cMmapWriter::createFile(UINT32 u32FileCount, SINT8 **pps8Map, SINT32 *ps32Fd)
+ * @brief This function is to create a record file, preallocate it, <!--
+ * --> map it and make its first pages writable
+ * @param [in] u32FileCount [UINT32] - File count
+ * @param [out] pps8Map [SINT8 **] - Mapped file
+ * @param [out] ps32Fd [SINT32 *] - File descriptor
+ * @return boolean value
+ */
+bool cMmapWriter::createFile(UINT32 u32FileCount, SINT8 **pps8Map,
+                             SINT32 *ps32Fd)
+{
+    SINT8 s8FileName[MAX_NAME_LEN * 3];
+
+    getFileName(u32FileCount, s8FileName);
+
+#ifndef _WIN32
+    SINT32 s32Fd = ::open(s8FileName, O_RDWR | O_CREAT | O_TRUNC, 0666);
+    void *pMap = MAP_FAILED;
+
+    /** Space is allocated up front, a write in a mapped hole would fault
+     *  on a full disk                                                  */
+    if(s32Fd >= 0)
+    {
+        if(posix_fallocate(s32Fd, 0, u64FileSize) == 0)
+            pMap = mmap(NULL, u64FileSize, PROT_READ | PROT_WRITE,
+                        MAP_SHARED, s32Fd, 0);
+        if(pMap == MAP_FAILED)
+        {
+            ::close(s32Fd);
+            s32Fd = -1;
+        }
+    }
+
+    if(s32Fd >= 0)
+    {
+        prefaultMap((SINT8 *)pMap, 0, (u64FileSize < MMAP_PREFAULT_BYTES) ?
+                                      u64FileSize : MMAP_PREFAULT_BYTES);
+        *pps8Map = (SINT8 *)pMap;
+        *ps32Fd = s32Fd;
+        return true;
+    }
+#else
+    (void)pps8Map;
+    (void)ps32Fd;
+#endif
+
+    RFDCARD_Callback(CMD_CODE_SYSTEM_ASYNC_STATUS,
+                     STS_REC_FILE_CREATION_ERR);
+    return false;
+}
+
+/** @fn void cMmapWriter::retireFile(UINT8 u8Slot)
+ * @brief This function is to leave the record file of the slot to the <!--
+ * --> flush thread to unmap, write back and close
+ * @param [in] u8Slot [UINT8] - Mapped file slot
+ */
+void cMmapWriter::retireFile(UINT8 u8Slot)
+{
+    u32MapFileCount[u8Slot] = 0;
+
+    /** The flush thread may be waiting on the disk, the receiver waits
+     *  only when the disk is behind by all of the retired files        */
+    while(s32FileFd[u8Slot] != -1)
+    {
+        for(UINT8 i = 0; i < MMAP_MAX_RETIRED_FILES; i ++)
+        {
+            if(s32RetiredFd[i] == -1)
+            {
+                ps8RetiredMap[i] = ps8FileMap[u8Slot];
+                s32RetiredFd[i] = s32FileFd[u8Slot].load();
+                s32FileFd[u8Slot] = -1;
+                break;
+            }
+        }
+        if(s32FileFd[u8Slot] != -1)
+            osalObj_api.SleepInMilliSec(1);
+    }
+    ps8FileMap[u8Slot] = NULL;
+}
+
+/** @fn void cMmapWriter::Thread_FlushFiles()
+ * @brief This thread function is to close the retired record files, <!--
+ * --> create the next file, make the pages ahead of the data writable <!--
+ * --> and write the completed regions back to disk
+ */
+void cMmapWriter::Thread_FlushFiles()
+{
+    ULONG64 u64Completed = 0;
+    ULONG64 u64HighWaterNow = 0;
+    SINT32 s32Fd = -1;
+
+    while(true)
+    {
+        osalObj_api.WaitForSignalInMilliSec(&sgnFlushWaitEvent,
+                                            MMAP_FLUSH_INTERVAL_MS);
+
+        /** Write back of the retired files is started, the page cache
+         *  keeps their data after they are closed                     */
+        for(UINT8 i = 0; i < MMAP_MAX_RETIRED_FILES; i ++)
+        {
+            s32Fd = s32RetiredFd[i];
+            if(s32Fd == -1)
+                continue;
+
+            syncFile(s32Fd, 0, 0, false);
+#ifndef _WIN32
+            munmap(ps8RetiredMap[i], u64FileSize);
+            ::close(s32Fd);
+#endif
+            ps8RetiredMap[i] = NULL;
+            s32RetiredFd[i] = -1;
+        }
+
+        /** Record is stopped, the rest is written back on close */
+        if(!bFlusherActive)
+            break;
+
+        /** File creation and page faults wait on the file system, they
+         *  are done here ahead of the data                              */
+        prepareNextFile();
+        u64HighWaterNow = u64HighWater;
+        prefaultRange(u64HighWaterNow, u64HighWaterNow + MMAP_PREFAULT_BYTES);
+
+        /** Wait for the region started last time, then start the region
+         *  completed since. Late packets are still expected close to the
+         *  end of the written data, a late packet in a region already
+         *  written back only dirties its page again                     */
+        flushRange(u64SyncedOffset, u64FlushedOffset, true);
+        u64SyncedOffset = u64FlushedOffset;
+
+        u64Completed = (u64HighWaterNow > MMAP_FLUSH_LAG_BYTES) ?
+                       (u64HighWaterNow - MMAP_FLUSH_LAG_BYTES) : 0;
+        if(u64Completed > u64FlushedOffset)
+        {
+            flushRange(u64FlushedOffset, u64Completed, false);
+            u64FlushedOffset = u64Completed;
+        }
+
+        /** Late packets are not expected before the region written back,
+         *  readers of the record files get the data till there          */
+        publishWatermark(u64FlushedOffset, false);
+    }
+
+    /** Signal the exit to the record stop */
+    osalObj_api.SignalEvent(&sgnFlushCompletionWaitEvent);
+}
+
+/** @fn void cMmapWriter::publishWatermark(ULONG64 u64Offset, bool bComplete)
+ * @brief This function is to publish the record data till an offset <!--
+ * --> as committed
+ * @param [in] u64Offset [ULONG64] - Record file offset of the end of <!--
+ * --> the committed data
+ * @param [in] bComplete [bool] - Record is stopped, nothing follows
+ */
+void cMmapWriter::publishWatermark(ULONG64 u64Offset, bool bComplete)
+{
+    UINT32 u32FileCount = 0;
+
+    if(pWatermark == NULL)
+        return;
+
+    /** Data ending at a file boundary is in the full file, the next file
+     *  may not be created yet                                          */
+    if(u64Offset > 0)
+        u32FileCount = (UINT32)((u64Offset - 1) / u64FileSize);
+    pWatermark->publish(u32FileCount,
+                        u64Offset - ((ULONG64)u32FileCount * u64FileSize),
+                        u64Offset, bComplete);
+}
+
+/** @fn void cMmapWriter::prefaultRange(ULONG64 u64Start, ULONG64 u64End)
+ * @brief This function is to make a range of the mapped record files <!--
+ * --> writable before the data is copied
+ * @param [in] u64Start [ULONG64] - Record file offset of the range start
+ * @param [in] u64End [ULONG64] - Record file offset of the range end
+ */
+void cMmapWriter::prefaultRange(ULONG64 u64Start, ULONG64 u64End)
+{
+    ULONG64 u64FileStart = 0;
+    ULONG64 u64ChunkEnd = 0;
+    UINT32 u32FileCount = 0;
+    UINT8 u8Slot = 0;
+    SINT8 *ps8Map = NULL;
+
+    while(u64Start < u64End)
+    {
+        u32FileCount = (UINT32)(u64Start / u64FileSize);
+        u64FileStart = (ULONG64)u32FileCount * u64FileSize;
+        u64ChunkEnd = u64FileStart + u64FileSize;
+        if(u64ChunkEnd > u64End)
+            u64ChunkEnd = u64End;
+
+        /** Only this thread unmaps the files, the map read between two
+         *  matching file counts is the map of the file                 */
+        u8Slot = u32FileCount % MMAP_NUM_OF_MAPPED_FILES;
+        if(u32MapFileCount[u8Slot] == (u32FileCount + 1))
+        {
+            ps8Map = ps8FileMap[u8Slot];
+            if((ps8Map != NULL) &&
+               (u32MapFileCount[u8Slot] == (u32FileCount + 1)))
+                prefaultMap(ps8Map, u64Start - u64FileStart,
+                            u64ChunkEnd - u64Start);
+        }
+
+        u64Start = u64ChunkEnd;
+    }
+}
+
+/** @fn void cMmapWriter::prefaultMap(SINT8 *ps8Map, ULONG64 u64Start, ULONG64 u64Size)
+ * @brief This function is to make a range of a mapped record file <!--
+ * --> writable, the data is not changed
+ * @param [in] ps8Map [SINT8 *] - Mapped file
+ * @param [in] u64Start [ULONG64] - File offset of the range
+ * @param [in] u64Size [ULONG64] - Size of the range
+ */
+void cMmapWriter::prefaultMap(SINT8 *ps8Map, ULONG64 u64Start, ULONG64 u64Size)
+{
+#if defined(MADV_POPULATE_WRITE)
+    ULONG64 u64PageSize = (ULONG64)sysconf(_SC_PAGESIZE);
+    ULONG64 u64PageStart = (u64Start / u64PageSize) * u64PageSize;
+
+    /** Pages already writable are skipped by the kernel, an older kernel
+     *  fails the call and the pages fault on the first copy             */
+    madvise(&ps8Map[u64PageStart], u64Size + (u64Start - u64PageStart),
+            MADV_POPULATE_WRITE);
+#else
+    (void)ps8Map;
+    (void)u64Start;
+    (void)u64Size;
+#endif
+}
+
+/** @fn void cMmapWriter::flushRange(ULONG64 u64Start, ULONG64 u64End, bool bWait)
+ * @brief This function is to write a range of the mapped record <!--
+ * --> files back to disk
+ * @param [in] u64Start [ULONG64] - Record file offset of the range start
+ * @param [in] u64End [ULONG64] - Record file offset of the range end
+ * @param [in] bWait [bool] - Wait for the write back, else only start it
+ */
+void cMmapWriter::flushRange(ULONG64 u64Start, ULONG64 u64End, bool bWait)
+{
+    ULONG64 u64FileStart = 0;
+    ULONG64 u64ChunkEnd = 0;
+    UINT32 u32FileCount = 0;
+    UINT8 u8Slot = 0;
+    SINT32 s32Fd = -1;
+
+    while(u64Start < u64End)
+    {
+        u32FileCount = (UINT32)(u64Start / u64FileSize);
+        u64FileStart = (ULONG64)u32FileCount * u64FileSize;
+        u64ChunkEnd = u64FileStart + u64FileSize;
+        if(u64ChunkEnd > u64End)
+            u64ChunkEnd = u64End;
+
+        /** Write back of a retired file is started when it is closed */
+        u8Slot = u32FileCount % MMAP_NUM_OF_MAPPED_FILES;
+        s32Fd = s32FileFd[u8Slot];
+        if((s32Fd != -1) && (u32MapFileCount[u8Slot] == (u32FileCount + 1)))
+            syncFile(s32Fd, u64Start - u64FileStart, u64ChunkEnd - u64Start,
+                     bWait);
+
+        u64Start = u64ChunkEnd;
+    }
+}
+
+/** @fn void cMmapWriter::syncFile(SINT32 s32Fd, ULONG64 u64Start, ULONG64 u64Size, bool bWait)
+ * @brief This function is to write a range of a record file back to disk
+ * @param [in] s32Fd [SINT32] - File descriptor
+ * @param [in] u64Start [ULONG64] - File offset of the range
+ * @param [in] u64Size [ULONG64] - Size of the range, 0 till the end
+ * @param [in] bWait [bool] - Wait for the write back, else only start it
+ */
+void cMmapWriter::syncFile(SINT32 s32Fd, ULONG64 u64Start, ULONG64 u64Size,
+                           bool bWait)
+{
+#if defined(SYNC_FILE_RANGE_WRITE)
+    UINT32 u32Flags = SYNC_FILE_RANGE_WRITE;
+
+    if(bWait)
+        u32Flags |= (SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WAIT_AFTER);
+    sync_file_range(s32Fd, u64Start, u64Size, u32Flags);
+#elif !defined(_WIN32)
+    /** Write back of a range is not available, the whole file is
+     *  written back on wait                                      */
+    (void)u64Start;
+    (void)u64Size;
+    if(bWait)
+        fdatasync(s32Fd);
+#else
+    (void)s32Fd;
+    (void)u64Start;
+    (void)u64Size;
+    (void)bWait;
+#endif
+}
@@ -0,0 +1,294 @@
+/**
+ * @file mmapwriter.h
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains the memory mapped writer of the record files
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+#ifndef MMAPWRITER_H
+#define MMAPWRITER_H
+
+///****************
+/// Includes
+///****************
+
+#include "../Common/rf_api_internal.h"
+#include "../Common/Osal_Utils/osal.h"
+
+#include "defines.h"
+#include "recordwatermark.h"
+
+/** The mapped files and the highest written offset are shared by the data
+ *  port thread and the flush thread, hence keep the class aligned for the
+ *  atomic access                                                            */
+#pragma pack(push, 8)
+
+/** @class cMmapWriter
+ * @brief This class provides support APIs to write the record data in <!--
+ * --> preallocated record files of defined size mapped in memory. Data <!--
+ * --> is copied to its record file offset, hence late packets land at <!--
+ * --> their position. A flush thread creates the next record file ahead, <!--
+ * --> makes the pages ahead of the data writable and writes the <!--
+ * --> completed regions back to disk while the record goes on (inline <!--
+ * --> processing)
+ */
+class cMmapWriter
+{
+    /** Record data file path without the file count        */
+    SINT8 strMmapFilePath[MAX_NAME_LEN * 2];
+
+    /** Bytes of a record file, whole packets of the maximum file size */
+    ULONG64 u64FileSize;
+
+    /** Mapped record files, indexed by the file count      */
+    std::atomic<SINT8 *> ps8FileMap[MMAP_NUM_OF_MAPPED_FILES];
+
+    /** File descriptors of the mapped record files         */
+    std::atomic<SINT32> s32FileFd[MMAP_NUM_OF_MAPPED_FILES];
+
+    /** File count + 1 of the mapped record files, 0 if none */
+    std::atomic<UINT32> u32MapFileCount[MMAP_NUM_OF_MAPPED_FILES];
+
+    /** Next record file created ahead by the flush thread  */
+    SINT8 *ps8SpareMap;
+
+    /** File descriptor of the next record file             */
+    SINT32 s32SpareFd;
+
+    /** File count + 1 of the next record file when it is ready, 0 if none */
+    std::atomic<UINT32> u32SpareFileCount;
+
+    /** Number of record files created or being created, the file is <!--
+     *  created by the thread which claims it               */
+    std::atomic<UINT32> u32NumOfFilesClaimed;
+
+    /** Number of record files taken in the mapped files    */
+    std::atomic<UINT32> u32NumOfFiles;
+
+    /** Record files unmapped and left to the flush thread to close */
+    SINT8 *ps8RetiredMap[MMAP_MAX_RETIRED_FILES];
+
+    /** File descriptors of the retired record files, -1 if none */
+    std::atomic<SINT32> s32RetiredFd[MMAP_MAX_RETIRED_FILES];
+
+    /** Record file offset of the end of the written data   */
+    std::atomic<ULONG64> u64HighWater;
+
+    /** Write back to disk is started till this offset      */
+    ULONG64 u64FlushedOffset;
+
+    /** Write back to disk is completed till this offset    */
+    ULONG64 u64SyncedOffset;
+
+    /** Record files are open for writing                   */
+    std::atomic<bool> bOpen;
+
+    /** Data port threads copying data in the mapped files  */
+    std::atomic<UINT32> u32NumOfWriters;
+
+    /** File creation failed, the rest of the data is not written */
+    std::atomic<bool> bFileError;
+
+    /** Flush thread runs till the record files are closed  */
+    bool bFlusherActive;
+
+    /** Watermark of the data written back, NULL if not published */
+    cRecordWatermark *pWatermark;
+
+    /** Flush wake up event (record file taken or record stop), the <!--
+     *  event type is packed, hence the events are aligned for the futex */
+    alignas(8) OSAL_SIGNAL_HANDLE_TYPE sgnFlushWaitEvent;
+
+    /** Flush thread exit event                             */
+    alignas(8) OSAL_SIGNAL_HANDLE_TYPE sgnFlushCompletionWaitEvent;
+
+public:
+    /** @fn cMmapWriter()
+     * @brief This constructor function is to initialize the class member <!--
+     * --> variables
+     */
+    cMmapWriter();
+
+    /** @fn ~cMmapWriter()
+     * @brief This destructor function is to close the record files
+     */
+    ~cMmapWriter();
+
+    /** @fn bool open(const SINT8 *s8FilePath, UINT32 u32MaxFileSize)
+     * @brief This function is to create the first record file and start <!--
+     * --> the flush thread. The file count and extension are appended to <!--
+     * --> the path
+     * @param [in] s8FilePath [const SINT8 *] - File path without the count
+     * @param [in] u32MaxFileSize [UINT32] - Maximum file size
+     * @return boolean value
+     */
+    bool open(const SINT8 *s8FilePath, UINT32 u32MaxFileSize);
+
+    /** @fn void setWatermark(cRecordWatermark *pWatermarkArg)
+     * @brief This function is to set the watermark published with the <!--
+     * --> write back of the record files, before they are opened
+     * @param [in] pWatermarkArg [cRecordWatermark *] - Watermark, NULL <!--
+     * --> if not published
+     */
+    void setWatermark(cRecordWatermark *pWatermarkArg);
+
+    /** @fn bool writeData(ULONG64 u64Offset, const SINT8 *s8Buffer, UINT32 u32Size)
+     * @brief This function is to copy data to its record file offset, the <!--
+     * --> record files up to the offset are taken. Data older than the <!--
+     * --> mapped files is not written
+     * @param [in] u64Offset [ULONG64] - Record file offset of the data
+     * @param [in] s8Buffer [const SINT8 *] - Data
+     * @param [in] u32Size [UINT32] - Size of data
+     * @return boolean value
+     */
+    bool writeData(ULONG64 u64Offset, const SINT8 *s8Buffer, UINT32 u32Size);
+
+    /** @fn void close()
+     * @brief This function is to stop the flush thread, write the rest of <!--
+     * --> the data back to disk and close the record files. The last file <!--
+     * --> is cut to the written data, an unused next file is removed
+     */
+    void close();
+
+private:
+    /** @fn void publishWatermark(ULONG64 u64Offset, bool bComplete)
+     * @brief This function is to publish the record data till an offset <!--
+     * --> as committed
+     * @param [in] u64Offset [ULONG64] - Record file offset of the end of <!--
+     * --> the committed data
+     * @param [in] bComplete [bool] - Record is stopped, nothing follows
+     */
+    void publishWatermark(ULONG64 u64Offset, bool bComplete);
+
+    /** @fn SINT8 *getFileMap(UINT32 u32FileCount)
+     * @brief This function is to get the mapped record file of a file <!--
+     * --> count, the files up to it are taken
+     * @param [in] u32FileCount [UINT32] - File count
+     * @return SINT8 pointer, NULL if the file is not mapped
+     */
+    SINT8 *getFileMap(UINT32 u32FileCount);
+
+    /** @fn bool takeNextFile()
+     * @brief This function is to map the next record file in its slot, <!--
+     * --> the file created ahead by the flush thread is taken if ready
+     * @return boolean value
+     */
+    bool takeNextFile();
+
+    /** @fn void prepareNextFile()
+     * @brief This function is to create the next record file ahead, <!--
+     * --> unless it is taken or created already
+     */
+    void prepareNextFile();
+
+    /** @fn void getFileName(UINT32 u32FileCount, SINT8 *s8FileName)
+     * @brief This function is to get the record file name of a file count
+     * @param [in] u32FileCount [UINT32] - File count
+     * @param [out] s8FileName [SINT8 *] - File name
+     */
+    void getFileName(UINT32 u32FileCount, SINT8 *s8FileName);
+
+    /** @fn bool createFile(UINT32 u32FileCount, SINT8 **pps8Map, SINT32 *ps32Fd)
+     * @brief This function is to create a record file, preallocate it, <!--
+     * --> map it and make its first pages writable
+     * @param [in] u32FileCount [UINT32] - File count
+     * @param [out] pps8Map [SINT8 **] - Mapped file
+     * @param [out] ps32Fd [SINT32 *] - File descriptor
+     * @return boolean value
+     */
+    bool createFile(UINT32 u32FileCount, SINT8 **pps8Map, SINT32 *ps32Fd);
+
+    /** @fn void retireFile(UINT8 u8Slot)
+     * @brief This function is to leave the record file of the slot to the <!--
+     * --> flush thread to unmap, write back and close
+     * @param [in] u8Slot [UINT8] - Mapped file slot
+     */
+    void retireFile(UINT8 u8Slot);
+
+    /** @fn void Thread_FlushFiles()
+     * @brief This thread function is to close the retired record files, <!--
+     * --> create the next file, make the pages ahead of the data writable <!--
+     * --> and write the completed regions back to disk
+     */
+    void Thread_FlushFiles();
+
+    /** @fn void prefaultRange(ULONG64 u64Start, ULONG64 u64End)
+     * @brief This function is to make a range of the mapped record files <!--
+     * --> writable before the data is copied
+     * @param [in] u64Start [ULONG64] - Record file offset of the range start
+     * @param [in] u64End [ULONG64] - Record file offset of the range end
+     */
+    void prefaultRange(ULONG64 u64Start, ULONG64 u64End);
+
+    /** @fn void prefaultMap(SINT8 *ps8Map, ULONG64 u64Start, ULONG64 u64Size)
+     * @brief This function is to make a range of a mapped record file <!--
+     * --> writable, the data is not changed
+     * @param [in] ps8Map [SINT8 *] - Mapped file
+     * @param [in] u64Start [ULONG64] - File offset of the range
+     * @param [in] u64Size [ULONG64] - Size of the range
+     */
+    void prefaultMap(SINT8 *ps8Map, ULONG64 u64Start, ULONG64 u64Size);
+
+    /** @fn void flushRange(ULONG64 u64Start, ULONG64 u64End, bool bWait)
+     * @brief This function is to write a range of the mapped record <!--
+     * --> files back to disk
+     * @param [in] u64Start [ULONG64] - Record file offset of the range start
+     * @param [in] u64End [ULONG64] - Record file offset of the range end
+     * @param [in] bWait [bool] - Wait for the write back, else only start it
+     */
+    void flushRange(ULONG64 u64Start, ULONG64 u64End, bool bWait);
+
+    /** @fn void syncFile(SINT32 s32Fd, ULONG64 u64Start, ULONG64 u64Size, bool bWait)
+     * @brief This function is to write a range of a record file back to disk
+     * @param [in] s32Fd [SINT32] - File descriptor
+     * @param [in] u64Start [ULONG64] - File offset of the range
+     * @param [in] u64Size [ULONG64] - Size of the range, 0 till the end
+     * @param [in] bWait [bool] - Wait for the write back, else only start it
+     */
+    void syncFile(SINT32 s32Fd, ULONG64 u64Start, ULONG64 u64Size, bool bWait);
+};
+
+#pragma pack(pop)
+
+#endif // MMAPWRITER_H
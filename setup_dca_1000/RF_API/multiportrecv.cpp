@@ -0,0 +1,228 @@
+/**
+ * @file multiportrecv.cpp
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains the class to receive the low rate data ports
+ * (CP, CQ, R4F, DSP) of MULTI mode in a single thread
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+///****************
+/// Includes
+///****************
+
+#include "multiportrecv.h"
+#include "capturetimers.h"
+#include "extern.h"
+
+#ifndef _WIN32
+#include <sys/epoll.h>
+#endif
+
+///****************
+/// Externs
+///****************
+
+/** Duration stop mode and capture timeout - class object */
+extern cCaptureTimers objCaptureTimers;
+
+/** @fn cUdpMultiPortReceiver::cUdpMultiPortReceiver(cUdpDataReceiver *pCpDataRecv, <!--
+ * --> cUdpDataReceiver *pCqDataRecv, cUdpDataReceiver *pR4fDataRecv, <!--
+ * --> cUdpDataReceiver *pDspDataRecv)
+ * @brief This constructor function is to initialize the class member <!--
+ * --> variables with the receivers of the data ports
+ * @param [in] pCpDataRecv [cUdpDataReceiver *] - CP data port receiver
+ * @param [in] pCqDataRecv [cUdpDataReceiver *] - CQ data port receiver
+ * @param [in] pR4fDataRecv [cUdpDataReceiver *] - R4F data port receiver
+ * @param [in] pDspDataRecv [cUdpDataReceiver *] - DSP data port receiver
+ */
+cUdpMultiPortReceiver::cUdpMultiPortReceiver(cUdpDataReceiver *pCpDataRecv,
+                                             cUdpDataReceiver *pCqDataRecv,
+                                             cUdpDataReceiver *pR4fDataRecv,
+                                             cUdpDataReceiver *pDspDataRecv)
+{
+    pDataRecv[CP_DATA_1_INDEX - CP_DATA_1_INDEX] = pCpDataRecv;
+    pDataRecv[CQ_DATA_2_INDEX - CP_DATA_1_INDEX] = pCqDataRecv;
+    pDataRecv[R4F_DATA_3_INDEX - CP_DATA_1_INDEX] = pR4fDataRecv;
+    pDataRecv[DSP_DATA_4_INDEX - CP_DATA_1_INDEX] = pDspDataRecv;
+    bSocketState = false;
+}
+
+/** @fn void cUdpMultiPortReceiver::setSocketOpen()
+ * @brief This function is to set the data sockets as open for the <!--
+ * --> data ports thread
+ */
+void cUdpMultiPortReceiver::setSocketOpen()
+{
+    for(UINT8 i = 0; i < NUM_MULTI_PORT_DATA_TYPES; i ++)
+        pDataRecv[i]->setSocketOpen();
+    bSocketState = true;
+}
+
+/** @fn void cUdpMultiPortReceiver::setSocketClose()
+ * @brief This function is to reset the data sockets as closed
+ */
+void cUdpMultiPortReceiver::setSocketClose()
+{
+    bSocketState = false;
+    for(UINT8 i = 0; i < NUM_MULTI_PORT_DATA_TYPES; i ++)
+        pDataRecv[i]->setSocketClose();
+}
+
+/** @fn bool cUdpMultiPortReceiver::getSocketStatus()
+ * @brief This function is to get data ports thread running status
+ * @return boolean value
+ */
+bool cUdpMultiPortReceiver::getSocketStatus()
+{
+    return bSocketState;
+}
+
+/** @fn void cUdpMultiPortReceiver::setThreadStart()
+ * @brief This function is to set the data ports as recording started
+ */
+void cUdpMultiPortReceiver::setThreadStart()
+{
+    for(UINT8 i = 0; i < NUM_MULTI_PORT_DATA_TYPES; i ++)
+        pDataRecv[i]->setThreadStart();
+}
+
+/** @fn void cUdpMultiPortReceiver::setThreadStop()
+ * @brief This function is to set the data ports as recording stopped <!--
+ * --> and close the record files
+ */
+void cUdpMultiPortReceiver::setThreadStop()
+{
+    for(UINT8 i = 0; i < NUM_MULTI_PORT_DATA_TYPES; i ++)
+        pDataRecv[i]->setThreadStop();
+}
+
+/** @fn void cUdpMultiPortReceiver::readData()
+ * @brief This function is a thread process to wait on all the data <!--
+ * --> sockets and record the received packets of each data port
+ */
+void cUdpMultiPortReceiver::readData()
+{
+    struct sockaddr_in SenderAddr;
+    SINT8       s8ReceiveBuf[MAX_BYTES_PER_PACKET];
+    SINT32      s32RecvSize = 0;
+    UINT32      u32SegSize = 0;
+    SINT32      s32NumOfReady = 0;
+    UINT8       u8Ready[NUM_MULTI_PORT_DATA_TYPES];
+    UINT8       i = 0;
+#ifdef _WIN32
+    fd_set      readset;
+    struct timeval timeout;
+#else
+    SINT32      s32EpollFd = -1;
+    struct epoll_event sEvent;
+    struct epoll_event sEvents[NUM_MULTI_PORT_DATA_TYPES];
+#endif
+
+    memset(s8ReceiveBuf, 0, (MAX_BYTES_PER_PACKET * sizeof(SINT8)));
+
+#ifndef _WIN32
+    /** One wait over the data sockets of all the low rate ports     */
+    s32EpollFd = epoll_create1(0);
+    for(i = 0; i < NUM_MULTI_PORT_DATA_TYPES; i ++)
+    {
+        sEvent.events = EPOLLIN;
+        sEvent.data.u32 = i;
+        epoll_ctl(s32EpollFd, EPOLL_CTL_ADD,
+                  sRFDCCard_SockInfo.s32DataSock[CP_DATA_1_INDEX + i], &sEvent);
+    }
+#endif
+
+    while(bSocketState)
+    {
+        /** Wait for packets, timeout to check the socket state         */
+#ifdef _WIN32
+        FD_ZERO(&readset);
+        for(i = 0; i < NUM_MULTI_PORT_DATA_TYPES; i ++)
+            FD_SET(sRFDCCard_SockInfo.s32DataSock[CP_DATA_1_INDEX + i],
+                   &readset);
+        timeout.tv_sec  = MULTI_PORT_WAIT_TIMEOUT_MS /
+                          SEC_TO_MILLI_SEC_CONVERSION;
+        timeout.tv_usec = (MULTI_PORT_WAIT_TIMEOUT_MS %
+                           SEC_TO_MILLI_SEC_CONVERSION) *
+                          MILLI_TO_MICRO_SEC_CONVERSION;
+        if(select(0, &readset, NULL, NULL, &timeout) <= 0)
+            continue;
+
+        s32NumOfReady = 0;
+        for(i = 0; i < NUM_MULTI_PORT_DATA_TYPES; i ++)
+        {
+            if(FD_ISSET(sRFDCCard_SockInfo.s32DataSock[CP_DATA_1_INDEX + i],
+                        &readset))
+                u8Ready[s32NumOfReady ++] = i;
+        }
+#else
+        s32NumOfReady = epoll_wait(s32EpollFd, sEvents,
+                                   NUM_MULTI_PORT_DATA_TYPES,
+                                   MULTI_PORT_WAIT_TIMEOUT_MS);
+        for(i = 0; i < s32NumOfReady; i ++)
+            u8Ready[i] = (UINT8)sEvents[i].data.u32;
+#endif
+
+        for(i = 0; i < s32NumOfReady; i ++)
+        {
+            /** Receiving data from FPGA        */
+            s32RecvSize = pDataRecv[u8Ready[i]]->recvPacket(
+                    sRFDCCard_SockInfo.s32DataSock[CP_DATA_1_INDEX + u8Ready[i]],
+                    s8ReceiveBuf, MAX_BYTES_PER_PACKET, 0, &SenderAddr,
+                    &u32SegSize);
+
+            /** Handle the received packet till stop command is executed */
+            if((s32RecvSize > 0) && (pDataRecv[u8Ready[i]]->getThreadStatus()))
+                pDataRecv[u8Ready[i]]->processPacket(s8ReceiveBuf, s32RecvSize);
+        }
+
+        /** Data of any port keeps the capture timeout from expiring */
+        if(s32NumOfReady > 0)
+            objCaptureTimers.dataReceived();
+    }
+
+#ifndef _WIN32
+    close(s32EpollFd);
+#endif
+}
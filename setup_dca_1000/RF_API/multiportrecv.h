@@ -0,0 +1,129 @@
+/**
+ * @file multiportrecv.h
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains the class to receive the low rate data ports
+ * (CP, CQ, R4F, DSP) of MULTI mode in a single thread
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+#ifndef MULTIPORTRECV_H
+#define MULTIPORTRECV_H
+
+///****************
+/// Includes
+///****************
+
+#include "recorddatarecv.h"
+
+/** @class cUdpMultiPortReceiver
+ * @brief This class provides support APIs to read the CP, CQ, R4F and <!--
+ * --> DSP data ports of MULTI mode from one thread. Each packet is <!--
+ * --> handed to the \ref cUdpDataReceiver of its port, which records it <!--
+ * --> in a small buffer written by the same thread. The raw data port <!--
+ * --> keeps its own threads
+ */
+class cUdpMultiPortReceiver
+{
+public:
+
+    /** @fn cUdpMultiPortReceiver(cUdpDataReceiver *pCpDataRecv, <!--
+     * --> cUdpDataReceiver *pCqDataRecv, cUdpDataReceiver *pR4fDataRecv, <!--
+     * --> cUdpDataReceiver *pDspDataRecv)
+     * @brief This constructor function is to initialize the class member <!--
+     * --> variables with the receivers of the data ports
+     * @param [in] pCpDataRecv [cUdpDataReceiver *] - CP data port receiver
+     * @param [in] pCqDataRecv [cUdpDataReceiver *] - CQ data port receiver
+     * @param [in] pR4fDataRecv [cUdpDataReceiver *] - R4F data port receiver
+     * @param [in] pDspDataRecv [cUdpDataReceiver *] - DSP data port receiver
+     */
+    cUdpMultiPortReceiver(cUdpDataReceiver *pCpDataRecv,
+                          cUdpDataReceiver *pCqDataRecv,
+                          cUdpDataReceiver *pR4fDataRecv,
+                          cUdpDataReceiver *pDspDataRecv);
+
+    /** @fn void setSocketOpen()
+     * @brief This function is to set the data sockets as open for the <!--
+     * --> data ports thread
+     */
+    void setSocketOpen();
+
+    /** @fn void setSocketClose()
+     * @brief This function is to reset the data sockets as closed
+     */
+    void setSocketClose();
+
+    /** @fn bool getSocketStatus()
+     * @brief This function is to get data ports thread running status
+     * @return boolean value
+     */
+    bool getSocketStatus();
+
+    /** @fn void setThreadStart()
+     * @brief This function is to set the data ports as recording started
+     */
+    void setThreadStart();
+
+    /** @fn void setThreadStop()
+     * @brief This function is to set the data ports as recording stopped <!--
+     * --> and close the record files
+     */
+    void setThreadStop();
+
+    /** @fn void readData()
+     * @brief This function is a thread process to wait on all the data <!--
+     * --> sockets and record the received packets of each data port
+     */
+    void readData();
+
+private:
+
+    /** Receivers of the CP, CQ, R4F and DSP data ports                     */
+    cUdpDataReceiver *pDataRecv[NUM_MULTI_PORT_DATA_TYPES];
+
+    /** Socket state                                                        */
+    bool bSocketState;
+
+};
+
+#endif // MULTIPORTRECV_H
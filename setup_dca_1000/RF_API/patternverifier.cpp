@@ -0,0 +1,261 @@
+/**
+ * @file patternverifier.cpp
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains the check of the ADC data against the LVDS test
+ * pattern of the radar device
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+///****************
+/// Includes
+///****************
+
+#include <bitset>
+
+#include "patternverifier.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define PATTERN_SIMD_X64
+#include <emmintrin.h>
+#endif
+
+///****************
+/// Defines
+///****************
+
+/** Samples of a ramp over the whole record, the 16 bit ramp repeats after
+ *  it whatever the increment                                              */
+#define PATTERN_RAMP_PERIOD_SAMPLES 65536
+
+/** Words compared at once                                      */
+#define PATTERN_WORDS_PER_VECTOR 8
+
+/** @fn cPatternVerifier::cPatternVerifier(strRFDCCard_PatternStats *psPatternStats)
+ * @brief This constructor function is to initialize the class member variables
+ * @param [in] psPatternStats [strRFDCCard_PatternStats *] - Statistics <!--
+ * --> to update
+ */
+cPatternVerifier::cPatternVerifier(strRFDCCard_PatternStats *psPatternStats)
+{
+    pu16Pattern = NULL;
+    u32PatternWords = 0;
+    u32SampleWords = 0;
+    u8NumOfLanes = 0;
+    psStats = psPatternStats;
+}
+
+/** @fn cPatternVerifier::~cPatternVerifier()
+ * @brief This destructor function is to free the expected pattern
+ */
+cPatternVerifier::~cPatternVerifier()
+{
+    if(pu16Pattern != NULL)
+        free(pu16Pattern);
+}
+
+/** @fn bool cPatternVerifier::setPattern(const strTestPatternConfig *psConfig, UINT8 u8Lanes)
+ * @brief This function is to build the expected words of the test pattern
+ * @param [in] psConfig [const strTestPatternConfig *] - Test pattern config
+ * @param [in] u8Lanes [UINT8] - LVDS lanes
+ * @return boolean value, false if the memory allocation failed
+ */
+bool cPatternVerifier::setPattern(const strTestPatternConfig *psConfig,
+                                  UINT8 u8Lanes)
+{
+    UINT32 u32NumOfSamples = (psConfig->u16PktSize > 0) ?
+                        psConfig->u16PktSize : PATTERN_RAMP_PERIOD_SAMPLES;
+
+    u8NumOfLanes = u8Lanes;
+    u32SampleWords = u8Lanes * ((psConfig->u8AdcFmt == 0) ? 1 : 2);
+    u32PatternWords = u32NumOfSamples * u32SampleWords;
+
+    if(pu16Pattern != NULL)
+        free(pu16Pattern);
+    pu16Pattern = (UINT16 *)malloc(u32PatternWords * sizeof(UINT16));
+    if(pu16Pattern == NULL)
+        return false;
+
+    /** I words of the lanes and then Q words in each sample */
+    for(UINT32 u32Slot = 0; u32Slot < u32SampleWords; u32Slot ++)
+    {
+        UINT32 u32Cfg = (u32Slot < u8Lanes) ?
+                    psConfig->au32LaneCfg[u32Slot] :
+                    psConfig->au32LaneCfg[MAX_PATTERN_LANES + u32Slot - u8Lanes];
+        UINT16 u16Value = (UINT16)(u32Cfg & 0xFFFF);
+        UINT16 u16Increment = (UINT16)(u32Cfg >> 16);
+
+        for(UINT32 i = 0; i < u32NumOfSamples; i ++)
+        {
+            pu16Pattern[(i * u32SampleWords) + u32Slot] = u16Value;
+            u16Value = (UINT16)(u16Value + u16Increment);
+        }
+    }
+
+    return true;
+}
+
+/** @fn void cPatternVerifier::verifyPacket(const SINT8 *s8Data, UINT32 u32Size, ULONG64 u64Offset)
+ * @brief This function is to check the ADC data of a packet, the <!--
+ * --> expected words follow from its offset in the data stream
+ * @param [in] s8Data [const SINT8 *] - ADC data of the packet
+ * @param [in] u32Size [UINT32] - Size of data
+ * @param [in] u64Offset [ULONG64] - Data stream offset of the packet
+ */
+void cPatternVerifier::verifyPacket(const SINT8 *s8Data, UINT32 u32Size,
+                                    ULONG64 u64Offset)
+{
+    const UINT8 *pu8Data = (const UINT8 *)s8Data;
+    UINT32 u32NumOfWords = u32Size / UINT16_DATA_SIZE;
+    UINT32 u32Index = (UINT32)((u64Offset / UINT16_DATA_SIZE) %
+                               u32PatternWords);
+    bool bBadPacket = false;
+
+    while(u32NumOfWords > 0)
+    {
+        UINT32 u32Run = u32PatternWords - u32Index;
+        if(u32Run > u32NumOfWords)
+            u32Run = u32NumOfWords;
+
+        if(verifyWords(pu8Data, u32Index, u32Run))
+            bBadPacket = true;
+
+        pu8Data += u32Run * UINT16_DATA_SIZE;
+        u32NumOfWords -= u32Run;
+        psStats->u64NumOfCheckedWords += u32Run;
+        u32Index = 0;
+    }
+
+    psStats->u64NumOfCheckedPackets ++;
+    if(bBadPacket)
+        psStats->u64NumOfBadPackets ++;
+}
+
+/** @fn bool cPatternVerifier::verifyWords(const UINT8 *pu8Data, UINT32 u32Index, UINT32 u32NumOfWords)
+ * @brief This function is to compare words with the expected pattern <!--
+ * --> from a pattern index, the run does not wrap the pattern
+ * @param [in] pu8Data [const UINT8 *] - ADC data
+ * @param [in] u32Index [UINT32] - Pattern index of the first word
+ * @param [in] u32NumOfWords [UINT32] - Words to compare
+ * @return boolean value, true if a word differs
+ */
+bool cPatternVerifier::verifyWords(const UINT8 *pu8Data, UINT32 u32Index,
+                                   UINT32 u32NumOfWords)
+{
+    bool bDiffers = false;
+    UINT32 i = 0;
+
+#ifdef PATTERN_SIMD_X64
+    /** SSE2 is part of x86-64, a vector of words equal to the pattern is
+     *  the common case and costs one compare                            */
+    for(; (i + PATTERN_WORDS_PER_VECTOR) <= u32NumOfWords;
+        i += PATTERN_WORDS_PER_VECTOR)
+    {
+        __m128i data = _mm_loadu_si128((const __m128i *)
+                                       &pu8Data[i * UINT16_DATA_SIZE]);
+        __m128i expected = _mm_loadu_si128((const __m128i *)
+                                           &pu16Pattern[u32Index + i]);
+        if(_mm_movemask_epi8(_mm_cmpeq_epi16(data, expected)) == 0xFFFF)
+            continue;
+
+        for(UINT32 j = i; j < (i + PATTERN_WORDS_PER_VECTOR); j ++)
+            bDiffers |= verifyWord(&pu8Data[j * UINT16_DATA_SIZE],
+                                   u32Index + j);
+    }
+#endif
+
+    for(; i < u32NumOfWords; i ++)
+        bDiffers |= verifyWord(&pu8Data[i * UINT16_DATA_SIZE], u32Index + i);
+
+    return bDiffers;
+}
+
+/** @fn bool cPatternVerifier::verifyWord(const UINT8 *pu8Data, UINT32 u32Index)
+ * @brief This function is to compare a word with the expected pattern <!--
+ * --> and count a difference as lane swap, misaligned word or bit errors
+ * @param [in] pu8Data [const UINT8 *] - Word of ADC data
+ * @param [in] u32Index [UINT32] - Pattern index of the word
+ * @return boolean value, true if the word differs
+ */
+bool cPatternVerifier::verifyWord(const UINT8 *pu8Data, UINT32 u32Index)
+{
+    UINT16 u16Word = 0;
+    memcpy(&u16Word, pu8Data, UINT16_DATA_SIZE);
+
+    UINT16 u16Expected = pu16Pattern[u32Index];
+    if(u16Word == u16Expected)
+        return false;
+
+    UINT32 u32Slot = u32Index % u32SampleWords;
+    UINT32 u32Lane = u32Slot % u8NumOfLanes;
+    UINT32 u32SampleIndex = u32Index - u32Slot;
+
+    /** Value of another lane or channel of the same sample */
+    for(UINT32 i = 0; i < u32SampleWords; i ++)
+    {
+        if((i != u32Slot) && (pu16Pattern[u32SampleIndex + i] == u16Word))
+        {
+            psStats->u64NumOfLaneSwaps[u32Lane] ++;
+            return true;
+        }
+    }
+
+    /** Value of the previous or next sample of the lane */
+    UINT32 u32PrevIndex = (u32Index >= u32SampleWords) ?
+                          (u32Index - u32SampleWords) :
+                          (u32Index + u32PatternWords - u32SampleWords);
+    UINT32 u32NextIndex = ((u32Index + u32SampleWords) < u32PatternWords) ?
+                          (u32Index + u32SampleWords) :
+                          (u32Index + u32SampleWords - u32PatternWords);
+    if((pu16Pattern[u32PrevIndex] == u16Word) ||
+       (pu16Pattern[u32NextIndex] == u16Word))
+    {
+        psStats->u64NumOfMisalignedWords[u32Lane] ++;
+        return true;
+    }
+
+    psStats->u64NumOfBadWords[u32Lane] ++;
+    psStats->u64NumOfBitErrors[u32Lane] +=
+                    std::bitset<16>(u16Word ^ u16Expected).count();
+    return true;
+}
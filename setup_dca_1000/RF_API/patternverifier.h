@@ -0,0 +1,137 @@
+/**
+ * @file patternverifier.h
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains the check of the ADC data against the LVDS test
+ * pattern of the radar device
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+#ifndef PATTERNVERIFIER_H
+#define PATTERNVERIFIER_H
+
+///****************
+/// Includes
+///****************
+
+#include "../Common/rf_api_internal.h"
+
+#include "defines.h"
+
+/** @class cPatternVerifier
+ * @brief This class provides support APIs to check the received ADC <!--
+ * --> data against the LVDS test pattern. The expected words of a test <!--
+ * --> pattern packet are built once and compared 16 bytes at a time, <!--
+ * --> only the words differing are classified per lane
+ */
+class cPatternVerifier
+{
+    /** Expected words of a test pattern packet, of the ramp period for a
+     *  ramp over the whole record                                        */
+    UINT16 *pu16Pattern;
+
+    /** Words in the expected pattern                       */
+    UINT32 u32PatternWords;
+
+    /** Words of a sample of all the lanes (I and Q)        */
+    UINT32 u32SampleWords;
+
+    /** LVDS lanes                                          */
+    UINT8 u8NumOfLanes;
+
+    /** Verification statistics updated per packet         */
+    strRFDCCard_PatternStats *psStats;
+
+public:
+    /** @fn cPatternVerifier(strRFDCCard_PatternStats *psPatternStats)
+     * @brief This constructor function is to initialize the class member variables
+     * @param [in] psPatternStats [strRFDCCard_PatternStats *] - Statistics <!--
+     * --> to update
+     */
+    cPatternVerifier(strRFDCCard_PatternStats *psPatternStats);
+
+    /** @fn ~cPatternVerifier()
+     * @brief This destructor function is to free the expected pattern
+     */
+    ~cPatternVerifier();
+
+    /** @fn bool setPattern(const strTestPatternConfig *psConfig, UINT8 u8Lanes)
+     * @brief This function is to build the expected words of the test pattern
+     * @param [in] psConfig [const strTestPatternConfig *] - Test pattern config
+     * @param [in] u8Lanes [UINT8] - LVDS lanes
+     * @return boolean value, false if the memory allocation failed
+     */
+    bool setPattern(const strTestPatternConfig *psConfig, UINT8 u8Lanes);
+
+    /** @fn void verifyPacket(const SINT8 *s8Data, UINT32 u32Size, ULONG64 u64Offset)
+     * @brief This function is to check the ADC data of a packet, the <!--
+     * --> expected words follow from its offset in the data stream
+     * @param [in] s8Data [const SINT8 *] - ADC data of the packet
+     * @param [in] u32Size [UINT32] - Size of data
+     * @param [in] u64Offset [ULONG64] - Data stream offset of the packet
+     */
+    void verifyPacket(const SINT8 *s8Data, UINT32 u32Size, ULONG64 u64Offset);
+
+private:
+    /** @fn bool verifyWords(const UINT8 *pu8Data, UINT32 u32Index, UINT32 u32NumOfWords)
+     * @brief This function is to compare words with the expected pattern <!--
+     * --> from a pattern index, the run does not wrap the pattern
+     * @param [in] pu8Data [const UINT8 *] - ADC data
+     * @param [in] u32Index [UINT32] - Pattern index of the first word
+     * @param [in] u32NumOfWords [UINT32] - Words to compare
+     * @return boolean value, true if a word differs
+     */
+    bool verifyWords(const UINT8 *pu8Data, UINT32 u32Index,
+                     UINT32 u32NumOfWords);
+
+    /** @fn bool verifyWord(const UINT8 *pu8Data, UINT32 u32Index)
+     * @brief This function is to compare a word with the expected pattern <!--
+     * --> and count a difference as lane swap, misaligned word or bit errors
+     * @param [in] pu8Data [const UINT8 *] - Word of ADC data
+     * @param [in] u32Index [UINT32] - Pattern index of the word
+     * @return boolean value, true if the word differs
+     */
+    bool verifyWord(const UINT8 *pu8Data, UINT32 u32Index);
+};
+
+#endif // PATTERNVERIFIER_H
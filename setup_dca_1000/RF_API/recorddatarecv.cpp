@@ -62,17 +62,41 @@
 ///****************
 
 #include "recorddatarecv.h"
+#include "latencyhist.h"
+#include "capturetimers.h"
+#include "sharedportdemux.h"
+#include "sockrecv.h"
 
 #include "extern.h"
 
-/** @fn cUdpDataReceiver::cUdpDataReceiver(UINT8 u8DataTypeArg)
+#ifndef _WIN32
+#include <sys/epoll.h>
+#endif
+
+///****************
+/// Externs
+///****************
+
+/** Duration stop mode and capture timeout - class object */
+extern cCaptureTimers objCaptureTimers;
+
+/** Systems sharing the ADC data port -  class object  */
+extern cSharedPortDemux objSharedPortDemux;
+
+/** @fn cUdpDataReceiver::cUdpDataReceiver(UINT8 u8DataTypeArg, UINT8 u8SystemArg)
  * @brief This constructor function is to initialize the class member <!--
- * --> variables and assign the corresponding datatype index
+ * --> variables and assign the corresponding datatype index. The low <!--
+ * --> rate data ports (MULTI mode) get a small record buffer which is <!--
+ * --> written by the receiving thread
  * @param [in] u8DataTypeArg [UINT8] - datatype index
+ * @param [in] u8SystemArg [UINT8] - System index of a shared data <!--
+ * --> port, 0 - connected system
  */
-cUdpDataReceiver::cUdpDataReceiver(UINT8 u8DataTypeArg)
+cUdpDataReceiver::cUdpDataReceiver(UINT8 u8DataTypeArg, UINT8 u8SystemArg)
 {
     u8DataTypeId = u8DataTypeArg;
+    u8SystemId = u8SystemArg;
+    u8StatsId = (u8SystemArg > 0) ? u8SystemArg : u8DataTypeArg;
     pRecordDataFile = NULL;
     bSocketState = false;
     bThreadState = false;
@@ -80,10 +104,25 @@ cUdpDataReceiver::cUdpDataReceiver(UINT8 u8DataTypeArg)
     u32DataCount = 0;
     u32DataFileCount = 0;
 	u32ByteIndex = 0;
+    u32NextPktNum = 0;
+    dTotalBytes = 0;
+    dTotalFrames = 0;
+    u32LastSockDropCount = 0;
+    u32PendingSockDrops = 0;
+    pu32PendingSockDrops = &u32PendingSockDrops;
+    memset(s8HeaderBuf, 0, NUM_OF_BYTES_DATA_HEADER);
     
 #ifndef POST_PROCESSING
     bBuf1Empty = false;
     bWaitForSignal = false;
+    bWriteInProgress = false;
+    bWriterActive = false;
+    bSyncFileWrite = (u8DataTypeArg != RAW_DATA_INDEX);
+    u32InlineBufSize = bSyncFileWrite ? INLINE_MULTI_PORT_BUF_SIZE :
+                                        INLINE_BUF_SIZE;
+    u64BytesSentTillPrevPkt = 0;
+    s32PrevPktRecvSize = 0;
+    u32PrevPktNum = 0;
     u32ReadPtrSize = 0;
     u32ReadPtrBufIndex = 0;
     u32WritePtrSize = 0;
@@ -102,6 +141,57 @@ cUdpDataReceiver::cUdpDataReceiver(UINT8 u8DataTypeArg)
     s8RecBuf2 = NULL;
     strLogBuf1 = NULL;
     strLogBuf2 = NULL;
+    psSpill = NULL;
+    u32WriteHoleIndex = 0;
+    u64WriteHoleBytes = 0;
+    u64WriteBufTimeUs = 0;
+    bDropOnOverflow = false;
+    bDroppingFrame = false;
+    bFileHolePending = false;
+    resetReadBufferDropState();
+    for(UINT8 i = 0; i < MAX_STRIPE_PATHS; i ++)
+        psStripeWriter[i] = NULL;
+    u8NumOfStripeWriters = 0;
+    u8NextStripePath = 0;
+    u32NumOfStripes = 0;
+    u64StripeOffset = 0;
+    pStripeManifestFile = NULL;
+    psTriggerRing = NULL;
+    u32TriggerRingUsers = 0;
+    pTriggerLogFile = NULL;
+    u64ReadBufOffset = 0;
+    u64LastMarkTimeUs = 0;
+    u64WriteBufOffset = 0;
+    u64RecordBytes = 0;
+    bCaptureFilter = false;
+    u32FilterRxSize = 0;
+    u32FilterChirpSize = 0;
+    u64FilterFrameSize = 0;
+    u8FilterRxSlotMask = 0;
+    pCrcLogFile = NULL;
+    u32CrcChunkSize = 0;
+    u32CrcChunkBytes = 0;
+    u32CrcChunkCrc = 0;
+    u32NumOfCrcChunks = 0;
+    pPatternVerifier = NULL;
+    pMmapWriter = NULL;
+    u64MmapBaseOffset = 0;
+    u64MmapFrontier = 0;
+    pRetentionRing = NULL;
+    u64RecordFileOffset = 0;
+    pRecordWatermark = NULL;
+    u64RolloverFrameSize = 0;
+    u32FileSizeLimit = 0;
+    u64FileDurationUs = 0;
+    u64FileOpenTimeUs = 0;
+    u64RecordBufStartUs = 0;
+    u64RecordBufEndUs = 0;
+    u64RecordBufOffset = 0;
+    u64RecordBufBytes = 0;
+#ifdef LATENCY_HISTOGRAMS
+    u64CtPktRecvTimeUs = 0;
+    u64BufHandoffTimeUs = 0;
+#endif
 
 #endif
 }
@@ -128,30 +218,55 @@ void cUdpDataReceiver::setSocketClose()
  */
 void cUdpDataReceiver::setThreadStart()
 {
-    bThreadState   = true;
-
     bFirstPktSeqSet = true;
     u32DataCount = 0;
     u32DataFileCount = 0;
 
+    /** Socket drops of the previous record are not matched to its gaps */
+    *pu32PendingSockDrops = 0;
+
 #ifndef POST_PROCESSING
     bBuf1Empty = true;
     bWaitForSignal = false;
+    bWriteInProgress = false;
+    bWriterActive = !bSyncFileWrite;
     u32ReadPtrBufIndex = 0;
     u32ReadPtrSize = 0;
     u32WritePtrSize = 0;
     u32LogBufOldIndex = 0;
     u64ZeroFilledStartHandoverOffset = 0;
+    u32WriteHoleIndex = 0;
+    u64WriteHoleBytes = 0;
+    u64WriteBufTimeUs = osalObj_api.GetTimeInMicroSec();
+    u64RecordBufEndUs = u64WriteBufTimeUs;
+    u64RecordBufOffset = 0;
+    u64RecordBufBytes = 0;
+    bDropOnOverflow = (!bSyncFileWrite) &&
+                      (sRFDCCard_StartRecConfig.eWriterOverflowPolicy ==
+                                            WRITER_OVERFLOW_DROP_FRAMES);
+    bDroppingFrame = false;
+    bFileHolePending = false;
+    resetReadBufferDropState();
     memset(s16DataReorderBuf, 0, MAX_BYTES_FOR_REORDERING);
     memset(s16DataReorderOutBuf, 0, MAX_BYTES_FOR_REORDERING);
     osalObj_api.InitEvent(&sgnFileWriteCompletionWaitEvent);
     osalObj_api.InitEvent(&sgnFileWriteInitWaitEvent);
+#ifdef LATENCY_HISTOGRAMS
+    vFrameDoneTimeUs.clear();
+#endif
 
-    s8RecBuf1 = (SINT8 *)malloc(INLINE_BUF_SIZE * sizeof(SINT8));
-    s8RecBuf2 = (SINT8 *)malloc(INLINE_BUF_SIZE * sizeof(SINT8));
-    strLogBuf1 = (strInlineProcLogFileStats *) malloc(
+    /** Buffers are kept across record processes of the same connection,
+     *  only the first record process allocates and touches them         */
+    bool bBufAllocated = (s8RecBuf1 != NULL) && (s8RecBuf2 != NULL);
+    if(s8RecBuf1 == NULL)
+        s8RecBuf1 = (SINT8 *)malloc(u32InlineBufSize * sizeof(SINT8));
+    if(s8RecBuf2 == NULL)
+        s8RecBuf2 = (SINT8 *)malloc(u32InlineBufSize * sizeof(SINT8));
+    if(strLogBuf1 == NULL)
+        strLogBuf1 = (strInlineProcLogFileStats *) malloc(
                                     sizeof(strInlineProcLogFileStats)) ;
-    strLogBuf2 = (strInlineProcLogFileStats *) malloc(
+    if(strLogBuf2 == NULL)
+        strLogBuf2 = (strInlineProcLogFileStats *) malloc(
                                     sizeof(strInlineProcLogFileStats));
 
     /** Callback if dynamic memmory allocation failed and packets received
@@ -165,11 +280,232 @@ void cUdpDataReceiver::setThreadStart()
         bThreadState   = false;
         return;
     }
-    memset(s8RecBuf1, 0, INLINE_BUF_SIZE * sizeof(SINT8));
-    memset(s8RecBuf2, 0, INLINE_BUF_SIZE * sizeof(SINT8));
+    if(!bBufAllocated)
+    {
+        memset(s8RecBuf1, 0, u32InlineBufSize * sizeof(SINT8));
+        memset(s8RecBuf2, 0, u32InlineBufSize * sizeof(SINT8));
+    }
     memset(strLogBuf1, 0, sizeof(strInlineProcLogFileStats));
     memset(strLogBuf2, 0, sizeof(strInlineProcLogFileStats));
+
+    /** Spill buffers for the busy file writer, the capacity is rounded up
+     *  to record buffers which are kept across record processes as well */
+    UINT32 u32NumOfSpillBufs = 0;
+    if((!bSyncFileWrite) && (sRFDCCard_StartRecConfig.u16WriterSpillSize > 0))
+    {
+        u32NumOfSpillBufs = (UINT32)(((ULONG64)
+                    sRFDCCard_StartRecConfig.u16WriterSpillSize *
+                    WRITER_SPILL_BYTES_PER_MB + u32InlineBufSize - 1) /
+                    u32InlineBufSize);
+        if(u32NumOfSpillBufs > MAX_WRITER_SPILL_BUFS)
+            u32NumOfSpillBufs = MAX_WRITER_SPILL_BUFS;
+    }
+    if((psSpill != NULL) && (psSpill->u32NumOfBufs != u32NumOfSpillBufs))
+        releaseSpillBuffers();
+    if((psSpill == NULL) && (u32NumOfSpillBufs > 0))
+    {
+        psSpill = new strWriterSpill();
+        for(UINT32 i = 0; i < u32NumOfSpillBufs; i ++)
+        {
+            psSpill->ps8Buf[i] = (SINT8 *)malloc(u32InlineBufSize *
+                                                 sizeof(SINT8));
+            if(psSpill->ps8Buf[i] == NULL)
+            {
+                releaseSpillBuffers();
+                RFDCARD_Callback(CMD_CODE_SYSTEM_ASYNC_STATUS ,
+                                 STS_REC_INLINE_BUF_ALLOCATION_ERR);
+                bThreadState   = false;
+                return;
+            }
+            memset(psSpill->ps8Buf[i], 0, u32InlineBufSize * sizeof(SINT8));
+        }
+        psSpill->u32NumOfBufs = u32NumOfSpillBufs;
+    }
+    if(psSpill != NULL)
+    {
+        psSpill->u32Head = 0;
+        psSpill->u32Tail = 0;
+        psSpill->u32HandoffTail = 0;
+    }
+
+    /** Pre-trigger ring of the event trigger mode, kept across record
+     *  processes as well. It holds one record buffer at least           */
+    ULONG64 u64TriggerRingSize = 0;
+    if((!bSyncFileWrite) && (sRFDCCard_StartRecConfig.eRecordTriggerMode ==
+                                                    RECORD_TRIGGER_EVENT))
+    {
+        u64TriggerRingSize = (ULONG64)
+                    sRFDCCard_StartRecConfig.u16TriggerRingSize *
+                    TRIGGER_RING_BYTES_PER_MB;
+        if(u64TriggerRingSize < u32InlineBufSize)
+            u64TriggerRingSize = u32InlineBufSize;
+    }
+    strTriggerRing *psRing = psTriggerRing;
+    if((psRing != NULL) && (psRing->u64Size != u64TriggerRingSize))
+    {
+        releaseTriggerRing();
+        psRing = NULL;
+    }
+    if((psRing == NULL) && (u64TriggerRingSize > 0))
+    {
+        /** Triggers see the ring once it is complete */
+        psRing = new strTriggerRing();
+        psRing->ps8Buf = (SINT8 *)malloc(u64TriggerRingSize * sizeof(SINT8));
+        psRing->ps8DumpBuf = (SINT8 *)malloc(u32InlineBufSize * sizeof(SINT8));
+        if((psRing->ps8Buf == NULL) || (psRing->ps8DumpBuf == NULL))
+        {
+            if(psRing->ps8Buf != NULL)
+                free(psRing->ps8Buf);
+            if(psRing->ps8DumpBuf != NULL)
+                free(psRing->ps8DumpBuf);
+            delete psRing;
+            RFDCARD_Callback(CMD_CODE_SYSTEM_ASYNC_STATUS ,
+                             STS_REC_INLINE_BUF_ALLOCATION_ERR);
+            bThreadState   = false;
+            return;
+        }
+        memset(psRing->ps8Buf, 0, u64TriggerRingSize * sizeof(SINT8));
+        memset(psRing->ps8DumpBuf, 0, u32InlineBufSize * sizeof(SINT8));
+        psRing->u64Size = u64TriggerRingSize;
+    }
+    if(psRing != NULL)
+    {
+        psRing->u64Tail = 0;
+        psRing->u64DumpedTill = 0;
+        psRing->bDumping = false;
+        psRing->u32NumOfDumps = 0;
+        psRing->u32MarkTail = 0;
+        psRing->u64PendingTriggerUs = 0;
+        psRing->u64LastTriggerUs = 0;
+        psTriggerRing = psRing;
+    }
+    u64ReadBufOffset = 0;
+    u64LastMarkTimeUs = 0;
+    u64WriteBufOffset = 0;
+    u64RecordBytes = 0;
+
+    /** Capture filter - sizes of the ADC data layout and the slots of
+     *  the kept RX channels among the enabled ones                    */
+    strCaptureFilterConfig *psFilter = &sRFDCCard_StartRecConfig.sCaptureFilter;
+    bCaptureFilter = (!bSyncFileWrite) && psFilter->bFilterEnable;
+    u8FilterRxSlotMask = 0;
+    if(bCaptureFilter)
+    {
+        UINT8 u8NumOfRx = 0;
+        for(UINT8 i = 0; i < NUM_OF_RX_CHANNELS; i ++)
+        {
+            if((psFilter->u8RxChanEn & (1 << i)) == 0)
+                continue;
+            if(psFilter->u8RxChanSel & (1 << i))
+                u8FilterRxSlotMask |= (1 << u8NumOfRx);
+            u8NumOfRx ++;
+        }
+        u32FilterRxSize = (UINT32)psFilter->u16NumAdcSamples *
+                          ((psFilter->u8AdcFmt == 0) ? ADC_REAL_SAMPLE_BYTES :
+                                                       ADC_COMPLEX_SAMPLE_BYTES);
+        u32FilterChirpSize = u32FilterRxSize * u8NumOfRx;
+        u64FilterFrameSize = (ULONG64)u32FilterChirpSize *
+                             psFilter->u16NumChirpsPerFrame;
+    }
+
+    /** CRC32C chunks of the record data, the log is created with the
+     *  record files                                                   */
+    u32CrcChunkSize = (UINT32)sRFDCCard_StartRecConfig.u16CrcChunkSize *
+                      CRC_CHUNK_BYTES_PER_KB;
+    u32CrcChunkBytes = 0;
+    u32CrcChunkCrc = 0;
+    u32NumOfCrcChunks = 0;
+
+    /** Test pattern verification replaces the record of the ADC data */
+    if(pPatternVerifier != NULL)
+    {
+        delete pPatternVerifier;
+        pPatternVerifier = NULL;
+    }
+    if((!bSyncFileWrite) && sRFDCCard_StartRecConfig.sTestPattern.bVerifyEnable)
+    {
+        pPatternVerifier = new cPatternVerifier(&sRFDCCard_PatternStats);
+        if(!pPatternVerifier->setPattern(&sRFDCCard_StartRecConfig.sTestPattern,
+                                         u8LaneNumber))
+        {
+            delete pPatternVerifier;
+            pPatternVerifier = NULL;
+            RFDCARD_Callback(CMD_CODE_SYSTEM_ASYNC_STATUS ,
+                             STS_REC_INLINE_BUF_ALLOCATION_ERR);
+            bThreadState   = false;
+            return;
+        }
+    }
+
+    /** Memory mapped record files of the ADC data get the packets in
+     *  place of the record buffers                                     */
+    if(pMmapWriter != NULL)
+    {
+        delete pMmapWriter;
+        pMmapWriter = NULL;
+    }
+    u64MmapBaseOffset = 0;
+    u64MmapFrontier = 0;
+    if((!bSyncFileWrite) && (pPatternVerifier == NULL) &&
+       (sRFDCCard_StartRecConfig.eWriterBackend == WRITER_BACKEND_MMAP))
+        pMmapWriter = new cMmapWriter();
+
+    /** Record files kept within a total size or age, the ring is set up
+     *  with the record file path                                       */
+    u64RecordFileOffset = 0;
+    if((pRetentionRing == NULL) && (!bSyncFileWrite) &&
+       ((sRFDCCard_StartRecConfig.u32RetentionSize > 0) ||
+        (sRFDCCard_StartRecConfig.u32RetentionAge > 0)))
+        pRetentionRing = new cRetentionRing();
+    else if((pRetentionRing != NULL) &&
+            (sRFDCCard_StartRecConfig.u32RetentionSize == 0) &&
+            (sRFDCCard_StartRecConfig.u32RetentionAge == 0))
+    {
+        delete pRetentionRing;
+        pRetentionRing = NULL;
+    }
+
+    /** Watermark of the record files, published by the file writer or
+     *  by the flush thread of the memory mapped files                 */
+    if((pRecordWatermark == NULL) && (!bSyncFileWrite) &&
+       sRFDCCard_StartRecConfig.bWatermarkEnable)
+        pRecordWatermark = new cRecordWatermark();
+    else if((pRecordWatermark != NULL) &&
+            (!sRFDCCard_StartRecConfig.bWatermarkEnable))
+    {
+        delete pRecordWatermark;
+        pRecordWatermark = NULL;
+    }
+
+    /** Stripe writers of the record buffers, one per base path. Each one
+     *  has a record buffer to exchange with the buffer handed over       */
+    releaseStripeWriters();
+    u8NextStripePath = 0;
+    u32NumOfStripes = 0;
+    u64StripeOffset = 0;
+    if((!bSyncFileWrite) && (sRFDCCard_StartRecConfig.u8NumOfStripePaths > 1))
+    {
+        for(UINT8 i = 0; i < sRFDCCard_StartRecConfig.u8NumOfStripePaths; i ++)
+        {
+            psStripeWriter[i] = new cStripeWriter(i);
+            u8NumOfStripeWriters ++;
+            if(!psStripeWriter[i]->allocateBuffer(u32InlineBufSize))
+            {
+                releaseStripeWriters();
+                RFDCARD_Callback(CMD_CODE_SYSTEM_ASYNC_STATUS ,
+                                 STS_REC_INLINE_BUF_ALLOCATION_ERR);
+                bThreadState   = false;
+                return;
+            }
+        }
+        for(UINT8 i = 0; i < u8NumOfStripeWriters; i ++)
+            psStripeWriter[i]->setThreadStart(u32MaxFileSizeToCapture);
+    }
 #endif
+
+    /** Data socket thread is already running and handles the packets
+     *  from here, hence set once the record state is ready               */
+    bThreadState   = true;
 }
 
 /** @fn void cUdpDataReceiver::setThreadStop()
@@ -181,29 +517,99 @@ void cUdpDataReceiver::setThreadStop()
      bThreadState   = false;
 
 #ifndef POST_PROCESSING
-     if(u32ReadPtrSize > 0)
+     /** Let the receiving thread finish the buffer it is writing */
+     while(bSyncFileWrite && bWriteInProgress)
+         osalObj_api.SleepInMilliSec(1);
+
+     if(bWaitForSignal)
      {
-         if(bWaitForSignal)
-         {
-             /** wait for signal */
-             osalObj_api.WaitForSignal(&sgnFileWriteCompletionWaitEvent, NON_STOP);
-         }
+         /** wait for the writer to finish the buffer handed over last */
+         osalObj_api.WaitForSignal(&sgnFileWriteCompletionWaitEvent, NON_STOP);
+         bWaitForSignal = false;
+     }
+
+     /** Buffers spilled after the writer was last seen busy */
+     if(psSpill != NULL)
+         writeSpilledBuffers(psSpill->u32Tail);
 
+     if((u32ReadPtrSize > 0) || (u64ReadHoleBytes > 0))
+     {
          bBuf1Empty = !bBuf1Empty;
+         u32WriteHoleIndex = u32ReadHoleIndex;
+         u64WriteHoleBytes = u64ReadHoleBytes;
+         u64WriteBufTimeUs = osalObj_api.GetTimeInMicroSec();
+
+#ifdef LATENCY_HISTOGRAMS
+         u64BufHandoffTimeUs = osalObj_api.GetTimeInMicroSec();
+         recordFrameHandoff(u64BufHandoffTimeUs);
+#endif
 
          if(bBuf1Empty)
          {
-             writeDataToFile_Inline(s8RecBuf2, u32ReadPtrSize);
+             writeDataToFile_Inline(&s8RecBuf2, u32ReadPtrSize);
          }
          else
          {
-             writeDataToFile_Inline(s8RecBuf1, u32ReadPtrSize);
+             writeDataToFile_Inline(&s8RecBuf1, u32ReadPtrSize);
          }
+
+#ifdef LATENCY_HISTOGRAMS
+         LatencyHistRecord(&sRFDCCard_LatencyStats.sHist[u8StatsId]
+                                                [LATENCY_BUFFER_TO_DISK],
+                  osalObj_api.GetTimeInMicroSec() - u64BufHandoffTimeUs);
+#endif
+    }
+
+    /** Dump of a trigger received during the last buffers */
+    closeTriggerLog();
+    closeCrcLog();
+
+    /** Wait for the stripes handed over to be written */
+    releaseStripeWriters();
+
+    /** Let the writer thread exit before its events are released, a
+     *  condition variable can not be destroyed with a thread blocked on it */
+    if(bWriterActive)
+    {
+        bWriterActive = false;
+        osalObj_api.SignalEvent(&sgnFileWriteInitWaitEvent);
+        osalObj_api.WaitForSignal(&sgnFileWriteCompletionWaitEvent, NON_STOP);
     }
 
     osalObj_api.DeInitEvent(&sgnFileWriteCompletionWaitEvent);
     osalObj_api.DeInitEvent(&sgnFileWriteInitWaitEvent);
 
+    /** Rest of the memory mapped data is written back to disk */
+    if(pMmapWriter != NULL)
+        pMmapWriter->close();
+
+    /** Readers of the record get the rest of the data */
+    publishWatermark(true);
+#endif
+
+     closeRecordFile();
+}
+
+/** @fn bool cUdpDataReceiver::getSocketStatus()
+ * @brief This function is to get data socket thread running status
+ * @return boolean value
+ */
+bool cUdpDataReceiver::getSocketStatus()
+{
+     return bSocketState;
+}
+
+/** @fn void cUdpDataReceiver::releaseBuffers()
+ * @brief This function is to free the inline processing buffers <!--
+ * --> kept allocated across record processes
+ */
+void cUdpDataReceiver::releaseBuffers()
+{
+#ifndef POST_PROCESSING
+    /** Buffers are still in use by a running record process */
+    if(bThreadState)
+        return;
+
     /** Delete the memory       */
     if(s8RecBuf1 != NULL)
     {
@@ -225,13 +631,169 @@ void cUdpDataReceiver::setThreadStop()
         free(strLogBuf2);
         strLogBuf2 = NULL;
     }
+    releaseSpillBuffers();
+    releaseStripeWriters();
+    releaseTriggerRing();
+    if(pPatternVerifier != NULL)
+    {
+        delete pPatternVerifier;
+        pPatternVerifier = NULL;
+    }
+    if(pMmapWriter != NULL)
+    {
+        delete pMmapWriter;
+        pMmapWriter = NULL;
+    }
+    if(pRetentionRing != NULL)
+    {
+        delete pRetentionRing;
+        pRetentionRing = NULL;
+    }
+    if(pRecordWatermark != NULL)
+    {
+        delete pRecordWatermark;
+        pRecordWatermark = NULL;
+    }
 #endif
+}
 
-     if (pRecordDataFile != NULL)
-     {
-         fclose(pRecordDataFile);
-         pRecordDataFile = NULL;
-     }
+/** @fn void cUdpDataReceiver::releaseSpillBuffers()
+ * @brief This function is to free the spill buffers of the file writer
+ */
+void cUdpDataReceiver::releaseSpillBuffers()
+{
+#ifndef POST_PROCESSING
+    if(psSpill == NULL)
+        return;
+
+    for(UINT32 i = 0; i < MAX_WRITER_SPILL_BUFS; i ++)
+    {
+        if(psSpill->ps8Buf[i] != NULL)
+            free(psSpill->ps8Buf[i]);
+    }
+    delete psSpill;
+    psSpill = NULL;
+#endif
+}
+
+/** @fn void cUdpDataReceiver::releaseTriggerRing()
+ * @brief This function is to free the pre-trigger ring once no <!--
+ * --> trigger uses it
+ */
+void cUdpDataReceiver::releaseTriggerRing()
+{
+#ifndef POST_PROCESSING
+    strTriggerRing *psRing = psTriggerRing.exchange(NULL);
+    if(psRing == NULL)
+        return;
+
+    /** A trigger latched from a signal handler may still hold the ring,
+     *  the later ones see none                                          */
+    while(u32TriggerRingUsers != 0)
+        osalObj_api.SleepInMilliSec(1);
+
+    if(psRing->ps8Buf != NULL)
+        free(psRing->ps8Buf);
+    if(psRing->ps8DumpBuf != NULL)
+        free(psRing->ps8DumpBuf);
+    delete psRing;
+#endif
+}
+
+/** @fn void cUdpDataReceiver::releaseStripeWriters()
+ * @brief This function is to stop the stripe writers, free their <!--
+ * --> buffers and close the stripe manifest
+ */
+void cUdpDataReceiver::releaseStripeWriters()
+{
+#ifndef POST_PROCESSING
+    for(UINT8 i = 0; i < u8NumOfStripeWriters; i ++)
+    {
+        psStripeWriter[i]->setThreadStop();
+        delete psStripeWriter[i];
+        psStripeWriter[i] = NULL;
+    }
+    u8NumOfStripeWriters = 0;
+
+    if(pStripeManifestFile != NULL)
+    {
+        fclose(pStripeManifestFile);
+        pStripeManifestFile = NULL;
+    }
+#endif
+}
+
+/** @fn void cUdpDataReceiver::closeRecordFile()
+ * @brief This function is to close the record file, a hole at the end <!--
+ * --> of the file is written out to keep the file size
+ */
+void cUdpDataReceiver::closeRecordFile()
+{
+    if(pRecordDataFile == NULL)
+        return;
+
+#ifndef POST_PROCESSING
+    flushRecordFile();
+
+    /** Record data of the file is listed in the segment index */
+    if(pRetentionRing != NULL)
+        pRetentionRing->closeSegment(pRecordDataFile, u32DataCount);
+    u64RecordFileOffset += u32DataCount;
+#endif
+
+    fclose(pRecordDataFile);
+    pRecordDataFile = NULL;
+}
+
+/** @fn void cUdpDataReceiver::flushRecordFile()
+ * @brief This function is to write out a hole at the end of the <!--
+ * --> record file and flush the record file
+ */
+void cUdpDataReceiver::flushRecordFile()
+{
+#ifndef POST_PROCESSING
+    if(pRecordDataFile == NULL)
+        return;
+
+    /** Seeking past the end does not extend the file till a write */
+    if(bFileHolePending)
+    {
+        fseek(pRecordDataFile, -1, SEEK_CUR);
+        fputc(0, pRecordDataFile);
+        bFileHolePending = false;
+    }
+    fflush(pRecordDataFile);
+#endif
+}
+
+/** @fn void cUdpDataReceiver::publishWatermark(bool bComplete)
+ * @brief This function is to publish the data written in the record <!--
+ * --> files so far as committed, the record file is flushed first
+ * @param [in] bComplete [bool] - Record is stopped, nothing follows
+ */
+void cUdpDataReceiver::publishWatermark(bool bComplete)
+{
+#ifndef POST_PROCESSING
+    UINT32 u32FirstFileCount = 0;
+    ULONG64 u64FirstFileOffset = 0;
+
+    /** Memory mapped record files are published by their flush thread */
+    if((pRecordWatermark == NULL) || (pMmapWriter != NULL) ||
+       (pRecordDataFile == NULL))
+        return;
+
+    flushRecordFile();
+
+    /** Readers leave the record files written over by the ring */
+    if((pRetentionRing != NULL) &&
+       pRetentionRing->getFirstSegment(&u32FirstFileCount, &u64FirstFileOffset))
+        pRecordWatermark->setFirstFile(u32FirstFileCount, u64FirstFileOffset);
+
+    pRecordWatermark->publish(u32DataFileCount, u32DataCount,
+                              u64RecordFileOffset + u32DataCount, bComplete);
+#else
+    (void)bComplete;
+#endif
 }
 
 /** @fn void cUdpDataReceiver::getThreadStatus()
@@ -243,6 +805,40 @@ bool cUdpDataReceiver::getThreadStatus()
      return bThreadState;
 }
 
+/** @fn bool cUdpDataReceiver::setTrigger()
+ * @brief This function is to latch a trigger of the pre-trigger ring <!--
+ * --> dump, it is safe to call from a signal handler
+ * @return boolean value, false if not recording in event trigger mode
+ */
+bool cUdpDataReceiver::setTrigger()
+{
+#ifndef POST_PROCESSING
+    strTriggerRing *psRing = NULL;
+    ULONG64 u64NoTrigger = 0;
+    ULONG64 u64TimeUs = 0;
+
+    /** The ring is not freed till the trigger is latched */
+    u32TriggerRingUsers ++;
+    psRing = psTriggerRing;
+    if(psRing == NULL)
+    {
+        u32TriggerRingUsers --;
+        return false;
+    }
+
+    /** The file writer takes the first pending trigger as the dump start,
+     *  the last one extends the dump end                                  */
+    u64TimeUs = osalObj_api.GetTimeInMicroSec();
+    psRing->u64LastTriggerUs = u64TimeUs;
+    psRing->u64PendingTriggerUs.compare_exchange_strong(u64NoTrigger,
+                                                         u64TimeUs);
+    u32TriggerRingUsers --;
+    return true;
+#else
+    return false;
+#endif
+}
+
 /** @fn void cUdpDataReceiver::setFileName(SINT8 s8Value1, SINT8 s8Value2)
  * @brief This function is to set  data file name for the record progress
  * @param [in] s8Value1 [SINT8] - Header value
@@ -252,42 +848,145 @@ bool cUdpDataReceiver::getThreadStatus()
 bool cUdpDataReceiver::setFileName(SINT8 s8Value1, SINT8 s8Value2)
 {
     SINT8 header[MAX_NAME_LEN];
+    SINT8 s8FileName[MAX_NAME_LEN * 2];
 
-    memcpy(strRecordFilePath, sRFDCCard_StartRecConfig.s8FileBasePath,
-           strlen(sRFDCCard_StartRecConfig.s8FileBasePath));
-#ifdef _WIN32
-    strcat(strRecordFilePath, "\\");
-#else
-    strcat(strRecordFilePath, "/");
-#endif
-    strcat(strRecordFilePath, sRFDCCard_StartRecConfig.s8FilePrefix);
+    /** Path is rebuilt for every record process of the same connection */
+    strcpy(s8FileName, sRFDCCard_StartRecConfig.s8FilePrefix);
     if(sRFDCCard_StartRecConfig.eConfigLogMode == RAW_MODE)
     {
-        strcat(strRecordFilePath, RAW_MODE_FILE_NAME);
+        /** Other systems of a shared data port - system index in the name */
+        if(u8SystemId > 0)
+        {
+            sprintf(header, "%s%d_", SHARED_PORT_FILE_NAME, u8SystemId);
+            strcat(s8FileName, header);
+        }
+        else
+            strcat(s8FileName, RAW_MODE_FILE_NAME);
 
         /** Header ID for storing globally */
-        strcpy(sRFDCCard_InlineStats.s8HeaderId[u8DataTypeId], "Raw");
+        strcpy(sRFDCCard_InlineStats.s8HeaderId[u8StatsId], "Raw");
     }
     else
     {
-        strcat(strRecordFilePath, MULTI_MODE_FILE_NAME);
+        strcat(s8FileName, MULTI_MODE_FILE_NAME);
         /** File name       */
         sprintf(header , "%02X%02X_", (s8Value1 & 0x0FF),
                 (s8Value2 & 0x0FF));
-        strcat(strRecordFilePath, header);
+        strcat(s8FileName, header);
 
        /** Header ID for storing globally */
         sprintf(header , "%02X%02X", (s8Value1 & 0x0FF),
                 (s8Value2 & 0x0FF));
-        strcpy(sRFDCCard_InlineStats.s8HeaderId[u8DataTypeId], header);
+        strcpy(sRFDCCard_InlineStats.s8HeaderId[u8StatsId], header);
     }
+
+    strcpy(strRecordFilePath, sRFDCCard_StartRecConfig.s8FileBasePath);
+#ifdef _WIN32
+    strcat(strRecordFilePath, "\\");
+#else
+    strcat(strRecordFilePath, "/");
+#endif
+    strcat(strRecordFilePath, s8FileName);
     strRecordFilePath[strlen(strRecordFilePath)] = '\0';
 
+#ifndef POST_PROCESSING
+    /** Event trigger mode - the dumps in the record files are listed in
+     *  the trigger log                                                   */
+    if((psTriggerRing != NULL) && (!createTriggerLog()))
+        return false;
+
+    /** Integrity tags of the record data */
+    if((u32CrcChunkSize > 0) && (!createCrcLog()))
+        return false;
+
+    /** Striped record - the base paths get the record files instead */
+    if(u8NumOfStripeWriters > 0)
+        return setStripeFileNames(s8FileName);
+
+    /** Frames of the record files are known from the layout of the
+     *  capture filter, the dumps of the trigger mode are not contiguous */
+    ULONG64 u64FrameSize = 0;
+    strCaptureFilterConfig *psFilter = &sRFDCCard_StartRecConfig.sCaptureFilter;
+    if(bCaptureFilter && (psTriggerRing == NULL))
+    {
+        UINT32 u32NumOfRxKept = 0;
+        for(UINT8 i = 0; i < NUM_OF_RX_CHANNELS; i ++)
+            u32NumOfRxKept += (u8FilterRxSlotMask >> i) & 1;
+        u64FrameSize = (ULONG64)u32FilterRxSize * u32NumOfRxKept *
+                (psFilter->u16ChirpEndIdx - psFilter->u16ChirpStartIdx + 1);
+    }
+
+    /** Record files end at whole frames by count or by duration, the
+     *  maximum file size holds one frame at least                     */
+    u64RolloverFrameSize = 0;
+    u32FileSizeLimit = u32MaxFileSizeToCapture;
+    u64FileDurationUs = 0;
+    if((u64FrameSize > 0) &&
+       ((sRFDCCard_StartRecConfig.u32FramesPerFile > 0) ||
+        (sRFDCCard_StartRecConfig.u32FileDuration > 0)))
+    {
+        ULONG64 u64FramesPerFile = u32MaxFileSizeToCapture / u64FrameSize;
+        if(u64FramesPerFile == 0)
+            u64FramesPerFile = 1;
+        if((sRFDCCard_StartRecConfig.u32FramesPerFile > 0) &&
+           (sRFDCCard_StartRecConfig.u32FramesPerFile < u64FramesPerFile))
+            u64FramesPerFile = sRFDCCard_StartRecConfig.u32FramesPerFile;
+
+        u64RolloverFrameSize = u64FrameSize;
+        u32FileSizeLimit = (UINT32)(u64FramesPerFile * u64FrameSize);
+        u64FileDurationUs = (ULONG64)sRFDCCard_StartRecConfig.u32FileDuration *
+                            1000;
+    }
+
+    if(pRecordWatermark != NULL)
+        pRecordWatermark->open(strRecordFilePath, u64FrameSize);
+
+    /** Memory mapped record files are created by their writer */
+    if(pMmapWriter != NULL)
+    {
+        pMmapWriter->setWatermark(pRecordWatermark);
+        return pMmapWriter->open(strRecordFilePath, u32MaxFileSizeToCapture);
+    }
+
+    if(pRetentionRing != NULL)
+    {
+        if(!pRetentionRing->setConfig(strRecordFilePath,
+                                u32FileSizeLimit,
+                                sRFDCCard_StartRecConfig.u32RetentionSize,
+                                sRFDCCard_StartRecConfig.u32RetentionAge))
+        {
+            RFDCARD_Callback(CMD_CODE_SYSTEM_ASYNC_STATUS,
+                             STS_REC_INLINE_BUF_ALLOCATION_ERR);
+            return false;
+        }
+        if(u64FrameSize > 0)
+            pRetentionRing->setFrameLayout(u64FrameSize,
+                                           psFilter->u32FrameStartIdx,
+                                           psFilter->u32FrameDecimation);
+    }
+#endif
+
+    return openRecordFile();
+}
+
+/** @fn bool cUdpDataReceiver::openRecordFile()
+ * @brief This function is to open the record file of the data file <!--
+ * --> count, the retention ring recycles its oldest file for it
+ * @return boolean value
+ */
+bool cUdpDataReceiver::openRecordFile()
+{
     strcpy(strFileName1, strRecordFilePath);
     strcat(strFileName1, std::to_string(u32DataFileCount).c_str());
     strcat(strFileName1, REC_DATA_FILE_EXTENSION);
 
-    pRecordDataFile = fopen(strFileName1, "wb+");
+#ifndef POST_PROCESSING
+    if(pRetentionRing != NULL)
+        pRecordDataFile = pRetentionRing->openSegment(u32DataFileCount,
+                                                      u64RecordFileOffset);
+    else
+#endif
+        pRecordDataFile = fopen(strFileName1, "wb+");
     if (NULL == pRecordDataFile)
     {
         RFDCARD_Callback(CMD_CODE_SYSTEM_ASYNC_STATUS,
@@ -299,166 +998,333 @@ bool cUdpDataReceiver::setFileName(SINT8 s8Value1, SINT8 s8Value2)
 }
 
 
-#ifdef POST_PROCESSING
+/** @fn SINT32 cUdpDataReceiver::recvPacket(SINT32 s32DataSock, SINT8 *s8ReceiveBuf, UINT32 u32BufSize, SINT32 s32Flags, struct sockaddr_in *pSenderAddr, UINT32 *pu32SegSize)
+ * @brief This function is to receive a data packet (or coalesced <!--
+ * --> packets) and to read the drop counter of the socket with it. The <!--
+ * --> packets dropped by the socket since the last packet are pending <!--
+ * --> for the next sequence gaps
+ * @param [in] s32DataSock [SINT32] - Data socket
+ * @param [out] s8ReceiveBuf [SINT8 *] - Received packet
+ * @param [in] u32BufSize [UINT32] - Receive buffer size
+ * @param [in] s32Flags [SINT32] - Receive flags
+ * @param [out] pSenderAddr [struct sockaddr_in *] - Source address
+ * @param [out] pu32SegSize [UINT32 *] - Size of the coalesced packets, <!--
+ * --> 0 if a single packet is received
+ * @return SINT32 value (received size)
+ */
+SINT32 cUdpDataReceiver::recvPacket(SINT32 s32DataSock, SINT8 *s8ReceiveBuf,
+                                    UINT32 u32BufSize, SINT32 s32Flags,
+                                    struct sockaddr_in *pSenderAddr,
+                                    UINT32 *pu32SegSize)
+{
+    UINT32      u32SockDropCount = u32LastSockDropCount;
+    SINT32      s32RecvSize = SockRecvPacket(s32DataSock, s8ReceiveBuf,
+                                             u32BufSize, s32Flags, pSenderAddr,
+                                             &u32SockDropCount, pu32SegSize);
+
+    /** The drop counter counts over the socket life */
+    if(s32RecvSize > 0)
+    {
+        *pu32PendingSockDrops += (u32SockDropCount - u32LastSockDropCount);
+        u32LastSockDropCount = u32SockDropCount;
+    }
+
+    return s32RecvSize;
+}
+
+/** @fn void cUdpDataReceiver::shareSockDrops(cUdpDataReceiver *pSockDataRecv)
+ * @brief This function is to match the sequence gaps to the socket <!--
+ * --> drops of another receiver reading the data socket (the other <!--
+ * --> systems of a shared data port)
+ * @param [in] pSockDataRecv [cUdpDataReceiver *] - Receiver reading <!--
+ * --> the data socket
+ */
+void cUdpDataReceiver::shareSockDrops(cUdpDataReceiver *pSockDataRecv)
+{
+    pu32PendingSockDrops = pSockDataRecv->pu32PendingSockDrops;
+}
 
 /** @fn void cUdpDataReceiver::readData()
- * @brief This function is a thread process to record data through UDP <!--
- * -->in the file, to check for packet out of sequence and to handle <!--
- * --> stop mode configs
+ * @brief This function is a thread process (capture event loop) to <!--
+ * --> record data through UDP in the file, to check for packet out of <!--
+ * --> sequence and to handle stop mode configs. It handles the timers <!--
+ * --> of the duration stop mode and the capture timeout as well
  */
 void cUdpDataReceiver::readData()
 {
     struct sockaddr_in SenderAddr;
-    socklen_t s32SenderAddrSize = sizeof(SenderAddr);
-    SINT8       s8ReceiveBuf[MAX_BYTES_PER_PACKET];
-    SINT8       s8HeaderBuf[NUM_OF_BYTES_DATA_HEADER];
-    SINT32		s32CtPktRecvSize = 0;
-    UINT32		u32CtPktNum = 0;
-    UINT32		u32NextPktNum = 0;
-    DOUBLE      dTotalBytes = 0;
-    DOUBLE      dTotalFrames = 0;
+    SINT8       s8ReceiveBuf[GRO_RECV_BUF_SIZE];
+    SINT32      s32RecvSize = 0;
+    UINT32      u32SegSize = 0;
+    SINT32      s32DataSock = sRFDCCard_SockInfo.s32DataSock[u8DataTypeId];
+    cUdpDataReceiver *pRecv = this;
+    bool        bSharedPort = false;
+    bool        bDataReady = false;
+    bool        bTimerExpired = false;
+#ifdef _WIN32
+    fd_set      readset;
+    struct timeval timeout;
+    UINT32      u32WaitMs = 0;
+#else
+    SINT32      s32NumOfReady = 0;
+    SINT32      s32EpollFd = -1;
+    struct epoll_event sEvent;
+    struct epoll_event sEvents[CAPTURE_LOOP_NUM_OF_EVENTS];
+#endif
+
+    memset(s8ReceiveBuf, 0, (GRO_RECV_BUF_SIZE * sizeof(SINT8)));
+
+#ifndef _WIN32
+    /** One wait over the data socket and the timers, the event data is
+     *  the file descriptor                                            */
+    s32EpollFd = epoll_create1(0);
+    sEvent.events = EPOLLIN;
+    sEvent.data.fd = s32DataSock;
+    epoll_ctl(s32EpollFd, EPOLL_CTL_ADD, s32DataSock, &sEvent);
+    sEvent.data.fd = objCaptureTimers.getDurationTimerFd();
+    epoll_ctl(s32EpollFd, EPOLL_CTL_ADD, sEvent.data.fd, &sEvent);
+    sEvent.data.fd = objCaptureTimers.getTimeoutTimerFd();
+    epoll_ctl(s32EpollFd, EPOLL_CTL_ADD, sEvent.data.fd, &sEvent);
+#endif
 
     while(bSocketState)
     {
-        START_LOOP:
-
-        /** Receiving data from FPGA        */
-        s32CtPktRecvSize = recvfrom(sRFDCCard_SockInfo.s32DataSock[u8DataTypeId],
-                               s8ReceiveBuf, MAX_BYTES_PER_PACKET, 0,
-                               (struct sockaddr *)&SenderAddr,
-                               &s32SenderAddrSize);
-
-        /** Handle the received packet till stop command is executed   */
-        if ((s32CtPktRecvSize > 0) && (bThreadState))
+        /** Wait for packets or a timer, timeout to check the socket state */
+#ifdef _WIN32
+        u32WaitMs = objCaptureTimers.getWaitMs();
+        FD_ZERO(&readset);
+        FD_SET(s32DataSock, &readset);
+        timeout.tv_sec  = u32WaitMs / SEC_TO_MILLI_SEC_CONVERSION;
+        timeout.tv_usec = (u32WaitMs % SEC_TO_MILLI_SEC_CONVERSION) *
+                          MILLI_TO_MICRO_SEC_CONVERSION;
+        bDataReady = (select(0, &readset, NULL, NULL, &timeout) > 0);
+        bTimerExpired = true;
+#else
+        s32NumOfReady = epoll_wait(s32EpollFd, sEvents,
+                                   CAPTURE_LOOP_NUM_OF_EVENTS,
+                                   CAPTURE_LOOP_WAIT_TIMEOUT_MS);
+        bDataReady = false;
+        bTimerExpired = false;
+        for(SINT32 i = 0; i < s32NumOfReady; i ++)
         {
+            if(sEvents[i].data.fd == s32DataSock)
+                bDataReady = true;
+            else
+                bTimerExpired = true;
+        }
+#endif
 
-            /** Signal capture timeout event that data is been received from system */
-            osalObj_api.SignalEvent(&sgnCaptureTimeoutWaitEvent);
-
-            memcpy(&u32CtPktNum, &s8ReceiveBuf[0], sizeof(UINT32));
+        if(bDataReady)
+        {
+            /** Systems are set before the record process is started */
+            bSharedPort = (objSharedPortDemux.getNumOfSystems() > 0);
 
-            /** First packet */
-            if (bFirstPktSeqSet)
+            /** Read the queued packets, a bounded number of them to keep
+             *  the timers on time while the data keeps coming           */
+            for(UINT32 i = 0; i < CAPTURE_LOOP_MAX_PACKETS; i ++)
             {
-                bFirstPktSeqSet = false;
-                u32NextPktNum = u32CtPktNum;
+                /** Receiving data from FPGA        */
+#ifdef _WIN32
+                /** Only the packet signalled ready is read without wait */
+                if(i > 0)
+                    break;
+                s32RecvSize = recvPacket(s32DataSock, s8ReceiveBuf,
+                                         MAX_BYTES_PER_PACKET, 0,
+                                         &SenderAddr, &u32SegSize);
+#else
+                s32RecvSize = recvPacket(s32DataSock, s8ReceiveBuf,
+                                         GRO_RECV_BUF_SIZE, MSG_DONTWAIT,
+                                         &SenderAddr, &u32SegSize);
+#endif
+                if(s32RecvSize <= 0)
+                    break;
 
-                sRFDCCard_InlineStats.StartTime[u8DataTypeId] = time(NULL);
-                sRFDCCard_InlineStats.u32FirstPktId[u8DataTypeId] = u32CtPktNum;
-
-                setFileName(s8ReceiveBuf[RECORD_DATA_BUF_INDEX + 1],
-                            s8ReceiveBuf[RECORD_DATA_BUF_INDEX]);
-
-                if(sRFDCCard_StartRecConfig.eRecordStopMode == FRAMES)
+                /** A single packet is truncated to the packet size as the
+                 *  receive without coalescing does                        */
+                if(u32SegSize == 0)
                 {
-                    /** Save the Header ID */
-                    memcpy(s8HeaderBuf, &s8ReceiveBuf[RECORD_DATA_BUF_INDEX],
-                                           NUM_OF_BYTES_DATA_HEADER);
+                    u32SegSize = MAX_BYTES_PER_PACKET;
+                    if(s32RecvSize > MAX_BYTES_PER_PACKET)
+                        s32RecvSize = MAX_BYTES_PER_PACKET;
                 }
-                else if(sRFDCCard_StartRecConfig.eRecordStopMode == DURATION)
+
+                /** Shared data port - the source system records the packet,
+                 *  packets of other sources are ignored. Coalesced packets
+                 *  are of one source                                        */
+                pRecv = bSharedPort ? objSharedPortDemux.getReceiver(
+                                            SenderAddr.sin_addr.s_addr) : this;
+
+                /** Handle the received packets till stop command is executed,
+                 *  coalesced packets are walked in place                    */
+                for(SINT32 s32Offset = 0; s32Offset < s32RecvSize;
+                    s32Offset += u32SegSize)
                 {
-                    osalObj_api.SignalEvent(&sgnDurationStopModeWaitEvent);
+                    if((pRecv == NULL) || (!pRecv->getThreadStatus()))
+                        break;
+                    pRecv->processPacket(&s8ReceiveBuf[s32Offset],
+                                         std::min((SINT32)u32SegSize,
+                                                  s32RecvSize - s32Offset));
                 }
-
             }
+            objCaptureTimers.dataReceived();
+        }
 
-            /** Verify bytes stop mode */
-            if(sRFDCCard_StartRecConfig.eRecordStopMode == BYTES)
-            {
-                if(sRFDCCard_StartRecConfig.bSequenceNumberEnable)
-                {
-                    if((dTotalBytes + s32CtPktRecvSize + UINT32_DATA_SIZE) >=
-                            sRFDCCard_StartRecConfig.u32BytesToCapture)
-                    {
-                        /** Write remaining data to file and exit */
-                        writeDataToFile(s8ReceiveBuf,
-                                    (UINT32)(sRFDCCard_StartRecConfig.u32BytesToCapture -
-                                             dTotalBytes - UINT32_DATA_SIZE -
-                                              RECORD_DATA_BUF_INDEX));
-
-                        /** Stop the recording */
-                        bThreadState = false;
-                        if(!gbRecStopCmdSent)
-                            RFDCARD_Callback(CMD_CODE_SYSTEM_ASYNC_STATUS,
-                                         STS_REC_COMPLETED);
-                        goto START_LOOP;
-                    }
+        if(bTimerExpired)
+            objCaptureTimers.handleTimers();
+    }
 
-                    dTotalBytes += (s32CtPktRecvSize + UINT32_DATA_SIZE);
-                }
-                else
-                {
-                    if((dTotalBytes + s32CtPktRecvSize - RECORD_DATA_BUF_INDEX) >=
-                            sRFDCCard_StartRecConfig.u32BytesToCapture)
-                    {
-                        /** Write remaining data to file and exit */
-                        writeDataToFile(s8ReceiveBuf,
-                                    (UINT32)(sRFDCCard_StartRecConfig.u32BytesToCapture - dTotalBytes));
-                        
-                        /** Stop the recording */
-                        bThreadState = false;
-                        if(!gbRecStopCmdSent)
-                            RFDCARD_Callback(CMD_CODE_SYSTEM_ASYNC_STATUS,
-                                         STS_REC_COMPLETED);
-                        goto START_LOOP;
-                    }
+#ifndef _WIN32
+    close(s32EpollFd);
+#endif
+}
 
-                    dTotalBytes += (s32CtPktRecvSize - RECORD_DATA_BUF_INDEX) ;
-                }
-            }
-			
-			/** Verify frames stop mode */
-			if((sRFDCCard_StartRecConfig.eConfigLogMode == MULTI_MODE) &&
-				(sRFDCCard_StartRecConfig.eRecordStopMode == FRAMES))
-			{
-				if(memcmp(s8HeaderBuf, &s8ReceiveBuf[RECORD_DATA_BUF_INDEX],
-                       NUM_OF_BYTES_DATA_HEADER) == 0)
-                {
-                    dTotalFrames ++;
-                }
+#ifdef POST_PROCESSING
 
-                if(dTotalFrames > sRFDCCard_StartRecConfig.u32FramesToCapture)
-                {
-                    /** Stop the recording */
-                    bThreadState = false;
-                    if(!gbRecStopCmdSent)
-                        RFDCARD_Callback(CMD_CODE_SYSTEM_ASYNC_STATUS,
-                                     STS_REC_COMPLETED);
-                    goto START_LOOP;
-                }
-            }
+/** @fn void cUdpDataReceiver::processPacket(SINT8 *s8ReceiveBuf, SINT32 s32PktRecvSize)
+ * @brief This function is to record a received data packet, to check <!--
+ * --> for packet out of sequence and to handle stop mode configs
+ * @param [in] s8ReceiveBuf [SINT8 *] - Received packet
+ * @param [in] s32PktRecvSize [SINT32] - Received packet size
+ */
+void cUdpDataReceiver::processPacket(SINT8 *s8ReceiveBuf, SINT32 s32PktRecvSize)
+{
+    SINT32		s32CtPktRecvSize = s32PktRecvSize;
+    UINT32		u32CtPktNum = 0;
 
-            /** Updating record process status variable for every packet */
-            sRFDCCard_InlineStats.u64NumOfRecvdPackets[u8DataTypeId] ++;
-            sRFDCCard_InlineStats.EndTime[u8DataTypeId] = time(NULL);
-            sRFDCCard_InlineStats.u32LastPktId[u8DataTypeId] = u32CtPktNum;
+    /** Data after the duration of the duration stop mode is not recorded */
+    if(objCaptureTimers.isDurationOver())
+    {
+        bThreadState = false;
+        return;
+    }
 
-            /** Verify out of sequence packet   */
-            if (u32NextPktNum != u32CtPktNum)
-            {
-                sRFDCCard_InlineStats.u64OutOfSeqCount[u8DataTypeId] ++;
-                UpdateInlineStatus(true, u8DataTypeId);
-            }
-            else
+    memcpy(&u32CtPktNum, &s8ReceiveBuf[0], sizeof(UINT32));
+
+    /** First packet */
+    if (bFirstPktSeqSet)
+    {
+        bFirstPktSeqSet = false;
+        u32NextPktNum = u32CtPktNum;
+        dTotalBytes = 0;
+        dTotalFrames = 0;
+
+        sRFDCCard_InlineStats.StartTime[u8StatsId] = time(NULL);
+        sRFDCCard_InlineStats.u32FirstPktId[u8StatsId] = u32CtPktNum;
+
+        setFileName(s8ReceiveBuf[RECORD_DATA_BUF_INDEX + 1],
+                    s8ReceiveBuf[RECORD_DATA_BUF_INDEX]);
+
+        if(sRFDCCard_StartRecConfig.eRecordStopMode == FRAMES)
+        {
+            /** Save the Header ID */
+            memcpy(s8HeaderBuf, &s8ReceiveBuf[RECORD_DATA_BUF_INDEX],
+                                   NUM_OF_BYTES_DATA_HEADER);
+        }
+        else if(sRFDCCard_StartRecConfig.eRecordStopMode == DURATION)
+        {
+            objCaptureTimers.startDuration();
+        }
+
+    }
+
+    /** Verify bytes stop mode */
+    if(sRFDCCard_StartRecConfig.eRecordStopMode == BYTES)
+    {
+        if(sRFDCCard_StartRecConfig.bSequenceNumberEnable)
+        {
+            if((dTotalBytes + s32CtPktRecvSize + UINT32_DATA_SIZE) >=
+                    sRFDCCard_StartRecConfig.u32BytesToCapture)
             {
-                UpdateInlineStatus(false, u8DataTypeId);
+                /** Write remaining data to file and exit */
+                writeDataToFile(s8ReceiveBuf,
+                            (UINT32)(sRFDCCard_StartRecConfig.u32BytesToCapture -
+                                     dTotalBytes - UINT32_DATA_SIZE -
+                                      RECORD_DATA_BUF_INDEX));
+
+                /** Stop the recording */
+                bThreadState = false;
+                if((!gbRecStopCmdSent) &&
+                   objSharedPortDemux.setCompleted(u8SystemId))
+                    RFDCARD_Callback(CMD_CODE_SYSTEM_ASYNC_STATUS,
+                                 STS_REC_COMPLETED);
+                return;
             }
-            u32NextPktNum = (u32CtPktNum + 1);
 
-            /** Write data to file */
-            if(!writeDataToFile(s8ReceiveBuf,
-                        (UINT32)(s32CtPktRecvSize - RECORD_DATA_BUF_INDEX)))
+            dTotalBytes += (s32CtPktRecvSize + UINT32_DATA_SIZE);
+        }
+        else
+        {
+            if((dTotalBytes + s32CtPktRecvSize - RECORD_DATA_BUF_INDEX) >=
+                    sRFDCCard_StartRecConfig.u32BytesToCapture)
             {
+                /** Write remaining data to file and exit */
+                writeDataToFile(s8ReceiveBuf,
+                            (UINT32)(sRFDCCard_StartRecConfig.u32BytesToCapture - dTotalBytes));
+
                 /** Stop the recording */
                 bThreadState = false;
-                if(!gbRecStopCmdSent)
+                if((!gbRecStopCmdSent) &&
+                   objSharedPortDemux.setCompleted(u8SystemId))
                     RFDCARD_Callback(CMD_CODE_SYSTEM_ASYNC_STATUS,
                                  STS_REC_COMPLETED);
-                goto START_LOOP;
-            }           
+                return;
+            }
+
+            dTotalBytes += (s32CtPktRecvSize - RECORD_DATA_BUF_INDEX) ;
+        }
+    }
+
+    /** Verify frames stop mode */
+    if((sRFDCCard_StartRecConfig.eConfigLogMode == MULTI_MODE) &&
+        (sRFDCCard_StartRecConfig.eRecordStopMode == FRAMES))
+    {
+        if(memcmp(s8HeaderBuf, &s8ReceiveBuf[RECORD_DATA_BUF_INDEX],
+               NUM_OF_BYTES_DATA_HEADER) == 0)
+        {
+            dTotalFrames ++;
+        }
 
+        if(dTotalFrames > sRFDCCard_StartRecConfig.u32FramesToCapture)
+        {
+            /** Stop the recording */
+            bThreadState = false;
+            if((!gbRecStopCmdSent) &&
+               objSharedPortDemux.setCompleted(u8SystemId))
+                RFDCARD_Callback(CMD_CODE_SYSTEM_ASYNC_STATUS,
+                             STS_REC_COMPLETED);
+            return;
         }
     }
+
+    /** Updating record process status variable for every packet */
+    sRFDCCard_InlineStats.u64NumOfRecvdPackets[u8StatsId] ++;
+    sRFDCCard_InlineStats.EndTime[u8StatsId] = time(NULL);
+    sRFDCCard_InlineStats.u32LastPktId[u8StatsId] = u32CtPktNum;
+
+    /** Verify out of sequence packet   */
+    if (u32NextPktNum != u32CtPktNum)
+    {
+        sRFDCCard_InlineStats.u64OutOfSeqCount[u8StatsId] ++;
+        UpdateInlineStatus(true, u8StatsId);
+    }
+    else
+    {
+        UpdateInlineStatus(false, u8StatsId);
+    }
+    u32NextPktNum = (u32CtPktNum + 1);
+
+    /** Write data to file */
+    if(!writeDataToFile(s8ReceiveBuf,
+                (UINT32)(s32CtPktRecvSize - RECORD_DATA_BUF_INDEX)))
+    {
+        /** Stop the recording */
+        bThreadState = false;
+        if((!gbRecStopCmdSent) &&
+           objSharedPortDemux.setCompleted(u8SystemId))
+            RFDCARD_Callback(CMD_CODE_SYSTEM_ASYNC_STATUS,
+                         STS_REC_COMPLETED);
+        return;
+    }
 }
 
 
@@ -511,512 +1377,2013 @@ bool cUdpDataReceiver::writeDataToFile(SINT8 *s8Buffer, UINT32 u32Size)
 #else
 /** Inline processing */
 
-/** @fn void cUdpDataReceiver::readData()
- * @brief This function is a thread process to record  data through UDP <!--
- * -->in the file, to check for packet out of sequence and to handle <!--
- * --> stop mode configs
+/** @fn void cUdpDataReceiver::processPacket(SINT8 *s8ReceiveBuf, SINT32 s32PktRecvSize)
+ * @brief This function is to record a received data packet, to check <!--
+ * --> for packet out of sequence and to handle stop mode configs
+ * @param [in] s8ReceiveBuf [SINT8 *] - Received packet
+ * @param [in] s32PktRecvSize [SINT32] - Received packet size
  */
-void cUdpDataReceiver::readData()
+void cUdpDataReceiver::processPacket(SINT8 *s8ReceiveBuf, SINT32 s32PktRecvSize)
 {
-    struct sockaddr_in SenderAddr;
-    socklen_t s32SenderAddrSize = sizeof(SenderAddr);
-    SINT8       s8ReceiveBuf[MAX_BYTES_PER_PACKET];
-    SINT8       s8HeaderBuf[NUM_OF_BYTES_DATA_HEADER];
-    s32CtPktRecvSize = 0;
-    SINT32		s32PrevPktRecvSize = 0;
     UINT32		u32CtPktNum = 0;
-    UINT32		u32NextPktNum = 0;
-    UINT32		u32PrevPktNum = 0;
     UINT32      u32NumOfDroppedPkts = 0;
-    DOUBLE      dTotalBytes = 0;
-    DOUBLE      dTotalFrames = 0;
-    u64BytesSentTillCtPkt = 0;
-    ULONG64     u64BytesSentTillPrevPkt = 0;
+    UINT32      u32NumOfSockDrops = 0;
     ULONG64     u64ZeroFilledBytes = 0;
 
-    memset(s8ReceiveBuf, 0, (MAX_BYTES_PER_PACKET * sizeof(SINT8)));
-    memset(s8HeaderBuf, 0, (NUM_OF_BYTES_DATA_HEADER * sizeof(SINT8)));
+    s32CtPktRecvSize = s32PktRecvSize;
 
-    while(bSocketState)
+#ifdef LATENCY_HISTOGRAMS
+    u64CtPktRecvTimeUs = osalObj_api.GetTimeInMicroSec();
+#endif
+
+    /** Data after the duration of the duration stop mode is not recorded */
+    if(objCaptureTimers.isDurationOver())
+    {
+        bThreadState = false;
+        return;
+    }
+
+    memcpy(&u32CtPktNum, &s8ReceiveBuf[0], sizeof(UINT32));
+
+    memcpy(&u64BytesSentTillCtPkt, &s8ReceiveBuf[4], 6);
+
+    /** Test pattern packets are checked, nothing is recorded */
+    if(pPatternVerifier != NULL)
+    {
+        verifyPatternPacket(s8ReceiveBuf, u32CtPktNum);
+        return;
+    }
+
+    /** Packets are copied to the memory mapped record files in place */
+    if(pMmapWriter != NULL)
     {
-        START_LOOP:
+        mmapPacket(s8ReceiveBuf, u32CtPktNum);
+        return;
+    }
+
+    /** First packet */
+    if (bFirstPktSeqSet)
+    {
+        /** Reset inline logic variables */
+        u32NextPktNum = u32CtPktNum;
+        u32PrevPktNum = (u32CtPktNum - 1);
+        u64BytesSentTillPrevPkt = 0;
+        s32PrevPktRecvSize = 0;
+        dTotalBytes = 0;
+        dTotalFrames = 0;
+
+        bFirstPktSeqSet = false;
+        sRFDCCard_InlineStats.StartTime[u8StatsId] = time(NULL);
+        sRFDCCard_InlineStats.u32FirstPktId[u8StatsId] = u32CtPktNum;
+
+        setFileName(s8ReceiveBuf[RECORD_DATA_BUF_INDEX + 1],
+                    s8ReceiveBuf[RECORD_DATA_BUF_INDEX]);
+
+        /** Save the Header ID   */
+        memcpy(s8HeaderBuf, &s8ReceiveBuf[RECORD_DATA_BUF_INDEX],
+                               NUM_OF_BYTES_DATA_HEADER);
+
+        if(sRFDCCard_StartRecConfig.eRecordStopMode == DURATION)
+        {
+            objCaptureTimers.startDuration();
+        }
+
+        /** Assigning buffer to read write pointers    */
+        bBuf1Empty = true;
+        u32ReadPtrSize = 0;
+        u32WritePtrSize = 0;
+        u32ReadPtrBufIndex = 0;
+    }
 
-        /** Receiving data from FPGA        */
-        s32CtPktRecvSize = recvfrom(sRFDCCard_SockInfo.s32DataSock[u8DataTypeId],
-                               s8ReceiveBuf, MAX_BYTES_PER_PACKET, 0,
-                               (struct sockaddr *)&SenderAddr,
-                               &s32SenderAddrSize);
+    /** Updating inline status variable for every packet */
+    sRFDCCard_InlineStats.EndTime[u8StatsId] = time(NULL);
+
+    /** Verify frames stop mode */
+    if((sRFDCCard_StartRecConfig.eConfigLogMode == MULTI_MODE) &&
+        (sRFDCCard_StartRecConfig.eRecordStopMode == FRAMES))
+    {
+        if(memcmp(s8HeaderBuf, &s8ReceiveBuf[RECORD_DATA_BUF_INDEX],
+               NUM_OF_BYTES_DATA_HEADER) == 0)
+        {
+            dTotalFrames ++;
+        }
 
-        /** Handle the received packet till stop command is executed   */
-        if ((s32CtPktRecvSize > 0) && (bThreadState))
+        if(dTotalFrames > sRFDCCard_StartRecConfig.u32FramesToCapture)
         {
-            /** Signal capture timeout event that data is been received from system */
-            osalObj_api.SignalEvent(&sgnCaptureTimeoutWaitEvent);
+            /** Stop the recording */
+            bThreadState = false;
+            if((!gbRecStopCmdSent) &&
+               objSharedPortDemux.setCompleted(u8SystemId))
+                RFDCARD_Callback(CMD_CODE_SYSTEM_ASYNC_STATUS,
+                             STS_REC_COMPLETED);
+            return;
+        }
+    }
+
+#ifdef LATENCY_HISTOGRAMS
+    /** Header of the next frame completes the previous frame */
+    if((sRFDCCard_StartRecConfig.eConfigLogMode == MULTI_MODE) &&
+       (u32CtPktNum != sRFDCCard_InlineStats.u32FirstPktId[u8StatsId]) &&
+       (memcmp(s8HeaderBuf, &s8ReceiveBuf[RECORD_DATA_BUF_INDEX],
+               NUM_OF_BYTES_DATA_HEADER) == 0))
+    {
+        vFrameDoneTimeUs.push_back(u64CtPktRecvTimeUs);
+    }
+#endif
+
+    sRFDCCard_InlineStats.u32LastPktId[u8StatsId] = u32CtPktNum;
+
+    /** Verifies out of sequence and increment the count */
+    if((u32PrevPktNum + 1) != u32CtPktNum)
+    {
+        sRFDCCard_InlineStats.u64OutOfSeqCount[u8StatsId] ++;
+    }
+    u32PrevPktNum = u32CtPktNum;
 
-            memcpy(&u32CtPktNum, &s8ReceiveBuf[0], sizeof(UINT32));
 
-            memcpy(&u64BytesSentTillCtPkt, &s8ReceiveBuf[4], 6);
+    /** Handle received packets     */
+    if (u32CtPktNum == u32NextPktNum)
+    {
+        sRFDCCard_InlineStats.u64NumOfRecvdPackets[u8StatsId] ++;
 
-            /** First packet */
-            if (bFirstPktSeqSet)
+        /** Verifies bytes stop mode    */
+        if(sRFDCCard_StartRecConfig.eRecordStopMode == BYTES)
+        {
+            /** Stop recording if data matches the total number of bytes */
+            if((dTotalBytes + s32CtPktRecvSize - RECORD_DATA_BUF_INDEX) >=
+                    sRFDCCard_StartRecConfig.u32BytesToCapture)
             {
-                /** Reset inline logic variables */
-                u32NextPktNum = u32CtPktNum;
-                u32PrevPktNum = (u32CtPktNum - 1);
-                u32NumOfDroppedPkts = 0;
-                u64BytesSentTillPrevPkt = 0;
-                u64ZeroFilledBytes = 0;
-                s32PrevPktRecvSize = 0;
-                dTotalBytes = 0;
-                dTotalFrames = 0;
-
-                bFirstPktSeqSet = false;
-                sRFDCCard_InlineStats.StartTime[u8DataTypeId] = time(NULL);
-                sRFDCCard_InlineStats.u32FirstPktId[u8DataTypeId] = u32CtPktNum;
-
-                setFileName(s8ReceiveBuf[RECORD_DATA_BUF_INDEX + 1],
-                            s8ReceiveBuf[RECORD_DATA_BUF_INDEX]);
-
-                if(sRFDCCard_StartRecConfig.eRecordStopMode == FRAMES)
-                {
-                    /** Save the Header ID   */
-                    memcpy(s8HeaderBuf, &s8ReceiveBuf[RECORD_DATA_BUF_INDEX],
-                                           NUM_OF_BYTES_DATA_HEADER);
-                }
-                else if(sRFDCCard_StartRecConfig.eRecordStopMode == DURATION)
-                {
-                    osalObj_api.SignalEvent(&sgnDurationStopModeWaitEvent);
-                }
+                writeDataToBuffer_Inline(&s8ReceiveBuf[RECORD_DATA_BUF_INDEX],
+                          (UINT32)(sRFDCCard_StartRecConfig.u32BytesToCapture - dTotalBytes),
+                             false, false);
+
+                /** Updating inline processing summary */
+                UpdateInlineStatus(true, u8StatsId);
 
-                /** Assigning buffer to read write pointers    */
-                bBuf1Empty = true;
-                u32ReadPtrSize = 0;
-                u32WritePtrSize = 0;
-                u32ReadPtrBufIndex = 0;
+                /** Stop the recording */
+                bThreadState = false;
+                if((!gbRecStopCmdSent) &&
+                   objSharedPortDemux.setCompleted(u8SystemId))
+                    RFDCARD_Callback(CMD_CODE_SYSTEM_ASYNC_STATUS,
+                                 STS_REC_COMPLETED);
+                return;
             }
 
-            /** Updating inline status variable for every packet */
-            sRFDCCard_InlineStats.EndTime[u8DataTypeId] = time(NULL);
-            
-			/** Verify frames stop mode */
-			if((sRFDCCard_StartRecConfig.eConfigLogMode == MULTI_MODE) &&
-				(sRFDCCard_StartRecConfig.eRecordStopMode == FRAMES))
-			{
-				if(memcmp(s8HeaderBuf, &s8ReceiveBuf[RECORD_DATA_BUF_INDEX],
-                       NUM_OF_BYTES_DATA_HEADER) == 0)
-                {
-                    dTotalFrames ++;
-                }
+            writeDataToBuffer_Inline(&s8ReceiveBuf[RECORD_DATA_BUF_INDEX],
+                              (s32CtPktRecvSize - RECORD_DATA_BUF_INDEX),
+                                false, false);
+            dTotalBytes += (s32CtPktRecvSize - RECORD_DATA_BUF_INDEX) ;
+        }
+        else
+        {
+            writeDataToBuffer_Inline(&s8ReceiveBuf[RECORD_DATA_BUF_INDEX],
+                          (s32CtPktRecvSize - RECORD_DATA_BUF_INDEX),
+                                     false, false);
+        }
+
+        u32NextPktNum = (u32CtPktNum + 1);
+        u64BytesSentTillPrevPkt = u64BytesSentTillCtPkt;
+        s32PrevPktRecvSize = s32CtPktRecvSize;
+
+        /** Updating inline processing summary */
+        UpdateInlineStatus(false, u8StatsId);
+    }
+    else if (u32CtPktNum < u32NextPktNum)
+    {
+        if(seekOldIndexReadBuf(
+            ((u64BytesSentTillPrevPkt + s32PrevPktRecvSize - RECORD_DATA_BUF_INDEX)
+             - u64BytesSentTillCtPkt))
+            != -1)
+        {
+            sRFDCCard_InlineStats.u64NumOfRecvdPackets[u8StatsId] ++;
+
+            /** Calculatig old index for log buffer     */
+            u32LogBufOldIndex = u32NextPktNum - u32CtPktNum;
+
+            /** Writing the old packet in the data buffer */
+            writeDataToBuffer_Inline(&s8ReceiveBuf[RECORD_DATA_BUF_INDEX],
+                              (s32CtPktRecvSize - RECORD_DATA_BUF_INDEX),
+                                     true, false);
+            sRFDCCard_InlineStats.
+                    u64NumOfZeroFilledPackets[u8StatsId] --;
+            /** A late packet was not dropped by the socket            */
+            if(sRFDCCard_InlineStats.u64NumOfUpstreamLostPackets[u8StatsId] > 0)
+                sRFDCCard_InlineStats.
+                        u64NumOfUpstreamLostPackets[u8StatsId] --;
+            else if(sRFDCCard_InlineStats.
+                        u64NumOfSockDroppedPackets[u8StatsId] > 0)
+                sRFDCCard_InlineStats.
+                        u64NumOfSockDroppedPackets[u8StatsId] --;
+            sRFDCCard_InlineStats.u64NumOfZeroFilledBytes[u8StatsId]
+                   -= (s32CtPktRecvSize - RECORD_DATA_BUF_INDEX);
+
+            /** Set to current index */
+            u32ReadPtrBufIndex = u32ReadPtrSize;
+
+            /** Logging out of seq metadata         */
+            sRFDCCard_InlineStats.u32OutOfSeqPktFromOffset[u8StatsId] =
+                u32NextPktNum - 1;
+            sRFDCCard_InlineStats.u32OutOfSeqPktToOffset[u8StatsId] =
+                u32CtPktNum;
+#ifdef LOG_OUT_OF_SEQ_OFFSET
+            WriteOffsetMetaData(u64BytesSentTillPrevPkt, s32PrevPktRecvSize - RECORD_DATA_BUF_INDEX,
+                                    u64BytesSentTillCtPkt, s32CtPktRecvSize - RECORD_DATA_BUF_INDEX);
+#endif
+        }
 
-                if(dTotalFrames > sRFDCCard_StartRecConfig.u32FramesToCapture)
+        /** Updating inline processing summary */
+        UpdateInlineStatus(true, u8StatsId);
+    }
+    else if (u32CtPktNum > u32NextPktNum)
+    {              
+        sRFDCCard_InlineStats.u64NumOfRecvdPackets[u8StatsId] ++;
+
+        u32NumOfDroppedPkts = u32CtPktNum - u32NextPktNum;
+        sRFDCCard_InlineStats.u64NumOfZeroFilledPackets[u8StatsId]
+                += u32NumOfDroppedPkts;
+
+        /** The packets dropped by the socket since are lost on the host,
+         *  the rest of the gap is lost upstream                          */
+        u32NumOfSockDrops = (u32NumOfDroppedPkts < *pu32PendingSockDrops) ?
+                            u32NumOfDroppedPkts : *pu32PendingSockDrops;
+        *pu32PendingSockDrops -= u32NumOfSockDrops;
+        sRFDCCard_InlineStats.u64NumOfSockDroppedPackets[u8StatsId]
+                += u32NumOfSockDrops;
+        sRFDCCard_InlineStats.u64NumOfUpstreamLostPackets[u8StatsId]
+                += (u32NumOfDroppedPkts - u32NumOfSockDrops);
+
+        u64ZeroFilledBytes = u64BytesSentTillCtPkt -
+                (u64BytesSentTillPrevPkt + (s32PrevPktRecvSize -
+                 RECORD_DATA_BUF_INDEX));
+        sRFDCCard_InlineStats.u64NumOfZeroFilledBytes[u8StatsId]
+                += u64ZeroFilledBytes;
+
+        /** Write single packet to ensure not filling beyond buffer size */
+        while(u64ZeroFilledBytes >= PAYLOAD_BYTES_PER_PACKET)
+        {
+            /** Verifies bytes stop mode    */
+            if(sRFDCCard_StartRecConfig.eRecordStopMode == BYTES)
+            {
+                /** Stop recording if data matches the total number of bytes */
+                if((dTotalBytes + PAYLOAD_BYTES_PER_PACKET) >=
+                        sRFDCCard_StartRecConfig.u32BytesToCapture)
                 {
+                    writeDataToBuffer_Inline(s8ZeroBuf,
+                      (UINT32)(sRFDCCard_StartRecConfig.u32BytesToCapture - dTotalBytes),
+                                     false, true);
+
+                    /** Updating inline processing summary */
+                    UpdateInlineStatus(true, u8StatsId);
+
                     /** Stop the recording */
                     bThreadState = false;
-                    if(!gbRecStopCmdSent)
+                    if((!gbRecStopCmdSent) &&
+                       objSharedPortDemux.setCompleted(u8SystemId))
                         RFDCARD_Callback(CMD_CODE_SYSTEM_ASYNC_STATUS,
                                      STS_REC_COMPLETED);
-                    goto START_LOOP;
+                    return;
                 }
+
+                writeDataToBuffer_Inline(s8ZeroBuf, PAYLOAD_BYTES_PER_PACKET,
+                                         false, true);
+                dTotalBytes += (PAYLOAD_BYTES_PER_PACKET) ;
             }
-			
-			sRFDCCard_InlineStats.u32LastPktId[u8DataTypeId] = u32CtPktNum;
-			
-            /** Verifies out of sequence and increment the count */
-            if((u32PrevPktNum + 1) != u32CtPktNum)
+            else
             {
-                sRFDCCard_InlineStats.u64OutOfSeqCount[u8DataTypeId] ++;
+                writeDataToBuffer_Inline(s8ZeroBuf, PAYLOAD_BYTES_PER_PACKET,
+                                         false, true);
             }
-            u32PrevPktNum = u32CtPktNum;
-			
-			
-            /** Handle received packets     */
-            if (u32CtPktNum == u32NextPktNum)
+            u64ZeroFilledBytes -= PAYLOAD_BYTES_PER_PACKET;
+        }
+        if(u64ZeroFilledBytes > 0)
+        {
+            /** Verifies bytes stop mode    */
+            if(sRFDCCard_StartRecConfig.eRecordStopMode == BYTES)
             {
-                sRFDCCard_InlineStats.u64NumOfRecvdPackets[u8DataTypeId] ++;
-
-                /** Verifies bytes stop mode    */
-                if(sRFDCCard_StartRecConfig.eRecordStopMode == BYTES)
+                /** Stop recording if data matches the total number of bytes */
+                if((dTotalBytes + u64ZeroFilledBytes) >=
+                        sRFDCCard_StartRecConfig.u32BytesToCapture)
                 {
-                    /** Stop recording if data matches the total number of bytes */
-                    if((dTotalBytes + s32CtPktRecvSize - RECORD_DATA_BUF_INDEX) >=
-                            sRFDCCard_StartRecConfig.u32BytesToCapture)
-                    {
-                        writeDataToBuffer_Inline(&s8ReceiveBuf[RECORD_DATA_BUF_INDEX],
-                                  (UINT32)(sRFDCCard_StartRecConfig.u32BytesToCapture - dTotalBytes),
-                                     false, false);
-
-                        /** Updating inline processing summary */
-                        UpdateInlineStatus(true, u8DataTypeId);
+                    writeDataToBuffer_Inline(s8ZeroBuf,
+                              (UINT32)(sRFDCCard_StartRecConfig.u32BytesToCapture - dTotalBytes),
+                                                 false, true);
 
-                        /** Stop the recording */
-                        bThreadState = false;
-                        if(!gbRecStopCmdSent)
-                            RFDCARD_Callback(CMD_CODE_SYSTEM_ASYNC_STATUS,
-                                         STS_REC_COMPLETED);
-                        goto START_LOOP;
-                    }
+                    /** Updating inline processing summary */
+                    UpdateInlineStatus(true, u8StatsId);
 
-                    writeDataToBuffer_Inline(&s8ReceiveBuf[RECORD_DATA_BUF_INDEX],
-                                      (s32CtPktRecvSize - RECORD_DATA_BUF_INDEX),
-                                        false, false);
-                    dTotalBytes += (s32CtPktRecvSize - RECORD_DATA_BUF_INDEX) ;
-                }
-                else
-                {
-                    writeDataToBuffer_Inline(&s8ReceiveBuf[RECORD_DATA_BUF_INDEX],
-                                  (s32CtPktRecvSize - RECORD_DATA_BUF_INDEX),
-                                             false, false);
+                    /** Stop the recording */
+                    bThreadState = false;
+                    if((!gbRecStopCmdSent) &&
+                       objSharedPortDemux.setCompleted(u8SystemId))
+                        RFDCARD_Callback(CMD_CODE_SYSTEM_ASYNC_STATUS,
+                                     STS_REC_COMPLETED);
+                    return;
                 }
 
-                u32NextPktNum = (u32CtPktNum + 1);
-                u64BytesSentTillPrevPkt = u64BytesSentTillCtPkt;
-                s32PrevPktRecvSize = s32CtPktRecvSize;
+                writeDataToBuffer_Inline(s8ZeroBuf, u64ZeroFilledBytes,
+                                         false, true);
+                dTotalBytes += (u64ZeroFilledBytes) ;
+            }
+            else
+            {
+                writeDataToBuffer_Inline(s8ZeroBuf, u64ZeroFilledBytes,
+                                         false, true);
+            }
+        }
+
+        /** Verifies bytes stop mode    */
+        if(sRFDCCard_StartRecConfig.eRecordStopMode == BYTES)
+        {
+            /** Stop recording if data matches the total number of bytes */
+            if((dTotalBytes + s32CtPktRecvSize - RECORD_DATA_BUF_INDEX) >=
+                    sRFDCCard_StartRecConfig.u32BytesToCapture)
+            {
+                writeDataToBuffer_Inline(&s8ReceiveBuf[RECORD_DATA_BUF_INDEX],
+                      (UINT32)(sRFDCCard_StartRecConfig.u32BytesToCapture - dTotalBytes),
+                                 false, false);
 
                 /** Updating inline processing summary */
-                UpdateInlineStatus(false, u8DataTypeId);
+                UpdateInlineStatus(true, u8StatsId);
+
+                /** Stop the recording */
+                bThreadState = false;
+                if((!gbRecStopCmdSent) &&
+                   objSharedPortDemux.setCompleted(u8SystemId))
+                    RFDCARD_Callback(CMD_CODE_SYSTEM_ASYNC_STATUS,
+                                 STS_REC_COMPLETED);
+                return;
             }
-            else if (u32CtPktNum < u32NextPktNum)
-            {
-                if(seekOldIndexReadBuf(
-                    ((u64BytesSentTillPrevPkt + s32PrevPktRecvSize - RECORD_DATA_BUF_INDEX)
-                     - u64BytesSentTillCtPkt))
-                    != -1)
-                {
-                    sRFDCCard_InlineStats.u64NumOfRecvdPackets[u8DataTypeId] ++;
-
-                    /** Calculatig old index for log buffer     */
-                    u32LogBufOldIndex = u32NextPktNum - u32CtPktNum;
-
-                    /** Writing the old packet in the data buffer */
-                    writeDataToBuffer_Inline(&s8ReceiveBuf[RECORD_DATA_BUF_INDEX],
-                                      (s32CtPktRecvSize - RECORD_DATA_BUF_INDEX),
-                                             true, false);
-                    sRFDCCard_InlineStats.
-                            u64NumOfZeroFilledPackets[u8DataTypeId] --;
-                    sRFDCCard_InlineStats.u64NumOfZeroFilledBytes[u8DataTypeId]
-                           -= (s32CtPktRecvSize - RECORD_DATA_BUF_INDEX);
-
-                    /** Set to current index */
-                    u32ReadPtrBufIndex = u32ReadPtrSize;
-
-                    /** Logging out of seq metadata         */
-                    sRFDCCard_InlineStats.u32OutOfSeqPktFromOffset[u8DataTypeId] =
-                        u32NextPktNum - 1;
-                    sRFDCCard_InlineStats.u32OutOfSeqPktToOffset[u8DataTypeId] =
-                        u32CtPktNum;
+
+            writeDataToBuffer_Inline(&s8ReceiveBuf[RECORD_DATA_BUF_INDEX],
+                              (s32CtPktRecvSize - RECORD_DATA_BUF_INDEX),
+                                     false, false);
+            dTotalBytes += (s32CtPktRecvSize - RECORD_DATA_BUF_INDEX) ;
+        }
+        else
+        {
+            writeDataToBuffer_Inline(&s8ReceiveBuf[RECORD_DATA_BUF_INDEX],
+                (s32CtPktRecvSize - RECORD_DATA_BUF_INDEX),
+                                     false, false);
+        }
+
+        /** Logging out of seq metadata         */
+        sRFDCCard_InlineStats.u32OutOfSeqPktFromOffset[u8StatsId] =
+            u32NextPktNum - 1;
+        sRFDCCard_InlineStats.u32OutOfSeqPktToOffset[u8StatsId] =
+            u32CtPktNum;
 #ifdef LOG_OUT_OF_SEQ_OFFSET
-                    WriteOffsetMetaData(u64BytesSentTillPrevPkt, s32PrevPktRecvSize - RECORD_DATA_BUF_INDEX,
-                                            u64BytesSentTillCtPkt, s32CtPktRecvSize - RECORD_DATA_BUF_INDEX);
+        WriteOffsetMetaData(u64BytesSentTillPrevPkt, s32PrevPktRecvSize - RECORD_DATA_BUF_INDEX,
+                                u64BytesSentTillCtPkt, s32CtPktRecvSize - RECORD_DATA_BUF_INDEX);
 #endif
-                }
+        /** Stores the offset for verifying next packet */
+        u32NextPktNum = (u32CtPktNum + 1);
+        u64BytesSentTillPrevPkt = u64BytesSentTillCtPkt;
+        s32PrevPktRecvSize = s32CtPktRecvSize;
+
+        /** Updating inline processing summary */
+        UpdateInlineStatus(true, u8StatsId);
+    } // verify sequence and write
+}
+
+/** @fn void cUdpDataReceiver::verifyPatternPacket(SINT8 *s8ReceiveBuf, UINT32 u32CtPktNum)
+ * @brief This function is to check a received data packet against <!--
+ * --> the test pattern instead of recording it, to check for packet <!--
+ * --> out of sequence and to handle stop mode configs
+ * @param [in] s8ReceiveBuf [SINT8 *] - Received packet
+ * @param [in] u32CtPktNum [UINT32] - Sequence number of the packet
+ */
+void cUdpDataReceiver::verifyPatternPacket(SINT8 *s8ReceiveBuf,
+                                           UINT32 u32CtPktNum)
+{
+    UINT32 u32DataSize = (UINT32)(s32CtPktRecvSize - RECORD_DATA_BUF_INDEX);
+    bool bStopRecord = false;
+
+    /** First packet */
+    if (bFirstPktSeqSet)
+    {
+        u32PrevPktNum = (u32CtPktNum - 1);
+        dTotalBytes = 0;
+
+        bFirstPktSeqSet = false;
+        sRFDCCard_InlineStats.StartTime[u8StatsId] = time(NULL);
+        sRFDCCard_InlineStats.u32FirstPktId[u8StatsId] = u32CtPktNum;
+
+        if(sRFDCCard_StartRecConfig.eRecordStopMode == DURATION)
+        {
+            objCaptureTimers.startDuration();
+        }
+    }
+
+    sRFDCCard_InlineStats.EndTime[u8StatsId] = time(NULL);
+    sRFDCCard_InlineStats.u32LastPktId[u8StatsId] = u32CtPktNum;
+
+    /** Verifies out of sequence and increment the count, the expected
+     *  pattern follows from the data stream offset of each packet
+     *  hence a packet out of sequence is checked as received         */
+    if((u32PrevPktNum + 1) != u32CtPktNum)
+    {
+        sRFDCCard_InlineStats.u64OutOfSeqCount[u8StatsId] ++;
+    }
+    u32PrevPktNum = u32CtPktNum;
+    sRFDCCard_InlineStats.u64NumOfRecvdPackets[u8StatsId] ++;
+
+    /** Verifies bytes stop mode on the checked data */
+    if(sRFDCCard_StartRecConfig.eRecordStopMode == BYTES)
+    {
+        if((dTotalBytes + u32DataSize) >=
+                sRFDCCard_StartRecConfig.u32BytesToCapture)
+        {
+            u32DataSize = (UINT32)(sRFDCCard_StartRecConfig.u32BytesToCapture -
+                                   dTotalBytes);
+            bStopRecord = true;
+        }
+        dTotalBytes += u32DataSize;
+    }
+
+    pPatternVerifier->verifyPacket(&s8ReceiveBuf[RECORD_DATA_BUF_INDEX],
+                                   u32DataSize, u64BytesSentTillCtPkt);
+
+    /** Updating inline processing summary */
+    UpdateInlineStatus(bStopRecord, u8StatsId);
+
+    if(bStopRecord)
+    {
+        /** Stop the recording */
+        bThreadState = false;
+        if((!gbRecStopCmdSent) &&
+           objSharedPortDemux.setCompleted(u8SystemId))
+            RFDCARD_Callback(CMD_CODE_SYSTEM_ASYNC_STATUS,
+                             STS_REC_COMPLETED);
+    }
+}
+
+/** @fn void cUdpDataReceiver::mmapPacket(SINT8 *s8ReceiveBuf, UINT32 u32CtPktNum)
+ * @brief This function is to copy a received data packet to its <!--
+ * --> offset in the memory mapped record files, to check for packet <!--
+ * --> out of sequence and to handle stop mode configs. Lost packets <!--
+ * --> are left as zeros, a late packet lands at its offset
+ * @param [in] s8ReceiveBuf [SINT8 *] - Received packet
+ * @param [in] u32CtPktNum [UINT32] - Sequence number of the packet
+ */
+void cUdpDataReceiver::mmapPacket(SINT8 *s8ReceiveBuf, UINT32 u32CtPktNum)
+{
+    SINT8 *s8Data = &s8ReceiveBuf[RECORD_DATA_BUF_INDEX];
+    UINT32 u32DataSize = (UINT32)(s32CtPktRecvSize - RECORD_DATA_BUF_INDEX);
+    UINT32 u32NumOfDroppedPkts = 0;
+    UINT32 u32NumOfSockDrops = 0;
+    ULONG64 u64Offset = 0;
+    ULONG64 u64End = 0;
+    bool bLatePkt = false;
+    bool bWritten = false;
+    bool bOutOfSeq = false;
+    bool bStopRecord = false;
+
+    /** First packet - its data starts the first record file */
+    if (bFirstPktSeqSet)
+    {
+        u32NextPktNum = u32CtPktNum;
+        u32PrevPktNum = (u32CtPktNum - 1);
+        u64MmapBaseOffset = u64BytesSentTillCtPkt;
+        u64MmapFrontier = 0;
+        dTotalFrames = 0;
+
+        bFirstPktSeqSet = false;
+        sRFDCCard_InlineStats.StartTime[u8StatsId] = time(NULL);
+        sRFDCCard_InlineStats.u32FirstPktId[u8StatsId] = u32CtPktNum;
+
+        setFileName(s8ReceiveBuf[RECORD_DATA_BUF_INDEX + 1],
+                    s8ReceiveBuf[RECORD_DATA_BUF_INDEX]);
+
+        /** Save the Header ID   */
+        memcpy(s8HeaderBuf, s8Data, NUM_OF_BYTES_DATA_HEADER);
+
+        if(sRFDCCard_StartRecConfig.eRecordStopMode == DURATION)
+        {
+            objCaptureTimers.startDuration();
+        }
+    }
+
+    sRFDCCard_InlineStats.EndTime[u8StatsId] = time(NULL);
+
+    /** Verify frames stop mode */
+    if((sRFDCCard_StartRecConfig.eConfigLogMode == MULTI_MODE) &&
+        (sRFDCCard_StartRecConfig.eRecordStopMode == FRAMES))
+    {
+        if(memcmp(s8HeaderBuf, s8Data, NUM_OF_BYTES_DATA_HEADER) == 0)
+        {
+            dTotalFrames ++;
+        }
+
+        if(dTotalFrames > sRFDCCard_StartRecConfig.u32FramesToCapture)
+        {
+            /** Stop the recording */
+            bThreadState = false;
+            if((!gbRecStopCmdSent) &&
+               objSharedPortDemux.setCompleted(u8SystemId))
+                RFDCARD_Callback(CMD_CODE_SYSTEM_ASYNC_STATUS,
+                             STS_REC_COMPLETED);
+            return;
+        }
+    }
+
+    sRFDCCard_InlineStats.u32LastPktId[u8StatsId] = u32CtPktNum;
+
+    /** Verifies out of sequence and increment the count */
+    if((u32PrevPktNum + 1) != u32CtPktNum)
+    {
+        sRFDCCard_InlineStats.u64OutOfSeqCount[u8StatsId] ++;
+    }
+    u32PrevPktNum = u32CtPktNum;
+
+    /** Data before the first packet is not recorded */
+    if(u64BytesSentTillCtPkt < u64MmapBaseOffset)
+    {
+        UpdateInlineStatus(true, u8StatsId);
+        return;
+    }
+    u64Offset = u64BytesSentTillCtPkt - u64MmapBaseOffset;
+    u64End = u64Offset + u32DataSize;
+    bLatePkt = (u32CtPktNum < u32NextPktNum);
+
+    /** Verifies bytes stop mode, data after the bytes to capture is not
+     *  recorded                                                         */
+    if((sRFDCCard_StartRecConfig.eRecordStopMode == BYTES) &&
+       (u64End >= sRFDCCard_StartRecConfig.u32BytesToCapture))
+    {
+        u32DataSize = (u64Offset < sRFDCCard_StartRecConfig.u32BytesToCapture) ?
+                      (UINT32)(sRFDCCard_StartRecConfig.u32BytesToCapture -
+                               u64Offset) : 0;
+        bStopRecord = !bLatePkt;
+    }
+
+    /** Reordering data bytes of the packet before it is copied */
+    if((u32DataSize > 0) && sRFDCCard_StartRecConfig.bReorderEnable &&
+       (!ReorderAlgorithm(s8Data, u32DataSize)))
+        u32DataSize = 0;
+
+    if(u32DataSize > 0)
+        bWritten = pMmapWriter->writeData(u64Offset, s8Data, u32DataSize);
+
+#ifdef LATENCY_HISTOGRAMS
+    LatencyHistRecord(&sRFDCCard_LatencyStats.sHist[u8StatsId]
+                                           [LATENCY_RECV_TO_BUFFER],
+              osalObj_api.GetTimeInMicroSec() - u64CtPktRecvTimeUs);
+#endif
+
+    if (!bLatePkt)
+    {
+        sRFDCCard_InlineStats.u64NumOfRecvdPackets[u8StatsId] ++;
+
+        /** Lost packets before this one are left as zeros in the files */
+        if (u32CtPktNum > u32NextPktNum)
+        {
+            u32NumOfDroppedPkts = u32CtPktNum - u32NextPktNum;
+            sRFDCCard_InlineStats.u64NumOfZeroFilledPackets[u8StatsId]
+                    += u32NumOfDroppedPkts;
+
+            /** The packets dropped by the socket since are lost on the
+             *  host, the rest of the gap is lost upstream              */
+            u32NumOfSockDrops = (u32NumOfDroppedPkts < *pu32PendingSockDrops) ?
+                                u32NumOfDroppedPkts : *pu32PendingSockDrops;
+            *pu32PendingSockDrops -= u32NumOfSockDrops;
+            sRFDCCard_InlineStats.u64NumOfSockDroppedPackets[u8StatsId]
+                    += u32NumOfSockDrops;
+            sRFDCCard_InlineStats.u64NumOfUpstreamLostPackets[u8StatsId]
+                    += (u32NumOfDroppedPkts - u32NumOfSockDrops);
+
+            if(u64Offset > u64MmapFrontier)
+                sRFDCCard_InlineStats.u64NumOfZeroFilledBytes[u8StatsId]
+                        += (u64Offset - u64MmapFrontier);
+            bOutOfSeq = true;
+        }
+
+        u32NextPktNum = (u32CtPktNum + 1);
+        if(u64End > u64MmapFrontier)
+            u64MmapFrontier = u64End;
+    }
+    else if (bWritten)
+    {
+        /** Late packet fills its zeros in the files */
+        sRFDCCard_InlineStats.u64NumOfRecvdPackets[u8StatsId] ++;
+        sRFDCCard_InlineStats.u64NumOfZeroFilledPackets[u8StatsId] --;
+
+        /** A late packet was not dropped by the socket            */
+        if(sRFDCCard_InlineStats.u64NumOfUpstreamLostPackets[u8StatsId] > 0)
+            sRFDCCard_InlineStats.
+                    u64NumOfUpstreamLostPackets[u8StatsId] --;
+        else if(sRFDCCard_InlineStats.
+                    u64NumOfSockDroppedPackets[u8StatsId] > 0)
+            sRFDCCard_InlineStats.
+                    u64NumOfSockDroppedPackets[u8StatsId] --;
+        sRFDCCard_InlineStats.u64NumOfZeroFilledBytes[u8StatsId]
+               -= u32DataSize;
+        bOutOfSeq = true;
+    }
+    else
+    {
+        bOutOfSeq = true;
+    }
+
+    if (bOutOfSeq)
+    {
+        /** Logging out of seq metadata         */
+        sRFDCCard_InlineStats.u32OutOfSeqPktFromOffset[u8StatsId] =
+            u32NextPktNum - 1;
+        sRFDCCard_InlineStats.u32OutOfSeqPktToOffset[u8StatsId] =
+            u32CtPktNum;
+    }
+
+    /** Updating inline processing summary */
+    UpdateInlineStatus(bOutOfSeq || bStopRecord, u8StatsId);
+
+    if(bStopRecord)
+    {
+        /** Stop the recording */
+        bThreadState = false;
+        if((!gbRecStopCmdSent) &&
+           objSharedPortDemux.setCompleted(u8SystemId))
+            RFDCARD_Callback(CMD_CODE_SYSTEM_ASYNC_STATUS,
+                             STS_REC_COMPLETED);
+    }
+}
+
+/** @fn void cUdpDataReceiver::writeDataToBuffer_Inline(SINT8 *s8Buffer, UINT32 u32Size, bool bOldPkt, bool bZeroFilledPkt)
+ * @brief This function is to handle recording  data in buffer (inline processing)
+ * @param [in] s8Buffer [SINT8 *] - Buffer to write in buffer
+ * @param [in] u32Size  [UINT32] - Size of buffer
+ * @param [in] bOldPkt  [bool] - Old packet flag
+ * @param [in] bZeroFilledPkt  [bool] - Zero filled packet flag
+ */
+void cUdpDataReceiver::writeDataToBuffer_Inline(SINT8 *s8Buffer, UINT32 u32Size,
+                                                bool bOldPkt, bool bZeroFilledPkt)
+{
+    /** Frame boundaries are tracked only to drop whole frames and to mark
+     *  the pre-trigger ring (Multi mode)                                  */
+    bool bFrameStart = (bDropOnOverflow || (psTriggerRing != NULL)) &&
+            (!bOldPkt) && (!bZeroFilledPkt) &&
+            (sRFDCCard_StartRecConfig.eConfigLogMode == MULTI_MODE) &&
+            (memcmp(s8HeaderBuf, s8Buffer, NUM_OF_BYTES_DATA_HEADER) == 0);
+
+    /** A frame start ends the frame being dropped */
+    if(bFrameStart)
+        bDroppingFrame = false;
+
+    /** Writer has not caught up with the previous buffer, apply the
+     *  overflow policy before waiting for it                         */
+    if((!bDroppingFrame) &&
+       ((u32ReadPtrBufIndex + u32Size) > u32InlineBufSize) &&
+       bWaitForSignal && bWriteInProgress)
+    {
+        if(handleWriterOverflow(u32Size))
+        {
+            sRFDCCard_InlineStats.u64NumOfBufSwaps[u8StatsId] ++;
+            sRFDCCard_InlineStats.u64NumOfWriterWaits[u8StatsId] ++;
+        }
+    }
+
+    /** Packets of the frame being dropped are not stored */
+    if(bDroppingFrame)
+    {
+        if(!bFrameStart)
+        {
+            dropReadBufferPacket(u32Size);
+            return;
+        }
+        bDroppingFrame = false;
+    }
+
+    if((u32ReadPtrBufIndex + u32Size) > u32InlineBufSize)
+    {        
+        sRFDCCard_InlineStats.u64NumOfBufSwaps[u8StatsId] ++;
+
+        if(bWaitForSignal)
+        {
+            /** Writer has not caught up with the previous buffer */
+            if(bWriteInProgress)
+                sRFDCCard_InlineStats.u64NumOfWriterWaits[u8StatsId] ++;
+
+#ifdef LATENCY_HISTOGRAMS
+            ULONG64 u64WaitStartUs = osalObj_api.GetTimeInMicroSec();
+#endif
+
+            /** Wait for write completion signal */
+            osalObj_api.WaitForSignal(&sgnFileWriteCompletionWaitEvent, NON_STOP);
+
+#ifdef LATENCY_HISTOGRAMS
+            LatencyHistRecord(&sRFDCCard_LatencyStats.sHist[u8StatsId]
+                                                   [LATENCY_WRITER_STALL],
+                      osalObj_api.GetTimeInMicroSec() - u64WaitStartUs);
+#endif
+        }
+        else if(!bSyncFileWrite)
+        {
+            bWaitForSignal = true;
+        }
+
+        /** Swapping buffers to continue read and parallel writing   */
+        bBuf1Empty = !bBuf1Empty;
+
+        u32WritePtrSize = u32ReadPtrSize;
+        u32WriteHoleIndex = u32ReadHoleIndex;
+        u64WriteHoleBytes = u64ReadHoleBytes;
+        u64WriteBufTimeUs = osalObj_api.GetTimeInMicroSec();
+        u64ReadBufOffset += u32ReadPtrSize + u64ReadHoleBytes;
+        u32ReadPtrSize = 0;
+        u32ReadPtrBufIndex = 0;
+        resetReadBufferDropState();
+
+        /** Spilled buffers are written before the swapped buffer */
+        if(psSpill != NULL)
+            psSpill->u32HandoffTail = psSpill->u32Tail;
+
+#ifdef LATENCY_HISTOGRAMS
+        u64BufHandoffTimeUs = osalObj_api.GetTimeInMicroSec();
+        recordFrameHandoff(u64BufHandoffTimeUs);
+#endif
+
+        /** Signal to write thread to start writing, the low rate ports
+         *  write the full buffer before reading the next packet      */
+        bWriteInProgress = true;
+        if(bSyncFileWrite)
+            writeSwappedBuffer();
+        else
+            osalObj_api.SignalEvent(&sgnFileWriteInitWaitEvent);
+    }
+
+    if(bFrameStart)
+    {
+        if(u32NumOfFrameStarts == 0)
+        {
+            u32FirstFrameIndex = u32ReadPtrBufIndex;
+#ifdef LOG_DROPPED_PKTS_OFFSET
+            u32FirstFrameLogIndex = bBuf1Empty ? strLogBuf1->u32LogSize :
+                                                 strLogBuf2->u32LogSize;
+#endif
+        }
+        u32LastFrameIndex = u32ReadPtrBufIndex;
+#ifdef LOG_DROPPED_PKTS_OFFSET
+        u32LastFrameLogIndex = bBuf1Empty ? strLogBuf1->u32LogSize :
+                                            strLogBuf2->u32LogSize;
+#endif
+        u32NumOfFrameStarts ++;
+    }
+
+    /** Time marks of the pre-trigger ring at the frame starts (Multi mode)
+     *  or at any packet (Raw mode)                                       */
+    if((psTriggerRing != NULL) && (!bOldPkt) && (!bZeroFilledPkt) &&
+       (bFrameStart || (sRFDCCard_StartRecConfig.eConfigLogMode == RAW_MODE)))
+        addTriggerRingMark();
+
+    /** Store the current packet in buffer  */
+    if(bBuf1Empty)
+        memcpy(&s8RecBuf1[u32ReadPtrBufIndex], s8Buffer, u32Size);
+    else
+        memcpy(&s8RecBuf2[u32ReadPtrBufIndex], s8Buffer, u32Size);
+    u32ReadPtrBufIndex += u32Size;
+    if(!bOldPkt)
+        u32ReadPtrSize += u32Size;
+
+#ifdef LATENCY_HISTOGRAMS
+    if(!bZeroFilledPkt)
+    {
+        LatencyHistRecord(&sRFDCCard_LatencyStats.sHist[u8StatsId]
+                                               [LATENCY_RECV_TO_BUFFER],
+                  osalObj_api.GetTimeInMicroSec() - u64CtPktRecvTimeUs);
+    }
+#endif
+
+#ifdef LOG_DROPPED_PKTS_OFFSET
+    /** Store the missed packet stats in log buffer */
+    if(bBuf1Empty)
+    {
+        if(bZeroFilledPkt)
+        {
+            strLogBuf1->bIsZeroFilledPktPresent = true;
+            strLogBuf1->bValidPacket[strLogBuf1->u32LogSize] = false;
+            strLogBuf1->u32LogSize ++;
+        }
+        else
+        {
+            if(!bOldPkt)
+            {
+                strLogBuf1->bValidPacket[strLogBuf1->u32LogSize] = true;
+                strLogBuf1->u32CtPktSize[strLogBuf1->u32LogSize] =
+                        s32CtPktRecvSize - RECORD_DATA_BUF_INDEX;
+                strLogBuf1->u64CtPktOffset[strLogBuf1->u32LogSize] =
+                        u64BytesSentTillCtPkt;
+                strLogBuf1->u32LogSize ++;
+            }
+            else
+            {
+                strLogBuf1->bValidPacket[strLogBuf1->u32LogSize -
+                        u32LogBufOldIndex] = true;
+                strLogBuf1->u32CtPktSize[strLogBuf1->u32LogSize -
+                        u32LogBufOldIndex] =
+                        s32CtPktRecvSize - RECORD_DATA_BUF_INDEX;
+                strLogBuf1->u64CtPktOffset[strLogBuf1->u32LogSize -
+                        u32LogBufOldIndex] = u64BytesSentTillCtPkt;
+            }
+        }
+    }
+    else
+    {
+        if(bZeroFilledPkt)
+        {
+            strLogBuf2->bIsZeroFilledPktPresent = true;
+            strLogBuf2->bValidPacket[strLogBuf2->u32LogSize] = false;
+            strLogBuf2->u32LogSize ++;
+        }
+        else
+        {
+            if(!bOldPkt)
+            {
+                strLogBuf2->bValidPacket[strLogBuf2->u32LogSize] = true;
+                strLogBuf2->u32CtPktSize[strLogBuf2->u32LogSize] =
+                        s32CtPktRecvSize - RECORD_DATA_BUF_INDEX;
+                strLogBuf2->u64CtPktOffset[strLogBuf2->u32LogSize] =
+                        u64BytesSentTillCtPkt;
+                strLogBuf2->u32LogSize ++;
+            }
+            else
+            {
+                strLogBuf2->bValidPacket[strLogBuf2->u32LogSize -
+                        u32LogBufOldIndex] = true;
+                strLogBuf2->u32CtPktSize[strLogBuf2->u32LogSize -
+                        u32LogBufOldIndex] =
+                        s32CtPktRecvSize - RECORD_DATA_BUF_INDEX;
+                strLogBuf2->u64CtPktOffset[strLogBuf2->u32LogSize -
+                        u32LogBufOldIndex] = u64BytesSentTillCtPkt;
+            }
+        }
+    }
+#endif
+
+}
+
+/** @fn void cUdpDataReceiver::Thread_WriteDataToFile()
+ * @brief This thread function is to handle recording  data in files (inline processing)
+ */
+void cUdpDataReceiver::Thread_WriteDataToFile()
+{
+    while(bSocketState)
+    {
+        /** Wait for ready to write signal      */
+        osalObj_api.WaitForSignal(&sgnFileWriteInitWaitEvent, NON_STOP);
+
+        /** Record is stopped */
+        if(!bWriterActive)
+            break;
+
+        writeSwappedBuffer();
+
+        /** Signal ready for next file write */
+        osalObj_api.SignalEvent(&sgnFileWriteCompletionWaitEvent);
+    }
+
+    /** Signal the exit to the record stop */
+    osalObj_api.SignalEvent(&sgnFileWriteCompletionWaitEvent);
+}
+
+/** @fn void cUdpDataReceiver::writeSwappedBuffer()
+ * @brief This function is to write the buffer handed over by the <!--
+ * --> last buffer swap in file (inline processing)
+ */
+void cUdpDataReceiver::writeSwappedBuffer()
+{
+    /** Buffers spilled before the swap precede the swapped buffer */
+    if(psSpill != NULL)
+        writeSpilledBuffers(psSpill->u32HandoffTail);
+
+    if(bBuf1Empty)
+    {
+        writeDataToFile_Inline(&s8RecBuf2, u32WritePtrSize);
+    }
+    else
+    {
+        writeDataToFile_Inline(&s8RecBuf1, u32WritePtrSize);
+    }
+
+#ifdef LATENCY_HISTOGRAMS
+    LatencyHistRecord(&sRFDCCard_LatencyStats.sHist[u8StatsId]
+                                           [LATENCY_BUFFER_TO_DISK],
+              osalObj_api.GetTimeInMicroSec() - u64BufHandoffTimeUs);
+#endif
+
+    /** Keep the writer busy till the buffers spilled meanwhile are written */
+    while((psSpill != NULL) && (psSpill->u32Head != psSpill->u32Tail))
+        writeSpilledBuffers(psSpill->u32Tail);
+
+    bWriteInProgress = false;
+}
+
+/** @fn void cUdpDataReceiver::writeSpilledBuffers(UINT32 u32Till)
+ * @brief This function is to write the spilled buffers in file till <!--
+ * --> the given spill count (inline processing)
+ * @param [in] u32Till [UINT32] - Spill count to write till
+ */
+void cUdpDataReceiver::writeSpilledBuffers(UINT32 u32Till)
+{
+    UINT32 u32Head = psSpill->u32Head;
+    UINT32 u32Slot = 0;
+
+    while(u32Head != u32Till)
+    {
+        u32Slot = u32Head % psSpill->u32NumOfBufs;
+        writeRecordBuffer_Inline(&psSpill->ps8Buf[u32Slot],
+                                 psSpill->u32Size[u32Slot],
+                                 psSpill->u32HoleIndex[u32Slot],
+                                 psSpill->u64HoleBytes[u32Slot],
+                                 psSpill->u64TimeUs[u32Slot]);
+
+        /** Free the spill buffer for the data port thread */
+        u32Head ++;
+        psSpill->u32Head = u32Head;
+    }
+}
+
+/** @fn bool cUdpDataReceiver::handleWriterOverflow(UINT32 u32Size)
+ * @brief This function is to apply the overflow policy at a buffer <!--
+ * --> swap while the file writer is busy: spill the read buffer to <!--
+ * --> RAM, else drop whole frames of it (inline processing)
+ * @param [in] u32Size  [UINT32] - Size of the data to be stored
+ * @return boolean value, false if the caller has to wait for the writer
+ */
+bool cUdpDataReceiver::handleWriterOverflow(UINT32 u32Size)
+{
+    if(spillReadBuffer())
+        return true;
+
+    if(bDropOnOverflow && dropReadBufferFrames(u32Size))
+        return true;
+
+    sRFDCCard_InlineStats.u64NumOfWriterPauses[u8StatsId] ++;
+    return false;
+}
+
+/** @fn bool cUdpDataReceiver::spillReadBuffer()
+ * @brief This function is to hand the read buffer over to a free <!--
+ * --> spill buffer (inline processing)
+ * @return boolean value
+ */
+bool cUdpDataReceiver::spillReadBuffer()
+{
+    UINT32 u32Tail = 0;
+    UINT32 u32Slot = 0;
+    SINT8 *ps8FreeBuf = NULL;
+
+    if(psSpill == NULL)
+        return false;
+
+    u32Tail = psSpill->u32Tail;
+    if((u32Tail - psSpill->u32Head) >= psSpill->u32NumOfBufs)
+        return false;
+
+    /** Exchange the read buffer with the free spill buffer */
+    u32Slot = u32Tail % psSpill->u32NumOfBufs;
+    ps8FreeBuf = psSpill->ps8Buf[u32Slot];
+    if(bBuf1Empty)
+    {
+        psSpill->ps8Buf[u32Slot] = s8RecBuf1;
+        s8RecBuf1 = ps8FreeBuf;
+    }
+    else
+    {
+        psSpill->ps8Buf[u32Slot] = s8RecBuf2;
+        s8RecBuf2 = ps8FreeBuf;
+    }
+    psSpill->u32Size[u32Slot] = u32ReadPtrSize;
+    psSpill->u32HoleIndex[u32Slot] = u32ReadHoleIndex;
+    psSpill->u64HoleBytes[u32Slot] = u64ReadHoleBytes;
+    psSpill->u64TimeUs[u32Slot] = osalObj_api.GetTimeInMicroSec();
+    psSpill->u32Tail = u32Tail + 1;
+
+    sRFDCCard_InlineStats.u64NumOfSpilledBufs[u8StatsId] ++;
+
+#ifdef LATENCY_HISTOGRAMS
+    recordFrameHandoff(osalObj_api.GetTimeInMicroSec());
+#endif
+
+    /** Packets of the spilled buffer stay in the read log buffer */
+    u64ReadBufOffset += u32ReadPtrSize + u64ReadHoleBytes;
+    u32ReadPtrSize = 0;
+    u32ReadPtrBufIndex = 0;
+    resetReadBufferDropState();
+#ifdef LOG_DROPPED_PKTS_OFFSET
+    u32DropFloorLogIndex = bBuf1Empty ? strLogBuf1->u32LogSize :
+                                        strLogBuf2->u32LogSize;
+#endif
+
+    return true;
+}
+
+/** @fn bool cUdpDataReceiver::dropReadBufferFrames(UINT32 u32Size)
+ * @brief This function is to drop whole frames of the read buffer to <!--
+ * --> store the next data. Raw mode has no frame boundaries, hence all <!--
+ * --> the data from the drop floor is dropped (inline processing)
+ * @param [in] u32Size  [UINT32] - Size of the data to be stored
+ * @return boolean value
+ */
+bool cUdpDataReceiver::dropReadBufferFrames(UINT32 u32Size)
+{
+    SINT8 *ps8ReadBuf = bBuf1Empty ? s8RecBuf1 : s8RecBuf2;
+    UINT32 u32DropStart = u32DropFloorIndex;
+    UINT32 u32DropEnd = u32ReadPtrSize;
+    ULONG64 u64Frames = u32NumOfFrameStarts;
+    bool bKeepLastFrame = false;
+
+    /** Data after the hole of an earlier drop starts with a frame, else
+     *  the data before the first frame start completes a stored frame  */
+    if(u64ReadHoleBytes > 0)
+        u32DropStart = u32ReadHoleIndex;
+    else if(u32NumOfFrameStarts > 0)
+        u32DropStart = u32FirstFrameIndex;
+
+    /** Keep the frame in progress if the frames before it make room */
+    if((u32NumOfFrameStarts > 0) && (u32LastFrameIndex > u32DropStart) &&
+       ((u32DropStart + (u32ReadPtrSize - u32LastFrameIndex) + u32Size) <=
+                                                        u32InlineBufSize))
+    {
+        u32DropEnd = u32LastFrameIndex;
+        u64Frames = u32NumOfFrameStarts - 1;
+        bKeepLastFrame = true;
+    }
+
+    if((u32DropEnd <= u32DropStart) ||
+       ((u32DropStart + u32Size) > u32InlineBufSize))
+        return false;
+
+#ifdef LOG_DROPPED_PKTS_OFFSET
+    /** Dropped packets are replaced by a zero filled log entry, so the
+     *  dropped bytes are logged like the zero filled ones             */
+    strInlineProcLogFileStats *psReadLog = bBuf1Empty ? strLogBuf1 :
+                                                        strLogBuf2;
+    UINT32 u32LogStart = u32DropFloorLogIndex;
+    UINT32 u32LogEnd = bKeepLastFrame ? u32LastFrameLogIndex :
+                                        psReadLog->u32LogSize;
+    UINT32 u32LogTail = psReadLog->u32LogSize - u32LogEnd;
+
+    if(u64ReadHoleBytes > 0)
+        u32LogStart = u32ReadHoleLogIndex + 1;
+    else if(u32NumOfFrameStarts > 0)
+        u32LogStart = u32FirstFrameLogIndex;
+
+    if((u64ReadHoleBytes == 0) && (u32LogEnd > u32LogStart))
+    {
+        u32ReadHoleLogIndex = u32LogStart;
+        psReadLog->bValidPacket[u32LogStart] = false;
+        psReadLog->bIsZeroFilledPktPresent = true;
+        u32LogStart ++;
+    }
+    if(u32LogEnd > u32LogStart)
+    {
+        memmove(&psReadLog->bValidPacket[u32LogStart],
+                &psReadLog->bValidPacket[u32LogEnd], u32LogTail * sizeof(bool));
+        memmove(&psReadLog->u64CtPktOffset[u32LogStart],
+                &psReadLog->u64CtPktOffset[u32LogEnd],
+                u32LogTail * sizeof(ULONG64));
+        memmove(&psReadLog->u32CtPktSize[u32LogStart],
+                &psReadLog->u32CtPktSize[u32LogEnd],
+                u32LogTail * sizeof(psReadLog->u32CtPktSize[0]));
+        psReadLog->u32LogSize = u32LogStart + u32LogTail;
+    }
+    u32DropFloorLogIndex = u32LogStart;
+    u32FirstFrameLogIndex = u32LogStart;
+    u32LastFrameLogIndex = u32LogStart;
+#endif
+
+    /** Move the frame in progress next to the hole */
+    memmove(&ps8ReadBuf[u32DropStart], &ps8ReadBuf[u32DropEnd],
+            u32ReadPtrSize - u32DropEnd);
+    if(u64ReadHoleBytes == 0)
+        u32ReadHoleIndex = u32DropStart;
+    u64ReadHoleBytes += (u32DropEnd - u32DropStart);
+
+    sRFDCCard_InlineStats.u64NumOfDroppedFrames[u8StatsId] += u64Frames;
+    sRFDCCard_InlineStats.u64NumOfDroppedBytes[u8StatsId] +=
+                                            (u32DropEnd - u32DropStart);
+
+    u32ReadPtrSize = u32DropStart + (u32ReadPtrSize - u32DropEnd);
+    u32ReadPtrBufIndex = u32ReadPtrSize;
+    u32DropFloorIndex = u32DropStart;
+    u32FirstFrameIndex = u32DropStart;
+    u32LastFrameIndex = u32DropStart;
+    u32NumOfFrameStarts = bKeepLastFrame ? 1 : 0;
+
+    /** Rest of the dropped frame in progress is dropped as it arrives */
+    bDroppingFrame = (!bKeepLastFrame) &&
+            (sRFDCCard_StartRecConfig.eConfigLogMode == MULTI_MODE);
+
+    return true;
+}
+
+/** @fn void cUdpDataReceiver::dropReadBufferPacket(UINT32 u32Size)
+ * @brief This function is to drop a packet of the frame being dropped, <!--
+ * --> the packet is added to the hole of the read buffer (inline processing)
+ * @param [in] u32Size  [UINT32] - Size of the packet data
+ */
+void cUdpDataReceiver::dropReadBufferPacket(UINT32 u32Size)
+{
+    /** Read buffer was swapped or spilled since the frame drop */
+    if(u64ReadHoleBytes == 0)
+    {
+        u32ReadHoleIndex = u32ReadPtrSize;
+        u32DropFloorIndex = u32ReadPtrSize;
+#ifdef LOG_DROPPED_PKTS_OFFSET
+        strInlineProcLogFileStats *psReadLog = bBuf1Empty ? strLogBuf1 :
+                                                            strLogBuf2;
+        u32ReadHoleLogIndex = psReadLog->u32LogSize;
+        psReadLog->bValidPacket[psReadLog->u32LogSize] = false;
+        psReadLog->bIsZeroFilledPktPresent = true;
+        psReadLog->u32LogSize ++;
+        u32DropFloorLogIndex = psReadLog->u32LogSize;
+#endif
+    }
+    u64ReadHoleBytes += u32Size;
+
+    sRFDCCard_InlineStats.u64NumOfDroppedBytes[u8StatsId] += u32Size;
+}
+
+/** @fn void cUdpDataReceiver::resetReadBufferDropState()
+ * @brief This function is to reset the dropped frames state of the <!--
+ * --> read buffer once it is handed to the file writer (inline processing)
+ */
+void cUdpDataReceiver::resetReadBufferDropState()
+{
+    u32ReadHoleIndex = 0;
+    u64ReadHoleBytes = 0;
+    u32DropFloorIndex = 0;
+    u32NumOfFrameStarts = 0;
+    u32FirstFrameIndex = 0;
+    u32LastFrameIndex = 0;
+#ifdef LOG_DROPPED_PKTS_OFFSET
+    u32DropFloorLogIndex = 0;
+    u32FirstFrameLogIndex = 0;
+    u32LastFrameLogIndex = 0;
+    u32ReadHoleLogIndex = 0;
+#endif
+}
+
+/** @fn bool cUdpDataReceiver::writeDataToFile_Inline(SINT8 **pps8Buffer, UINT32 u32Size)
+ * @brief This function is to handle recording  data in files along with  <!--
+ * --> reordering of data (inline processing)
+ * @param [in, out] pps8Buffer [SINT8 **] - Buffer to write in file, <!--
+ * --> exchanged with an empty one if handed over to a stripe writer
+ * @param [in] u32Size  [UINT32] - Size of buffer
+ * @return boolean value
+ */
+bool cUdpDataReceiver::writeDataToFile_Inline(SINT8 **pps8Buffer, UINT32 u32Size)
+{
+    if(!writeRecordBuffer_Inline(pps8Buffer, u32Size, u32WriteHoleIndex,
+                                 u64WriteHoleBytes, u64WriteBufTimeUs))
+        return false;
+
+    /** Record data of the buffer is committed for the readers */
+    publishWatermark(false);
+
+#ifdef LOG_DROPPED_PKTS_OFFSET
+
+	/** Logfile writing */
+    writeLogToFile_Inline();
+	
+#endif
+
+    return true;
+}
+
+/** @fn bool cUdpDataReceiver::writeRecordBuffer_Inline(SINT8 **pps8Buffer, UINT32 u32Size, UINT32 u32HoleIndex, ULONG64 u64HoleBytes, ULONG64 u64TimeUs)
+ * @brief This function is to write a record buffer in the record file, <!--
+ * --> hand it over as the next stripe or keep it in the pre-trigger <!--
+ * --> ring (inline processing)
+ * @param [in, out] pps8Buffer [SINT8 **] - Buffer to write in file, <!--
+ * --> exchanged with an empty one if handed over to a stripe writer
+ * @param [in] u32Size  [UINT32] - Size of buffer
+ * @param [in] u32HoleIndex [UINT32] - Buffer index of the dropped frames
+ * @param [in] u64HoleBytes [ULONG64] - Dropped bytes
+ * @param [in] u64TimeUs [ULONG64] - Time the buffer is handed over
+ * @return boolean value
+ */
+bool cUdpDataReceiver::writeRecordBuffer_Inline(SINT8 **pps8Buffer, UINT32 u32Size,
+                                    UINT32 u32HoleIndex, ULONG64 u64HoleBytes,
+                                    ULONG64 u64TimeUs)
+{
+    /** Data of the buffer is received since the previous handover */
+    u64RecordBufStartUs = u64RecordBufEndUs;
+    u64RecordBufEndUs = u64TimeUs;
+
+    /** Event trigger mode - only the ring data of the triggers is written */
+    if(psTriggerRing != NULL)
+        return writeTriggerRing_Inline(pps8Buffer, u32Size, u32HoleIndex,
+                                       u64HoleBytes);
+
+    bool bStatus = writeRecordData_Inline(pps8Buffer, u32Size, u32HoleIndex,
+                                          u64HoleBytes, u64WriteBufOffset);
+    u64WriteBufOffset += u32Size + u64HoleBytes;
+    return bStatus;
+}
+
+/** @fn bool cUdpDataReceiver::writeRecordData_Inline(SINT8 **pps8Buffer, UINT32 u32Size, UINT32 u32HoleIndex, ULONG64 u64HoleBytes, ULONG64 u64StreamOffset)
+ * @brief This function is to reorder and filter record data and <!--
+ * --> write it in the record file or hand it over as the next <!--
+ * --> stripe (inline processing)
+ * @param [in, out] pps8Buffer [SINT8 **] - Buffer to write in file, <!--
+ * --> exchanged with an empty one if handed over to a stripe writer
+ * @param [in] u32Size  [UINT32] - Size of buffer
+ * @param [in] u32HoleIndex [UINT32] - Buffer index of the dropped frames
+ * @param [in] u64HoleBytes [ULONG64] - Dropped bytes
+ * @param [in] u64StreamOffset [ULONG64] - Data stream offset of the buffer
+ * @return boolean value
+ */
+bool cUdpDataReceiver::writeRecordData_Inline(SINT8 **pps8Buffer, UINT32 u32Size,
+                                    UINT32 u32HoleIndex, ULONG64 u64HoleBytes,
+                                    ULONG64 u64StreamOffset)
+{
+    /** Reordering data bytes, the capture filter works on the ADC data
+     *  layout of the record file                                       */
+    if(sRFDCCard_StartRecConfig.bReorderEnable)
+    {
+        if(!ReorderAlgorithm(*pps8Buffer, u32Size))
+            return false;
+    }
+
+    if(bCaptureFilter)
+    {
+        filterRecordData_Inline(*pps8Buffer, &u32Size, &u32HoleIndex,
+                                &u64HoleBytes, u64StreamOffset);
+
+        /** Nothing kept of the buffer */
+        if((u32Size == 0) && (u64HoleBytes == 0))
+            return true;
+    }
+    u64RecordBytes += u32Size + u64HoleBytes;
+
+    /** Tags are taken before a stripe writer gets the buffer */
+    if(pCrcLogFile != NULL)
+        updateRecordCrc_Inline(*pps8Buffer, u32Size, u32HoleIndex,
+                               u64HoleBytes);
+
+    if(u8NumOfStripeWriters > 0)
+        return writeStripe_Inline(pps8Buffer, u32Size, u32HoleIndex,
+                                  u64HoleBytes);
+
+    u64RecordBufOffset = u64RecordFileOffset + u32DataCount;
+    u64RecordBufBytes = u32Size + u64HoleBytes;
+    return writeBufferToFile_Inline(*pps8Buffer, u32Size, u32HoleIndex,
+                                    u64HoleBytes);
+}
+
+/** @fn void cUdpDataReceiver::filterRecordData_Inline(SINT8 *s8Buffer, UINT32 *pu32Size, UINT32 *pu32HoleIndex, ULONG64 *pu64HoleBytes, ULONG64 u64StreamOffset)
+ * @brief This function is to remove the frames, RX channels and <!--
+ * --> chirps dropped by the capture filter from record data in place
+ * @param [in, out] s8Buffer [SINT8 *] - Record data
+ * @param [in, out] pu32Size [UINT32 *] - Size of record data
+ * @param [in, out] pu32HoleIndex [UINT32 *] - Buffer index of the <!--
+ * --> dropped frames
+ * @param [in, out] pu64HoleBytes [ULONG64 *] - Dropped bytes
+ * @param [in] u64StreamOffset [ULONG64] - Data stream offset of the data
+ */
+void cUdpDataReceiver::filterRecordData_Inline(SINT8 *s8Buffer, UINT32 *pu32Size,
+                                UINT32 *pu32HoleIndex, ULONG64 *pu64HoleBytes,
+                                ULONG64 u64StreamOffset)
+{
+    UINT32 u32Size = *pu32Size;
+    UINT32 u32HoleIndex = *pu32HoleIndex;
+    ULONG64 u64HoleBytes = *pu64HoleBytes;
+    ULONG64 u64Kept = 0;
+    ULONG64 u64HoleKept = 0;
+
+    /** The hole keeps the size of the data kept of the dropped frames */
+    u64Kept = filterRecordBytes_Inline(s8Buffer, 0, 0, u32HoleIndex,
+                                       u64StreamOffset);
+    *pu32HoleIndex = (UINT32)u64Kept;
+    u64HoleKept = filterRecordBytes_Inline(NULL, 0, 0, u64HoleBytes,
+                                           u64StreamOffset + u32HoleIndex);
+    u64Kept = filterRecordBytes_Inline(s8Buffer, u64Kept, u32HoleIndex,
+                                       u32Size - u32HoleIndex,
+                                       u64StreamOffset + u32HoleIndex +
+                                       u64HoleBytes);
+
+    sRFDCCard_InlineStats.u64NumOfFilteredBytes[u8StatsId] +=
+                    (u32Size + u64HoleBytes) - (u64Kept + u64HoleKept);
+    *pu32Size = (UINT32)u64Kept;
+    *pu64HoleBytes = u64HoleKept;
+}
+
+/** @fn ULONG64 cUdpDataReceiver::filterRecordBytes_Inline(SINT8 *s8Buffer, ULONG64 u64OutIndex, ULONG64 u64InIndex, ULONG64 u64Size, ULONG64 u64StreamOffset)
+ * @brief This function is to move the bytes kept by the capture <!--
+ * --> filter to the output index, a NULL buffer only counts them
+ * @param [in, out] s8Buffer [SINT8 *] - Record data or NULL
+ * @param [in] u64OutIndex [ULONG64] - Output index of the kept bytes
+ * @param [in] u64InIndex [ULONG64] - Buffer index of the bytes
+ * @param [in] u64Size [ULONG64] - Number of bytes
+ * @param [in] u64StreamOffset [ULONG64] - Data stream offset of the bytes
+ * @return ULONG64 value - Output index after the kept bytes
+ */
+ULONG64 cUdpDataReceiver::filterRecordBytes_Inline(SINT8 *s8Buffer,
+                                ULONG64 u64OutIndex, ULONG64 u64InIndex,
+                                ULONG64 u64Size, ULONG64 u64StreamOffset)
+{
+    strCaptureFilterConfig *psFilter = &sRFDCCard_StartRecConfig.sCaptureFilter;
+    ULONG64 u64Frame = 0;
+    ULONG64 u64FrameIndex = 0;
+    UINT32 u32Chirp = 0;
+    UINT32 u32ChirpIndex = 0;
+    ULONG64 u64Chunk = 0;
+    bool bKeep = false;
+
+    /** Data is walked in RX channel segments, a dropped frame or chirp
+     *  is skipped at once                                             */
+    while(u64Size > 0)
+    {
+        u64Frame = u64StreamOffset / u64FilterFrameSize;
+        u64FrameIndex = u64StreamOffset % u64FilterFrameSize;
+        u32Chirp = (UINT32)(u64FrameIndex / u32FilterChirpSize);
+        u32ChirpIndex = (UINT32)(u64FrameIndex % u32FilterChirpSize);
+
+        if((u64Frame < psFilter->u32FrameStartIdx) ||
+           (u64Frame > psFilter->u32FrameEndIdx) ||
+           (((u64Frame - psFilter->u32FrameStartIdx) %
+                                    psFilter->u32FrameDecimation) != 0))
+        {
+            u64Chunk = u64FilterFrameSize - u64FrameIndex;
+            bKeep = false;
+        }
+        else if((u32Chirp < psFilter->u16ChirpStartIdx) ||
+                (u32Chirp > psFilter->u16ChirpEndIdx))
+        {
+            u64Chunk = u32FilterChirpSize - u32ChirpIndex;
+            bKeep = false;
+        }
+        else
+        {
+            u64Chunk = u32FilterRxSize - (u32ChirpIndex % u32FilterRxSize);
+            bKeep = ((u8FilterRxSlotMask >>
+                      (u32ChirpIndex / u32FilterRxSize)) & 1) != 0;
+        }
+        if(u64Chunk > u64Size)
+            u64Chunk = u64Size;
+
+        if(bKeep)
+        {
+            if((s8Buffer != NULL) && (u64OutIndex != u64InIndex))
+                memmove(&s8Buffer[u64OutIndex], &s8Buffer[u64InIndex],
+                        u64Chunk);
+            u64OutIndex += u64Chunk;
+        }
+        u64InIndex += u64Chunk;
+        u64StreamOffset += u64Chunk;
+        u64Size -= u64Chunk;
+    }
+
+    return u64OutIndex;
+}
+
+/** @fn bool cUdpDataReceiver::writeTriggerRing_Inline(SINT8 **pps8Buffer, UINT32 u32Size, UINT32 u32HoleIndex, ULONG64 u64HoleBytes)
+ * @brief This function is to keep a record buffer in the pre-trigger <!--
+ * --> ring and dump the ring data of the triggers (inline processing)
+ * @param [in, out] pps8Buffer [SINT8 **] - Buffer to keep in the ring
+ * @param [in] u32Size  [UINT32] - Size of buffer
+ * @param [in] u32HoleIndex [UINT32] - Buffer index of the dropped frames
+ * @param [in] u64HoleBytes [ULONG64] - Dropped bytes
+ * @return boolean value
+ */
+bool cUdpDataReceiver::writeTriggerRing_Inline(SINT8 **pps8Buffer, UINT32 u32Size,
+                                    UINT32 u32HoleIndex, ULONG64 u64HoleBytes)
+{
+    /** Trigger detection of the application on the received data */
+    if((RecordTrigger_Callback != NULL) &&
+       RecordTrigger_Callback(*pps8Buffer, u32Size))
+    {
+        setTrigger();
+    }
+
+    /** Pending trigger is handled before the buffer overwrites the
+     *  pre-trigger data in the ring                                  */
+    if(!dumpTriggerRing())
+        return false;
+
+    /** Dropped frames are kept as zeros to keep the data offsets */
+    copyToTriggerRing(*pps8Buffer, u32HoleIndex);
+    copyToTriggerRing(NULL, u64HoleBytes);
+    copyToTriggerRing(&(*pps8Buffer)[u32HoleIndex], u32Size - u32HoleIndex);
+
+    return dumpTriggerRing();
+}
+
+/** @fn void cUdpDataReceiver::copyToTriggerRing(const SINT8 *s8Buffer, ULONG64 u64Size)
+ * @brief This function is to append data to the pre-trigger ring, a <!--
+ * --> NULL buffer appends zeros (inline processing)
+ * @param [in] s8Buffer [const SINT8 *] - Data or NULL
+ * @param [in] u64Size [ULONG64] - Size of data
+ */
+void cUdpDataReceiver::copyToTriggerRing(const SINT8 *s8Buffer, ULONG64 u64Size)
+{
+    strTriggerRing *psRing = psTriggerRing;
+    ULONG64 u64Pos = 0;
+    ULONG64 u64Chunk = 0;
+
+    /** Data beyond the ring size is overwritten by the rest of it */
+    if(u64Size > psRing->u64Size)
+    {
+        if(s8Buffer != NULL)
+            s8Buffer += (u64Size - psRing->u64Size);
+        psRing->u64Tail += (u64Size - psRing->u64Size);
+        u64Size = psRing->u64Size;
+    }
+
+    while(u64Size > 0)
+    {
+        u64Pos = psRing->u64Tail % psRing->u64Size;
+        u64Chunk = psRing->u64Size - u64Pos;
+        if(u64Chunk > u64Size)
+            u64Chunk = u64Size;
+
+        if(s8Buffer != NULL)
+        {
+            memcpy(&psRing->ps8Buf[u64Pos], s8Buffer, u64Chunk);
+            s8Buffer += u64Chunk;
+        }
+        else
+        {
+            memset(&psRing->ps8Buf[u64Pos], 0, u64Chunk);
+        }
+        psRing->u64Tail += u64Chunk;
+        u64Size -= u64Chunk;
+    }
+}
+
+/** @fn bool cUdpDataReceiver::dumpTriggerRing()
+ * @brief This function is to handle the pending trigger and write the <!--
+ * --> ring data of the dump in progress (inline processing)
+ * @return boolean value
+ */
+bool cUdpDataReceiver::dumpTriggerRing()
+{
+    strTriggerRing *psRing = psTriggerRing;
+    ULONG64 u64TriggerUs = psRing->u64PendingTriggerUs.exchange(0);
+    ULONG64 u64RingStart = 0;
+    ULONG64 u64StartUs = 0;
+    ULONG64 u64Floor = 0;
+    ULONG64 u64From = 0;
+    ULONG64 u64To = 0;
+    ULONG64 u64Pos = 0;
+    UINT32 u32Size = 0;
+    UINT32 u32Copied = 0;
+    UINT32 u32Chunk = 0;
+
+    if(psRing->u64Tail > psRing->u64Size)
+        u64RingStart = psRing->u64Tail - psRing->u64Size;
+
+    if(u64TriggerUs != 0)
+    {
+        /** A new dump starts at the time mark the pre-trigger duration
+         *  before the trigger, a trigger during a dump extends it       */
+        if(!psRing->bDumping)
+        {
+            u64StartUs = (ULONG64)sRFDCCard_StartRecConfig.u32PreTriggerDuration *
+                         MILLI_TO_MICRO_SEC_CONVERSION;
+            u64StartUs = (u64TriggerUs > u64StartUs) ?
+                         (u64TriggerUs - u64StartUs) : 0;
+            u64Floor = (psRing->u64DumpedTill > u64RingStart) ?
+                        psRing->u64DumpedTill : u64RingStart;
+
+            psRing->u64DumpStart = findTriggerRingMark(u64StartUs, true,
+                                u64Floor, &psRing->u64DumpStartTimeUs);
+            if(psRing->u64DumpStart == ULLONG_MAX)
+            {
+                psRing->u64DumpStart = u64Floor;
+                psRing->u64DumpStartTimeUs = u64TriggerUs;
+            }
+            psRing->u64DumpTriggerTimeUs = u64TriggerUs;
+            psRing->u64DumpFileOffset = u64RecordBytes;
+            psRing->bDumping = true;
+        }
+        psRing->u64DumpEndTimeUs = psRing->u64LastTriggerUs +
+                    (ULONG64)sRFDCCard_StartRecConfig.u32PostTriggerDuration *
+                    MILLI_TO_MICRO_SEC_CONVERSION;
+        psRing->u64DumpEnd = ULLONG_MAX;
+    }
+
+    if(!psRing->bDumping)
+        return true;
+
+    /** Dump ends at the time mark the post-trigger duration after the
+     *  last trigger, the mark time replaces the end time once found   */
+    if(psRing->u64DumpEnd == ULLONG_MAX)
+    {
+        psRing->u64DumpEnd = findTriggerRingMark(psRing->u64DumpEndTimeUs,
+                    false, psRing->u64DumpStart + 1, &psRing->u64DumpEndTimeUs);
+    }
+
+    u64From = psRing->u64DumpStart;
+    if(u64From < psRing->u64DumpedTill)
+        u64From = psRing->u64DumpedTill;
+    if(u64From < u64RingStart)
+        u64From = u64RingStart;
+    u64To = (psRing->u64DumpEnd < psRing->u64Tail) ? psRing->u64DumpEnd :
+                                                     psRing->u64Tail;
+
+    /** Ring data is written in record buffers, a stripe writer exchanges
+     *  the dump buffer with its empty one                                */
+    while(u64From < u64To)
+    {
+        u32Size = ((u64To - u64From) < u32InlineBufSize) ?
+                  (UINT32)(u64To - u64From) : u32InlineBufSize;
+        for(u32Copied = 0; u32Copied < u32Size; u32Copied += u32Chunk)
+        {
+            u64Pos = (u64From + u32Copied) % psRing->u64Size;
+            u32Chunk = u32Size - u32Copied;
+            if(u32Chunk > (psRing->u64Size - u64Pos))
+                u32Chunk = (UINT32)(psRing->u64Size - u64Pos);
+            memcpy(&psRing->ps8DumpBuf[u32Copied], &psRing->ps8Buf[u64Pos],
+                   u32Chunk);
+        }
+
+        if(!writeRecordData_Inline(&psRing->ps8DumpBuf, u32Size, 0, 0,
+                                   u64From))
+            return false;
+
+        u64From += u32Size;
+        psRing->u64DumpedTill = u64From;
+    }
+
+    /** Ring data till the dump end is written or already overwritten */
+    if((psRing->u64DumpEnd != ULLONG_MAX) &&
+       (psRing->u64Tail >= psRing->u64DumpEnd))
+    {
+        closeTriggerDump();
+    }
+
+    return true;
+}
+
+/** @fn ULONG64 cUdpDataReceiver::findTriggerRingMark(ULONG64 u64TimeUs, bool bBefore, ULONG64 u64Floor, ULONG64 *pu64MarkTimeUs)
+ * @brief This function is to find the data stream offset of the <!--
+ * --> time mark at a dump boundary (inline processing)
+ * @param [in] u64TimeUs [ULONG64] - Dump boundary time (micro seconds)
+ * @param [in] bBefore [bool] - Last mark at or before the time if <!--
+ * --> true (else the oldest mark), else first mark at or after it
+ * @param [in] u64Floor [ULONG64] - Marks before this offset are not used
+ * @param [out] pu64MarkTimeUs [ULONG64 *] - Receive time of the mark
+ * @return ULONG64 value - Data stream offset, ULLONG_MAX if not found
+ */
+ULONG64 cUdpDataReceiver::findTriggerRingMark(ULONG64 u64TimeUs, bool bBefore,
+                                ULONG64 u64Floor, ULONG64 *pu64MarkTimeUs)
+{
+    strTriggerRing *psRing = psTriggerRing;
+    UINT32 u32MarkTail = psRing->u32MarkTail;
+    UINT32 u32NumOfMarks = 0;
+    UINT32 u32Slot = 0;
+    ULONG64 u64Offset = ULLONG_MAX;
+
+    /** The data port thread may be overwriting the oldest half */
+    u32NumOfMarks = (u32MarkTail < (MAX_TRIGGER_RING_MARKS / 2)) ?
+                     u32MarkTail : (MAX_TRIGGER_RING_MARKS / 2);
+
+    /** Newest to oldest mark */
+    for(UINT32 i = 1; i <= u32NumOfMarks; i ++)
+    {
+        u32Slot = (u32MarkTail - i) % MAX_TRIGGER_RING_MARKS;
+        if(psRing->u64MarkOffset[u32Slot] < u64Floor)
+            break;
+
+        if(bBefore || (psRing->u64MarkTimeUs[u32Slot] >= u64TimeUs))
+        {
+            u64Offset = psRing->u64MarkOffset[u32Slot];
+            *pu64MarkTimeUs = psRing->u64MarkTimeUs[u32Slot];
+        }
+
+        if(bBefore && (psRing->u64MarkTimeUs[u32Slot] <= u64TimeUs))
+            break;
+        if((!bBefore) && (psRing->u64MarkTimeUs[u32Slot] < u64TimeUs))
+            break;
+    }
+
+    return u64Offset;
+}
+
+/** @fn void cUdpDataReceiver::addTriggerRingMark()
+ * @brief This function is to add a time mark of the pre-trigger ring <!--
+ * --> at the read buffer index (inline processing)
+ */
+void cUdpDataReceiver::addTriggerRingMark()
+{
+    strTriggerRing *psRing = psTriggerRing;
+    ULONG64 u64TimeUs = osalObj_api.GetTimeInMicroSec();
+    UINT32 u32MarkTail = psRing->u32MarkTail;
+    UINT32 u32Slot = u32MarkTail % MAX_TRIGGER_RING_MARKS;
+
+    if((u32MarkTail > 0) &&
+       ((u64TimeUs - u64LastMarkTimeUs) < TRIGGER_RING_MARK_INTERVAL_US))
+        return;
+
+    psRing->u64MarkOffset[u32Slot] = u64ReadBufOffset +
+                                    u32ReadPtrBufIndex + u64ReadHoleBytes;
+    psRing->u64MarkTimeUs[u32Slot] = u64TimeUs;
+    psRing->u32MarkTail = u32MarkTail + 1;
+    u64LastMarkTimeUs = u64TimeUs;
+}
+
+/** @fn void cUdpDataReceiver::closeTriggerDump()
+ * @brief This function is to end the dump in progress and add it to <!--
+ * --> the trigger log (inline processing)
+ */
+void cUdpDataReceiver::closeTriggerDump()
+{
+    strTriggerRing *psRing = psTriggerRing;
+    UINT32 u32MarkTail = psRing->u32MarkTail;
+    ULONG64 u64EndUs = psRing->u64DumpEndTimeUs;
+    ULONG64 u64NowUs = osalObj_api.GetTimeInMicroSec();
+    ULONG64 u64EpochUs = (ULONG64)std::chrono::duration_cast<
+                std::chrono::microseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count();
+
+    /** Record stopped before the post-trigger duration, the dump ends at
+     *  the last data received                                            */
+    if(psRing->u64DumpEnd == ULLONG_MAX)
+    {
+        if((u32MarkTail > 0) && (psRing->u64MarkTimeUs[(u32MarkTail - 1) %
+                                MAX_TRIGGER_RING_MARKS] < u64EndUs))
+            u64EndUs = psRing->u64MarkTimeUs[(u32MarkTail - 1) %
+                                             MAX_TRIGGER_RING_MARKS];
+    }
+    else if(psRing->u64DumpedTill < psRing->u64DumpEnd)
+    {
+        psRing->u64DumpedTill = psRing->u64DumpEnd;
+    }
+    if(u64EndUs < psRing->u64DumpTriggerTimeUs)
+        u64EndUs = psRing->u64DumpTriggerTimeUs;
+
+    if(pTriggerLogFile != NULL)
+    {
+        fprintf(pTriggerLogFile, "%u,%llu,%.3f,%.3f,%llu,%llu,%llu\n",
+                psRing->u32NumOfDumps,
+                u64EpochUs - (u64NowUs - psRing->u64DumpTriggerTimeUs),
+                ((DOUBLE)psRing->u64DumpTriggerTimeUs -
+                 (DOUBLE)psRing->u64DumpStartTimeUs) /
+                                            MILLI_TO_MICRO_SEC_CONVERSION,
+                (DOUBLE)(u64EndUs - psRing->u64DumpTriggerTimeUs) /
+                                            MILLI_TO_MICRO_SEC_CONVERSION,
+                psRing->u64DumpStart, psRing->u64DumpFileOffset,
+                u64RecordBytes - psRing->u64DumpFileOffset);
+        fflush(pTriggerLogFile);
+    }
+
+    sRFDCCard_InlineStats.u64NumOfTriggerDumps[u8StatsId] ++;
+    psRing->u32NumOfDumps ++;
+    psRing->bDumping = false;
+}
+
+/** @fn bool cUdpDataReceiver::createTriggerLog()
+ * @brief This function is to create the trigger log of the record <!--
+ * --> (inline processing)
+ * @return boolean value
+ */
+bool cUdpDataReceiver::createTriggerLog()
+{
+    SINT8 s8LogFileName[MAX_NAME_LEN * 3];
 
-                /** Updating inline processing summary */
-                UpdateInlineStatus(true, u8DataTypeId);
-            }
-            else if (u32CtPktNum > u32NextPktNum)
-            {              
-                sRFDCCard_InlineStats.u64NumOfRecvdPackets[u8DataTypeId] ++;
-
-                u32NumOfDroppedPkts = u32CtPktNum - u32NextPktNum;
-                sRFDCCard_InlineStats.u64NumOfZeroFilledPackets[u8DataTypeId]
-                        += u32NumOfDroppedPkts;
-
-                u64ZeroFilledBytes = u64BytesSentTillCtPkt -
-                        (u64BytesSentTillPrevPkt + (s32PrevPktRecvSize -
-                         RECORD_DATA_BUF_INDEX));
-                sRFDCCard_InlineStats.u64NumOfZeroFilledBytes[u8DataTypeId]
-                        += u64ZeroFilledBytes;
-
-                /** Write single packet to ensure not filling beyond buffer size */
-                while(u64ZeroFilledBytes >= PAYLOAD_BYTES_PER_PACKET)
-                {
-                    /** Verifies bytes stop mode    */
-                    if(sRFDCCard_StartRecConfig.eRecordStopMode == BYTES)
-                    {
-                        /** Stop recording if data matches the total number of bytes */
-                        if((dTotalBytes + PAYLOAD_BYTES_PER_PACKET) >=
-                                sRFDCCard_StartRecConfig.u32BytesToCapture)
-                        {
-                            writeDataToBuffer_Inline(s8ZeroBuf,
-                              (UINT32)(sRFDCCard_StartRecConfig.u32BytesToCapture - dTotalBytes),
-                                             false, true);
+    strcpy(s8LogFileName, strRecordFilePath);
+    strcat(s8LogFileName, TRIGGER_LOG_FILE_NAME);
 
-                            /** Updating inline processing summary */
-                            UpdateInlineStatus(true, u8DataTypeId);
+    pTriggerLogFile = fopen(s8LogFileName, "w");
+    if(NULL == pTriggerLogFile)
+    {
+        RFDCARD_Callback(CMD_CODE_SYSTEM_ASYNC_STATUS,
+                         STS_REC_FILE_CREATION_ERR);
+        return false;
+    }
 
-                            /** Stop the recording */
-                            bThreadState = false;
-                            if(!gbRecStopCmdSent)
-                                RFDCARD_Callback(CMD_CODE_SYSTEM_ASYNC_STATUS,
-                                             STS_REC_COMPLETED);
-                            goto START_LOOP;
-                        }
+    fprintf(pTriggerLogFile, "%s\nPre-trigger (ms),%u\nPost-trigger (ms),%u\n",
+            TRIGGER_LOG_TITLE, sRFDCCard_StartRecConfig.u32PreTriggerDuration,
+            sRFDCCard_StartRecConfig.u32PostTriggerDuration);
+    fprintf(pTriggerLogFile, "Dump,Trigger time (us since epoch),"
+            "Pre-trigger (ms),Post-trigger (ms),Stream offset (bytes),"
+            "File offset (bytes),Size (bytes)\n");
+    fflush(pTriggerLogFile);
 
-                        writeDataToBuffer_Inline(s8ZeroBuf, PAYLOAD_BYTES_PER_PACKET,
-                                                 false, true);
-                        dTotalBytes += (PAYLOAD_BYTES_PER_PACKET) ;
-                    }
-                    else
-                    {
-                        writeDataToBuffer_Inline(s8ZeroBuf, PAYLOAD_BYTES_PER_PACKET,
-                                                 false, true);
-                    }
-                    u64ZeroFilledBytes -= PAYLOAD_BYTES_PER_PACKET;
-                }
-                if(u64ZeroFilledBytes > 0)
-                {
-                    /** Verifies bytes stop mode    */
-                    if(sRFDCCard_StartRecConfig.eRecordStopMode == BYTES)
-                    {
-                        /** Stop recording if data matches the total number of bytes */
-                        if((dTotalBytes + u64ZeroFilledBytes) >=
-                                sRFDCCard_StartRecConfig.u32BytesToCapture)
-                        {
-                            writeDataToBuffer_Inline(s8ZeroBuf,
-                                      (UINT32)(sRFDCCard_StartRecConfig.u32BytesToCapture - dTotalBytes),
-                                                         false, true);
-
-                            /** Updating inline processing summary */
-                            UpdateInlineStatus(true, u8DataTypeId);
-
-                            /** Stop the recording */
-                            bThreadState = false;
-                            if(!gbRecStopCmdSent)
-                                RFDCARD_Callback(CMD_CODE_SYSTEM_ASYNC_STATUS,
-                                             STS_REC_COMPLETED);
-                            goto START_LOOP;
-                        }
-
-                        writeDataToBuffer_Inline(s8ZeroBuf, u64ZeroFilledBytes,
-                                                 false, true);
-                        dTotalBytes += (u64ZeroFilledBytes) ;
-                    }
-                    else
-                    {
-                        writeDataToBuffer_Inline(s8ZeroBuf, u64ZeroFilledBytes,
-                                                 false, true);
-                    }
-                }
+    return true;
+}
 
-                /** Verifies bytes stop mode    */
-                if(sRFDCCard_StartRecConfig.eRecordStopMode == BYTES)
-                {
-                    /** Stop recording if data matches the total number of bytes */
-                    if((dTotalBytes + s32CtPktRecvSize - RECORD_DATA_BUF_INDEX) >=
-                            sRFDCCard_StartRecConfig.u32BytesToCapture)
-                    {
-                        writeDataToBuffer_Inline(&s8ReceiveBuf[RECORD_DATA_BUF_INDEX],
-                              (UINT32)(sRFDCCard_StartRecConfig.u32BytesToCapture - dTotalBytes),
-                                         false, false);
+/** @fn void cUdpDataReceiver::closeTriggerLog()
+ * @brief This function is to dump the data of the last trigger <!--
+ * --> received before the record stop and close the trigger log
+ */
+void cUdpDataReceiver::closeTriggerLog()
+{
+    /** No data received, nothing to dump */
+    if((psTriggerRing == NULL) || (pTriggerLogFile == NULL))
+        return;
 
-                        /** Updating inline processing summary */
-                        UpdateInlineStatus(true, u8DataTypeId);
+    dumpTriggerRing();
+    if(psTriggerRing.load()->bDumping)
+        closeTriggerDump();
 
-                        /** Stop the recording */
-                        bThreadState = false;
-                        if(!gbRecStopCmdSent)
-                            RFDCARD_Callback(CMD_CODE_SYSTEM_ASYNC_STATUS,
-                                         STS_REC_COMPLETED);
-                        goto START_LOOP;
-                    }
+    fclose(pTriggerLogFile);
+    pTriggerLogFile = NULL;
+}
 
-                    writeDataToBuffer_Inline(&s8ReceiveBuf[RECORD_DATA_BUF_INDEX],
-                                      (s32CtPktRecvSize - RECORD_DATA_BUF_INDEX),
-                                             false, false);
-                    dTotalBytes += (s32CtPktRecvSize - RECORD_DATA_BUF_INDEX) ;
-                }
-                else
-                {
-                    writeDataToBuffer_Inline(&s8ReceiveBuf[RECORD_DATA_BUF_INDEX],
-                        (s32CtPktRecvSize - RECORD_DATA_BUF_INDEX),
-                                             false, false);
-                }
+/** @fn bool cUdpDataReceiver::createCrcLog()
+ * @brief This function is to create the CRC32C log of the record <!--
+ * --> (inline processing)
+ * @return boolean value
+ */
+bool cUdpDataReceiver::createCrcLog()
+{
+    SINT8 s8LogFileName[MAX_NAME_LEN * 3];
 
-                /** Logging out of seq metadata         */
-                sRFDCCard_InlineStats.u32OutOfSeqPktFromOffset[u8DataTypeId] =
-                    u32NextPktNum - 1;
-                sRFDCCard_InlineStats.u32OutOfSeqPktToOffset[u8DataTypeId] =
-                    u32CtPktNum;
-#ifdef LOG_OUT_OF_SEQ_OFFSET
-                WriteOffsetMetaData(u64BytesSentTillPrevPkt, s32PrevPktRecvSize - RECORD_DATA_BUF_INDEX,
-                                        u64BytesSentTillCtPkt, s32CtPktRecvSize - RECORD_DATA_BUF_INDEX);
-#endif
-                /** Stores the offset for verifying next packet */
-                u32NextPktNum = (u32CtPktNum + 1);
-                u64BytesSentTillPrevPkt = u64BytesSentTillCtPkt;
-                s32PrevPktRecvSize = s32CtPktRecvSize;
+    strcpy(s8LogFileName, strRecordFilePath);
+    strcat(s8LogFileName, CRC_LOG_FILE_NAME);
 
-                /** Updating inline processing summary */
-                UpdateInlineStatus(true, u8DataTypeId);
-            } // verify sequence and write
-			
-        } // If packet has some data
+    pCrcLogFile = fopen(s8LogFileName, "w");
+    if(NULL == pCrcLogFile)
+    {
+        RFDCARD_Callback(CMD_CODE_SYSTEM_ASYNC_STATUS,
+                         STS_REC_FILE_CREATION_ERR);
+        return false;
+    }
+
+    /** Tags are of the data stream of the record files, or of the
+     *  striped record read back by its manifest                    */
+    fprintf(pCrcLogFile, "%s\n", CRC_LOG_TITLE);
+    if(u8NumOfStripeWriters > 0)
+        fprintf(pCrcLogFile, "Stripe manifest,%s%s\n", strRecordFilePath,
+                STRIPE_MANIFEST_FILE_NAME);
+    else
+        fprintf(pCrcLogFile, "Record files,%s\n", strRecordFilePath);
+    fprintf(pCrcLogFile, "Chunk size (bytes),%u\n", u32CrcChunkSize);
+    fprintf(pCrcLogFile, "Chunk,Offset (bytes),Size (bytes),CRC32C\n");
+    fflush(pCrcLogFile);
+
+    return true;
+}
 
+/** @fn void cUdpDataReceiver::updateRecordCrc_Inline(const SINT8 *s8Buffer, UINT32 u32Size, UINT32 u32HoleIndex, ULONG64 u64HoleBytes)
+ * @brief This function is to add record data to the CRC32C chunks, <!--
+ * --> the hole of the dropped frames counts as zero bytes <!--
+ * --> (inline processing)
+ * @param [in] s8Buffer [const SINT8 *] - Record data
+ * @param [in] u32Size  [UINT32] - Size of record data
+ * @param [in] u32HoleIndex [UINT32] - Buffer index of the dropped frames
+ * @param [in] u64HoleBytes [ULONG64] - Dropped bytes
+ */
+void cUdpDataReceiver::updateRecordCrc_Inline(const SINT8 *s8Buffer,
+                                UINT32 u32Size, UINT32 u32HoleIndex,
+                                ULONG64 u64HoleBytes)
+{
+    if(u64HoleBytes == 0)
+    {
+        crcRecordBytes_Inline(s8Buffer, u32Size);
+        return;
     }
+
+    crcRecordBytes_Inline(s8Buffer, u32HoleIndex);
+    crcRecordBytes_Inline(NULL, u64HoleBytes);
+    crcRecordBytes_Inline(&s8Buffer[u32HoleIndex], u32Size - u32HoleIndex);
 }
 
-/** @fn void cUdpDataReceiver::writeDataToBuffer_Inline(SINT8 *s8Buffer, UINT32 u32Size, bool bOldPkt, bool bZeroFilledPkt)
- * @brief This function is to handle recording  data in buffer (inline processing)
- * @param [in] s8Buffer [SINT8 *] - Buffer to write in buffer
- * @param [in] u32Size  [UINT32] - Size of buffer
- * @param [in] bOldPkt  [bool] - Old packet flag
- * @param [in] bZeroFilledPkt  [bool] - Zero filled packet flag
+/** @fn void cUdpDataReceiver::crcRecordBytes_Inline(const SINT8 *s8Buffer, ULONG64 u64Size)
+ * @brief This function is to add bytes to the CRC32C chunks, a full <!--
+ * --> chunk is added to the CRC32C log. A NULL buffer adds zero <!--
+ * --> bytes (inline processing)
+ * @param [in] s8Buffer [const SINT8 *] - Bytes or NULL
+ * @param [in] u64Size [ULONG64] - Number of bytes
  */
-void cUdpDataReceiver::writeDataToBuffer_Inline(SINT8 *s8Buffer, UINT32 u32Size,
-                                                bool bOldPkt, bool bZeroFilledPkt)
+void cUdpDataReceiver::crcRecordBytes_Inline(const SINT8 *s8Buffer,
+                                             ULONG64 u64Size)
 {
-    if((u32ReadPtrBufIndex + u32Size) > INLINE_BUF_SIZE)
-    {        
-        if(bWaitForSignal)
+    UINT32 u32Chunk = 0;
+
+    while(u64Size > 0)
+    {
+        u32Chunk = u32CrcChunkSize - u32CrcChunkBytes;
+        if(u32Chunk > u64Size)
+            u32Chunk = (UINT32)u64Size;
+
+        if(s8Buffer != NULL)
         {
-            /** Wait for write completion signal */
-            osalObj_api.WaitForSignal(&sgnFileWriteCompletionWaitEvent, NON_STOP);
+            u32CrcChunkCrc = Crc32cUpdate(u32CrcChunkCrc, s8Buffer, u32Chunk);
+            s8Buffer += u32Chunk;
         }
         else
         {
-            bWaitForSignal = true;
+            u32CrcChunkCrc = Crc32cUpdateZeros(u32CrcChunkCrc, u32Chunk);
         }
+        u32CrcChunkBytes += u32Chunk;
+        u64Size -= u32Chunk;
 
-        /** Swapping buffers to continue read and parallel writing   */
-        bBuf1Empty = !bBuf1Empty;
+        if(u32CrcChunkBytes == u32CrcChunkSize)
+        {
+            fprintf(pCrcLogFile, "%u,%llu,%u,%08X\n", u32NumOfCrcChunks,
+                    (ULONG64)u32NumOfCrcChunks * u32CrcChunkSize,
+                    u32CrcChunkBytes, u32CrcChunkCrc);
+            fflush(pCrcLogFile);
+            u32NumOfCrcChunks ++;
+            u32CrcChunkBytes = 0;
+            u32CrcChunkCrc = 0;
+        }
+    }
+}
 
-        u32WritePtrSize = u32ReadPtrSize;
-        u32ReadPtrSize = 0;
-        u32ReadPtrBufIndex = 0;
+/** @fn void cUdpDataReceiver::closeCrcLog()
+ * @brief This function is to add the last chunk to the CRC32C log <!--
+ * --> and close it
+ */
+void cUdpDataReceiver::closeCrcLog()
+{
+    if(pCrcLogFile == NULL)
+        return;
 
-        /** Signal to write thread to start writing */
-        osalObj_api.SignalEvent(&sgnFileWriteInitWaitEvent);
+    if(u32CrcChunkBytes > 0)
+    {
+        fprintf(pCrcLogFile, "%u,%llu,%u,%08X\n", u32NumOfCrcChunks,
+                (ULONG64)u32NumOfCrcChunks * u32CrcChunkSize,
+                u32CrcChunkBytes, u32CrcChunkCrc);
+        u32NumOfCrcChunks ++;
     }
 
-    /** Store the current packet in buffer  */
-    if(bBuf1Empty)
-        memcpy(&s8RecBuf1[u32ReadPtrBufIndex], s8Buffer, u32Size);
-    else
-        memcpy(&s8RecBuf2[u32ReadPtrBufIndex], s8Buffer, u32Size);
-    u32ReadPtrBufIndex += u32Size;
-    if(!bOldPkt)
-        u32ReadPtrSize += u32Size;
+    fclose(pCrcLogFile);
+    pCrcLogFile = NULL;
+}
 
-#ifdef LOG_DROPPED_PKTS_OFFSET
-    /** Store the missed packet stats in log buffer */
-    if(bBuf1Empty)
+/** @fn bool cUdpDataReceiver::writeStripe_Inline(SINT8 **pps8Buffer, UINT32 u32Size, UINT32 u32HoleIndex, ULONG64 u64HoleBytes)
+ * @brief This function is to hand a record buffer over <!--
+ * --> to the next idle stripe writer, the stripe is added to the <!--
+ * --> manifest (inline processing)
+ * @param [in, out] pps8Buffer [SINT8 **] - Buffer to write in file, <!--
+ * --> exchanged with the empty stripe buffer
+ * @param [in] u32Size  [UINT32] - Size of buffer
+ * @param [in] u32HoleIndex [UINT32] - Buffer index of the dropped frames
+ * @param [in] u64HoleBytes [ULONG64] - Dropped bytes
+ * @return boolean value
+ */
+bool cUdpDataReceiver::writeStripe_Inline(SINT8 **pps8Buffer, UINT32 u32Size,
+                                    UINT32 u32HoleIndex, ULONG64 u64HoleBytes)
+{
+    cStripeWriter *pWriter = NULL;
+    UINT8 u8Path = 0;
+    UINT8 i = 0;
+
+    /** File creation failed, error is already reported */
+    if(NULL == pStripeManifestFile)
+        return false;
+
+    /** The next idle path in turn takes the stripe, hence a slower disk
+     *  gets fewer stripes instead of holding the others up            */
+    for(i = 0; i < u8NumOfStripeWriters; i ++)
     {
-        if(bZeroFilledPkt)
+        u8Path = (u8NextStripePath + i) % u8NumOfStripeWriters;
+        if(psStripeWriter[u8Path]->getFileStatus() &&
+           psStripeWriter[u8Path]->isIdle())
         {
-            strLogBuf1->bIsZeroFilledPktPresent = true;
-            strLogBuf1->bValidPacket[strLogBuf1->u32LogSize] = false;
-            strLogBuf1->u32LogSize ++;
-        }
-        else
-        {
-            if(!bOldPkt)
-            {
-                strLogBuf1->bValidPacket[strLogBuf1->u32LogSize] = true;
-                strLogBuf1->u32CtPktSize[strLogBuf1->u32LogSize] =
-                        s32CtPktRecvSize - RECORD_DATA_BUF_INDEX;
-                strLogBuf1->u64CtPktOffset[strLogBuf1->u32LogSize] =
-                        u64BytesSentTillCtPkt;
-                strLogBuf1->u32LogSize ++;
-            }
-            else
-            {
-                strLogBuf1->bValidPacket[strLogBuf1->u32LogSize -
-                        u32LogBufOldIndex] = true;
-                strLogBuf1->u32CtPktSize[strLogBuf1->u32LogSize -
-                        u32LogBufOldIndex] =
-                        s32CtPktRecvSize - RECORD_DATA_BUF_INDEX;
-                strLogBuf1->u64CtPktOffset[strLogBuf1->u32LogSize -
-                        u32LogBufOldIndex] = u64BytesSentTillCtPkt;
-            }
+            pWriter = psStripeWriter[u8Path];
+            break;
         }
     }
-    else
+
+    /** All the paths are busy, wait for the one in turn */
+    for(i = 0; (pWriter == NULL) && (i < u8NumOfStripeWriters); i ++)
     {
-        if(bZeroFilledPkt)
-        {
-            strLogBuf2->bIsZeroFilledPktPresent = true;
-            strLogBuf2->bValidPacket[strLogBuf2->u32LogSize] = false;
-            strLogBuf2->u32LogSize ++;
-        }
-        else
+        u8Path = (u8NextStripePath + i) % u8NumOfStripeWriters;
+        if(psStripeWriter[u8Path]->getFileStatus())
         {
-            if(!bOldPkt)
-            {
-                strLogBuf2->bValidPacket[strLogBuf2->u32LogSize] = true;
-                strLogBuf2->u32CtPktSize[strLogBuf2->u32LogSize] =
-                        s32CtPktRecvSize - RECORD_DATA_BUF_INDEX;
-                strLogBuf2->u64CtPktOffset[strLogBuf2->u32LogSize] =
-                        u64BytesSentTillCtPkt;
-                strLogBuf2->u32LogSize ++;
-            }
-            else
-            {
-                strLogBuf2->bValidPacket[strLogBuf2->u32LogSize -
-                        u32LogBufOldIndex] = true;
-                strLogBuf2->u32CtPktSize[strLogBuf2->u32LogSize -
-                        u32LogBufOldIndex] =
-                        s32CtPktRecvSize - RECORD_DATA_BUF_INDEX;
-                strLogBuf2->u64CtPktOffset[strLogBuf2->u32LogSize -
-                        u32LogBufOldIndex] = u64BytesSentTillCtPkt;
-            }
+            psStripeWriter[u8Path]->waitForIdle();
+            if(psStripeWriter[u8Path]->getFileStatus())
+                pWriter = psStripeWriter[u8Path];
         }
     }
-#endif
 
+    if(pWriter == NULL)
+        return false;
+
+    pWriter->writeStripe(pps8Buffer, u32Size, u32HoleIndex, u64HoleBytes);
+
+    fprintf(pStripeManifestFile, "%u,%u,%llu,%llu\n", u32NumOfStripes, u8Path,
+            u64StripeOffset, u32Size + u64HoleBytes);
+    fflush(pStripeManifestFile);
+
+    u32NumOfStripes ++;
+    u64StripeOffset += u32Size + u64HoleBytes;
+    u8NextStripePath = (u8Path + 1) % u8NumOfStripeWriters;
+
+    return true;
 }
 
-/** @fn void cUdpDataReceiver::Thread_WriteDataToFile()
- * @brief This thread function is to handle recording  data in files (inline processing)
+/** @fn bool cUdpDataReceiver::setStripeFileNames(const SINT8 *s8FileName)
+ * @brief This function is to create the first record file of each <!--
+ * --> stripe path and the stripe manifest (inline processing)
+ * @param [in] s8FileName [const SINT8 *] - File name without the <!--
+ * --> base path and the file count
+ * @return boolean value
  */
-void cUdpDataReceiver::Thread_WriteDataToFile()
+bool cUdpDataReceiver::setStripeFileNames(const SINT8 *s8FileName)
 {
-    while(bSocketState)
+    SINT8 s8FilePath[MAX_NAME_LEN * 2];
+
+    for(UINT8 i = 0; i < u8NumOfStripeWriters; i ++)
     {
-        /** Wait for ready to write signal      */
-        osalObj_api.WaitForSignal(&sgnFileWriteInitWaitEvent, NON_STOP);
+        strcpy(s8FilePath, sRFDCCard_StartRecConfig.s8StripeBasePath[i]);
+#ifdef _WIN32
+        strcat(s8FilePath, "\\");
+#else
+        strcat(s8FilePath, "/");
+#endif
+        strcat(s8FilePath, s8FileName);
 
-        if(bBuf1Empty)
-        {
-            writeDataToFile_Inline(s8RecBuf2, u32WritePtrSize);
-        }
-        else
-        {
-            writeDataToFile_Inline(s8RecBuf1, u32WritePtrSize);
-        }
+        /** Error is reported by the stripe writer */
+        if(!psStripeWriter[i]->setFileName(s8FilePath))
+            return false;
+    }
 
-        /** Signal ready for next file write */
-        osalObj_api.SignalEvent(&sgnFileWriteCompletionWaitEvent);
+    strcpy(strFileName1, strRecordFilePath);
+    strcat(strFileName1, STRIPE_MANIFEST_FILE_NAME);
+
+    pStripeManifestFile = fopen(strFileName1, "w");
+    if (NULL == pStripeManifestFile)
+    {
+        RFDCARD_Callback(CMD_CODE_SYSTEM_ASYNC_STATUS,
+                         STS_REC_FILE_CREATION_ERR);
+        return false;
+    }
+
+    /** Stripes of a path follow each other in its record files, which
+     *  are named as the record files of a single path               */
+    fprintf(pStripeManifestFile, "%s\nFile name,%s\nStripe paths,%u\n",
+            STRIPE_MANIFEST_TITLE, s8FileName, u8NumOfStripeWriters);
+    for(UINT8 i = 0; i < u8NumOfStripeWriters; i ++)
+    {
+        fprintf(pStripeManifestFile, "Path %u,%s\n", i,
+                sRFDCCard_StartRecConfig.s8StripeBasePath[i]);
     }
+    fprintf(pStripeManifestFile, "Stripe,Path,Offset (bytes),Size (bytes)\n");
+    fflush(pStripeManifestFile);
+
+    return true;
 }
 
-/** @fn bool cUdpDataReceiver::writeDataToFile_Inline(SINT8 *s8Buffer, UINT32 u32Size)
- * @brief This function is to handle recording  data in files along with  <!--
- * --> reordering of data (inline processing)
+/** @fn bool cUdpDataReceiver::writeBufferToFile_Inline(SINT8 *s8Buffer, UINT32 u32Size, UINT32 u32HoleIndex, ULONG64 u64HoleBytes)
+ * @brief This function is to write a record buffer in files, <!--
+ * --> leaving a hole in the file for its dropped frames (inline processing)
  * @param [in] s8Buffer [SINT8 *] - Buffer to write in file
  * @param [in] u32Size  [UINT32] - Size of buffer
+ * @param [in] u32HoleIndex [UINT32] - Buffer index of the dropped frames
+ * @param [in] u64HoleBytes [ULONG64] - Dropped bytes
  * @return boolean value
  */
-bool cUdpDataReceiver::writeDataToFile_Inline(SINT8 *s8Buffer, UINT32 u32Size)
+bool cUdpDataReceiver::writeBufferToFile_Inline(SINT8 *s8Buffer, UINT32 u32Size,
+                                    UINT32 u32HoleIndex, ULONG64 u64HoleBytes)
 {
-    /** Reordering data bytes */
-    if(sRFDCCard_StartRecConfig.bReorderEnable)
+    UINT32 u32HoleChunk = 0;
+
+    /** File creation failed, error is already reported */
+    if(NULL == pRecordDataFile)
+        return false;
+
+    if(u64HoleBytes == 0)
+        return writeBytesToFile_Inline(s8Buffer, u32Size);
+
+    if(!writeBytesToFile_Inline(s8Buffer, u32HoleIndex))
+        return false;
+
+    /** Dropped frames are seeked over, which keeps the file offsets of
+     *  the data after them                                           */
+    while(u64HoleBytes > 0)
     {
-        if(!ReorderAlgorithm(s8Buffer, u32Size))
+        u32HoleChunk = (u64HoleBytes > u32InlineBufSize) ? u32InlineBufSize :
+                                                    (UINT32)u64HoleBytes;
+        if(!writeBytesToFile_Inline(NULL, u32HoleChunk))
             return false;
+        u64HoleBytes -= u32HoleChunk;
     }
 
+    return writeBytesToFile_Inline(&s8Buffer[u32HoleIndex],
+                                   u32Size - u32HoleIndex);
+}
+
+/** @fn bool cUdpDataReceiver::writeBytesToFile_Inline(SINT8 *s8Buffer, UINT32 u32Size)
+ * @brief This function is to write bytes in files of the maximum file <!--
+ * --> size, or of whole frames by count or duration. A NULL buffer <!--
+ * --> seeks over the bytes, which leaves a hole (inline processing)
+ * @param [in] s8Buffer [SINT8 *] - Buffer to write in file or NULL
+ * @param [in] u32Size  [UINT32] - Size of buffer
+ * @return boolean value
+ */
+bool cUdpDataReceiver::writeBytesToFile_Inline(SINT8 *s8Buffer, UINT32 u32Size)
+{
+    UINT32 u32Chunk = 0;
+
 	/** Data file writing */
 	u32ByteIndex = 0;
     
-    do
+    while(u32Size > 0)
     {
         /** Verifies for maximum file size */
-        if((u32DataCount + u32Size) <= u32MaxFileSizeToCapture)
+        if(u64RolloverFrameSize > 0)
+        {
+            u32Chunk = getFrameFileChunk(u32Size);
+        }
+        else if((u32DataCount + u32Size) <= u32MaxFileSizeToCapture)
         {
-            fwrite((const SINT8 *)&s8Buffer[u32ByteIndex], 1,
-                                        u32Size, pRecordDataFile);
-            u32DataCount += u32Size;
-            u32Size = 0;
+            u32Chunk = u32Size;
         }
         else
         {
@@ -1025,42 +3392,100 @@ bool cUdpDataReceiver::writeDataToFile_Inline(SINT8 *s8Buffer, UINT32 u32Size)
              */
             u32Loop = floor(((u32MaxFileSizeToCapture - u32DataCount) /
                                 PAYLOAD_BYTES_PER_PACKET));
-            if(u32Loop != 0)
+            u32Chunk = u32Loop * PAYLOAD_BYTES_PER_PACKET;
+        }
+
+        if(u32Chunk > 0)
+        {
+            if(s8Buffer != NULL)
             {
-                u32DataCount = u32Loop * PAYLOAD_BYTES_PER_PACKET;
-                fwrite((const SINT8 *)&s8Buffer[u32ByteIndex], 1, u32DataCount,
+                fwrite((const SINT8 *)&s8Buffer[u32ByteIndex], 1, u32Chunk,
                                         pRecordDataFile);
-                u32Size -= u32DataCount;
-                u32ByteIndex += u32DataCount;
+                bFileHolePending = false;
             }
+            else if(pRetentionRing != NULL)
+            {
+                /** Stale data of a recycled file is written over */
+                bFileHolePending = pRetentionRing->writeHole(pRecordDataFile,
+                                                             u32Chunk);
+            }
+            else
+            {
+                fseek(pRecordDataFile, u32Chunk, SEEK_CUR);
+                bFileHolePending = true;
+            }
+            u32DataCount += u32Chunk;
+            u32Size -= u32Chunk;
+            u32ByteIndex += u32Chunk;
+        }
 
+        if(u32Size > 0)
+        {
             /** Closes and open another file if maximum file size exceeds */
-            fclose(pRecordDataFile);
+            closeRecordFile();
             u32DataFileCount ++;
-
-            strcpy(strFileName1, strRecordFilePath);
-            strcat(strFileName1, std::to_string(u32DataFileCount).c_str());
-            strcat(strFileName1, REC_DATA_FILE_EXTENSION);
-
-            pRecordDataFile = fopen (strFileName1, "wb+");
-            if (NULL == pRecordDataFile)
-            {
-                RFDCARD_Callback(CMD_CODE_SYSTEM_ASYNC_STATUS,
-                                 STS_REC_FILE_CREATION_ERR);
+            if(!openRecordFile())
                 return false;
-            }
             u32DataCount = 0;
         }
-    }while(u32Size > 0);
+    }
 
-#ifdef LOG_DROPPED_PKTS_OFFSET
+    return true;
+}
 
-	/** Logfile writing */
-    writeLogToFile_Inline();
-	
-#endif
+/** @fn UINT32 cUdpDataReceiver::getFrameFileChunk(UINT32 u32Size)
+ * @brief This function is to get the bytes written in the record file <!--
+ * --> before it ends at a frame boundary. The file holds the frames per <!--
+ * --> file, or ends at the first frame after the file duration of data <!--
+ * --> time, taken from the handover times of the record buffers <!--
+ * --> (inline processing)
+ * @param [in] u32Size  [UINT32] - Bytes to write
+ * @return UINT32 value - Bytes in the file, 0 if it is full
+ */
+UINT32 cUdpDataReceiver::getFrameFileChunk(UINT32 u32Size)
+{
+    UINT32 u32Room = u32FileSizeLimit - u32DataCount;
+    ULONG64 u64Offset = u64RecordFileOffset + u32DataCount;
+    ULONG64 u64BufTimeUs = u64RecordBufEndUs - u64RecordBufStartUs;
+    ULONG64 u64EndUs = 0;
+    ULONG64 u64EndOffset = 0;
+    ULONG64 u64FileEnd = 0;
+
+    if(u64FileDurationUs == 0)
+        return (u32Size < u32Room) ? u32Size : u32Room;
+
+    /** Data time of the record data at the offset, spread evenly over the
+     *  time the record buffer is received                              */
+    if(u32DataCount == 0)
+    {
+        u64FileOpenTimeUs = u64RecordBufStartUs;
+        if((u64RecordBufBytes > 0) && (u64Offset > u64RecordBufOffset))
+            u64FileOpenTimeUs += (u64Offset - u64RecordBufOffset) *
+                                 u64BufTimeUs / u64RecordBufBytes;
+    }
 
-    return true;
+    /** Record data offset the file duration ends at */
+    u64EndUs = u64FileOpenTimeUs + u64FileDurationUs;
+    if(u64EndUs >= u64RecordBufEndUs)
+        return (u32Size < u32Room) ? u32Size : u32Room;
+
+    u64EndOffset = u64RecordBufOffset;
+    if(u64EndUs > u64RecordBufStartUs)
+        u64EndOffset += (u64EndUs - u64RecordBufStartUs) *
+                        u64RecordBufBytes / u64BufTimeUs;
+    if(u64EndOffset < u64Offset)
+        u64EndOffset = u64Offset;
+
+    /** The file ends at the frame boundary after it */
+    u64FileEnd = u64EndOffset - u64RecordFileOffset;
+    u64FileEnd = ((u64FileEnd + u64RolloverFrameSize - 1) /
+                  u64RolloverFrameSize) * u64RolloverFrameSize;
+    if(u64FileEnd == 0)
+        u64FileEnd = u64RolloverFrameSize;
+    if((u64FileEnd - u32DataCount) < u32Room)
+        u32Room = (UINT32)(u64FileEnd - u32DataCount);
+
+    return (u32Size < u32Room) ? u32Size : u32Room;
 }
 
 /** @fn  bool ReorderAlgorithm(SINT8 *s8Buffer, UINT32 u32SizeReorder)
@@ -1118,7 +3543,8 @@ bool cUdpDataReceiver::ReorderAlgorithm(SINT8 *s8Buffer, UINT32 u32SizeReorder)
  */
 SINT32 cUdpDataReceiver::seekOldIndexReadBuf(SINT32 bytes)
 {
-    if(((SINT32)u32ReadPtrBufIndex - bytes) < 0)
+    /** Data before the drop floor is not contiguous with the current one */
+    if(((SINT32)u32ReadPtrBufIndex - bytes) < (SINT32)u32DropFloorIndex)
         return -1;
     else
         u32ReadPtrBufIndex = u32ReadPtrBufIndex - bytes;
@@ -1308,8 +3734,8 @@ void cUdpDataReceiver::WriteOffsetMetaData(ULONG64 u64PrevPktOffset, UINT32 u32P
     if(pInlineLogFile != NULL)
     {
 		/** Dropped packets offset and bytes        */
-		if(sRFDCCard_InlineStats.u32OutOfSeqPktFromOffset[u8DataTypeId] <
-				sRFDCCard_InlineStats.u32OutOfSeqPktToOffset[u8DataTypeId])
+		if(sRFDCCard_InlineStats.u32OutOfSeqPktFromOffset[u8StatsId] <
+				sRFDCCard_InlineStats.u32OutOfSeqPktToOffset[u8StatsId])
 		{
 			if(u8DataTypeId == RAW_DATA_INDEX)
 				sprintf(s8LogMsg, "\n,%llu,%llu,,,",
@@ -1361,4 +3787,23 @@ void cUdpDataReceiver::WriteOffsetMetaData(ULONG64 u64PrevPktOffset, UINT32 u32P
     }
 }
 
+#ifdef LATENCY_HISTOGRAMS
+/** @fn void cUdpDataReceiver::recordFrameHandoff(ULONG64 u64HandoffTimeUs)
+ * @brief This function is to update the frame to handoff latency of <!--
+ * --> the frames completed in the read buffer when it is handed to <!--
+ * --> the file writer (inline processing)
+ * @param [in] u64HandoffTimeUs [ULONG64] - Handoff time in micro seconds
+ */
+void cUdpDataReceiver::recordFrameHandoff(ULONG64 u64HandoffTimeUs)
+{
+    for(size_t i = 0; i < vFrameDoneTimeUs.size(); i ++)
+    {
+        LatencyHistRecord(&sRFDCCard_LatencyStats.sHist[u8StatsId]
+                                               [LATENCY_FRAME_TO_HANDOFF],
+                          u64HandoffTimeUs - vFrameDoneTimeUs[i]);
+    }
+    vFrameDoneTimeUs.clear();
+}
+#endif
+
 #endif
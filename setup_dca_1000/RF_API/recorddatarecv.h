@@ -68,7 +68,118 @@
 
 #include "defines.h"
 #include "extern.h"
+#include "stripewriter.h"
+#include "mmapwriter.h"
+#include "retentionring.h"
+#include "recordwatermark.h"
+#include "crc32c.h"
+#include "patternverifier.h"
 
+#ifndef POST_PROCESSING
+/** The buffer indexes are shared by the data port thread and the file
+ *  writer thread, hence keep them aligned for the atomic access          */
+#pragma pack(push, 8)
+
+/** Record buffers spilled to RAM while the file writer is busy (inline
+ *  processing). Buffers are exchanged with the record buffer, not copied  */
+typedef struct
+{
+    /** Spill buffers, each of the record buffer size       */
+    SINT8 *ps8Buf[MAX_WRITER_SPILL_BUFS];
+
+    /** Bytes filled in each spill buffer                   */
+    UINT32 u32Size[MAX_WRITER_SPILL_BUFS];
+
+    /** Buffer index of the dropped frames in each buffer   */
+    UINT32 u32HoleIndex[MAX_WRITER_SPILL_BUFS];
+
+    /** Dropped bytes in each buffer                        */
+    ULONG64 u64HoleBytes[MAX_WRITER_SPILL_BUFS];
+
+    /** Time each buffer is spilled in micro seconds         */
+    ULONG64 u64TimeUs[MAX_WRITER_SPILL_BUFS];
+
+    /** Number of spill buffers                             */
+    UINT32 u32NumOfBufs;
+
+    /** Count of buffers written by the file writer         */
+    std::atomic<UINT32> u32Head;
+
+    /** Count of buffers spilled by the data port thread    */
+    std::atomic<UINT32> u32Tail;
+
+    /** Count of buffers spilled before the last buffer swap */
+    UINT32 u32HandoffTail;
+} strWriterSpill;
+
+/** Pre-trigger RAM ring of the event trigger mode (inline processing). The
+ *  file writer copies the record buffers in the ring instead of the file,
+ *  a trigger dumps the ring data around it in the file. Data is located by
+ *  its offset in the data stream, holes of dropped frames included       */
+typedef struct
+{
+    /** Ring buffer                                         */
+    SINT8 *ps8Buf;
+
+    /** Ring buffer size                                    */
+    ULONG64 u64Size;
+
+    /** Record buffer the dumped data is handed over in     */
+    SINT8 *ps8DumpBuf;
+
+    /** Data stream offset of the end of the ring data      */
+    ULONG64 u64Tail;
+
+    /** Data before this data stream offset is not dumped   */
+    ULONG64 u64DumpedTill;
+
+    /** Data stream offset of the dump start                */
+    ULONG64 u64DumpStart;
+
+    /** Data stream offset of the dump end, ULLONG_MAX till the data
+     *  after the post-trigger duration is received        */
+    ULONG64 u64DumpEnd;
+
+    /** Dump end time (micro seconds)                       */
+    ULONG64 u64DumpEndTimeUs;
+
+    /** Receive time of the dump start (micro seconds)      */
+    ULONG64 u64DumpStartTimeUs;
+
+    /** Trigger time of the dump (micro seconds)            */
+    ULONG64 u64DumpTriggerTimeUs;
+
+    /** Record file offset of the dump start                */
+    ULONG64 u64DumpFileOffset;
+
+    /** Dump is in progress                                 */
+    bool bDumping;
+
+    /** Dumps written in the trigger log                    */
+    UINT32 u32NumOfDumps;
+
+    /** Data stream offsets of the time marks, frame starts in Multi mode */
+    ULONG64 u64MarkOffset[MAX_TRIGGER_RING_MARKS];
+
+    /** Receive time of the time marks (micro seconds)      */
+    ULONG64 u64MarkTimeUs[MAX_TRIGGER_RING_MARKS];
+
+    /** Count of time marks added by the data port thread   */
+    std::atomic<UINT32> u32MarkTail;
+
+    /** First trigger time not handled by the file writer, 0 if none */
+    std::atomic<ULONG64> u64PendingTriggerUs;
+
+    /** Last trigger time (micro seconds)                   */
+    std::atomic<ULONG64> u64LastTriggerUs;
+} strTriggerRing;
+
+#pragma pack(pop)
+#endif
+
+/** OSAL events are declared under pack(1), the futex of an event and the
+ *  atomic flags shared with the file writer thread need their alignment */
+#pragma pack(push, 8)
 
 /** @class cUdpDataReceiver
  * @brief This class provides support APIs for reading different data UDP <!--
@@ -81,6 +192,13 @@ class cUdpDataReceiver
 	/** Data type index										*/
     UINT8 u8DataTypeId;
 
+    /** System index of a shared data port, 0 - connected system          */
+    UINT8 u8SystemId;
+
+    /** Record statistics index - the system index of a shared data port,
+     *  else the data type index                                          */
+    UINT8 u8StatsId;
+
     /** Record data file pointer                            */
     FILE *pRecordDataFile;
 
@@ -108,13 +226,25 @@ class cUdpDataReceiver
 	/** File writing - Loop index	*/
     UINT32 u32ByteIndex;
 
+    /** Header ID of the first packet                       */
+    SINT8 s8HeaderBuf[NUM_OF_BYTES_DATA_HEADER];
+
+    /** Expected next packet sequence number                */
+    UINT32 u32NextPktNum;
+
+    /** Bytes stop mode - Total bytes recorded              */
+    DOUBLE dTotalBytes;
+
+    /** Frames stop mode - Total frames recorded            */
+    DOUBLE dTotalFrames;
+
     #ifndef POST_PROCESSING
 
     /** File write completion wait event                    */
-    OSAL_SIGNAL_HANDLE_TYPE sgnFileWriteCompletionWaitEvent;
+    alignas(8) OSAL_SIGNAL_HANDLE_TYPE sgnFileWriteCompletionWaitEvent;
 
     /** File write init wait event                          */
-    OSAL_SIGNAL_HANDLE_TYPE sgnFileWriteInitWaitEvent;
+    alignas(8) OSAL_SIGNAL_HANDLE_TYPE sgnFileWriteInitWaitEvent;
 
     /** Buffer 1 empty flag                                 */
     bool bBuf1Empty;
@@ -122,12 +252,150 @@ class cUdpDataReceiver
     /** Skip flag for the signal wait for first buffer swap */
     bool bWaitForSignal;
 
+    /** File writer is busy with the swapped buffer         */
+    std::atomic<bool> bWriteInProgress;
+
+    /** File writer thread is running for this record       */
+    std::atomic<bool> bWriterActive;
+
+    /** Full buffers are written by the receiving thread    */
+    bool bSyncFileWrite;
+
+    /** Record buffer size                                  */
+    UINT32 u32InlineBufSize;
+
     /** Record buffer 1 for inline processing               */
     SINT8 *s8RecBuf1;
 
     /** Record buffer 2 for inline processing               */
     SINT8 *s8RecBuf2;
 
+    /** Spill buffers, NULL if no spill capacity configured */
+    strWriterSpill *psSpill;
+
+    /** Read buffer - Buffer index of the dropped frames    */
+    UINT32 u32ReadHoleIndex;
+
+    /** Read buffer - Dropped bytes                         */
+    ULONG64 u64ReadHoleBytes;
+
+    /** Stripe writers, one per base path the record buffers are
+     *  striped across                                      */
+    cStripeWriter *psStripeWriter[MAX_STRIPE_PATHS];
+
+    /** Number of stripe writers, 0 to write in the record file */
+    UINT8 u8NumOfStripeWriters;
+
+    /** Stripe path in turn for the next stripe             */
+    UINT8 u8NextStripePath;
+
+    /** Number of stripes handed over                       */
+    UINT32 u32NumOfStripes;
+
+    /** Data stream offset of the next stripe               */
+    ULONG64 u64StripeOffset;
+
+    /** Stripe manifest file pointer                        */
+    FILE *pStripeManifestFile;
+
+    /** Pre-trigger ring, NULL if not in event trigger mode */
+    std::atomic<strTriggerRing *> psTriggerRing;
+
+    /** Triggers using the pre-trigger ring, it is freed once none is */
+    std::atomic<UINT32> u32TriggerRingUsers;
+
+    /** Trigger log file pointer                            */
+    FILE *pTriggerLogFile;
+
+    /** Read buffer - Data stream offset of the buffer      */
+    ULONG64 u64ReadBufOffset;
+
+    /** Receive time of the last time mark (micro seconds)  */
+    ULONG64 u64LastMarkTimeUs;
+
+    /** Data stream offset of the next record buffer written */
+    ULONG64 u64WriteBufOffset;
+
+    /** Bytes written in the record, holes included         */
+    ULONG64 u64RecordBytes;
+
+    /** Capture filter of the ADC data is enabled           */
+    bool bCaptureFilter;
+
+    /** Capture filter - Bytes of an RX channel in a chirp  */
+    UINT32 u32FilterRxSize;
+
+    /** Capture filter - Bytes of a chirp                   */
+    UINT32 u32FilterChirpSize;
+
+    /** Capture filter - Bytes of a frame                   */
+    ULONG64 u64FilterFrameSize;
+
+    /** Capture filter - RX channels kept, bit per RX channel in the data */
+    UINT8 u8FilterRxSlotMask;
+
+    /** CRC32C log file pointer, NULL if the integrity tags are disabled */
+    FILE *pCrcLogFile;
+
+    /** CRC32C - Chunk size in bytes                        */
+    UINT32 u32CrcChunkSize;
+
+    /** CRC32C - Bytes of the chunk in progress             */
+    UINT32 u32CrcChunkBytes;
+
+    /** CRC32C - CRC of the chunk in progress               */
+    UINT32 u32CrcChunkCrc;
+
+    /** CRC32C - Number of chunks logged                    */
+    UINT32 u32NumOfCrcChunks;
+
+    /** Test pattern verifier, NULL if the ADC data is recorded */
+    cPatternVerifier *pPatternVerifier;
+
+    /** Write buffer - Buffer index of the dropped frames   */
+    UINT32 u32WriteHoleIndex;
+
+    /** Write buffer - Dropped bytes                        */
+    ULONG64 u64WriteHoleBytes;
+
+    /** Write buffer - Time it is handed over in micro seconds */
+    ULONG64 u64WriteBufTimeUs;
+
+    /** Read buffer - Data before this index is not dropped */
+    UINT32 u32DropFloorIndex;
+
+    /** Read buffer - Frames started from the drop floor    */
+    UINT32 u32NumOfFrameStarts;
+
+    /** Read buffer - Index of the first frame start        */
+    UINT32 u32FirstFrameIndex;
+
+    /** Read buffer - Index of the last frame start         */
+    UINT32 u32LastFrameIndex;
+
+    /** Drop whole frames once the spill capacity is used   */
+    bool bDropOnOverflow;
+
+    /** Packets till the next frame start are dropped       */
+    bool bDroppingFrame;
+
+    /** Record file ends with a hole of dropped frames      */
+    bool bFileHolePending;
+
+#ifdef LOG_DROPPED_PKTS_OFFSET
+    /** Read log buffer - Entry of the drop floor           */
+    UINT32 u32DropFloorLogIndex;
+
+    /** Read log buffer - Entry of the first frame start    */
+    UINT32 u32FirstFrameLogIndex;
+
+    /** Read log buffer - Entry of the last frame start     */
+    UINT32 u32LastFrameLogIndex;
+
+    /** Read log buffer - Entry marking the dropped frames  */
+    UINT32 u32ReadHoleLogIndex;
+#endif
+
     /** Read data buffer size                               */
     UINT32 u32ReadPtrSize;
 
@@ -164,6 +432,15 @@ class cUdpDataReceiver
     /** Bytes sent till current packet 					   	*/
     ULONG64 u64BytesSentTillCtPkt;
 
+    /** Bytes sent till previous packet                     */
+    ULONG64 u64BytesSentTillPrevPkt;
+
+    /** Previous packet size                                */
+    SINT32  s32PrevPktRecvSize;
+
+    /** Previous packet sequence number                     */
+    UINT32  u32PrevPktNum;
+
     /** Log buffer loop                                     */
     UINT32 u32Loop;
 
@@ -184,16 +461,86 @@ class cUdpDataReceiver
     
     /** Loop index                                     */
     UINT32 u32Loop1;
+
+#ifdef LATENCY_HISTOGRAMS
+    /** Current packet receive time (micro seconds)         */
+    ULONG64 u64CtPktRecvTimeUs;
+
+    /** Read buffer handed to the file writer at (micro seconds) */
+    ULONG64 u64BufHandoffTimeUs;
+
+    /** Receive time of the frames completed in the read buffer  */
+    std::vector<ULONG64> vFrameDoneTimeUs;
+#endif
     
     #endif
 
+    /** Socket drop counter last read from the data socket  */
+    UINT32 u32LastSockDropCount;
+
+    /** Packets dropped by the data socket not yet matched to a sequence
+     *  gap                                                 */
+    UINT32 u32PendingSockDrops;
+
+    /** Pending socket drops used - its own, or those of the data port
+     *  receiver for the other systems of a shared data port  */
+    UINT32 *pu32PendingSockDrops;
+
+#ifndef POST_PROCESSING
+    /** Memory mapped record files, NULL if the record buffers are written */
+    cMmapWriter *pMmapWriter;
+
+    /** Memory mapped files - Data stream offset of the first packet      */
+    ULONG64 u64MmapBaseOffset;
+
+    /** Memory mapped files - Record file offset after the data of the
+     *  packets received in sequence                                      */
+    ULONG64 u64MmapFrontier;
+
+    /** Record files kept within a total size or age, NULL if unbounded */
+    cRetentionRing *pRetentionRing;
+
+    /** Record data offset of the first byte in the record file        */
+    ULONG64 u64RecordFileOffset;
+
+    /** Watermark of the committed record data, NULL if not published */
+    cRecordWatermark *pRecordWatermark;
+
+    /** Recorded bytes of a frame the record files end at, 0 if they end
+     *  at whole packets of the maximum file size                        */
+    ULONG64 u64RolloverFrameSize;
+
+    /** Bytes of a record file ending at whole frames                   */
+    UINT32 u32FileSizeLimit;
+
+    /** Record file holding more data time than this in micro seconds
+     *  ends at the next frame, 0 if the files end by size               */
+    ULONG64 u64FileDurationUs;
+
+    /** Time of the first data of the record file in micro seconds      */
+    ULONG64 u64FileOpenTimeUs;
+
+    /** Record buffer written - Time of the previous and its handover in
+     *  micro seconds, its data is spread evenly in between             */
+    ULONG64 u64RecordBufStartUs;
+    ULONG64 u64RecordBufEndUs;
+
+    /** Record buffer written - Record data offset and bytes            */
+    ULONG64 u64RecordBufOffset;
+    ULONG64 u64RecordBufBytes;
+#endif
+
 public:
-    /** @fn cUdpDataReceiver(UINT8 u8DataTypeArg)
+    /** @fn cUdpDataReceiver(UINT8 u8DataTypeArg, UINT8 u8SystemArg)
      * @brief This constructor function is to initialize the class member <!--
-     * --> variables and assign the corresponding datatype index
+     * --> variables and assign the corresponding datatype index. The low <!--
+     * --> rate data ports (MULTI mode) get a small record buffer which is <!--
+     * --> written by the receiving thread
      * @param [in] u8DataTypeArg [UINT8] - datatype index
+     * @param [in] u8SystemArg [UINT8] - System index of a shared data <!--
+     * --> port, 0 - connected system
      */
-    cUdpDataReceiver(UINT8 u8DataTypeArg);
+    cUdpDataReceiver(UINT8 u8DataTypeArg, UINT8 u8SystemArg);
 	
     /** @fn void setSocketOpen()
      * @brief This function is to reset member variables and set data socket <!--
@@ -223,6 +570,42 @@ public:
      */
     bool getThreadStatus();
 
+    /** @fn bool getSocketStatus()
+     * @brief This function is to get data socket thread running status
+     * @return boolean value
+     */
+    bool getSocketStatus();
+
+    /** @fn void releaseBuffers()
+     * @brief This function is to free the inline processing buffers <!--
+     * --> kept allocated across record processes
+     */
+    void releaseBuffers();
+
+    /** @fn void releaseSpillBuffers()
+     * @brief This function is to free the spill buffers of the file writer
+     */
+    void releaseSpillBuffers();
+
+    /** @fn void releaseStripeWriters()
+     * @brief This function is to stop the stripe writers, free their <!--
+     * --> buffers and close the stripe manifest
+     */
+    void releaseStripeWriters();
+
+    /** @fn void releaseTriggerRing()
+     * @brief This function is to free the pre-trigger ring once no <!--
+     * --> trigger uses it
+     */
+    void releaseTriggerRing();
+
+    /** @fn bool setTrigger()
+     * @brief This function is to latch a trigger of the pre-trigger ring <!--
+     * --> dump, it is safe to call from a signal handler
+     * @return boolean value, false if not recording in event trigger mode
+     */
+    bool setTrigger();
+
     /** @fn void setFileName(SINT8 s8Value1, SINT8 s8Value2)
      * @brief This function is to set data file name for the record progress
      * @param [in] s8Value1 [SINT8] - Header value
@@ -238,6 +621,62 @@ public:
      */
     void readData();
 
+    /** @fn SINT32 recvPacket(SINT32 s32DataSock, SINT8 *s8ReceiveBuf, UINT32 u32BufSize, SINT32 s32Flags, struct sockaddr_in *pSenderAddr, UINT32 *pu32SegSize)
+     * @brief This function is to receive a data packet (or coalesced <!--
+     * --> packets) and to read the drop counter of the socket with it. The <!--
+     * --> packets dropped by the socket since the last packet are pending <!--
+     * --> for the next sequence gaps
+     * @param [in] s32DataSock [SINT32] - Data socket
+     * @param [out] s8ReceiveBuf [SINT8 *] - Received packet
+     * @param [in] u32BufSize [UINT32] - Receive buffer size
+     * @param [in] s32Flags [SINT32] - Receive flags
+     * @param [out] pSenderAddr [struct sockaddr_in *] - Source address
+     * @param [out] pu32SegSize [UINT32 *] - Size of the coalesced packets, <!--
+     * --> 0 if a single packet is received
+     * @return SINT32 value (received size)
+     */
+    SINT32 recvPacket(SINT32 s32DataSock, SINT8 *s8ReceiveBuf,
+                      UINT32 u32BufSize, SINT32 s32Flags,
+                      struct sockaddr_in *pSenderAddr, UINT32 *pu32SegSize);
+
+    /** @fn void shareSockDrops(cUdpDataReceiver *pSockDataRecv)
+     * @brief This function is to match the sequence gaps to the socket <!--
+     * --> drops of another receiver reading the data socket (the other <!--
+     * --> systems of a shared data port)
+     * @param [in] pSockDataRecv [cUdpDataReceiver *] - Receiver reading <!--
+     * --> the data socket
+     */
+    void shareSockDrops(cUdpDataReceiver *pSockDataRecv);
+
+    /** @fn void processPacket(SINT8 *s8ReceiveBuf, SINT32 s32PktRecvSize)
+     * @brief This function is to record a received data packet, to check <!--
+     * --> for packet out of sequence and to handle stop mode configs
+     * @param [in] s8ReceiveBuf [SINT8 *] - Received packet
+     * @param [in] s32PktRecvSize [SINT32] - Received packet size
+     */
+    void processPacket(SINT8 *s8ReceiveBuf, SINT32 s32PktRecvSize);
+
+#ifndef POST_PROCESSING
+    /** @fn void verifyPatternPacket(SINT8 *s8ReceiveBuf, UINT32 u32CtPktNum)
+     * @brief This function is to check a received data packet against <!--
+     * --> the test pattern instead of recording it, to check for packet <!--
+     * --> out of sequence and to handle stop mode configs
+     * @param [in] s8ReceiveBuf [SINT8 *] - Received packet
+     * @param [in] u32CtPktNum [UINT32] - Sequence number of the packet
+     */
+    void verifyPatternPacket(SINT8 *s8ReceiveBuf, UINT32 u32CtPktNum);
+
+    /** @fn void mmapPacket(SINT8 *s8ReceiveBuf, UINT32 u32CtPktNum)
+     * @brief This function is to copy a received data packet to its <!--
+     * --> offset in the memory mapped record files, to check for packet <!--
+     * --> out of sequence and to handle stop mode configs. Lost packets <!--
+     * --> are left as zeros, a late packet lands at its offset
+     * @param [in] s8ReceiveBuf [SINT8 *] - Received packet
+     * @param [in] u32CtPktNum [UINT32] - Sequence number of the packet
+     */
+    void mmapPacket(SINT8 *s8ReceiveBuf, UINT32 u32CtPktNum);
+#endif
+
     /** @fn bool writeDataToFile(SINT8 *s8Buffer, UINT32 u32Size)
      * @brief This function is to handle recording data in files
      * @return boolean value
@@ -254,19 +693,311 @@ public:
     void writeDataToBuffer_Inline(SINT8 *s8Buffer, UINT32 u32Size,
                                                     bool bOldPkt, bool bZeroFilledPkt);
 
-    /** @fn void Thread_WriteDataToFile()
+    /** @fn bool handleWriterOverflow(UINT32 u32Size)
+     * @brief This function is to apply the overflow policy at a buffer <!--
+     * --> swap while the file writer is busy: spill the read buffer to <!--
+     * --> RAM, else drop whole frames of it (inline processing)
+     * @param [in] u32Size  [UINT32] - Size of the data to be stored
+     * @return boolean value, false if the caller has to wait for the writer
+     */
+    bool handleWriterOverflow(UINT32 u32Size);
+
+    /** @fn bool spillReadBuffer()
+     * @brief This function is to hand the read buffer over to a free <!--
+     * --> spill buffer (inline processing)
+     * @return boolean value
+     */
+    bool spillReadBuffer();
+
+    /** @fn bool dropReadBufferFrames(UINT32 u32Size)
+     * @brief This function is to drop whole frames of the read buffer to <!--
+     * --> store the next data. Raw mode has no frame boundaries, hence all <!--
+     * --> the data from the drop floor is dropped (inline processing)
+     * @param [in] u32Size  [UINT32] - Size of the data to be stored
+     * @return boolean value
+     */
+    bool dropReadBufferFrames(UINT32 u32Size);
+
+    /** @fn void dropReadBufferPacket(UINT32 u32Size)
+     * @brief This function is to drop a packet of the frame being dropped, <!--
+     * --> the packet is added to the hole of the read buffer (inline processing)
+     * @param [in] u32Size  [UINT32] - Size of the packet data
+     */
+    void dropReadBufferPacket(UINT32 u32Size);
+
+    /** @fn void resetReadBufferDropState()
+     * @brief This function is to reset the dropped frames state of the <!--
+     * --> read buffer once it is handed to the file writer (inline processing)
+     */
+    void resetReadBufferDropState();
+
+    /** @fn void writeSpilledBuffers(UINT32 u32Till)
+     * @brief This function is to write the spilled buffers in file till <!--
+     * --> the given spill count (inline processing)
+     * @param [in] u32Till [UINT32] - Spill count to write till
+     */
+    void writeSpilledBuffers(UINT32 u32Till);
+
+        /** @fn void Thread_WriteDataToFile()
      * @brief This thread function is to handle recording data in files (inline processing)
      */
     void Thread_WriteDataToFile();
 
-    /** @fn bool writeDataToFile_Inline(SINT8 *s8Buffer, UINT32 u32Size)
+    /** @fn void writeSwappedBuffer()
+     * @brief This function is to write the buffer handed over by the <!--
+     * --> last buffer swap in file (inline processing)
+     */
+    void writeSwappedBuffer();
+
+    /** @fn bool writeDataToFile_Inline(SINT8 **pps8Buffer, UINT32 u32Size)
      * @brief This function is to handle recording data in files along with  <!--
      * --> reordering of data (inline processing)
+     * @param [in, out] pps8Buffer [SINT8 **] - Buffer to write in file, <!--
+     * --> exchanged with an empty one if handed over to a stripe writer
+     * @param [in] u32Size  [UINT32] - Size of buffer
+     * @return boolean value
+     */
+    bool writeDataToFile_Inline(SINT8 **pps8Buffer, UINT32 u32Size);
+
+    /** @fn bool writeRecordBuffer_Inline(SINT8 **pps8Buffer, UINT32 u32Size, UINT32 u32HoleIndex, ULONG64 u64HoleBytes, ULONG64 u64TimeUs)
+     * @brief This function is to write a record buffer in the record file <!--
+     * --> or hand it over as the next stripe (inline processing)
+     * @param [in, out] pps8Buffer [SINT8 **] - Buffer to write in file, <!--
+     * --> exchanged with an empty one if handed over to a stripe writer
+     * @param [in] u32Size  [UINT32] - Size of buffer
+     * @param [in] u32HoleIndex [UINT32] - Buffer index of the dropped frames
+     * @param [in] u64HoleBytes [ULONG64] - Dropped bytes
+     * @param [in] u64TimeUs [ULONG64] - Time the buffer is handed over
+     * @return boolean value
+     */
+    bool writeRecordBuffer_Inline(SINT8 **pps8Buffer, UINT32 u32Size,
+                                  UINT32 u32HoleIndex, ULONG64 u64HoleBytes,
+                                  ULONG64 u64TimeUs);
+
+    /** @fn bool writeStripe_Inline(SINT8 **pps8Buffer, UINT32 u32Size, UINT32 u32HoleIndex, ULONG64 u64HoleBytes)
+     * @brief This function is to hand a record buffer over <!--
+     * --> to the next idle stripe writer, the stripe is added to the <!--
+     * --> manifest (inline processing)
+     * @param [in, out] pps8Buffer [SINT8 **] - Buffer to write in file, <!--
+     * --> exchanged with the empty stripe buffer
+     * @param [in] u32Size  [UINT32] - Size of buffer
+     * @param [in] u32HoleIndex [UINT32] - Buffer index of the dropped frames
+     * @param [in] u64HoleBytes [ULONG64] - Dropped bytes
+     * @return boolean value
+     */
+    bool writeStripe_Inline(SINT8 **pps8Buffer, UINT32 u32Size,
+                            UINT32 u32HoleIndex, ULONG64 u64HoleBytes);
+
+    /** @fn bool writeRecordData_Inline(SINT8 **pps8Buffer, UINT32 u32Size, UINT32 u32HoleIndex, ULONG64 u64HoleBytes, ULONG64 u64StreamOffset)
+     * @brief This function is to reorder and filter record data and <!--
+     * --> write it in the record file or hand it over as the next <!--
+     * --> stripe (inline processing)
+     * @param [in, out] pps8Buffer [SINT8 **] - Buffer to write in file, <!--
+     * --> exchanged with an empty one if handed over to a stripe writer
+     * @param [in] u32Size  [UINT32] - Size of buffer
+     * @param [in] u32HoleIndex [UINT32] - Buffer index of the dropped frames
+     * @param [in] u64HoleBytes [ULONG64] - Dropped bytes
+     * @param [in] u64StreamOffset [ULONG64] - Data stream offset of the buffer
+     * @return boolean value
+     */
+    bool writeRecordData_Inline(SINT8 **pps8Buffer, UINT32 u32Size,
+                                UINT32 u32HoleIndex, ULONG64 u64HoleBytes,
+                                ULONG64 u64StreamOffset);
+
+    /** @fn void filterRecordData_Inline(SINT8 *s8Buffer, UINT32 *pu32Size, UINT32 *pu32HoleIndex, ULONG64 *pu64HoleBytes, ULONG64 u64StreamOffset)
+     * @brief This function is to remove the frames, RX channels and <!--
+     * --> chirps dropped by the capture filter from record data in place
+     * @param [in, out] s8Buffer [SINT8 *] - Record data
+     * @param [in, out] pu32Size [UINT32 *] - Size of record data
+     * @param [in, out] pu32HoleIndex [UINT32 *] - Buffer index of the <!--
+     * --> dropped frames
+     * @param [in, out] pu64HoleBytes [ULONG64 *] - Dropped bytes
+     * @param [in] u64StreamOffset [ULONG64] - Data stream offset of the data
+     */
+    void filterRecordData_Inline(SINT8 *s8Buffer, UINT32 *pu32Size,
+                                 UINT32 *pu32HoleIndex, ULONG64 *pu64HoleBytes,
+                                 ULONG64 u64StreamOffset);
+
+    /** @fn ULONG64 filterRecordBytes_Inline(SINT8 *s8Buffer, ULONG64 u64OutIndex, ULONG64 u64InIndex, ULONG64 u64Size, ULONG64 u64StreamOffset)
+     * @brief This function is to move the bytes kept by the capture <!--
+     * --> filter to the output index, a NULL buffer only counts them
+     * @param [in, out] s8Buffer [SINT8 *] - Record data or NULL
+     * @param [in] u64OutIndex [ULONG64] - Output index of the kept bytes
+     * @param [in] u64InIndex [ULONG64] - Buffer index of the bytes
+     * @param [in] u64Size [ULONG64] - Number of bytes
+     * @param [in] u64StreamOffset [ULONG64] - Data stream offset of the bytes
+     * @return ULONG64 value - Output index after the kept bytes
+     */
+    ULONG64 filterRecordBytes_Inline(SINT8 *s8Buffer, ULONG64 u64OutIndex,
+                                     ULONG64 u64InIndex, ULONG64 u64Size,
+                                     ULONG64 u64StreamOffset);
+
+    /** @fn bool writeTriggerRing_Inline(SINT8 **pps8Buffer, UINT32 u32Size, UINT32 u32HoleIndex, ULONG64 u64HoleBytes)
+     * @brief This function is to keep a record buffer in the pre-trigger <!--
+     * --> ring and dump the ring data of the triggers (inline processing)
+     * @param [in, out] pps8Buffer [SINT8 **] - Buffer to keep in the ring
+     * @param [in] u32Size  [UINT32] - Size of buffer
+     * @param [in] u32HoleIndex [UINT32] - Buffer index of the dropped frames
+     * @param [in] u64HoleBytes [ULONG64] - Dropped bytes
+     * @return boolean value
+     */
+    bool writeTriggerRing_Inline(SINT8 **pps8Buffer, UINT32 u32Size,
+                                 UINT32 u32HoleIndex, ULONG64 u64HoleBytes);
+
+    /** @fn void copyToTriggerRing(const SINT8 *s8Buffer, ULONG64 u64Size)
+     * @brief This function is to append data to the pre-trigger ring, a <!--
+     * --> NULL buffer appends zeros (inline processing)
+     * @param [in] s8Buffer [const SINT8 *] - Data or NULL
+     * @param [in] u64Size [ULONG64] - Size of data
+     */
+    void copyToTriggerRing(const SINT8 *s8Buffer, ULONG64 u64Size);
+
+    /** @fn bool dumpTriggerRing()
+     * @brief This function is to handle the pending trigger and write the <!--
+     * --> ring data of the dump in progress (inline processing)
+     * @return boolean value
+     */
+    bool dumpTriggerRing();
+
+    /** @fn ULONG64 findTriggerRingMark(ULONG64 u64TimeUs, bool bBefore, ULONG64 u64Floor, ULONG64 *pu64MarkTimeUs)
+     * @brief This function is to find the data stream offset of the <!--
+     * --> time mark at a dump boundary (inline processing)
+     * @param [in] u64TimeUs [ULONG64] - Dump boundary time (micro seconds)
+     * @param [in] bBefore [bool] - Last mark at or before the time if <!--
+     * --> true (else the oldest mark), else first mark at or after it
+     * @param [in] u64Floor [ULONG64] - Marks before this offset are not used
+     * @param [out] pu64MarkTimeUs [ULONG64 *] - Receive time of the mark
+     * @return ULONG64 value - Data stream offset, ULLONG_MAX if not found
+     */
+    ULONG64 findTriggerRingMark(ULONG64 u64TimeUs, bool bBefore,
+                                ULONG64 u64Floor, ULONG64 *pu64MarkTimeUs);
+
+    /** @fn void addTriggerRingMark()
+     * @brief This function is to add a time mark of the pre-trigger ring <!--
+     * --> at the read buffer index (inline processing)
+     */
+    void addTriggerRingMark();
+
+    /** @fn void closeTriggerDump()
+     * @brief This function is to end the dump in progress and add it to <!--
+     * --> the trigger log (inline processing)
+     */
+    void closeTriggerDump();
+
+    /** @fn bool createTriggerLog()
+     * @brief This function is to create the trigger log of the record <!--
+     * --> (inline processing)
+     * @return boolean value
+     */
+    bool createTriggerLog();
+
+    /** @fn void closeTriggerLog()
+     * @brief This function is to dump the data of the last trigger <!--
+     * --> received before the record stop and close the trigger log
+     */
+    void closeTriggerLog();
+
+    /** @fn bool createCrcLog()
+     * @brief This function is to create the CRC32C log of the record <!--
+     * --> (inline processing)
+     * @return boolean value
+     */
+    bool createCrcLog();
+
+    /** @fn void updateRecordCrc_Inline(const SINT8 *s8Buffer, UINT32 u32Size, UINT32 u32HoleIndex, ULONG64 u64HoleBytes)
+     * @brief This function is to add record data to the CRC32C chunks, <!--
+     * --> the hole of the dropped frames counts as zero bytes <!--
+     * --> (inline processing)
+     * @param [in] s8Buffer [const SINT8 *] - Record data
+     * @param [in] u32Size  [UINT32] - Size of record data
+     * @param [in] u32HoleIndex [UINT32] - Buffer index of the dropped frames
+     * @param [in] u64HoleBytes [ULONG64] - Dropped bytes
+     */
+    void updateRecordCrc_Inline(const SINT8 *s8Buffer, UINT32 u32Size,
+                                UINT32 u32HoleIndex, ULONG64 u64HoleBytes);
+
+    /** @fn void crcRecordBytes_Inline(const SINT8 *s8Buffer, ULONG64 u64Size)
+     * @brief This function is to add bytes to the CRC32C chunks, a full <!--
+     * --> chunk is added to the CRC32C log. A NULL buffer adds zero <!--
+     * --> bytes (inline processing)
+     * @param [in] s8Buffer [const SINT8 *] - Bytes or NULL
+     * @param [in] u64Size [ULONG64] - Number of bytes
+     */
+    void crcRecordBytes_Inline(const SINT8 *s8Buffer, ULONG64 u64Size);
+
+    /** @fn void closeCrcLog()
+     * @brief This function is to add the last chunk to the CRC32C log <!--
+     * --> and close it
+     */
+    void closeCrcLog();
+
+    /** @fn bool setStripeFileNames(const SINT8 *s8FileName)
+     * @brief This function is to create the first record file of each <!--
+     * --> stripe path and the stripe manifest (inline processing)
+     * @param [in] s8FileName [const SINT8 *] - File name without the <!--
+     * --> base path and the file count
+     * @return boolean value
+     */
+    bool setStripeFileNames(const SINT8 *s8FileName);
+
+    /** @fn bool writeBufferToFile_Inline(SINT8 *s8Buffer, UINT32 u32Size, UINT32 u32HoleIndex, ULONG64 u64HoleBytes)
+     * @brief This function is to write a record buffer in files, <!--
+     * --> leaving a hole in the file for its dropped frames (inline processing)
      * @param [in] s8Buffer [SINT8 *] - Buffer to write in file
      * @param [in] u32Size  [UINT32] - Size of buffer
+     * @param [in] u32HoleIndex [UINT32] - Buffer index of the dropped frames
+     * @param [in] u64HoleBytes [ULONG64] - Dropped bytes
+     * @return boolean value
+     */
+    bool writeBufferToFile_Inline(SINT8 *s8Buffer, UINT32 u32Size,
+                                  UINT32 u32HoleIndex, ULONG64 u64HoleBytes);
+
+    /** @fn bool writeBytesToFile_Inline(SINT8 *s8Buffer, UINT32 u32Size)
+     * @brief This function is to write bytes in files of the maximum file <!--
+     * --> size, or of whole frames by count or duration. A NULL buffer <!--
+     * --> seeks over the bytes, which leaves a hole (inline processing)
+     * @param [in] s8Buffer [SINT8 *] - Buffer to write in file or NULL
+     * @param [in] u32Size  [UINT32] - Size of buffer
+     * @return boolean value
+     */
+    bool writeBytesToFile_Inline(SINT8 *s8Buffer, UINT32 u32Size);
+
+    /** @fn UINT32 getFrameFileChunk(UINT32 u32Size)
+     * @brief This function is to get the bytes written in the record file <!--
+     * --> before it ends at a frame boundary. The file holds the frames per <!--
+     * --> file, or ends at the first frame after the file duration of data <!--
+     * --> time, taken from the handover times of the record buffers <!--
+     * --> (inline processing)
+     * @param [in] u32Size  [UINT32] - Bytes to write
+     * @return UINT32 value - Bytes in the file, 0 if it is full
+     */
+    UINT32 getFrameFileChunk(UINT32 u32Size);
+
+    /** @fn bool openRecordFile()
+     * @brief This function is to open the record file of the data file <!--
+     * --> count, the retention ring recycles its oldest file for it
      * @return boolean value
      */
-    bool writeDataToFile_Inline(SINT8 *s8Buffer, UINT32 u32Size);
+    bool openRecordFile();
+
+    /** @fn void closeRecordFile()
+     * @brief This function is to close the record file, a hole at the end <!--
+     * --> of the file is written out to keep the file size
+     */
+    void closeRecordFile();
+
+    /** @fn void flushRecordFile()
+     * @brief This function is to write out a hole at the end of the <!--
+     * --> record file and flush the record file
+     */
+    void flushRecordFile();
+
+    /** @fn void publishWatermark(bool bComplete)
+     * @brief This function is to publish the data written in the record <!--
+     * --> files so far as committed, the record file is flushed first
+     * @param [in] bComplete [bool] - Record is stopped, nothing follows
+     */
+    void publishWatermark(bool bComplete);
 
     /** @fn  bool ReorderAlgorithm(SINT8 *s8Buffer, UINT32 u32SizeReorder)
      * @brief This function is to reorder the recorded data based on number <!--
@@ -306,6 +1037,18 @@ public:
     */
     void WriteOffsetMetaData(ULONG64 u64PrevPktOffset, UINT32 u32PrevPktSize,
                                  ULONG64 u64CtPktOffset, UINT32 u32CtPktSize);
+
+#if !defined(POST_PROCESSING) && defined(LATENCY_HISTOGRAMS)
+    /** @fn void recordFrameHandoff(ULONG64 u64HandoffTimeUs)
+     * @brief This function is to update the frame to handoff latency of <!--
+     * --> the frames completed in the read buffer when it is handed to <!--
+     * --> the file writer (inline processing)
+     * @param [in] u64HandoffTimeUs [ULONG64] - Handoff time in micro seconds
+     */
+    void recordFrameHandoff(ULONG64 u64HandoffTimeUs);
+#endif
 };
 
+#pragma pack(pop)
+
 #endif //RECORDDATARECV_H
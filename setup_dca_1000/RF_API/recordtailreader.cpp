@@ -0,0 +1,423 @@
+/**
+ * @file recordtailreader.cpp
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains the class to read the committed data of a
+ * record in progress
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+///****************
+/// Includes
+///****************
+
+#include "recordtailreader.h"
+
+#include "extern.h"
+
+#ifndef _WIN32
+#include <sys/stat.h>
+#endif
+
+/** @fn cRecordTailReader::cRecordTailReader()
+ * @brief This constructor function is to initialize the class member <!--
+ * --> variables
+ */
+cRecordTailReader::cRecordTailReader()
+{
+    strWatermarkFile[0] = '\0';
+    strRecordFilePath[0] = '\0';
+    u64FrameSize = 0;
+    memset(&sWatermark, 0, sizeof(sWatermark));
+    pRecordFile = NULL;
+    u32FileCount = 0;
+    u64FileOffset = 0;
+    u64ReadOffset = 0;
+    u64SkipBytes = 0;
+}
+
+/** @fn cRecordTailReader::~cRecordTailReader()
+ * @brief This destructor function is to close the record file
+ */
+cRecordTailReader::~cRecordTailReader()
+{
+    closeWatermark();
+}
+
+/** @fn STATUS cRecordTailReader::openWatermark(const SINT8 *s8WatermarkFile, ULONG64 u64FrameSizeArg, bool bFromLatest)
+ * @brief This function is to open a record by its watermark file
+ * @param [in] s8WatermarkFile [const SINT8 *] - Watermark file
+ * @param [in] u64FrameSizeArg [ULONG64] - Bytes of a frame, 0 for the <!--
+ * --> frame size of the watermark file
+ * @param [in] bFromLatest [bool] - Read from the first frame of the <!--
+ * --> record file written last, else from the oldest record file kept
+ * @return SINT32 value
+ */
+STATUS cRecordTailReader::openWatermark(const SINT8 *s8WatermarkFile,
+                                        ULONG64 u64FrameSizeArg,
+                                        bool bFromLatest)
+{
+    STATUS s32Status = STS_RFDCCARD_SUCCESS;
+
+    closeWatermark();
+
+    if(strlen(s8WatermarkFile) >= sizeof(strWatermarkFile))
+        return STS_RFDCCARD_INVALID_INPUT_PARAMS;
+    strcpy(strWatermarkFile, s8WatermarkFile);
+
+    s32Status = readWatermark();
+    if(s32Status != STS_RFDCCARD_SUCCESS)
+    {
+        strWatermarkFile[0] = '\0';
+        return s32Status;
+    }
+
+    u64FrameSize = (u64FrameSizeArg > 0) ? u64FrameSizeArg :
+                                           sWatermark.u64FrameSize;
+
+    if(bFromLatest)
+        moveToFile(sWatermark.u32FileCount,
+                   sWatermark.u64CommittedOffset - sWatermark.u64FileBytes);
+    else
+        moveToFile(sWatermark.u32FirstFileCount,
+                   sWatermark.u64FirstFileOffset);
+
+    return STS_RFDCCARD_SUCCESS;
+}
+
+/** @fn SINT32 cRecordTailReader::readData(SINT8 *s8Buffer, UINT32 u32Size, UINT32 u32TimeoutMs, ULONG64 *pu64Offset)
+ * @brief This function is to read the next whole frames committed, <!--
+ * --> the watermark is polled till they are committed
+ * @param [out] s8Buffer [SINT8 *] - Buffer filled with the data
+ * @param [in] u32Size [UINT32] - Size of buffer, one frame at least
+ * @param [in] u32TimeoutMs [UINT32] - Wait for the data in millisec
+ * @param [out] pu64Offset [ULONG64 *] - Record data offset of the <!--
+ * --> data read, NULL if not needed
+ * @return SINT32 value - Bytes read, 0 at the end of a stopped <!--
+ * --> record or error status
+ */
+SINT32 cRecordTailReader::readData(SINT8 *s8Buffer, UINT32 u32Size,
+                                   UINT32 u32TimeoutMs, ULONG64 *pu64Offset)
+{
+    ULONG64 u64StartUs = osalObj_api.GetTimeInMicroSec();
+    ULONG64 u64CommittedEnd = 0;
+    UINT32 u32Chunk = 0;
+    UINT32 u32BytesRead = 0;
+    UINT32 u32SavedFileCount = 0;
+    ULONG64 u64SavedFileOffset = 0;
+    ULONG64 u64SavedReadOffset = 0;
+    ULONG64 u64SavedSkipBytes = 0;
+    bool bRead = false;
+
+    if((strWatermarkFile[0] == '\0') || (u32Size > 0x7FFFFFFF))
+        return STS_RFDCCARD_INVALID_INPUT_PARAMS;
+
+    /** Data is read in whole frames */
+    if(u64FrameSize > 0)
+        u32Size -= (UINT32)(u32Size % u64FrameSize);
+    if(u32Size == 0)
+        return STS_RFDCCARD_INVALID_INPUT_PARAMS;
+
+    while(true)
+    {
+        /** Watermark being replaced is read again on the next poll */
+        readWatermark();
+
+        /** Record files older than the oldest one kept are written over */
+        if(u32FileCount < sWatermark.u32FirstFileCount)
+            moveToFile(sWatermark.u32FirstFileCount,
+                       sWatermark.u64FirstFileOffset);
+
+        u64CommittedEnd = sWatermark.u64CommittedOffset;
+        if(u64FrameSize > 0)
+            u64CommittedEnd -= (u64CommittedEnd % u64FrameSize);
+
+        if(u64CommittedEnd > (u64ReadOffset + u64SkipBytes))
+        {
+            u32SavedFileCount = u32FileCount;
+            u64SavedFileOffset = u64FileOffset;
+            u64SavedReadOffset = u64ReadOffset;
+            u64SavedSkipBytes = u64SkipBytes;
+            bRead = true;
+
+            /** Rest of a frame read from its middle is skipped */
+            while(bRead && (u64SkipBytes > 0))
+            {
+                u32Chunk = (u64SkipBytes < u32Size) ? (UINT32)u64SkipBytes :
+                                                      u32Size;
+                bRead = (readFileData(s8Buffer, u32Chunk) == u32Chunk);
+                u64SkipBytes -= u32Chunk;
+            }
+
+            u32Chunk = u32Size;
+            if(u32Chunk > (u64CommittedEnd - u64ReadOffset))
+                u32Chunk = (UINT32)(u64CommittedEnd - u64ReadOffset);
+            if(bRead)
+            {
+                u32BytesRead = readFileData(s8Buffer, u32Chunk);
+                bRead = (u32BytesRead == u32Chunk);
+            }
+
+            /** Data read before the file is renamed is of the file */
+            if(bRead && (!isFileRecycled()))
+            {
+                if(pu64Offset != NULL)
+                    *pu64Offset = u64ReadOffset - u32BytesRead;
+                return (SINT32)u32BytesRead;
+            }
+
+            /** Record file is written over, it is read again or left once
+             *  the watermark moves past it                               */
+            if(pRecordFile != NULL)
+            {
+                fclose(pRecordFile);
+                pRecordFile = NULL;
+            }
+            u32FileCount = u32SavedFileCount;
+            u64FileOffset = u64SavedFileOffset;
+            u64ReadOffset = u64SavedReadOffset;
+            u64SkipBytes = u64SavedSkipBytes;
+        }
+        else if(sWatermark.bComplete)
+        {
+            return 0;
+        }
+
+        if((osalObj_api.GetTimeInMicroSec() - u64StartUs) >=
+           ((ULONG64)u32TimeoutMs * 1000))
+            return STS_RFDCCARD_TIMEOUT_ERR;
+
+        osalObj_api.SleepInMilliSec(RECORD_TAIL_POLL_INTERVAL_MS);
+    }
+}
+
+/** @fn void cRecordTailReader::closeWatermark()
+ * @brief This function is to close the record file
+ */
+void cRecordTailReader::closeWatermark()
+{
+    if(NULL != pRecordFile)
+    {
+        fclose(pRecordFile);
+        pRecordFile = NULL;
+    }
+    strWatermarkFile[0] = '\0';
+    u32FileCount = 0;
+    u64FileOffset = 0;
+    u64ReadOffset = 0;
+    u64SkipBytes = 0;
+}
+
+/** @fn STATUS cRecordTailReader::readWatermark()
+ * @brief This function is to read the watermark file
+ * @return SINT32 value
+ */
+STATUS cRecordTailReader::readWatermark()
+{
+    SINT8 s8Line[MAX_NAME_LEN * 3];
+    SINT8 s8FilePath[MAX_NAME_LEN * 2];
+    SINT8 *s8Value = NULL;
+    strRecordWatermark sRead;
+    FILE *pWatermarkFile = NULL;
+    bool bValid = false;
+
+    pWatermarkFile = fopen(strWatermarkFile, "r");
+    if(NULL == pWatermarkFile)
+        return STS_RFDCCARD_OS_ERR;
+
+    /** Title, record files, frame size, oldest file kept, committed data
+     *  and state                                                        */
+    memset(&sRead, 0, sizeof(sRead));
+    if((NULL != fgets(s8Line, sizeof(s8Line), pWatermarkFile)) &&
+       (strncmp(s8Line, WATERMARK_TITLE, strlen(WATERMARK_TITLE)) == 0) &&
+       (NULL != fgets(s8Line, sizeof(s8Line), pWatermarkFile)) &&
+       (NULL != (s8Value = strchr(s8Line, ','))) &&
+       (strlen(s8Value) <= sizeof(s8FilePath)))
+    {
+        s8Value[strcspn(s8Value, "\r\n")] = '\0';
+        strcpy(s8FilePath, &s8Value[1]);
+
+        bValid =
+            (NULL != fgets(s8Line, sizeof(s8Line), pWatermarkFile)) &&
+            (sscanf(s8Line, "Frame size (bytes),%llu",
+                    &sRead.u64FrameSize) == 1) &&
+            (NULL != fgets(s8Line, sizeof(s8Line), pWatermarkFile)) &&
+            (sscanf(s8Line, "First file count,%u",
+                    &sRead.u32FirstFileCount) == 1) &&
+            (NULL != fgets(s8Line, sizeof(s8Line), pWatermarkFile)) &&
+            (sscanf(s8Line, "First file record offset (bytes),%llu",
+                    &sRead.u64FirstFileOffset) == 1) &&
+            (NULL != fgets(s8Line, sizeof(s8Line), pWatermarkFile)) &&
+            (sscanf(s8Line, "File count,%u", &sRead.u32FileCount) == 1) &&
+            (NULL != fgets(s8Line, sizeof(s8Line), pWatermarkFile)) &&
+            (sscanf(s8Line, "File committed size (bytes),%llu",
+                    &sRead.u64FileBytes) == 1) &&
+            (NULL != fgets(s8Line, sizeof(s8Line), pWatermarkFile)) &&
+            (sscanf(s8Line, "Committed record offset (bytes),%llu",
+                    &sRead.u64CommittedOffset) == 1) &&
+            (NULL != fgets(s8Line, sizeof(s8Line), pWatermarkFile)) &&
+            (strncmp(s8Line, "State,", strlen("State,")) == 0);
+        sRead.bComplete = bValid &&
+            (strncmp(&s8Line[strlen("State,")], WATERMARK_STATE_COMPLETE,
+                     strlen(WATERMARK_STATE_COMPLETE)) == 0);
+    }
+    fclose(pWatermarkFile);
+
+    if(!bValid)
+        return STS_RFDCCARD_INVALID_INPUT_PARAMS;
+
+    strcpy(strRecordFilePath, s8FilePath);
+    sWatermark = sRead;
+    return STS_RFDCCARD_SUCCESS;
+}
+
+/** @fn void cRecordTailReader::moveToFile(UINT32 u32FileCountArg, ULONG64 u64FileOffsetArg)
+ * @brief This function is to read from the start of a record file, <!--
+ * --> the bytes till the next frame are skipped
+ * @param [in] u32FileCountArg [UINT32] - Data file count
+ * @param [in] u64FileOffsetArg [ULONG64] - Record data offset of the file
+ */
+void cRecordTailReader::moveToFile(UINT32 u32FileCountArg,
+                                   ULONG64 u64FileOffsetArg)
+{
+    if(NULL != pRecordFile)
+    {
+        fclose(pRecordFile);
+        pRecordFile = NULL;
+    }
+    u32FileCount = u32FileCountArg;
+    u64FileOffset = u64FileOffsetArg;
+    u64ReadOffset = u64FileOffsetArg;
+
+    /** Record files are split at the packets, not at the frames */
+    u64SkipBytes = 0;
+    if((u64FrameSize > 0) && ((u64ReadOffset % u64FrameSize) != 0))
+        u64SkipBytes = u64FrameSize - (u64ReadOffset % u64FrameSize);
+}
+
+/** @fn UINT32 cRecordTailReader::readFileData(SINT8 *s8Buffer, UINT32 u32Size)
+ * @brief This function is to read the next bytes of the record files, <!--
+ * --> continuing in the next record file
+ * @param [out] s8Buffer [SINT8 *] - Buffer filled with the data
+ * @param [in] u32Size [UINT32] - Bytes to read
+ * @return UINT32 value - Bytes read
+ */
+UINT32 cRecordTailReader::readFileData(SINT8 *s8Buffer, UINT32 u32Size)
+{
+    SINT8 s8FileName[MAX_NAME_LEN * 3];
+    UINT32 u32BytesRead = 0;
+    UINT32 u32Read = 0;
+
+    while(u32BytesRead < u32Size)
+    {
+        if(NULL == pRecordFile)
+        {
+            strcpy(s8FileName, strRecordFilePath);
+            strcat(s8FileName, std::to_string(u32FileCount).c_str());
+            strcat(s8FileName, REC_DATA_FILE_EXTENSION);
+
+            pRecordFile = fopen(s8FileName, "rb");
+            if(NULL == pRecordFile)
+                break;
+
+            /** Data after the watermark is not read ahead into the stream
+             *  buffer, it is not final yet                               */
+            setvbuf(pRecordFile, NULL, _IONBF, 0);
+            if(fseek(pRecordFile, (long)(u64ReadOffset - u64FileOffset),
+                     SEEK_SET) != 0)
+                break;
+        }
+
+        u32Read = (UINT32)fread(&s8Buffer[u32BytesRead], 1,
+                                u32Size - u32BytesRead, pRecordFile);
+        u32BytesRead += u32Read;
+        u64ReadOffset += u32Read;
+
+        /** Record files before the one written last are complete, they
+         *  are split at the maximum file size                          */
+        if(u32BytesRead < u32Size)
+        {
+            if((u32FileCount >= sWatermark.u32FileCount) || isFileRecycled())
+                break;
+
+            fclose(pRecordFile);
+            pRecordFile = NULL;
+            u32FileCount ++;
+            u64FileOffset = u64ReadOffset;
+        }
+    }
+
+    return u32BytesRead;
+}
+
+/** @fn bool cRecordTailReader::isFileRecycled()
+ * @brief This function is to check that the open record file still <!--
+ * --> has its name, the retention ring renames the oldest record file <!--
+ * --> before it is written over
+ * @return boolean value
+ */
+bool cRecordTailReader::isFileRecycled()
+{
+#ifndef _WIN32
+    SINT8 s8FileName[MAX_NAME_LEN * 3];
+    struct stat sFileStat;
+    struct stat sNameStat;
+
+    if(NULL == pRecordFile)
+        return false;
+
+    strcpy(s8FileName, strRecordFilePath);
+    strcat(s8FileName, std::to_string(u32FileCount).c_str());
+    strcat(s8FileName, REC_DATA_FILE_EXTENSION);
+
+    if((fstat(fileno(pRecordFile), &sFileStat) != 0) ||
+       (stat(s8FileName, &sNameStat) != 0))
+        return true;
+
+    return ((sFileStat.st_dev != sNameStat.st_dev) ||
+            (sFileStat.st_ino != sNameStat.st_ino));
+#else
+    /** An open file is not renamed on Windows */
+    return false;
+#endif
+}
@@ -0,0 +1,198 @@
+/**
+ * @file recordtailreader.h
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains the class to read the committed data of a
+ * record in progress
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+#ifndef RECORDTAILREADER_H
+#define RECORDTAILREADER_H
+
+///****************
+/// Includes
+///****************
+
+#include "../Common/rf_api_internal.h"
+
+#include "defines.h"
+
+/** Watermark of a record in progress                                        */
+typedef struct
+{
+    /** Recorded bytes of a frame, 0 if the frames are not known */
+    ULONG64 u64FrameSize;
+
+    /** Data file count of the oldest record file kept      */
+    UINT32 u32FirstFileCount;
+
+    /** Record data offset of the oldest record file kept   */
+    ULONG64 u64FirstFileOffset;
+
+    /** Data file count of the record file written last     */
+    UINT32 u32FileCount;
+
+    /** Bytes committed in the record file written last     */
+    ULONG64 u64FileBytes;
+
+    /** Record data offset of the end of the committed data */
+    ULONG64 u64CommittedOffset;
+
+    /** Record is stopped, nothing follows                  */
+    bool bComplete;
+} strRecordWatermark;
+
+/** @class cRecordTailReader
+ * @brief This class provides support APIs to read the record files of a <!--
+ * --> record in progress. The watermark file is polled and the data is <!--
+ * --> read up to the last whole frame before the watermark only, a <!--
+ * --> record file written over by the retention ring is left for the <!--
+ * --> oldest one kept
+ */
+class cRecordTailReader
+{
+    /** Watermark file of the record                        */
+    SINT8 strWatermarkFile[MAX_NAME_LEN * 3];
+
+    /** Record data file path without the file count        */
+    SINT8 strRecordFilePath[MAX_NAME_LEN * 2];
+
+    /** Bytes of a frame, the data is read in whole frames, 0 for bytes */
+    ULONG64 u64FrameSize;
+
+    /** Watermark read last                                 */
+    strRecordWatermark sWatermark;
+
+    /** Record data file pointer                            */
+    FILE *pRecordFile;
+
+    /** Data file count of the record file read             */
+    UINT32 u32FileCount;
+
+    /** Record data offset of the first byte in the file read */
+    ULONG64 u64FileOffset;
+
+    /** Record data offset of the next byte read            */
+    ULONG64 u64ReadOffset;
+
+    /** Bytes skipped till the start of the next frame      */
+    ULONG64 u64SkipBytes;
+
+public:
+    /** @fn cRecordTailReader()
+     * @brief This constructor function is to initialize the class member <!--
+     * --> variables
+     */
+    cRecordTailReader();
+
+    /** @fn ~cRecordTailReader()
+     * @brief This destructor function is to close the record file
+     */
+    ~cRecordTailReader();
+
+    /** @fn STATUS openWatermark(const SINT8 *s8WatermarkFile, ULONG64 u64FrameSizeArg, bool bFromLatest)
+     * @brief This function is to open a record by its watermark file
+     * @param [in] s8WatermarkFile [const SINT8 *] - Watermark file
+     * @param [in] u64FrameSizeArg [ULONG64] - Bytes of a frame, 0 for the <!--
+     * --> frame size of the watermark file
+     * @param [in] bFromLatest [bool] - Read from the first frame of the <!--
+     * --> record file written last, else from the oldest record file kept
+     * @return SINT32 value
+     */
+    STATUS openWatermark(const SINT8 *s8WatermarkFile, ULONG64 u64FrameSizeArg,
+                         bool bFromLatest);
+
+    /** @fn SINT32 readData(SINT8 *s8Buffer, UINT32 u32Size, UINT32 u32TimeoutMs, ULONG64 *pu64Offset)
+     * @brief This function is to read the next whole frames committed, <!--
+     * --> the watermark is polled till they are committed
+     * @param [out] s8Buffer [SINT8 *] - Buffer filled with the data
+     * @param [in] u32Size [UINT32] - Size of buffer, one frame at least
+     * @param [in] u32TimeoutMs [UINT32] - Wait for the data in millisec
+     * @param [out] pu64Offset [ULONG64 *] - Record data offset of the <!--
+     * --> data read, NULL if not needed
+     * @return SINT32 value - Bytes read, 0 at the end of a stopped <!--
+     * --> record or error status
+     */
+    SINT32 readData(SINT8 *s8Buffer, UINT32 u32Size, UINT32 u32TimeoutMs,
+                    ULONG64 *pu64Offset);
+
+    /** @fn void closeWatermark()
+     * @brief This function is to close the record file
+     */
+    void closeWatermark();
+
+private:
+    /** @fn STATUS readWatermark()
+     * @brief This function is to read the watermark file
+     * @return SINT32 value
+     */
+    STATUS readWatermark();
+
+    /** @fn void moveToFile(UINT32 u32FileCountArg, ULONG64 u64FileOffsetArg)
+     * @brief This function is to read from the start of a record file, <!--
+     * --> the bytes till the next frame are skipped
+     * @param [in] u32FileCountArg [UINT32] - Data file count
+     * @param [in] u64FileOffsetArg [ULONG64] - Record data offset of the file
+     */
+    void moveToFile(UINT32 u32FileCountArg, ULONG64 u64FileOffsetArg);
+
+    /** @fn UINT32 readFileData(SINT8 *s8Buffer, UINT32 u32Size)
+     * @brief This function is to read the next bytes of the record files, <!--
+     * --> continuing in the next record file
+     * @param [out] s8Buffer [SINT8 *] - Buffer filled with the data
+     * @param [in] u32Size [UINT32] - Bytes to read
+     * @return UINT32 value - Bytes read
+     */
+    UINT32 readFileData(SINT8 *s8Buffer, UINT32 u32Size);
+
+    /** @fn bool isFileRecycled()
+     * @brief This function is to check that the open record file still <!--
+     * --> has its name, the retention ring renames the oldest record file <!--
+     * --> before it is written over
+     * @return boolean value
+     */
+    bool isFileRecycled();
+};
+
+#endif // RECORDTAILREADER_H
@@ -0,0 +1,298 @@
+/**
+ * @file recordverifier.cpp
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains the verification of record data against the
+ * CRC32C tags of its chunks
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+///****************
+/// Includes
+///****************
+
+#include "recordverifier.h"
+
+///****************
+/// Defines
+///****************
+
+/** Chunk result - not read, missing in the record files      */
+#define VERIFY_CHUNK_MISSING 0
+
+/** Chunk result - matching its CRC32C                         */
+#define VERIFY_CHUNK_GOOD 1
+
+/** Chunk result - not matching its CRC32C                     */
+#define VERIFY_CHUNK_BAD 2
+
+/** @fn cRecordVerifier::cRecordVerifier()
+ * @brief This constructor function is to initialize the class member variables
+ */
+cRecordVerifier::cRecordVerifier()
+{
+    strRecordPath[0] = '\0';
+    bStriped = false;
+    u32ChunkSize = 0;
+}
+
+/** @fn STATUS cRecordVerifier::openCrcLog(const SINT8 *s8CrcLogFile)
+ * @brief This function is to read the chunk tags of a CRC32C log
+ * @param [in] s8CrcLogFile [const SINT8 *] - CRC32C log file
+ * @return SINT32 value
+ */
+STATUS cRecordVerifier::openCrcLog(const SINT8 *s8CrcLogFile)
+{
+    SINT8 s8Line[MAX_NAME_LEN * 3];
+    SINT8 *s8Value = NULL;
+    strCrcChunkTag sTag;
+    UINT32 u32Chunk = 0;
+    FILE *pLogFile = NULL;
+    STATUS s32Status = STS_RFDCCARD_SUCCESS;
+
+    vChunkTags.clear();
+
+    pLogFile = fopen(s8CrcLogFile, "r");
+    if(NULL == pLogFile)
+        return STS_RFDCCARD_OS_ERR;
+
+    /** Header - title, record, chunk size and column names */
+    if((NULL == fgets(s8Line, sizeof(s8Line), pLogFile)) ||
+       (strncmp(s8Line, CRC_LOG_TITLE, strlen(CRC_LOG_TITLE)) != 0) ||
+       (NULL == fgets(s8Line, sizeof(s8Line), pLogFile)) ||
+       (NULL == (s8Value = strchr(s8Line, ','))))
+    {
+        fclose(pLogFile);
+        return STS_RFDCCARD_INVALID_INPUT_PARAMS;
+    }
+
+    /** Record files of a single base path or a striped record */
+    bStriped = (strncmp(s8Line, "Stripe manifest,", s8Value - s8Line + 1) == 0);
+    if((!bStriped) &&
+       (strncmp(s8Line, "Record files,", s8Value - s8Line + 1) != 0))
+    {
+        fclose(pLogFile);
+        return STS_RFDCCARD_INVALID_INPUT_PARAMS;
+    }
+    s8Value[strcspn(s8Value, "\r\n")] = '\0';
+    strcpy(strRecordPath, &s8Value[1]);
+
+    if((NULL == fgets(s8Line, sizeof(s8Line), pLogFile)) ||
+       (sscanf(s8Line, "Chunk size (bytes),%u", &u32ChunkSize) != 1) ||
+       (u32ChunkSize == 0) ||
+       (u32ChunkSize > VERIFY_BATCH_SIZE) ||
+       (NULL == fgets(s8Line, sizeof(s8Line), pLogFile)))
+    {
+        fclose(pLogFile);
+        return STS_RFDCCARD_INVALID_INPUT_PARAMS;
+    }
+
+    /** Chunks follow each other in the data stream, only the last one
+     *  of the record is short                                        */
+    while(NULL != fgets(s8Line, sizeof(s8Line), pLogFile))
+    {
+        if((sscanf(s8Line, "%u,%llu,%u,%X", &u32Chunk, &sTag.u64Offset,
+                   &sTag.u32Size, &sTag.u32Crc) != 4) ||
+           (u32Chunk != vChunkTags.size()) ||
+           (sTag.u64Offset != ((ULONG64)u32Chunk * u32ChunkSize)) ||
+           (sTag.u32Size == 0) || (sTag.u32Size > u32ChunkSize) ||
+           ((!vChunkTags.empty()) &&
+            (vChunkTags.back().u32Size != u32ChunkSize)))
+        {
+            s32Status = STS_RFDCCARD_INVALID_INPUT_PARAMS;
+            break;
+        }
+        vChunkTags.push_back(sTag);
+    }
+
+    fclose(pLogFile);
+    return s32Status;
+}
+
+/** @fn STATUS cRecordVerifier::verifyRecord(UINT32 u32NumOfThreads, strRecordVerifyStatus *psVerifyStatus)
+ * @brief This function is to check the record data against the chunk tags
+ * @param [in] u32NumOfThreads [UINT32] - Worker threads, 0 for one <!--
+ * --> per processor core
+ * @param [out] psVerifyStatus [strRecordVerifyStatus *] - Verification <!--
+ * --> status
+ * @return SINT32 value
+ */
+STATUS cRecordVerifier::verifyRecord(UINT32 u32NumOfThreads,
+                                     strRecordVerifyStatus *psVerifyStatus)
+{
+    cStripeReader oReader;
+    std::vector<std::thread> vWorkers;
+    std::vector<SINT8> vBatchBuf[2];
+    UINT32 u32NumOfChunks = (UINT32)vChunkTags.size();
+    UINT32 u32BatchChunks = 0;
+    UINT32 u32NextChunk = 0;
+    UINT32 u32Count = 0;
+    UINT32 u32Workers = 0;
+    UINT8 u8Buf = 0;
+    ULONG64 u64BatchBytes = 0;
+    SINT32 s32BytesRead = 0;
+    bool bRecordEnd = false;
+    STATUS s32Status = STS_RFDCCARD_SUCCESS;
+
+    memset(psVerifyStatus, 0, sizeof(strRecordVerifyStatus));
+    psVerifyStatus->u32NumOfChunks = u32NumOfChunks;
+    psVerifyStatus->u32FirstFailedChunk = u32NumOfChunks;
+
+    if(u32ChunkSize == 0)
+        return STS_RFDCCARD_INVALID_INPUT_PARAMS;
+
+    if(bStriped)
+        s32Status = oReader.openManifest(strRecordPath);
+    else
+        s32Status = oReader.openRecordFiles(strRecordPath);
+    if(s32Status != STS_RFDCCARD_SUCCESS)
+        return s32Status;
+
+    if(u32NumOfThreads == 0)
+        u32NumOfThreads = std::thread::hardware_concurrency();
+    if(u32NumOfThreads == 0)
+        u32NumOfThreads = 1;
+
+    u32BatchChunks = VERIFY_BATCH_SIZE / u32ChunkSize;
+    vBatchBuf[0].resize((size_t)u32BatchChunks * u32ChunkSize);
+    vBatchBuf[1].resize((size_t)u32BatchChunks * u32ChunkSize);
+    vChunkResult.assign(u32NumOfChunks, VERIFY_CHUNK_MISSING);
+
+    /** Tables are built before the workers share them */
+    Crc32cHardwareSupport();
+
+    while((u32NextChunk < u32NumOfChunks) && (!bRecordEnd))
+    {
+        /** Batch of whole chunks, a short chunk ends the record read */
+        u32Count = 0;
+        u64BatchBytes = 0;
+        while((u32Count < u32BatchChunks) &&
+              ((u32NextChunk + u32Count) < u32NumOfChunks))
+        {
+            UINT32 u32Size = vChunkTags[u32NextChunk + u32Count].u32Size;
+            s32BytesRead = oReader.readData(&vBatchBuf[u8Buf][u64BatchBytes],
+                                            u32Size);
+            if(s32BytesRead != (SINT32)u32Size)
+            {
+                bRecordEnd = true;
+                break;
+            }
+            u64BatchBytes += u32Size;
+            u32Count ++;
+        }
+
+        /** Workers of the previous batch are done with the other buffer */
+        for(UINT32 i = 0; i < vWorkers.size(); i ++)
+            vWorkers[i].join();
+        vWorkers.clear();
+
+        u32Workers = (u32Count < u32NumOfThreads) ? u32Count : u32NumOfThreads;
+        for(UINT32 i = 0; i < u32Workers; i ++)
+        {
+            vWorkers.push_back(std::thread(&cRecordVerifier::verifyChunks,
+                                           this, &vBatchBuf[u8Buf][0],
+                                           u32NextChunk, u32Count, i,
+                                           u32Workers));
+        }
+
+        psVerifyStatus->u64VerifiedBytes += u64BatchBytes;
+        u32NextChunk += u32Count;
+        u8Buf ^= 1;
+    }
+
+    for(UINT32 i = 0; i < vWorkers.size(); i ++)
+        vWorkers[i].join();
+    vWorkers.clear();
+
+    /** Record data left after the last chunk, the log is incomplete */
+    if(!bRecordEnd)
+    {
+        while((s32BytesRead = oReader.readData(&vBatchBuf[0][0],
+                                               u32ChunkSize)) > 0)
+            psVerifyStatus->u64UnloggedBytes += s32BytesRead;
+    }
+
+    for(UINT32 i = 0; i < u32NumOfChunks; i ++)
+    {
+        if(vChunkResult[i] == VERIFY_CHUNK_GOOD)
+        {
+            psVerifyStatus->u32NumOfGoodChunks ++;
+            continue;
+        }
+
+        if(vChunkResult[i] == VERIFY_CHUNK_BAD)
+            psVerifyStatus->u32NumOfBadChunks ++;
+        else
+            psVerifyStatus->u32NumOfMissingChunks ++;
+        if(psVerifyStatus->u32FirstFailedChunk == u32NumOfChunks)
+            psVerifyStatus->u32FirstFailedChunk = i;
+    }
+
+    return STS_RFDCCARD_SUCCESS;
+}
+
+/** @fn void cRecordVerifier::verifyChunks(const SINT8 *s8Buffer, UINT32 u32FirstChunk, UINT32 u32NumOfChunks, UINT32 u32Thread, UINT32 u32NumOfThreads)
+ * @brief This function is a worker thread process to check the <!--
+ * --> chunks of a batch, every u32NumOfThreads-th from u32Thread
+ * @param [in] s8Buffer [const SINT8 *] - Record data of the batch
+ * @param [in] u32FirstChunk [UINT32] - First chunk of the batch
+ * @param [in] u32NumOfChunks [UINT32] - Chunks in the batch
+ * @param [in] u32Thread [UINT32] - Worker thread index
+ * @param [in] u32NumOfThreads [UINT32] - Worker threads
+ */
+void cRecordVerifier::verifyChunks(const SINT8 *s8Buffer, UINT32 u32FirstChunk,
+                                   UINT32 u32NumOfChunks, UINT32 u32Thread,
+                                   UINT32 u32NumOfThreads)
+{
+    strCrcChunkTag *psTag = NULL;
+
+    /** Chunks of a batch are whole but the last one of the record */
+    for(UINT32 i = u32Thread; i < u32NumOfChunks; i += u32NumOfThreads)
+    {
+        psTag = &vChunkTags[u32FirstChunk + i];
+        vChunkResult[u32FirstChunk + i] =
+            (Crc32cUpdate(0, &s8Buffer[(size_t)i * u32ChunkSize],
+                          psTag->u32Size) == psTag->u32Crc) ?
+                                    VERIFY_CHUNK_GOOD : VERIFY_CHUNK_BAD;
+    }
+}
@@ -0,0 +1,137 @@
+/**
+ * @file recordverifier.h
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains the verification of record data against the
+ * CRC32C tags of its chunks
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+#ifndef RECORDVERIFIER_H
+#define RECORDVERIFIER_H
+
+///****************
+/// Includes
+///****************
+
+#include "../Common/rf_api_internal.h"
+
+#include "defines.h"
+#include "crc32c.h"
+#include "stripereader.h"
+
+/** CRC32C tag of a chunk of record data                                    */
+typedef struct
+{
+    /** Data stream offset of the chunk                 */
+    ULONG64 u64Offset;
+
+    /** Size of the chunk                               */
+    UINT32 u32Size;
+
+    /** CRC32C of the chunk                             */
+    UINT32 u32Crc;
+} strCrcChunkTag;
+
+/** @class cRecordVerifier
+ * @brief This class provides support APIs to check a record against its <!--
+ * --> CRC32C log. The record is read once in batches of chunks, the <!--
+ * --> worker threads check a batch while the next one is read
+ */
+class cRecordVerifier
+{
+    /** Record data file path without the file count, or stripe manifest */
+    SINT8 strRecordPath[MAX_NAME_LEN * 3];
+
+    /** Record is striped, read by its manifest            */
+    bool bStriped;
+
+    /** Chunk size in bytes                                 */
+    UINT32 u32ChunkSize;
+
+    /** Chunk tags of the CRC32C log                        */
+    std::vector<strCrcChunkTag> vChunkTags;
+
+    /** Verification result per chunk                       */
+    std::vector<UINT8> vChunkResult;
+
+public:
+    /** @fn cRecordVerifier()
+     * @brief This constructor function is to initialize the class member variables
+     */
+    cRecordVerifier();
+
+    /** @fn STATUS openCrcLog(const SINT8 *s8CrcLogFile)
+     * @brief This function is to read the chunk tags of a CRC32C log
+     * @param [in] s8CrcLogFile [const SINT8 *] - CRC32C log file
+     * @return SINT32 value
+     */
+    STATUS openCrcLog(const SINT8 *s8CrcLogFile);
+
+    /** @fn STATUS verifyRecord(UINT32 u32NumOfThreads, strRecordVerifyStatus *psVerifyStatus)
+     * @brief This function is to check the record data against the chunk tags
+     * @param [in] u32NumOfThreads [UINT32] - Worker threads, 0 for one <!--
+     * --> per processor core
+     * @param [out] psVerifyStatus [strRecordVerifyStatus *] - Verification <!--
+     * --> status
+     * @return SINT32 value
+     */
+    STATUS verifyRecord(UINT32 u32NumOfThreads,
+                        strRecordVerifyStatus *psVerifyStatus);
+
+private:
+    /** @fn void verifyChunks(const SINT8 *s8Buffer, UINT32 u32FirstChunk, UINT32 u32NumOfChunks, UINT32 u32Thread, UINT32 u32NumOfThreads)
+     * @brief This function is a worker thread process to check the <!--
+     * --> chunks of a batch, every u32NumOfThreads-th from u32Thread
+     * @param [in] s8Buffer [const SINT8 *] - Record data of the batch
+     * @param [in] u32FirstChunk [UINT32] - First chunk of the batch
+     * @param [in] u32NumOfChunks [UINT32] - Chunks in the batch
+     * @param [in] u32Thread [UINT32] - Worker thread index
+     * @param [in] u32NumOfThreads [UINT32] - Worker threads
+     */
+    void verifyChunks(const SINT8 *s8Buffer, UINT32 u32FirstChunk,
+                      UINT32 u32NumOfChunks, UINT32 u32Thread,
+                      UINT32 u32NumOfThreads);
+};
+
+#endif // RECORDVERIFIER_H
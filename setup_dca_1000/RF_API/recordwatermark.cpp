@@ -0,0 +1,175 @@
+/**
+ * @file recordwatermark.cpp
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains the class to publish the committed data of a
+ * record in progress for its readers
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+///****************
+/// Includes
+///****************
+
+#include "recordwatermark.h"
+
+#include "extern.h"
+
+/** @fn cRecordWatermark::cRecordWatermark()
+ * @brief This constructor function is to initialize the class member <!--
+ * --> variables
+ */
+cRecordWatermark::cRecordWatermark()
+{
+    strRecordFilePath[0] = '\0';
+    u64FrameSize = 0;
+    u32FirstFileCount = 0;
+    u64FirstFileOffset = 0;
+    u64PublishedOffset = 0;
+    bPublished = false;
+    bPublishError = false;
+}
+
+/** @fn void cRecordWatermark::open(const SINT8 *s8FilePath, ULONG64 u64FrameSizeArg)
+ * @brief This function is to publish an empty watermark for a record <!--
+ * --> process. The watermark file name is appended to the path
+ * @param [in] s8FilePath [const SINT8 *] - Record data file path <!--
+ * --> without the file count
+ * @param [in] u64FrameSizeArg [ULONG64] - Recorded bytes of a frame, <!--
+ * --> 0 if the frames are not known
+ */
+void cRecordWatermark::open(const SINT8 *s8FilePath, ULONG64 u64FrameSizeArg)
+{
+    snprintf(strRecordFilePath, sizeof(strRecordFilePath), "%s", s8FilePath);
+    u64FrameSize = u64FrameSizeArg;
+    u32FirstFileCount = 0;
+    u64FirstFileOffset = 0;
+    u64PublishedOffset = 0;
+    bPublished = false;
+    bPublishError = false;
+
+    /** Watermark of an earlier record of the same path is replaced */
+    publish(0, 0, 0, false);
+}
+
+/** @fn void cRecordWatermark::setFirstFile(UINT32 u32FileCount, ULONG64 u64Offset)
+ * @brief This function is to set the oldest record file kept, the <!--
+ * --> older ones are written over by the retention ring
+ * @param [in] u32FileCount [UINT32] - Data file count
+ * @param [in] u64Offset [ULONG64] - Record data offset of the file
+ */
+void cRecordWatermark::setFirstFile(UINT32 u32FileCount, ULONG64 u64Offset)
+{
+    u32FirstFileCount = u32FileCount;
+    u64FirstFileOffset = u64Offset;
+}
+
+/** @fn void cRecordWatermark::publish(UINT32 u32FileCount, ULONG64 u64FileBytes, ULONG64 u64Offset, bool bComplete)
+ * @brief This function is to publish the committed data, the <!--
+ * --> watermark file is written in place of the previous one at once
+ * @param [in] u32FileCount [UINT32] - Data file count of the record <!--
+ * --> file written last
+ * @param [in] u64FileBytes [ULONG64] - Bytes committed in the file
+ * @param [in] u64Offset [ULONG64] - Record data offset of the end of <!--
+ * --> the committed data
+ * @param [in] bComplete [bool] - Record is stopped, nothing follows
+ */
+void cRecordWatermark::publish(UINT32 u32FileCount, ULONG64 u64FileBytes,
+                               ULONG64 u64Offset, bool bComplete)
+{
+    SINT8 s8WatermarkFileName[MAX_NAME_LEN * 3];
+    SINT8 s8TempFileName[MAX_NAME_LEN * 3];
+    FILE *pWatermarkFile = NULL;
+
+    /** Buffers of dropped frames only leave the watermark where it is */
+    if(bPublished && (!bComplete) && (u64Offset == u64PublishedOffset))
+        return;
+
+    snprintf(s8WatermarkFileName, sizeof(s8WatermarkFileName), "%s%s",
+             strRecordFilePath, WATERMARK_FILE_NAME);
+    snprintf(s8TempFileName, sizeof(s8TempFileName), "%s%s%s",
+             strRecordFilePath, WATERMARK_FILE_NAME, WATERMARK_TEMP_EXTENSION);
+
+    /** Readers poll the watermark, the record goes on without it */
+    pWatermarkFile = fopen(s8TempFileName, "w");
+    if(pWatermarkFile == NULL)
+    {
+        reportPublishError();
+        return;
+    }
+
+    fprintf(pWatermarkFile, "%s\nRecord files,%s\nFrame size (bytes),%llu\n"
+            "First file count,%u\nFirst file record offset (bytes),%llu\n"
+            "File count,%u\nFile committed size (bytes),%llu\n"
+            "Committed record offset (bytes),%llu\nState,%s\n",
+            WATERMARK_TITLE, strRecordFilePath, u64FrameSize,
+            u32FirstFileCount, u64FirstFileOffset, u32FileCount,
+            u64FileBytes, u64Offset,
+            bComplete ? WATERMARK_STATE_COMPLETE : WATERMARK_STATE_RECORDING);
+    fclose(pWatermarkFile);
+
+#ifdef _WIN32
+    remove(s8WatermarkFileName);
+#endif
+    if(rename(s8TempFileName, s8WatermarkFileName) != 0)
+    {
+        reportPublishError();
+        return;
+    }
+
+    u64PublishedOffset = u64Offset;
+    bPublished = true;
+}
+
+/** @fn void cRecordWatermark::reportPublishError()
+ * @brief This function is to report a failed publish of the watermark <!--
+ * --> once for a record process
+ */
+void cRecordWatermark::reportPublishError()
+{
+    if(bPublishError)
+        return;
+
+    bPublishError = true;
+    RFDCARD_Callback(CMD_CODE_SYSTEM_ASYNC_STATUS, STS_REC_FILE_CREATION_ERR);
+}
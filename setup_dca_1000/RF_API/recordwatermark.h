@@ -0,0 +1,136 @@
+/**
+ * @file recordwatermark.h
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains the class to publish the committed data of a
+ * record in progress for its readers
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+#ifndef RECORDWATERMARK_H
+#define RECORDWATERMARK_H
+
+///****************
+/// Includes
+///****************
+
+#include "../Common/rf_api_internal.h"
+
+#include "defines.h"
+
+/** @class cRecordWatermark
+ * @brief This class provides support APIs to publish the committed data <!--
+ * --> of a record in progress. The watermark file gives the record file <!--
+ * --> and the bytes written in it so far, the record data before the <!--
+ * --> watermark is final and can be read while the record goes on
+ */
+class cRecordWatermark
+{
+    /** Record data file path without the file count        */
+    SINT8 strRecordFilePath[MAX_NAME_LEN * 2];
+
+    /** Recorded bytes of a frame, 0 if the frames are not known */
+    ULONG64 u64FrameSize;
+
+    /** Data file count of the oldest record file kept      */
+    UINT32 u32FirstFileCount;
+
+    /** Record data offset of the oldest record file kept   */
+    ULONG64 u64FirstFileOffset;
+
+    /** Record data offset published last                   */
+    ULONG64 u64PublishedOffset;
+
+    /** Watermark published at least once                   */
+    bool bPublished;
+
+    /** Failed publish of the watermark is reported         */
+    bool bPublishError;
+
+public:
+    /** @fn cRecordWatermark()
+     * @brief This constructor function is to initialize the class member <!--
+     * --> variables
+     */
+    cRecordWatermark();
+
+    /** @fn void open(const SINT8 *s8FilePath, ULONG64 u64FrameSizeArg)
+     * @brief This function is to publish an empty watermark for a record <!--
+     * --> process. The watermark file name is appended to the path
+     * @param [in] s8FilePath [const SINT8 *] - Record data file path <!--
+     * --> without the file count
+     * @param [in] u64FrameSizeArg [ULONG64] - Recorded bytes of a frame, <!--
+     * --> 0 if the frames are not known
+     */
+    void open(const SINT8 *s8FilePath, ULONG64 u64FrameSizeArg);
+
+    /** @fn void setFirstFile(UINT32 u32FileCount, ULONG64 u64Offset)
+     * @brief This function is to set the oldest record file kept, the <!--
+     * --> older ones are written over by the retention ring
+     * @param [in] u32FileCount [UINT32] - Data file count
+     * @param [in] u64Offset [ULONG64] - Record data offset of the file
+     */
+    void setFirstFile(UINT32 u32FileCount, ULONG64 u64Offset);
+
+    /** @fn void publish(UINT32 u32FileCount, ULONG64 u64FileBytes, ULONG64 u64Offset, bool bComplete)
+     * @brief This function is to publish the committed data, the <!--
+     * --> watermark file is written in place of the previous one at once
+     * @param [in] u32FileCount [UINT32] - Data file count of the record <!--
+     * --> file written last
+     * @param [in] u64FileBytes [ULONG64] - Bytes committed in the file
+     * @param [in] u64Offset [ULONG64] - Record data offset of the end of <!--
+     * --> the committed data
+     * @param [in] bComplete [bool] - Record is stopped, nothing follows
+     */
+    void publish(UINT32 u32FileCount, ULONG64 u64FileBytes, ULONG64 u64Offset,
+                 bool bComplete);
+
+private:
+    /** @fn void reportPublishError()
+     * @brief This function is to report a failed publish of the <!--
+     * --> watermark once for a record process
+     */
+    void reportPublishError();
+};
+
+#endif // RECORDWATERMARK_H
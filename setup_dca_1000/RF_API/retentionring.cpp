@@ -0,0 +1,455 @@
+/**
+ * @file retentionring.cpp
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains the class to keep the record files of a
+ * bounded-disk record as a ring of segments
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+///****************
+/// Includes
+///****************
+
+#include "retentionring.h"
+
+#include "extern.h"
+
+#include <chrono>
+#include <cerrno>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+/** @fn cRetentionRing::cRetentionRing()
+ * @brief This constructor function is to initialize the class member <!--
+ * --> variables
+ */
+cRetentionRing::cRetentionRing()
+{
+    strRecordFilePath[0] = '\0';
+    psSegments = NULL;
+    u32Head = 0;
+    u32NumOfSegments = 0;
+    u32MaxSegments = MAX_RETENTION_SEGMENTS;
+    u64MaxAgeUs = 0;
+    u32MaxFileSize = 0;
+    u32RetentionSize = 0;
+    u32RetentionAge = 0;
+    u64FrameSize = 0;
+    u32FrameStartIdx = 0;
+    u32FrameDecimation = 1;
+    u32NumOfRecycled = 0;
+    u32NumOfDeleted = 0;
+    u32NumOfDroppedYoung = 0;
+    bRecycled = false;
+    bWriteError = false;
+    s8ZeroBuf = NULL;
+}
+
+/** @fn cRetentionRing::~cRetentionRing()
+ * @brief This destructor function is to free the segments
+ */
+cRetentionRing::~cRetentionRing()
+{
+    if(psSegments != NULL)
+        free(psSegments);
+    if(s8ZeroBuf != NULL)
+        free(s8ZeroBuf);
+}
+
+/** @fn bool cRetentionRing::setConfig(const SINT8 *s8FilePath, UINT32 u32MaxFileSizeArg, UINT32 u32RetentionSizeArg, UINT32 u32RetentionAgeArg)
+ * @brief This function is to empty the ring for a record process and <!--
+ * --> set its bounds. The file count and extension are appended to <!--
+ * --> the path
+ * @param [in] s8FilePath [const SINT8 *] - File path without the count
+ * @param [in] u32MaxFileSizeArg [UINT32] - Maximum file size
+ * @param [in] u32RetentionSizeArg [UINT32] - Total size in MB, 0 if <!--
+ * --> unbounded
+ * @param [in] u32RetentionAgeArg [UINT32] - Age in seconds, 0 if <!--
+ * --> unbounded
+ * @return boolean value, false if the path is too long
+ */
+bool cRetentionRing::setConfig(const SINT8 *s8FilePath,
+                               UINT32 u32MaxFileSizeArg,
+                               UINT32 u32RetentionSizeArg,
+                               UINT32 u32RetentionAgeArg)
+{
+    ULONG64 u64NumOfFiles = 0;
+
+    if(psSegments == NULL)
+        psSegments = (strRetentionSegment *)malloc(MAX_RETENTION_SEGMENTS *
+                                                sizeof(strRetentionSegment));
+    if(s8ZeroBuf == NULL)
+        s8ZeroBuf = (SINT8 *)calloc(RETENTION_ZERO_BUF_SIZE, sizeof(SINT8));
+    if((psSegments == NULL) || (s8ZeroBuf == NULL))
+        return false;
+
+    if(snprintf(strRecordFilePath, sizeof(strRecordFilePath), "%s",
+                s8FilePath) >= (SINT32)sizeof(strRecordFilePath))
+        return false;
+    u32MaxFileSize = u32MaxFileSizeArg;
+    u32RetentionSize = u32RetentionSizeArg;
+    u32RetentionAge = u32RetentionAgeArg;
+    u64MaxAgeUs = (ULONG64)u32RetentionAgeArg * RETENTION_AGE_US_PER_SEC;
+
+    /** Whole record files fit in the total size, the open one included */
+    u32MaxSegments = MAX_RETENTION_SEGMENTS;
+    if(u32RetentionSizeArg > 0)
+    {
+        u64NumOfFiles = ((ULONG64)u32RetentionSizeArg * RETENTION_BYTES_PER_MB) /
+                        u32MaxFileSizeArg;
+        if(u64NumOfFiles < u32MaxSegments)
+            u32MaxSegments = (UINT32)u64NumOfFiles;
+        if(u32MaxSegments < MIN_RECORD_RETENTION_FILES)
+            u32MaxSegments = MIN_RECORD_RETENTION_FILES;
+    }
+
+    u32Head = 0;
+    u32NumOfSegments = 0;
+    u64FrameSize = 0;
+    u32FrameStartIdx = 0;
+    u32FrameDecimation = 1;
+    u32NumOfRecycled = 0;
+    u32NumOfDeleted = 0;
+    u32NumOfDroppedYoung = 0;
+    bRecycled = false;
+    bWriteError = false;
+
+    return true;
+}
+
+/** @fn void cRetentionRing::setFrameLayout(ULONG64 u64FrameSizeArg, UINT32 u32FrameStartIdxArg, UINT32 u32FrameDecimationArg)
+ * @brief This function is to set the frames of the record data listed <!--
+ * --> in the segment index
+ * @param [in] u64FrameSizeArg [ULONG64] - Recorded bytes of a frame, <!--
+ * --> 0 if the frames are not known
+ * @param [in] u32FrameStartIdxArg [UINT32] - Frame index of the first <!--
+ * --> recorded frame
+ * @param [in] u32FrameDecimationArg [UINT32] - Frame index increment
+ */
+void cRetentionRing::setFrameLayout(ULONG64 u64FrameSizeArg,
+                                    UINT32 u32FrameStartIdxArg,
+                                    UINT32 u32FrameDecimationArg)
+{
+    u64FrameSize = u64FrameSizeArg;
+    u32FrameStartIdx = u32FrameStartIdxArg;
+    u32FrameDecimation = u32FrameDecimationArg;
+}
+
+/** @fn FILE *cRetentionRing::openSegment(UINT32 u32FileCount, ULONG64 u64Offset)
+ * @brief This function is to open the next record file. The oldest <!--
+ * --> record file is renamed to it once the ring is full or the file <!--
+ * --> is older than the age, else a new file is preallocated
+ * @param [in] u32FileCount [UINT32] - Data file count
+ * @param [in] u64Offset [ULONG64] - Record data offset of the file
+ * @return FILE * value, NULL on failure
+ */
+FILE *cRetentionRing::openSegment(UINT32 u32FileCount, ULONG64 u64Offset)
+{
+    SINT8 s8FileName[MAX_NAME_LEN * 3];
+    FILE *pFile = NULL;
+    ULONG64 u64NowUs = (ULONG64)std::chrono::duration_cast<
+                std::chrono::microseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count();
+
+    getFileName(u32FileCount, s8FileName, sizeof(s8FileName));
+    dropOldSegments(s8FileName, u64NowUs);
+
+    /** A recycled file is written over without truncation, which keeps
+     *  its disk space. A new file gets the space of the maximum file
+     *  size at once, the file size follows the data written            */
+    if(bRecycled)
+    {
+        pFile = fopen(s8FileName, "rb+");
+    }
+    else
+    {
+        pFile = fopen(s8FileName, "wb+");
+#ifndef _WIN32
+        /** File systems without preallocation are not an error        */
+        if((pFile != NULL) &&
+           (fallocate(fileno(pFile), FALLOC_FL_KEEP_SIZE, 0,
+                      u32MaxFileSize) != 0) && (errno != EOPNOTSUPP))
+            reportWriteError();
+#endif
+    }
+    if(pFile == NULL)
+        return NULL;
+
+    strRetentionSegment *psSegment = &psSegments[(u32Head + u32NumOfSegments) %
+                                                 MAX_RETENTION_SEGMENTS];
+    psSegment->u32FileCount = u32FileCount;
+    psSegment->u64Offset = u64Offset;
+    psSegment->u64Size = 0;
+    psSegment->u64StartTimeUs = u64NowUs;
+    psSegment->u64EndTimeUs = 0;
+    u32NumOfSegments ++;
+
+    writeIndex();
+    return pFile;
+}
+
+/** @fn bool cRetentionRing::writeHole(FILE *pFile, UINT32 u32Size)
+ * @brief This function is to leave a hole in the open record file, <!--
+ * --> the stale data of a recycled file is written over with zeros
+ * @param [in] pFile [FILE *] - Open record file
+ * @param [in] u32Size [UINT32] - Hole size
+ * @return boolean value - true if the hole is seeked over and not <!--
+ * --> written yet
+ */
+bool cRetentionRing::writeHole(FILE *pFile, UINT32 u32Size)
+{
+    UINT32 u32Chunk = 0;
+
+    if(!bRecycled)
+    {
+        fseek(pFile, u32Size, SEEK_CUR);
+        return true;
+    }
+
+    while(u32Size > 0)
+    {
+        u32Chunk = (u32Size > RETENTION_ZERO_BUF_SIZE) ?
+                                    RETENTION_ZERO_BUF_SIZE : u32Size;
+        if(fwrite((const SINT8 *)s8ZeroBuf, 1, u32Chunk, pFile) != u32Chunk)
+        {
+            reportWriteError();
+            break;
+        }
+        u32Size -= u32Chunk;
+    }
+    return false;
+}
+
+/** @fn void cRetentionRing::closeSegment(FILE *pFile, ULONG64 u64Size)
+ * @brief This function is to cut the open record file to its data <!--
+ * --> and update the segment index, the file is closed by the caller
+ * @param [in] pFile [FILE *] - Open record file
+ * @param [in] u64Size [ULONG64] - Bytes written in the file
+ */
+void cRetentionRing::closeSegment(FILE *pFile, ULONG64 u64Size)
+{
+    if(u32NumOfSegments == 0)
+        return;
+
+    /** Data of the older segment is left after the end of a recycled
+     *  file                                                          */
+    if(bRecycled)
+    {
+        fflush(pFile);
+#ifdef _WIN32
+        _chsize_s(_fileno(pFile), u64Size);
+#else
+        if(ftruncate(fileno(pFile), u64Size) != 0)
+            RFDCARD_Callback(CMD_CODE_SYSTEM_ASYNC_STATUS,
+                             STS_REC_FILE_CREATION_ERR);
+#endif
+    }
+
+    strRetentionSegment *psSegment = &psSegments[(u32Head + u32NumOfSegments
+                                        - 1) % MAX_RETENTION_SEGMENTS];
+    psSegment->u64Size = u64Size;
+    psSegment->u64EndTimeUs = (ULONG64)std::chrono::duration_cast<
+                std::chrono::microseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count();
+    bRecycled = false;
+
+    writeIndex();
+}
+
+/** @fn bool cRetentionRing::getFirstSegment(UINT32 *pu32FileCount, ULONG64 *pu64Offset)
+ * @brief This function is to get the oldest record file kept
+ * @param [out] pu32FileCount [UINT32 *] - Data file count
+ * @param [out] pu64Offset [ULONG64 *] - Record data offset of the file
+ * @return boolean value, false if the ring is empty
+ */
+bool cRetentionRing::getFirstSegment(UINT32 *pu32FileCount,
+                                     ULONG64 *pu64Offset)
+{
+    if(u32NumOfSegments == 0)
+        return false;
+
+    *pu32FileCount = psSegments[u32Head].u32FileCount;
+    *pu64Offset = psSegments[u32Head].u64Offset;
+    return true;
+}
+
+/** @fn void cRetentionRing::getFileName(UINT32 u32FileCount, SINT8 *s8FileName, UINT32 u32FileNameSize)
+ * @brief This function is to get the name of a record file
+ * @param [in] u32FileCount [UINT32] - Data file count
+ * @param [out] s8FileName [SINT8 *] - File name
+ * @param [in] u32FileNameSize [UINT32] - Size of the file name buffer
+ */
+void cRetentionRing::getFileName(UINT32 u32FileCount, SINT8 *s8FileName,
+                                 UINT32 u32FileNameSize)
+{
+    snprintf(s8FileName, u32FileNameSize, "%s%u%s", strRecordFilePath,
+             u32FileCount, REC_DATA_FILE_EXTENSION);
+}
+
+/** @fn void cRetentionRing::reportWriteError()
+ * @brief This function is to report a failed write or preallocation of <!--
+ * --> the record files once for a record process
+ */
+void cRetentionRing::reportWriteError()
+{
+    if(bWriteError)
+        return;
+
+    bWriteError = true;
+    RFDCARD_Callback(CMD_CODE_SYSTEM_ASYNC_STATUS, STS_REC_FILE_CREATION_ERR);
+}
+
+/** @fn void cRetentionRing::dropOldSegments(const SINT8 *s8FileName, ULONG64 u64NowUs)
+ * @brief This function is to drop the segments out of the bounds, <!--
+ * --> the first one is renamed to the next record file and the <!--
+ * --> others are deleted
+ * @param [in] s8FileName [const SINT8 *] - Next record file
+ * @param [in] u64NowUs [ULONG64] - Time in micro seconds since epoch
+ */
+void cRetentionRing::dropOldSegments(const SINT8 *s8FileName, ULONG64 u64NowUs)
+{
+    SINT8 s8OldFileName[MAX_NAME_LEN * 3];
+    strRetentionSegment *psOldest = NULL;
+
+    bRecycled = false;
+    while(u32NumOfSegments > 0)
+    {
+        psOldest = &psSegments[u32Head];
+
+        /** The ring keeps one segment for the next record file         */
+        if((u32NumOfSegments < u32MaxSegments) &&
+           ((u64MaxAgeUs == 0) ||
+            ((psOldest->u64EndTimeUs + u64MaxAgeUs) >= u64NowUs)))
+            break;
+
+        /** Without a total size the segment count bounds an age that
+         *  holds more files than the ring, reported once            */
+        if((u32RetentionSize == 0) && (u64MaxAgeUs > 0) &&
+           ((psOldest->u64EndTimeUs + u64MaxAgeUs) >= u64NowUs))
+        {
+            if(u32NumOfDroppedYoung == 0)
+                RFDCARD_Callback(CMD_CODE_SYSTEM_ASYNC_STATUS,
+                                 STS_REC_RETENTION_AGE_ERR);
+            u32NumOfDroppedYoung ++;
+        }
+
+        getFileName(psOldest->u32FileCount, s8OldFileName,
+                    sizeof(s8OldFileName));
+        if((!bRecycled) && (rename(s8OldFileName, s8FileName) == 0))
+        {
+            bRecycled = true;
+            u32NumOfRecycled ++;
+        }
+        else
+        {
+            remove(s8OldFileName);
+            u32NumOfDeleted ++;
+        }
+        u32Head = (u32Head + 1) % MAX_RETENTION_SEGMENTS;
+        u32NumOfSegments --;
+    }
+}
+
+/** @fn void cRetentionRing::writeIndex()
+ * @brief This function is to write the segment index in place of the <!--
+ * --> previous one at once
+ */
+void cRetentionRing::writeIndex()
+{
+    SINT8 s8IndexFileName[MAX_NAME_LEN * 3];
+    SINT8 s8TempFileName[MAX_NAME_LEN * 3];
+    strRetentionSegment *psSegment = NULL;
+    FILE *pIndexFile = NULL;
+
+    snprintf(s8IndexFileName, sizeof(s8IndexFileName), "%s%s",
+             strRecordFilePath, SEGMENT_INDEX_FILE_NAME);
+    snprintf(s8TempFileName, sizeof(s8TempFileName), "%s%s%s",
+             strRecordFilePath, SEGMENT_INDEX_FILE_NAME,
+             SEGMENT_INDEX_TEMP_EXTENSION);
+
+    /** Index is advisory, the record goes on without it */
+    pIndexFile = fopen(s8TempFileName, "w");
+    if(pIndexFile == NULL)
+        return;
+
+    fprintf(pIndexFile, "%s\nRecord files,%s\nRetention size (MB),%u\n"
+            "Retention age (s),%u\nFrame size (bytes),%llu\n"
+            "Recycled files,%u\nDeleted files,%u\n"
+            "Files dropped before the age,%u\n", SEGMENT_INDEX_TITLE,
+            strRecordFilePath, u32RetentionSize, u32RetentionAge,
+            u64FrameSize, u32NumOfRecycled, u32NumOfDeleted,
+            u32NumOfDroppedYoung);
+    fprintf(pIndexFile, "File count,Record offset (bytes),Size (bytes),"
+            "Start time (us since epoch),End time (us since epoch),"
+            "First frame,Last frame\n");
+
+    /** Open segment has no size and end time yet, frames are listed once
+     *  the data of the segment is known                                 */
+    for(UINT32 i = 0; i < u32NumOfSegments; i ++)
+    {
+        psSegment = &psSegments[(u32Head + i) % MAX_RETENTION_SEGMENTS];
+        fprintf(pIndexFile, "%u,%llu,%llu,%llu,%llu", psSegment->u32FileCount,
+                psSegment->u64Offset, psSegment->u64Size,
+                psSegment->u64StartTimeUs, psSegment->u64EndTimeUs);
+        if((u64FrameSize > 0) && (psSegment->u64Size > 0))
+            fprintf(pIndexFile, ",%llu,%llu\n", u32FrameStartIdx +
+                    (psSegment->u64Offset / u64FrameSize) * u32FrameDecimation,
+                    u32FrameStartIdx + ((psSegment->u64Offset +
+                    psSegment->u64Size - 1) / u64FrameSize) *
+                    u32FrameDecimation);
+        else
+            fprintf(pIndexFile, ",,\n");
+    }
+    fclose(pIndexFile);
+
+#ifdef _WIN32
+    remove(s8IndexFileName);
+#endif
+    rename(s8TempFileName, s8IndexFileName);
+}
@@ -0,0 +1,250 @@
+/**
+ * @file retentionring.h
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains the class to keep the record files of a
+ * bounded-disk record as a ring of segments
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+#ifndef RETENTIONRING_H
+#define RETENTIONRING_H
+
+///****************
+/// Includes
+///****************
+
+#include "../Common/rf_api_internal.h"
+
+#include "defines.h"
+
+/** Record file of the retention ring                                        */
+typedef struct
+{
+    /** Data file count of the record file                  */
+    UINT32 u32FileCount;
+
+    /** Record data offset of the first byte in the file    */
+    ULONG64 u64Offset;
+
+    /** Bytes written in the file, 0 while it is open       */
+    ULONG64 u64Size;
+
+    /** Time of the first write in micro seconds since epoch */
+    ULONG64 u64StartTimeUs;
+
+    /** Time of the file close in micro seconds since epoch */
+    ULONG64 u64EndTimeUs;
+} strRetentionSegment;
+
+/** @class cRetentionRing
+ * @brief This class provides support APIs to keep the record files of a <!--
+ * --> record within a total size and age. The oldest record file is <!--
+ * --> renamed to the next one and written over in place, which reuses <!--
+ * --> its disk space, and the segment index lists the record data and <!--
+ * --> the frames held by each file (inline processing)
+ */
+class cRetentionRing
+{
+    /** Record data file path without the file count        */
+    SINT8 strRecordFilePath[MAX_NAME_LEN * 2];
+
+    /** Segments, the oldest at the head                    */
+    strRetentionSegment *psSegments;
+
+    /** Index of the oldest segment                         */
+    UINT32 u32Head;
+
+    /** Segments in the ring, the last one is open          */
+    UINT32 u32NumOfSegments;
+
+    /** Segments kept by the total size                     */
+    UINT32 u32MaxSegments;
+
+    /** Segments older than this are dropped, 0 to keep them */
+    ULONG64 u64MaxAgeUs;
+
+    /** Maximum file size of the record files               */
+    UINT32 u32MaxFileSize;
+
+    /** Total size of the record files in MB, 0 if unbounded */
+    UINT32 u32RetentionSize;
+
+    /** Age of the record files in seconds, 0 if unbounded  */
+    UINT32 u32RetentionAge;
+
+    /** Recorded bytes of a frame, 0 if the frames are not known */
+    ULONG64 u64FrameSize;
+
+    /** Frame index of the first recorded frame             */
+    UINT32 u32FrameStartIdx;
+
+    /** Frame index increment of the recorded frames        */
+    UINT32 u32FrameDecimation;
+
+    /** Record files written over in place                  */
+    UINT32 u32NumOfRecycled;
+
+    /** Record files deleted by the age                     */
+    UINT32 u32NumOfDeleted;
+
+    /** Record files dropped by the segment count before the age */
+    UINT32 u32NumOfDroppedYoung;
+
+    /** Open record file holds the data of an older segment */
+    bool bRecycled;
+
+    /** Failed write of the record files is reported        */
+    bool bWriteError;
+
+    /** Zeros written over the holes of a recycled file     */
+    SINT8 *s8ZeroBuf;
+
+public:
+    /** @fn cRetentionRing()
+     * @brief This constructor function is to initialize the class member <!--
+     * --> variables
+     */
+    cRetentionRing();
+
+    /** @fn ~cRetentionRing()
+     * @brief This destructor function is to free the segments
+     */
+    ~cRetentionRing();
+
+    /** @fn bool setConfig(const SINT8 *s8FilePath, UINT32 u32MaxFileSizeArg, UINT32 u32RetentionSizeArg, UINT32 u32RetentionAgeArg)
+     * @brief This function is to empty the ring for a record process and <!--
+     * --> set its bounds. The file count and extension are appended to <!--
+     * --> the path
+     * @param [in] s8FilePath [const SINT8 *] - File path without the count
+     * @param [in] u32MaxFileSizeArg [UINT32] - Maximum file size
+     * @param [in] u32RetentionSizeArg [UINT32] - Total size in MB, 0 if <!--
+     * --> unbounded
+     * @param [in] u32RetentionAgeArg [UINT32] - Age in seconds, 0 if <!--
+     * --> unbounded
+     * @return boolean value, false if the path is too long
+     */
+    bool setConfig(const SINT8 *s8FilePath, UINT32 u32MaxFileSizeArg,
+                   UINT32 u32RetentionSizeArg, UINT32 u32RetentionAgeArg);
+
+    /** @fn void setFrameLayout(ULONG64 u64FrameSizeArg, UINT32 u32FrameStartIdxArg, UINT32 u32FrameDecimationArg)
+     * @brief This function is to set the frames of the record data listed <!--
+     * --> in the segment index
+     * @param [in] u64FrameSizeArg [ULONG64] - Recorded bytes of a frame, <!--
+     * --> 0 if the frames are not known
+     * @param [in] u32FrameStartIdxArg [UINT32] - Frame index of the first <!--
+     * --> recorded frame
+     * @param [in] u32FrameDecimationArg [UINT32] - Frame index increment
+     */
+    void setFrameLayout(ULONG64 u64FrameSizeArg, UINT32 u32FrameStartIdxArg,
+                        UINT32 u32FrameDecimationArg);
+
+    /** @fn FILE *openSegment(UINT32 u32FileCount, ULONG64 u64Offset)
+     * @brief This function is to open the next record file. The oldest <!--
+     * --> record file is renamed to it once the ring is full or the file <!--
+     * --> is older than the age, else a new file is preallocated
+     * @param [in] u32FileCount [UINT32] - Data file count
+     * @param [in] u64Offset [ULONG64] - Record data offset of the file
+     * @return FILE * value, NULL on failure
+     */
+    FILE *openSegment(UINT32 u32FileCount, ULONG64 u64Offset);
+
+    /** @fn bool writeHole(FILE *pFile, UINT32 u32Size)
+     * @brief This function is to leave a hole in the open record file, <!--
+     * --> the stale data of a recycled file is written over with zeros
+     * @param [in] pFile [FILE *] - Open record file
+     * @param [in] u32Size [UINT32] - Hole size
+     * @return boolean value - true if the hole is seeked over and not <!--
+     * --> written yet
+     */
+    bool writeHole(FILE *pFile, UINT32 u32Size);
+
+    /** @fn void closeSegment(FILE *pFile, ULONG64 u64Size)
+     * @brief This function is to cut the open record file to its data <!--
+     * --> and update the segment index, the file is closed by the caller
+     * @param [in] pFile [FILE *] - Open record file
+     * @param [in] u64Size [ULONG64] - Bytes written in the file
+     */
+    void closeSegment(FILE *pFile, ULONG64 u64Size);
+
+    /** @fn bool getFirstSegment(UINT32 *pu32FileCount, ULONG64 *pu64Offset)
+     * @brief This function is to get the oldest record file kept
+     * @param [out] pu32FileCount [UINT32 *] - Data file count
+     * @param [out] pu64Offset [ULONG64 *] - Record data offset of the file
+     * @return boolean value, false if the ring is empty
+     */
+    bool getFirstSegment(UINT32 *pu32FileCount, ULONG64 *pu64Offset);
+
+private:
+    /** @fn void getFileName(UINT32 u32FileCount, SINT8 *s8FileName, UINT32 u32FileNameSize)
+     * @brief This function is to get the name of a record file
+     * @param [in] u32FileCount [UINT32] - Data file count
+     * @param [out] s8FileName [SINT8 *] - File name
+     * @param [in] u32FileNameSize [UINT32] - Size of the file name buffer
+     */
+    void getFileName(UINT32 u32FileCount, SINT8 *s8FileName,
+                     UINT32 u32FileNameSize);
+
+    /** @fn void reportWriteError()
+     * @brief This function is to report a failed write or preallocation <!--
+     * --> of the record files once for a record process
+     */
+    void reportWriteError();
+
+    /** @fn void dropOldSegments(const SINT8 *s8FileName, ULONG64 u64NowUs)
+     * @brief This function is to drop the segments out of the bounds, <!--
+     * --> the first one is renamed to the next record file and the <!--
+     * --> others are deleted
+     * @param [in] s8FileName [const SINT8 *] - Next record file
+     * @param [in] u64NowUs [ULONG64] - Time in micro seconds since epoch
+     */
+    void dropOldSegments(const SINT8 *s8FileName, ULONG64 u64NowUs);
+
+    /** @fn void writeIndex()
+     * @brief This function is to write the segment index in place of the <!--
+     * --> previous one at once
+     */
+    void writeIndex();
+};
+
+#endif //RETENTIONRING_H
@@ -62,6 +62,15 @@
 #include "commandsprotocol.h"
 #include "configdatarecv.h"
 #include "recorddatarecv.h"
+#include "capturetimers.h"
+#include "latencyhist.h"
+#include "cmdpipeline.h"
+#include "multiportrecv.h"
+#include "sharedportdemux.h"
+#include "sockrecv.h"
+#include "stripereader.h"
+#include "recordtailreader.h"
+#include "recordverifier.h"
 #include "../Common/Validate_Utils/validate_params.h"
 #include "../Common/Osal_Utils/osal.h"
 
@@ -77,6 +86,12 @@ strRFDCCard_SockInfo sRFDCCard_SockInfo;
 /** Record process - Inline stats                       */
 strRFDCCard_InlineProcStats sRFDCCard_InlineStats;
 
+/** Record process - Latency histograms                 */
+strRFDCCard_LatencyStats sRFDCCard_LatencyStats;
+
+/** Record process - Test pattern verification stats    */
+strRFDCCard_PatternStats sRFDCCard_PatternStats;
+
 /** Start record config structure                       */
 strStartRecConfigMode sRFDCCard_StartRecConfig;
 
@@ -86,27 +101,43 @@ EVENT_HANDLER RFDCARD_Callback;
 /** Callback function - To handle recording inline stats */
 INLINE_PROC_HANDLER RecordInlineProc_Callback;
 
+/** Callback function - To detect triggers of the pre-trigger ring */
+RECORD_TRIGGER_HANDLER RecordTrigger_Callback;
+
 /** Commands protocol -  class object                   */
 cCommandsProtocol objCmdsProto;
 
 /** ADC data record process -  class object             */
-cUdpDataReceiver objUdpDataRecv(RAW_DATA_INDEX);
+cUdpDataReceiver objUdpDataRecv(RAW_DATA_INDEX, 0);
 
 /** CP data record process -  class object              */
-cUdpDataReceiver objUdpCpDataRecv(CP_DATA_1_INDEX);
+cUdpDataReceiver objUdpCpDataRecv(CP_DATA_1_INDEX, 0);
 
 /** CQ data record process -  class object              */
-cUdpDataReceiver objUdpCqDataRecv(CQ_DATA_2_INDEX);
+cUdpDataReceiver objUdpCqDataRecv(CQ_DATA_2_INDEX, 0);
 
 /** R4F data record process -  class object             */
-cUdpDataReceiver objUdpR4fDataRecv(R4F_DATA_3_INDEX);
+cUdpDataReceiver objUdpR4fDataRecv(R4F_DATA_3_INDEX, 0);
 
 /** DSP data record process -  class object             */
-cUdpDataReceiver objUdpDspDataRecv(DSP_DATA_4_INDEX);
+cUdpDataReceiver objUdpDspDataRecv(DSP_DATA_4_INDEX, 0);
+
+/** CP, CQ, R4F and DSP data ports thread -  class object */
+cUdpMultiPortReceiver objUdpMultiPortRecv(&objUdpCpDataRecv, &objUdpCqDataRecv,
+                                          &objUdpR4fDataRecv, &objUdpDspDataRecv);
+
+/** Systems sharing the ADC data port -  class object  */
+cSharedPortDemux objSharedPortDemux(&objUdpDataRecv);
 
 /** Command response data handling -  class object      */
 cUdpReceiver objUdpConfigRecv;
 
+/** Pipelined config commands - class object            */
+cCmdPipeline objCmdPipeline;
+
+/** Duration stop mode and capture timeout - class object */
+cCaptureTimers objCaptureTimers;
+
 /** Osal class object                                   */
 osal osalObj_api;
 
@@ -125,6 +156,9 @@ UINT32 u32MaxFileSizeToCapture = 0;
 /** Record - Lane number                                    */
 UINT8 u8LaneNumber = 4;
 
+/** Record - Packet delay (us) configured, 0 if not configured yet */
+UINT16 u16RecPktDelayUs = 0;
+
 /** Record stop command sent                            */
 bool gbRecStopCmdSent = false;
 
@@ -164,15 +198,15 @@ DATA_CAPTURE_RESP configResp;
  */
 OSAL_SIGNAL_HANDLE_TYPE sgnCmdTimeoutWaitEvent;
 
-/** Duration stop mode timeout wait event
- * Thread and wait event enabled when duration stop mode config is set for recording
+/** Pipelined config commands response wait event
+ *  Signalled by the config port thread on a response of the pipeline
  */
-OSAL_SIGNAL_HANDLE_TYPE sgnDurationStopModeWaitEvent;
+OSAL_SIGNAL_HANDLE_TYPE sgnCmdPipelineWaitEvent;
 
-/** Capture timeout wait event.
- *  To handle system disconnect/idleness while recording
+/** Shared data port systems command response wait event
+ *  Signalled by the config port thread on the last awaited response
  */
-OSAL_SIGNAL_HANDLE_TYPE sgnCaptureTimeoutWaitEvent;
+OSAL_SIGNAL_HANDLE_TYPE sgnSharedPortWaitEvent;
 
 /** @fn STATUS ConnectRFDCCard_ConfigMode (strEthConfigMode	sEthConfigMode)
  * @brief This function is to create a socket communication to DCA1000EVM <!--
@@ -318,6 +352,18 @@ STATUS ConnectRFDCCard_ConfigMode(strEthConfigMode sEthConfigMode)
     ethConf_PortAddress.sin_addr.s_addr = inet_addr("0.0.0.0");
     ethConf_PortAddress.sin_port = htons(sRFDCCard_EthConfig.u32ConfigPortNo);
 
+#ifdef EMULATOR_PORT_SHARING
+    /** Allow the emulator to bind the same config port on its own address */
+    SINT32 s32ReuseAddr = 1;
+    if (setsockopt(sRFDCCard_SockInfo.s32EthConfSock, SOL_SOCKET, SO_REUSEADDR,
+                   (char *)&s32ReuseAddr, sizeof(SINT32)) == -1)
+    {
+        THROW_ERROR_STATUS("ConnectRFDCCard_ConfigMode(): "
+                           "setsockopt reuse failed (Config port)");
+        return (STS_RFDCCARD_OS_ERR);
+    }
+#endif
+
     /** Bind                                                                 */
     if (bind(sRFDCCard_SockInfo.s32EthConfSock,
              (struct sockaddr *)&ethConf_PortAddress,
@@ -579,8 +625,8 @@ STATUS ConnectRFDCCard_RecordMode(strEthConfigMode sEthConfigMode)
 
     /** Initialize waiting events             */
     osalObj_api.InitEvent(&sgnCmdTimeoutWaitEvent);
-    osalObj_api.InitEvent(&sgnDurationStopModeWaitEvent);
-    osalObj_api.InitEvent(&sgnCaptureTimeoutWaitEvent);
+    osalObj_api.InitEvent(&sgnCmdPipelineWaitEvent);
+    osalObj_api.InitEvent(&sgnSharedPortWaitEvent);
 
 #if defined _WIN32
     WSADATA wsaData;
@@ -902,6 +948,14 @@ STATUS ConnectRFDCCard_RecordMode(strEthConfigMode sEthConfigMode)
         return (STS_RFDCCARD_OS_ERR);
     }
 
+    /** Receive buffer granted and drop counter of the data sockets      */
+    sRFDCCard_SockInfo.bSockDropCount = true;
+    for (UINT8 i = 0; i < NUM_DATA_TYPES; i++)
+    {
+        if (ConfigureDataSockRecv(i) != STS_RFDCCARD_SUCCESS)
+            return (STS_RFDCCARD_OS_ERR);
+    }
+
     /** Create socket for config port */
     sRFDCCard_SockInfo.s32EthConfSock = socket(AF_INET, SOCK_DGRAM,
                                                IPPROTO_UDP);
@@ -931,6 +985,18 @@ STATUS ConnectRFDCCard_RecordMode(strEthConfigMode sEthConfigMode)
         return (STS_RFDCCARD_OS_ERR);
     }
 
+#ifdef EMULATOR_PORT_SHARING
+    /** Allow the emulator to bind the same config port on its own address */
+    SINT32 s32ReuseAddr = 1;
+    if (setsockopt(sRFDCCard_SockInfo.s32EthConfSock, SOL_SOCKET, SO_REUSEADDR,
+                   (char *)&s32ReuseAddr, sizeof(SINT32)) == -1)
+    {
+        THROW_ERROR_STATUS("ConnectRFDCCard_RecordMode(): "
+                           "setsockopt reuse failed (Config port)");
+        return (STS_RFDCCARD_OS_ERR);
+    }
+#endif
+
     /** Bind                                                                 */
     if (bind(sRFDCCard_SockInfo.s32EthConfSock,
              (struct sockaddr *)&ethConf_PortAddress,
@@ -994,6 +1060,48 @@ STATUS ConfigureRFDCCard_Fpga(strFpgaConfigMode sConfigMode)
     DEBUG_FILE_WRITE(s8DebugMsg);
 #endif
 
+    /** Validate the config and copy it to Command packet                    */
+    SINT8 s8Data[sizeof(DATA_CAPTURE_REQ)];
+    UINT16 u16PacketLen = 0;
+    STATUS s32Status = FpgaConfigCmdPacket(sConfigMode, s8Data, &u16PacketLen);
+    if (s32Status != STS_RFDCCARD_SUCCESS)
+        return s32Status;
+
+    /** Send the command packet to FPGA                                      */
+    std::cout << "RDFCard Configure RDFCard_FPGA sendt!" << std::endl;
+    SINT32 s32BytesSent = SendConfigCmdRequest(s8Data, u16PacketLen);
+
+    if (s32BytesSent <= SOCKET_ERROR)
+    {
+        THROW_ERROR_STATUS("ConfigureRFDCCard_Mode(): UDP write failed");
+        return (STS_RFDCCARD_UDP_WRITE_ERR);
+    }
+    else
+    {
+        /** Receive the command response from FPGA                           */
+        return GetConfigCmdResponse("ConfigureRFDCCard_Fpga");
+    }
+
+#ifdef ENABLE_DEBUG
+    sprintf(s8DebugMsg, "\n\nConfigureRFDCCard_Mode: Sent successfully");
+    DEBUG_FILE_WRITE(s8DebugMsg);
+#endif
+
+    return (STS_RFDCCARD_SUCCESS);
+}
+
+/** @fn STATUS FpgaConfigCmdPacket(strFpgaConfigMode sConfigMode, <!--
+ * --> SINT8 *s8Data, UINT16 *pu16PacketLen)
+ * @brief This function is to validate the FPGA config and fill the <!--
+ * --> configure FPGA command packet
+ * @param [in] sConfigMode [strFpgaConfigMode] - Structure filled with config data
+ * @param [out] s8Data [SINT8 *] - Command packet
+ * @param [out] pu16PacketLen [UINT16 *] - Command packet size
+ * @return SINT32 value
+ */
+STATUS FpgaConfigCmdPacket(strFpgaConfigMode sConfigMode, SINT8 *s8Data,
+                           UINT16 *pu16PacketLen)
+{
     /** Validate the Logging Mode                                            */
     if (!((RAW_MODE == sConfigMode.eLogMode) ||
           (MULTI_MODE == sConfigMode.eLogMode)))
@@ -1086,30 +1194,9 @@ STATUS ConfigureRFDCCard_Fpga(strFpgaConfigMode sConfigMode)
     u8PacketData[u16DataSize++] = sConfigMode.eDataFormatMode;
     u8PacketData[u16DataSize++] = sConfigMode.u8Timer;
 
-    SINT8 s8Data[sizeof(DATA_CAPTURE_REQ)];
-    UINT16 u16PacketLen = objCmdsProto.configFpgaCommand(
+    *pu16PacketLen = objCmdsProto.configFpgaCommand(
         s8Data, u8PacketData, u16DataSize);
 
-    /** Send the command packet to FPGA                                      */
-    std::cout << "RDFCard Configure RDFCard_FPGA sendt!" << std::endl;
-    SINT32 s32BytesSent = SendConfigCmdRequest(s8Data, u16PacketLen);
-
-    if (s32BytesSent <= SOCKET_ERROR)
-    {
-        THROW_ERROR_STATUS("ConfigureRFDCCard_Mode(): UDP write failed");
-        return (STS_RFDCCARD_UDP_WRITE_ERR);
-    }
-    else
-    {
-        /** Receive the command response from FPGA                           */
-        return GetConfigCmdResponse("ConfigureRFDCCard_Fpga");
-    }
-
-#ifdef ENABLE_DEBUG
-    sprintf(s8DebugMsg, "\n\nConfigureRFDCCard_Mode: Sent successfully");
-    DEBUG_FILE_WRITE(s8DebugMsg);
-#endif
-
     return (STS_RFDCCARD_SUCCESS);
 }
 
@@ -1138,6 +1225,18 @@ STATUS GetConfigCmdResponse(const SINT8 *s8Cmd)
     SINT8 s8Msg[MAX_NAME_LEN];
     DATA_CAPTURE_RESP strConfigResp;
 
+    /** The config port thread of a record process owns the socket, it
+     *  signals the command response in configResp                       */
+    if (objUdpConfigRecv.getThreadStatus())
+    {
+        if (STS_RFDCCARD_EVENT_TIMEOUT_ERR == osalObj_api.WaitForSignal(
+                                                  &sgnCmdTimeoutWaitEvent, CMD_TIMEOUT_DURATION_SEC))
+        {
+            return STS_RFDCCARD_TIMEOUT_ERR;
+        }
+        return configResp.u16Status;
+    }
+
     /** Setting the timeout for command response */
     if (osalObj_api.sock_setopt(sRFDCCard_SockInfo.s32EthConfSock,
                                 CMD_TIMEOUT_DURATION_SEC) < 0)
@@ -1219,6 +1318,49 @@ STATUS ConfigureRFDCCard_Eeprom(strEthConfigMode sEthConfigMode)
     DEBUG_FILE_WRITE(s8DebugMsg);
 #endif
 
+    /** Validate the config and copy it to Command packet                    */
+    SINT8 s8Data[sizeof(DATA_CAPTURE_REQ)];
+    UINT16 u16PacketLen = 0;
+    STATUS s32Status = EepromConfigCmdPacket(sEthConfigMode, s8Data,
+                                             &u16PacketLen);
+    if (s32Status != STS_RFDCCARD_SUCCESS)
+        return s32Status;
+
+    /** Send the command packet to FPGA                                      */
+    std::cout << "RDFCard EPPROM sendt!" << std::endl;
+    SINT32 s32BytesSent = SendConfigCmdRequest(s8Data, u16PacketLen);
+
+    if (s32BytesSent <= SOCKET_ERROR)
+    {
+        THROW_ERROR_STATUS("ConfigureRFDCCard_EEPROM(): UDP write failed");
+        return (STS_RFDCCARD_UDP_WRITE_ERR);
+    }
+    else
+    {
+        return GetConfigCmdResponse("ConfigureRFDCCard_EEPROM");
+    }
+
+#ifdef ENABLE_DEBUG
+    sprintf(s8DebugMsg, "\n\nConfigureRFDCCard_EEPROM: Sent successfully");
+    DEBUG_FILE_WRITE(s8DebugMsg);
+#endif
+
+    return (STS_RFDCCARD_SUCCESS);
+}
+
+/** @fn STATUS EepromConfigCmdPacket(strEthConfigMode sEthConfigMode, <!--
+ * --> SINT8 *s8Data, UINT16 *pu16PacketLen)
+ * @brief This function is to validate the EEPROM config and fill the <!--
+ * --> configure EEPROM command packet
+ * @param [in] sEthConfigMode [strEthConfigMode] - <!--
+ * --> Structure filled with config data
+ * @param [out] s8Data [SINT8 *] - Command packet
+ * @param [out] pu16PacketLen [UINT16 *] - Command packet size
+ * @return SINT32 value
+ */
+STATUS EepromConfigCmdPacket(strEthConfigMode sEthConfigMode, SINT8 *s8Data,
+                             UINT16 *pu16PacketLen)
+{
     /** Validate Record Port number                                          */
     if (SUCCESS_STATUS != validatePortNumber(sEthConfigMode.u32RecordPortNo))
     {
@@ -1263,7 +1405,6 @@ STATUS ConfigureRFDCCard_Eeprom(strEthConfigMode sEthConfigMode)
     }
 
     /** Copy the configuration mode info to Command packet                   */
-    SINT8 s8Data[sizeof(DATA_CAPTURE_REQ)];
     UINT8 u8PacketData[MAX_DATA_BYTES];
     UINT16 u16DataSize = 0;
 
@@ -1306,31 +1447,326 @@ STATUS ConfigureRFDCCard_Eeprom(strEthConfigMode sEthConfigMode)
     u16DataSize += UINT16_DATA_SIZE;
 
     /** Copy the EEPROM config info to Command packet                        */
-    UINT16 u16PacketLen = objCmdsProto.configEepromCommand(
+    *pu16PacketLen = objCmdsProto.configEepromCommand(
         s8Data, u8PacketData, u16DataSize);
 
-    /** Send the command packet to FPGA                                      */
-    std::cout << "RDFCard EPPROM sendt!" << std::endl;
-    SINT32 s32BytesSent = SendConfigCmdRequest(s8Data, u16PacketLen);
+    return (STS_RFDCCARD_SUCCESS);
+}
 
-    if (s32BytesSent <= SOCKET_ERROR)
+/** @fn SINT32 RecvConfigCmdResponseUntil(ULONG64 u64DeadlineUs, <!--
+ * --> DATA_CAPTURE_RESP *psResp, struct sockaddr_in *psSenderAddr)
+ * @brief This function is to receive a command response of any <!--
+ * --> DCA1000EVM system over the config port till the deadline
+ * @param [in] u64DeadlineUs [ULONG64] - Deadline in micro seconds
+ * @param [out] psResp [DATA_CAPTURE_RESP *] - Command response
+ * @param [out] psSenderAddr [struct sockaddr_in *] - Sender address
+ * @return SINT32 value (bytes received, 0 on deadline)
+ */
+SINT32 RecvConfigCmdResponseUntil(ULONG64 u64DeadlineUs,
+                                  DATA_CAPTURE_RESP *psResp,
+                                  struct sockaddr_in *psSenderAddr)
+{
+    ULONG64 u64CurTimeUs = 0;
+    ULONG64 u64WaitUs = 0;
+    SINT32 s32BytesRecvd = 0;
+    fd_set readFds;
+    struct timeval sTimeout;
+    socklen_t s32SenderAddrSize = sizeof(struct sockaddr_in);
+
+    while (true)
+    {
+        u64CurTimeUs = osalObj_api.GetTimeInMicroSec();
+        if (u64CurTimeUs >= u64DeadlineUs)
+            return 0;
+
+        u64WaitUs = u64DeadlineUs - u64CurTimeUs;
+        sTimeout.tv_sec = (long)(u64WaitUs / (SEC_TO_MILLI_SEC_CONVERSION *
+                                              MILLI_TO_MICRO_SEC_CONVERSION));
+        sTimeout.tv_usec = (long)(u64WaitUs % (SEC_TO_MILLI_SEC_CONVERSION *
+                                               MILLI_TO_MICRO_SEC_CONVERSION));
+
+        FD_ZERO(&readFds);
+        FD_SET(sRFDCCard_SockInfo.s32EthConfSock, &readFds);
+        if (select(sRFDCCard_SockInfo.s32EthConfSock + 1, &readFds, NULL, NULL,
+                   &sTimeout) <= 0)
+            continue;
+
+        s32SenderAddrSize = sizeof(struct sockaddr_in);
+        s32BytesRecvd = recvfrom(sRFDCCard_SockInfo.s32EthConfSock,
+                                 (SINT8 *)psResp, sizeof(DATA_CAPTURE_RESP), 0,
+                                 (struct sockaddr *)psSenderAddr,
+                                 &s32SenderAddrSize);
+        if (s32BytesRecvd <= SOCKET_ERROR)
+            return SOCKET_ERROR;
+
+        /** Packets other than command responses are skipped     */
+        if ((s32BytesRecvd == sizeof(DATA_CAPTURE_RESP)) &&
+            (psResp->u16Header == HEADER_START_BYTES) &&
+            (psResp->u16Footer == FOOTER_STOP_BYTES))
+            return s32BytesRecvd;
+    }
+}
+
+/** @fn STATUS DiscoverRFDCCards(UINT8 *pu8StartIpAddr, UINT16 u16NumOfIps, <!--
+ * --> UINT32 u32TimeoutMs, strRFDCCard_DiscoveryInfo *psCards, <!--
+ * --> UINT16 *pu16NumOfCards)
+ * @brief This function is to find the DCA1000EVM systems in a range of <!--
+ * --> IP addresses. System aliveness and read FPGA version commands are <!--
+ * --> sent to all the addresses at once and the responders are collected <!--
+ * --> within one timeout window
+ * @param [in] pu8StartIpAddr [UINT8 *] - First IP address of the range
+ * @param [in] u16NumOfIps [UINT16] - Number of IP addresses to probe
+ * @param [in] u32TimeoutMs [UINT32] - Response window in millisec
+ * @param [out] psCards [strRFDCCard_DiscoveryInfo *] - Responded systems, <!--
+ * --> array of u16NumOfIps entries
+ * @param [out] pu16NumOfCards [UINT16 *] - Number of responded systems
+ * @pre Application should be connected to DCA1000EVM system using <!--
+ * --> \ref ConnectRFDCCard_ConfigMode API
+ * @return SINT32 value
+ */
+STATUS DiscoverRFDCCards(UINT8 *pu8StartIpAddr, UINT16 u16NumOfIps,
+                         UINT32 u32TimeoutMs,
+                         strRFDCCard_DiscoveryInfo *psCards,
+                         UINT16 *pu16NumOfCards)
+{
+    strRFDCCard_DiscoveryInfo sProbes[MAX_DISCOVERY_IPS];
+    SINT8 s8AliveData[sizeof(DATA_CAPTURE_REQ)];
+    SINT8 s8VersionData[sizeof(DATA_CAPTURE_REQ)];
+    struct sockaddr_in probeAddr;
+    struct sockaddr_in senderAddr;
+    DATA_CAPTURE_RESP sResp;
+    UINT32 u32Pending = 0;
+    UINT32 u32Index = 0;
+    UINT16 i = 0;
+
+    if ((pu8StartIpAddr == NULL) || (psCards == NULL) ||
+        (pu16NumOfCards == NULL) || (u16NumOfIps == 0) ||
+        (u16NumOfIps > MAX_DISCOVERY_IPS) ||
+        (SUCCESS_STATUS != validateIPAddr(pu8StartIpAddr)) ||
+        ((UINT32)pu8StartIpAddr[3] + u16NumOfIps - 1 > MAX_DISCOVERY_IPS))
+    {
+        printf("\nDiscoverRFDCCards(): Invalid input parameters");
+        return (STS_RFDCCARD_INVALID_INPUT_PARAMS);
+    }
+    *pu16NumOfCards = 0;
+
+    /** Responses of the range are read here, not by a record process */
+    if (objUdpConfigRecv.getThreadStatus())
     {
-        THROW_ERROR_STATUS("ConfigureRFDCCard_EEPROM(): UDP write failed");
-        return (STS_RFDCCARD_UDP_WRITE_ERR);
+        printf("\nDiscoverRFDCCards(): Config port is in use by record process");
+        return (STS_RFDCCARD_INVALID_INPUT_PARAMS);
     }
-    else
+
+    UINT16 u16AlivePacketLen = objCmdsProto.systemAlivenessCommand(s8AliveData);
+    UINT16 u16VersionPacketLen = objCmdsProto.readFpgaVersionCommand(
+        s8VersionData);
+
+    /** Probe all the addresses back to back from the config socket    */
+    memcpy(&probeAddr, &ethConf_ServAddr, sizeof(probeAddr));
+    for (i = 0; i < u16NumOfIps; i++)
     {
-        return GetConfigCmdResponse("ConfigureRFDCCard_EEPROM");
+        memcpy(sProbes[i].au8Dca1000IpAddr, pu8StartIpAddr, 4);
+        sProbes[i].au8Dca1000IpAddr[3] += (UINT8)i;
+        sProbes[i].s32AlivenessStatus = STS_RFDCCARD_TIMEOUT_ERR;
+        sProbes[i].s32FpgaVersion = STS_RFDCCARD_TIMEOUT_ERR;
+        sProbes[i].s8FpgaVersion[0] = '\0';
+        memcpy(&probeAddr.sin_addr.s_addr, sProbes[i].au8Dca1000IpAddr, 4);
+
+        if (sendto(sRFDCCard_SockInfo.s32EthConfSock, s8AliveData,
+                   u16AlivePacketLen, 0, (struct sockaddr *)&probeAddr,
+                   sizeof(probeAddr)) <= SOCKET_ERROR)
+            sProbes[i].s32AlivenessStatus = STS_RFDCCARD_UDP_WRITE_ERR;
+        else
+            u32Pending++;
+
+        if (sendto(sRFDCCard_SockInfo.s32EthConfSock, s8VersionData,
+                   u16VersionPacketLen, 0, (struct sockaddr *)&probeAddr,
+                   sizeof(probeAddr)) <= SOCKET_ERROR)
+            sProbes[i].s32FpgaVersion = STS_RFDCCARD_UDP_WRITE_ERR;
+        else
+            u32Pending++;
+    }
+
+    /** Collect the responses of the range within one window           */
+    ULONG64 u64DeadlineUs = osalObj_api.GetTimeInMicroSec() +
+                            ((ULONG64)u32TimeoutMs *
+                             MILLI_TO_MICRO_SEC_CONVERSION);
+    while (u32Pending > 0)
+    {
+        SINT32 s32BytesRecvd = RecvConfigCmdResponseUntil(u64DeadlineUs,
+                                                          &sResp, &senderAddr);
+        if (s32BytesRecvd == 0)
+            break;
+        if (s32BytesRecvd < 0)
+        {
+            THROW_ERROR_STATUS("DiscoverRFDCCards(): UDP recvfrom failed");
+            return (STS_RFDCCARD_OS_ERR);
+        }
+
+        u32Index = (UINT32)(ntohl(senderAddr.sin_addr.s_addr) -
+                            ntohl(*(UINT32 *)pu8StartIpAddr));
+        if (u32Index >= u16NumOfIps)
+            continue;
+
+        if ((sResp.u16CmdCode == CMD_CODE_SYSTEM_ALIVENESS) &&
+            (sProbes[u32Index].s32AlivenessStatus == STS_RFDCCARD_TIMEOUT_ERR))
+        {
+            sProbes[u32Index].s32AlivenessStatus = sResp.u16Status;
+            u32Pending--;
+        }
+        else if ((sResp.u16CmdCode == CMD_CODE_READ_FPGA_VERSION) &&
+                 (sProbes[u32Index].s32FpgaVersion == STS_RFDCCARD_TIMEOUT_ERR))
+        {
+            sProbes[u32Index].s32FpgaVersion = sResp.u16Status;
+            sprintf(sProbes[u32Index].s8FpgaVersion, "%d.%d [%s]",
+                    sResp.u16Status & VERSION_BITS_DECODE,
+                    (sResp.u16Status >> VERSION_NUM_OF_BITS) &
+                        VERSION_BITS_DECODE,
+                    ((sResp.u16Status & PLAYBACK_BIT_DECODE) ==
+                     PLAYBACK_BIT_DECODE) ? "Playback" : "Record");
+            u32Pending--;
+        }
+    }
+
+    /** A system responding to any of the probes is reported           */
+    for (i = 0; i < u16NumOfIps; i++)
+    {
+        if ((sProbes[i].s32AlivenessStatus >= SUCCESS_STATUS) ||
+            (sProbes[i].s32FpgaVersion >= SUCCESS_STATUS))
+        {
+            memcpy(&psCards[(*pu16NumOfCards)++], &sProbes[i],
+                   sizeof(strRFDCCard_DiscoveryInfo));
+        }
     }
 
 #ifdef ENABLE_DEBUG
-    sprintf(s8DebugMsg, "\n\nConfigureRFDCCard_EEPROM: Sent successfully");
+    sprintf(s8DebugMsg, "\n\nDiscoverRFDCCards: %d of %d responded",
+            *pu16NumOfCards, u16NumOfIps);
     DEBUG_FILE_WRITE(s8DebugMsg);
 #endif
 
     return (STS_RFDCCARD_SUCCESS);
 }
 
+/** @fn STATUS ConfigureRFDCCards_Eeprom(strEthConfigMode *psCurEthConfig, <!--
+ * --> strEthConfigMode *psNewEthConfig, UINT16 u16NumOfCards, <!--
+ * --> STATUS *ps32Status)
+ * @brief This function is to configure the EEPROM of several DCA1000EVM <!--
+ * --> systems at once, see \ref ConfigureRFDCCard_Eeprom. The commands <!--
+ * --> are sent back to back and the responses are matched by the IP <!--
+ * --> address of the system
+ * @param [in] psCurEthConfig [strEthConfigMode *] - Current IP address <!--
+ * --> and config port of each system
+ * @param [in] psNewEthConfig [strEthConfigMode *] - EEPROM config of <!--
+ * --> each system
+ * @param [in] u16NumOfCards [UINT16] - Number of systems
+ * @param [out] ps32Status [STATUS *] - Command status of each system
+ * @pre Application should be connected to DCA1000EVM system using <!--
+ * --> \ref ConnectRFDCCard_ConfigMode API
+ * @return SINT32 value (status of the first failed system)
+ */
+STATUS ConfigureRFDCCards_Eeprom(strEthConfigMode *psCurEthConfig,
+                                 strEthConfigMode *psNewEthConfig,
+                                 UINT16 u16NumOfCards, STATUS *ps32Status)
+{
+    SINT8 s8Data[sizeof(DATA_CAPTURE_REQ)];
+    UINT16 u16PacketLen = 0;
+    struct sockaddr_in cardAddr;
+    struct sockaddr_in senderAddr;
+    DATA_CAPTURE_RESP sResp;
+    UINT32 u32Pending = 0;
+    UINT16 i = 0;
+    UINT16 j = 0;
+
+    if ((psCurEthConfig == NULL) || (psNewEthConfig == NULL) ||
+        (ps32Status == NULL) || (u16NumOfCards == 0) ||
+        (u16NumOfCards > MAX_DISCOVERY_IPS))
+    {
+        printf("\nConfigureRFDCCards_Eeprom(): Invalid input parameters");
+        return (STS_RFDCCARD_INVALID_INPUT_PARAMS);
+    }
+
+    /** Responses are told apart by the IP address of the system     */
+    for (i = 0; i < u16NumOfCards; i++)
+    {
+        for (j = i + 1; j < u16NumOfCards; j++)
+        {
+            if (memcmp(psCurEthConfig[i].au8Dca1000IpAddr,
+                       psCurEthConfig[j].au8Dca1000IpAddr, 4) == 0)
+            {
+                printf("\nConfigureRFDCCards_Eeprom(): "
+                       "Invalid input parameters (same au8Dca1000IpAddr)");
+                return (STS_RFDCCARD_INVALID_INPUT_PARAMS);
+            }
+        }
+    }
+
+    if (objUdpConfigRecv.getThreadStatus())
+    {
+        printf("\nConfigureRFDCCards_Eeprom(): "
+               "Config port is in use by record process");
+        return (STS_RFDCCARD_INVALID_INPUT_PARAMS);
+    }
+
+    memcpy(&cardAddr, &ethConf_ServAddr, sizeof(cardAddr));
+    for (i = 0; i < u16NumOfCards; i++)
+    {
+        ps32Status[i] = EepromConfigCmdPacket(psNewEthConfig[i], s8Data,
+                                              &u16PacketLen);
+        if (ps32Status[i] != STS_RFDCCARD_SUCCESS)
+            continue;
+
+        memcpy(&cardAddr.sin_addr.s_addr, psCurEthConfig[i].au8Dca1000IpAddr, 4);
+        cardAddr.sin_port = htons(psCurEthConfig[i].u32ConfigPortNo);
+        if (sendto(sRFDCCard_SockInfo.s32EthConfSock, s8Data, u16PacketLen, 0,
+                   (struct sockaddr *)&cardAddr, sizeof(cardAddr)) <= SOCKET_ERROR)
+        {
+            ps32Status[i] = STS_RFDCCARD_UDP_WRITE_ERR;
+            continue;
+        }
+        ps32Status[i] = STS_RFDCCARD_TIMEOUT_ERR;
+        u32Pending++;
+    }
+
+    ULONG64 u64DeadlineUs = osalObj_api.GetTimeInMicroSec() +
+                            ((ULONG64)CMD_TIMEOUT_DURATION_MS *
+                             MILLI_TO_MICRO_SEC_CONVERSION);
+    while (u32Pending > 0)
+    {
+        SINT32 s32BytesRecvd = RecvConfigCmdResponseUntil(u64DeadlineUs,
+                                                          &sResp, &senderAddr);
+        if (s32BytesRecvd == 0)
+            break;
+        if (s32BytesRecvd < 0)
+        {
+            THROW_ERROR_STATUS("ConfigureRFDCCards_Eeprom(): UDP recvfrom failed");
+            return (STS_RFDCCARD_OS_ERR);
+        }
+        if (sResp.u16CmdCode != CMD_CODE_CONFIG_EEPROM)
+            continue;
+
+        for (i = 0; i < u16NumOfCards; i++)
+        {
+            if ((memcmp(&senderAddr.sin_addr.s_addr,
+                        psCurEthConfig[i].au8Dca1000IpAddr, 4) == 0) &&
+                (ps32Status[i] == STS_RFDCCARD_TIMEOUT_ERR))
+            {
+                ps32Status[i] = sResp.u16Status;
+                u32Pending--;
+                break;
+            }
+        }
+    }
+
+    for (i = 0; i < u16NumOfCards; i++)
+    {
+        if (ps32Status[i] != STS_RFDCCARD_SUCCESS)
+            return ps32Status[i];
+    }
+
+    return (STS_RFDCCARD_SUCCESS);
+}
+
 /** @fn EXPORT STATUS HandshakeRFDCCard(void)
  * @brief This function is to verify the DCA1000EVM system connectivity
  * @pre Application should be connected to DCA1000EVM system
@@ -1375,15 +1811,20 @@ STATUS DisconnectRFDCCard_RecordMode(void)
 {
     /** Deinitialize waiting events             */
     osalObj_api.DeInitEvent(&sgnCmdTimeoutWaitEvent);
-    osalObj_api.DeInitEvent(&sgnDurationStopModeWaitEvent);
-    osalObj_api.DeInitEvent(&sgnCaptureTimeoutWaitEvent);
+    osalObj_api.DeInitEvent(&sgnCmdPipelineWaitEvent);
+    osalObj_api.DeInitEvent(&sgnSharedPortWaitEvent);
 
     objUdpConfigRecv.setSocketClose();
     objUdpDataRecv.setSocketClose();
-    objUdpCpDataRecv.setSocketClose();
-    objUdpCqDataRecv.setSocketClose();
-    objUdpR4fDataRecv.setSocketClose();
-    objUdpDspDataRecv.setSocketClose();
+    objUdpMultiPortRecv.setSocketClose();
+
+    /** Inline buffers are kept across the record processes of the connection */
+    objUdpDataRecv.releaseBuffers();
+    objUdpCpDataRecv.releaseBuffers();
+    objUdpCqDataRecv.releaseBuffers();
+    objUdpR4fDataRecv.releaseBuffers();
+    objUdpDspDataRecv.releaseBuffers();
+    objSharedPortDemux.releaseBuffers();
 
     /** Close ports */
     if (osalObj_api.sock_Close(sRFDCCard_SockInfo.s32EthConfSock) != 0)
@@ -1480,32 +1921,7 @@ STATUS DisconnectRFDCCard_ConfigMode(void)
 STATUS JustStartRecordData(strStartRecConfigMode sStartRecConfigMode)
 {
 #ifdef ENABLE_DEBUG
-    sprintf(s8DebugMsg, "\n\nStartRecordData : ");
-    DEBUG_FILE_WRITE(s8DebugMsg);
-    sprintf(s8DebugMsg, "\nbMsbToggleEnable : %d", sStartRecConfigMode.bMsbToggleEnable);
-    DEBUG_FILE_WRITE(s8DebugMsg);
-    sprintf(s8DebugMsg, "\nbReorderEnable : %d", sStartRecConfigMode.bReorderEnable);
-    DEBUG_FILE_WRITE(s8DebugMsg);
-    sprintf(s8DebugMsg, "\nbSequenceNumberEnable : %d", sStartRecConfigMode.bSequenceNumberEnable);
-    DEBUG_FILE_WRITE(s8DebugMsg);
-    sprintf(s8DebugMsg, "\neConfigLogMode : %d", sStartRecConfigMode.eConfigLogMode);
-    DEBUG_FILE_WRITE(s8DebugMsg);
-    sprintf(s8DebugMsg, "\neLvdsMode : %d", sStartRecConfigMode.eLvdsMode);
-    DEBUG_FILE_WRITE(s8DebugMsg);
-    sprintf(s8DebugMsg, "\neRecordStopMode : %d", sStartRecConfigMode.eRecordStopMode);
-    DEBUG_FILE_WRITE(s8DebugMsg);
-    sprintf(s8DebugMsg, "\ns8FileBasePath : %s", sStartRecConfigMode.s8FileBasePath);
-    DEBUG_FILE_WRITE(s8DebugMsg);
-    sprintf(s8DebugMsg, "\ns8FilePrefix : %s", sStartRecConfigMode.s8FilePrefix);
-    DEBUG_FILE_WRITE(s8DebugMsg);
-    sprintf(s8DebugMsg, "\nu16MaxRecFileSize : %d", sStartRecConfigMode.u16MaxRecFileSize);
-    DEBUG_FILE_WRITE(s8DebugMsg);
-    sprintf(s8DebugMsg, "\nu32BytesToCapture : %d", sStartRecConfigMode.u32BytesToCapture);
-    DEBUG_FILE_WRITE(s8DebugMsg);
-    sprintf(s8DebugMsg, "\nu32DurationToCapture : %d", sStartRecConfigMode.u32DurationToCapture);
-    DEBUG_FILE_WRITE(s8DebugMsg);
-    sprintf(s8DebugMsg, "\nu32FramesToCapture : %d", sStartRecConfigMode.u32FramesToCapture);
-    DEBUG_FILE_WRITE(s8DebugMsg);
+    DebugStartRecordConfig(sStartRecConfigMode);
 #endif
 
     /** Resetting record global status    */
@@ -1568,7 +1984,7 @@ STATUS JustStartRecordData(strStartRecConfigMode sStartRecConfigMode)
     WriteRecordSettingsInLogFile();
 
     /** Resetting the inline stats structure */
-    for (int i = 0; i < NUM_DATA_TYPES; i++)
+    for (int i = 0; i < NUM_REC_STATS_ENTRIES; i++)
     {
         sRFDCCard_InlineStats.u64OutOfSeqCount[i] = 0;
         sRFDCCard_InlineStats.u32FirstPktId[i] = 0;
@@ -1578,9 +1994,22 @@ STATUS JustStartRecordData(strStartRecConfigMode sStartRecConfigMode)
         sRFDCCard_InlineStats.u64NumOfZeroFilledPackets[i] = 0;
         sRFDCCard_InlineStats.u32OutOfSeqPktFromOffset[i] = 0;
         sRFDCCard_InlineStats.u32OutOfSeqPktToOffset[i] = 0;
+        sRFDCCard_InlineStats.u64NumOfBufSwaps[i] = 0;
+        sRFDCCard_InlineStats.u64NumOfWriterWaits[i] = 0;
+        sRFDCCard_InlineStats.u64NumOfDrainedPackets[i] = 0;
+        sRFDCCard_InlineStats.u64NumOfSpilledBufs[i] = 0;
+        sRFDCCard_InlineStats.u64NumOfWriterPauses[i] = 0;
+        sRFDCCard_InlineStats.u64NumOfDroppedFrames[i] = 0;
+        sRFDCCard_InlineStats.u64NumOfDroppedBytes[i] = 0;
+        sRFDCCard_InlineStats.u64NumOfTriggerDumps[i] = 0;
+        sRFDCCard_InlineStats.u64NumOfFilteredBytes[i] = 0;
+        sRFDCCard_InlineStats.u64NumOfSockDroppedPackets[i] = 0;
+        sRFDCCard_InlineStats.u64NumOfUpstreamLostPackets[i] = 0;
         sRFDCCard_InlineStats.EndTime[i] = time(NULL);
         sRFDCCard_InlineStats.StartTime[i] = time(NULL);
     }
+    memset(&sRFDCCard_LatencyStats, 0, sizeof(strRFDCCard_LatencyStats));
+    memset(&sRFDCCard_PatternStats, 0, sizeof(strRFDCCard_PatternStats));
 
 //    /** Start thread to record data into file for ADC data port */
 //    objUdpConfigRecv.setSocketOpen();
@@ -1684,47 +2113,68 @@ STATUS JustStartRecordData(strStartRecConfigMode sStartRecConfigMode)
     return (STS_RFDCCARD_SUCCESS);
 }
 
-/** @fn STATUS StartRecordData(strStartRecConfigMode sStartRecConfigMode)
- * @brief This function is to start recording the data streamed over <!--
- * --> Ethernet from the DCA1000EVM system with the \ref <!--
- * --> strStartRecConfigMode structure configuration
+#ifdef ENABLE_DEBUG
+/** @fn void DebugStartRecordConfig(strStartRecConfigMode sStartRecConfigMode)
+ * @brief This function is to write the start record config in the debug <!--
+ * --> file, for the start record and the pipelined start paths
  * @param [in] sStartRecConfigMode [strStartRecConfigMode] - <!--
  * --> Structure filled with record config data
- * @pre Application should be connected to DCA1000EVM system and <!--
- * --> FPGA and record packet delay should be configured
- * @return SINT32 value
  */
-STATUS StartRecordData(strStartRecConfigMode sStartRecConfigMode)
+void DebugStartRecordConfig(strStartRecConfigMode sStartRecConfigMode)
 {
-#ifdef ENABLE_DEBUG
-    sprintf(s8DebugMsg, "\n\nStartRecordData : ");
+    snprintf(s8DebugMsg, sizeof(s8DebugMsg), "\n\nStartRecordData : ");
     DEBUG_FILE_WRITE(s8DebugMsg);
-    sprintf(s8DebugMsg, "\nbMsbToggleEnable : %d", sStartRecConfigMode.bMsbToggleEnable);
+    snprintf(s8DebugMsg, sizeof(s8DebugMsg), "\nbMsbToggleEnable : %d",
+             sStartRecConfigMode.bMsbToggleEnable);
     DEBUG_FILE_WRITE(s8DebugMsg);
-    sprintf(s8DebugMsg, "\nbReorderEnable : %d", sStartRecConfigMode.bReorderEnable);
+    snprintf(s8DebugMsg, sizeof(s8DebugMsg), "\nbReorderEnable : %d",
+             sStartRecConfigMode.bReorderEnable);
     DEBUG_FILE_WRITE(s8DebugMsg);
-    sprintf(s8DebugMsg, "\nbSequenceNumberEnable : %d", sStartRecConfigMode.bSequenceNumberEnable);
+    snprintf(s8DebugMsg, sizeof(s8DebugMsg), "\nbSequenceNumberEnable : %d",
+             sStartRecConfigMode.bSequenceNumberEnable);
     DEBUG_FILE_WRITE(s8DebugMsg);
-    sprintf(s8DebugMsg, "\neConfigLogMode : %d", sStartRecConfigMode.eConfigLogMode);
+    snprintf(s8DebugMsg, sizeof(s8DebugMsg), "\neConfigLogMode : %d",
+             sStartRecConfigMode.eConfigLogMode);
     DEBUG_FILE_WRITE(s8DebugMsg);
-    sprintf(s8DebugMsg, "\neLvdsMode : %d", sStartRecConfigMode.eLvdsMode);
+    snprintf(s8DebugMsg, sizeof(s8DebugMsg), "\neLvdsMode : %d",
+             sStartRecConfigMode.eLvdsMode);
     DEBUG_FILE_WRITE(s8DebugMsg);
-    sprintf(s8DebugMsg, "\neRecordStopMode : %d", sStartRecConfigMode.eRecordStopMode);
+    snprintf(s8DebugMsg, sizeof(s8DebugMsg), "\neRecordStopMode : %d",
+             sStartRecConfigMode.eRecordStopMode);
     DEBUG_FILE_WRITE(s8DebugMsg);
-    sprintf(s8DebugMsg, "\ns8FileBasePath : %s", sStartRecConfigMode.s8FileBasePath);
+
+    /** Paths are cut to fit the debug message                           */
+    snprintf(s8DebugMsg, sizeof(s8DebugMsg), "\ns8FileBasePath : %.*s",
+             MAX_NAME_LEN - 32, sStartRecConfigMode.s8FileBasePath);
     DEBUG_FILE_WRITE(s8DebugMsg);
-    sprintf(s8DebugMsg, "\ns8FilePrefix : %s", sStartRecConfigMode.s8FilePrefix);
+    snprintf(s8DebugMsg, sizeof(s8DebugMsg), "\ns8FilePrefix : %.*s",
+             MAX_NAME_LEN - 32, sStartRecConfigMode.s8FilePrefix);
     DEBUG_FILE_WRITE(s8DebugMsg);
-    sprintf(s8DebugMsg, "\nu16MaxRecFileSize : %d", sStartRecConfigMode.u16MaxRecFileSize);
+    snprintf(s8DebugMsg, sizeof(s8DebugMsg), "\nu16MaxRecFileSize : %d",
+             sStartRecConfigMode.u16MaxRecFileSize);
     DEBUG_FILE_WRITE(s8DebugMsg);
-    sprintf(s8DebugMsg, "\nu32BytesToCapture : %d", sStartRecConfigMode.u32BytesToCapture);
+    snprintf(s8DebugMsg, sizeof(s8DebugMsg), "\nu32BytesToCapture : %d",
+             sStartRecConfigMode.u32BytesToCapture);
     DEBUG_FILE_WRITE(s8DebugMsg);
-    sprintf(s8DebugMsg, "\nu32DurationToCapture : %d", sStartRecConfigMode.u32DurationToCapture);
+    snprintf(s8DebugMsg, sizeof(s8DebugMsg), "\nu32DurationToCapture : %d",
+             sStartRecConfigMode.u32DurationToCapture);
     DEBUG_FILE_WRITE(s8DebugMsg);
-    sprintf(s8DebugMsg, "\nu32FramesToCapture : %d", sStartRecConfigMode.u32FramesToCapture);
+    snprintf(s8DebugMsg, sizeof(s8DebugMsg), "\nu32FramesToCapture : %d",
+             sStartRecConfigMode.u32FramesToCapture);
     DEBUG_FILE_WRITE(s8DebugMsg);
+}
 #endif
 
+/** @fn STATUS PrepareRecordProcess(strStartRecConfigMode sStartRecConfigMode)
+ * @brief This function is to validate the start record config, reset the <!--
+ * --> record stats and start the config port and record threads ahead of <!--
+ * --> the start record command
+ * @param [in] sStartRecConfigMode [strStartRecConfigMode] - <!--
+ * --> Structure filled with record config data
+ * @return SINT32 value
+ */
+STATUS PrepareRecordProcess(strStartRecConfigMode sStartRecConfigMode)
+{
     /** Resetting record global status    */
     gbRecStopCmdSent = false;
 
@@ -1751,6 +2201,24 @@ STATUS StartRecordData(strStartRecConfigMode sStartRecConfigMode)
         return (STS_RFDCCARD_INVALID_INPUT_PARAMS);
     }
 
+    /** Validate the stripe base paths          */
+    if (sStartRecConfigMode.u8NumOfStripePaths > MAX_STRIPE_PATHS)
+    {
+        printf("\nStartRecordData(): "
+               "Invalid input parameters (sStartRecConfigMode.u8NumOfStripePaths)");
+        return (STS_RFDCCARD_INVALID_INPUT_PARAMS);
+    }
+    for (UINT8 i = 0; (sStartRecConfigMode.u8NumOfStripePaths > 1) &&
+                      (i < sStartRecConfigMode.u8NumOfStripePaths); i++)
+    {
+        if (!osalObj_api.IsValidDir(sStartRecConfigMode.s8StripeBasePath[i]))
+        {
+            printf("\nStartRecordData(): "
+                   "Invalid input parameters (sStartRecConfigMode.s8StripeBasePath)");
+            return (STS_RFDCCARD_INVALID_INPUT_PARAMS);
+        }
+    }
+
     if (sStartRecConfigMode.eRecordStopMode == BYTES)
     {
         if (SUCCESS_STATUS != validateBytesStopConfig(
@@ -1790,11 +2258,179 @@ STATUS StartRecordData(strStartRecConfigMode sStartRecConfigMode)
         return (STS_RFDCCARD_INVALID_INPUT_PARAMS);
     }
 
-    memcpy(&sRFDCCard_StartRecConfig, &sStartRecConfigMode,
-           sizeof(strStartRecConfigMode));
+    /** Validate the pre-trigger ring config    */
+    if (sStartRecConfigMode.eRecordTriggerMode == RECORD_TRIGGER_EVENT)
+    {
+        if ((sStartRecConfigMode.u16TriggerRingSize == 0) ||
+            (sStartRecConfigMode.u16TriggerRingSize > MAX_RECORD_TRIGGER_RING_SIZE) ||
+            (sStartRecConfigMode.u32PreTriggerDuration >
+                                    MAX_RECORD_PRE_TRIGGER_DURATION) ||
+            (sStartRecConfigMode.u32PostTriggerDuration >
+                                    MAX_RECORD_POST_TRIGGER_DURATION))
+        {
+            printf("\nStartRecordData(): "
+                   "Invalid input parameters (sStartRecConfigMode trigger config)");
+            return (STS_RFDCCARD_INVALID_INPUT_PARAMS);
+        }
+    }
+    else if (sStartRecConfigMode.eRecordTriggerMode != RECORD_TRIGGER_CONTINUOUS)
+    {
+        printf("\nStartRecordData(): "
+               "Invalid input parameters (sStartRecConfigMode.eRecordTriggerMode)");
+        return (STS_RFDCCARD_INVALID_INPUT_PARAMS);
+    }
 
-    u32MaxFileSizeToCapture = sRFDCCard_StartRecConfig.u16MaxRecFileSize *
-                              1024 * 1024;
+    /** Validate the capture filter config, the kept RX channels and
+     *  chirps are within the ADC data layout. The layout is the one of
+     *  the reordered data, the RX channels of the raw data are lane
+     *  interleaved. Reordering works on the lane groups of bytes, hence
+     *  an RX channel holds whole groups                                */
+    strCaptureFilterConfig *psFilter = &sStartRecConfigMode.sCaptureFilter;
+    if (psFilter->bFilterEnable)
+    {
+        UINT32 u32RxBytes = (UINT32)psFilter->u16NumAdcSamples *
+                            ((psFilter->u8AdcFmt == 0) ? ADC_REAL_SAMPLE_BYTES :
+                                                         ADC_COMPLEX_SAMPLE_BYTES);
+        UINT32 u32LaneGroupBytes =
+                            (sStartRecConfigMode.eLvdsMode == TWO_LANE) ? 8 : 16;
+        if ((sStartRecConfigMode.eConfigLogMode != RAW_MODE) ||
+            (psFilter->u16NumAdcSamples == 0) ||
+            (psFilter->u8AdcFmt > MAX_CAPTURE_FILTER_ADC_FMT) ||
+            (psFilter->u16NumChirpsPerFrame == 0) ||
+            (psFilter->u8RxChanEn == 0) ||
+            ((psFilter->u8RxChanEn & ~CAPTURE_FILTER_RX_CHAN_MASK) != 0) ||
+            (psFilter->u8RxChanSel == 0) ||
+            ((psFilter->u8RxChanSel & ~psFilter->u8RxChanEn) != 0) ||
+            (psFilter->u16ChirpStartIdx > psFilter->u16ChirpEndIdx) ||
+            (psFilter->u16ChirpEndIdx >= psFilter->u16NumChirpsPerFrame) ||
+            (psFilter->u32FrameDecimation == 0) ||
+            (psFilter->u32FrameStartIdx > psFilter->u32FrameEndIdx) ||
+            (!sStartRecConfigMode.bReorderEnable) ||
+            ((u32RxBytes % u32LaneGroupBytes) != 0))
+        {
+            printf("\nStartRecordData(): "
+                   "Invalid input parameters (sStartRecConfigMode.sCaptureFilter)");
+            return (STS_RFDCCARD_INVALID_INPUT_PARAMS);
+        }
+    }
+
+    /** Validate the CRC32C chunk size          */
+    if (sStartRecConfigMode.u16CrcChunkSize > MAX_RECORD_CRC_CHUNK_SIZE)
+    {
+        printf("\nStartRecordData(): "
+               "Invalid input parameters (sStartRecConfigMode.u16CrcChunkSize)");
+        return (STS_RFDCCARD_INVALID_INPUT_PARAMS);
+    }
+
+    /** Validate the test pattern config, the pattern is checked on the
+     *  ADC data of the raw mode only                                   */
+    strTestPatternConfig *psPattern = &sStartRecConfigMode.sTestPattern;
+    if (psPattern->bVerifyEnable &&
+        ((sStartRecConfigMode.eConfigLogMode != RAW_MODE) ||
+         (psPattern->u8AdcFmt > MAX_CAPTURE_FILTER_ADC_FMT)))
+    {
+        printf("\nStartRecordData(): "
+               "Invalid input parameters (sStartRecConfigMode.sTestPattern)");
+        return (STS_RFDCCARD_INVALID_INPUT_PARAMS);
+    }
+
+    /** Validate the systems sharing the data port, the connected system
+     *  is the first one. Packets are told apart by source IP in the raw
+     *  mode only                                                        */
+    strSharedPortConfig *psShared = &sStartRecConfigMode.sSharedPort;
+    bool bSharedPortValid = true;
+    if (psShared->u8NumOfSystems > 1)
+    {
+        bSharedPortValid = (psShared->u8NumOfSystems <= MAX_SHARED_PORT_SYSTEMS) &&
+                           (sStartRecConfigMode.eConfigLogMode == RAW_MODE) &&
+                           (!psPattern->bVerifyEnable) &&
+                           (memcmp(psShared->au8IpAddr[0],
+                                   &ethConf_ServAddr.sin_addr.s_addr,
+                                   UINT32_DATA_SIZE) == 0);
+        for (UINT8 i = 1; bSharedPortValid && (i < psShared->u8NumOfSystems); i++)
+        {
+            bSharedPortValid = (SUCCESS_STATUS ==
+                                validateIPAddr(psShared->au8IpAddr[i]));
+            for (UINT8 j = 0; bSharedPortValid && (j < i); j++)
+            {
+                bSharedPortValid = (memcmp(psShared->au8IpAddr[i],
+                                           psShared->au8IpAddr[j],
+                                           UINT32_DATA_SIZE) != 0);
+            }
+        }
+    }
+    if (!bSharedPortValid)
+    {
+        printf("\nStartRecordData(): "
+               "Invalid input parameters (sStartRecConfigMode.sSharedPort)");
+        return (STS_RFDCCARD_INVALID_INPUT_PARAMS);
+    }
+
+    /** Validate the retention config, the record files are written
+     *  over in place by the file writer of the raw mode. The total size
+     *  holds the open record file and one before it at least          */
+    if (((sStartRecConfigMode.u32RetentionSize > 0) ||
+         (sStartRecConfigMode.u32RetentionAge > 0)) &&
+        ((sStartRecConfigMode.eConfigLogMode != RAW_MODE) ||
+         (sStartRecConfigMode.u8NumOfStripePaths > 1) ||
+         (sStartRecConfigMode.eWriterBackend == WRITER_BACKEND_MMAP) ||
+         ((sStartRecConfigMode.u32RetentionSize > 0) &&
+          (sStartRecConfigMode.u32RetentionSize <
+           (UINT32)sStartRecConfigMode.u16MaxRecFileSize *
+                                        MIN_RECORD_RETENTION_FILES))))
+    {
+        printf("\nStartRecordData(): "
+               "Invalid input parameters (sStartRecConfigMode retention config)");
+        return (STS_RFDCCARD_INVALID_INPUT_PARAMS);
+    }
+
+    /** Validate the watermark, the stripes are written by their own
+     *  threads in several base paths                                  */
+    if (sStartRecConfigMode.bWatermarkEnable &&
+        (sStartRecConfigMode.u8NumOfStripePaths > 1))
+    {
+        printf("\nStartRecordData(): "
+               "Invalid input parameters (sStartRecConfigMode.bWatermarkEnable)");
+        return (STS_RFDCCARD_INVALID_INPUT_PARAMS);
+    }
+
+    /** Validate the file rollover, the record files end at whole frames
+     *  of the capture filter layout in the file writer of the raw mode */
+    if (((sStartRecConfigMode.u32FramesPerFile > 0) ||
+         (sStartRecConfigMode.u32FileDuration > 0)) &&
+        (((sStartRecConfigMode.u32FramesPerFile > 0) &&
+          (sStartRecConfigMode.u32FileDuration > 0)) ||
+         (sStartRecConfigMode.eConfigLogMode != RAW_MODE) ||
+         (!sStartRecConfigMode.sCaptureFilter.bFilterEnable) ||
+         (sStartRecConfigMode.u8NumOfStripePaths > 1) ||
+         (sStartRecConfigMode.eWriterBackend == WRITER_BACKEND_MMAP) ||
+         (sStartRecConfigMode.eRecordTriggerMode == RECORD_TRIGGER_EVENT)))
+    {
+        printf("\nStartRecordData(): "
+               "Invalid input parameters (sStartRecConfigMode file rollover)");
+        return (STS_RFDCCARD_INVALID_INPUT_PARAMS);
+    }
+
+    memcpy(&sRFDCCard_StartRecConfig, &sStartRecConfigMode,
+           sizeof(strStartRecConfigMode));
+
+    /** Receivers of the other systems are kept across record processes */
+    if (!objSharedPortDemux.setSystems(&sRFDCCard_StartRecConfig.sSharedPort))
+    {
+        printf("\nStartRecordData(): Memory allocation failed "
+               "(sStartRecConfigMode.sSharedPort)");
+        return (STS_RFDCCARD_OS_ERR);
+    }
+
+    /** Coalesced receive follows the config of each record process   */
+    SINT32 s32RawSock = sRFDCCard_SockInfo.s32DataSock[RAW_DATA_INDEX];
+    sRFDCCard_SockInfo.bUdpGro = sRFDCCard_StartRecConfig.bUdpGroEnable &&
+                                 (SockSetUdpGro(s32RawSock, true) == 0);
+    if (!sRFDCCard_SockInfo.bUdpGro)
+        SockSetUdpGro(s32RawSock, false);
+
+    u32MaxFileSizeToCapture = sRFDCCard_StartRecConfig.u16MaxRecFileSize *
+                              1024 * 1024;
 
     if (sRFDCCard_StartRecConfig.eLvdsMode == TWO_LANE)
         u8LaneNumber = 2;
@@ -1805,7 +2441,7 @@ STATUS StartRecordData(strStartRecConfigMode sStartRecConfigMode)
     WriteRecordSettingsInLogFile();
 
     /** Resetting the inline stats structure */
-    for (int i = 0; i < NUM_DATA_TYPES; i++)
+    for (int i = 0; i < NUM_REC_STATS_ENTRIES; i++)
     {
         sRFDCCard_InlineStats.u64OutOfSeqCount[i] = 0;
         sRFDCCard_InlineStats.u32FirstPktId[i] = 0;
@@ -1815,19 +2451,44 @@ STATUS StartRecordData(strStartRecConfigMode sStartRecConfigMode)
         sRFDCCard_InlineStats.u64NumOfZeroFilledPackets[i] = 0;
         sRFDCCard_InlineStats.u32OutOfSeqPktFromOffset[i] = 0;
         sRFDCCard_InlineStats.u32OutOfSeqPktToOffset[i] = 0;
+        sRFDCCard_InlineStats.u64NumOfBufSwaps[i] = 0;
+        sRFDCCard_InlineStats.u64NumOfWriterWaits[i] = 0;
+        sRFDCCard_InlineStats.u64NumOfDrainedPackets[i] = 0;
+        sRFDCCard_InlineStats.u64NumOfSpilledBufs[i] = 0;
+        sRFDCCard_InlineStats.u64NumOfWriterPauses[i] = 0;
+        sRFDCCard_InlineStats.u64NumOfDroppedFrames[i] = 0;
+        sRFDCCard_InlineStats.u64NumOfDroppedBytes[i] = 0;
+        sRFDCCard_InlineStats.u64NumOfTriggerDumps[i] = 0;
+        sRFDCCard_InlineStats.u64NumOfFilteredBytes[i] = 0;
+        sRFDCCard_InlineStats.u64NumOfSockDroppedPackets[i] = 0;
+        sRFDCCard_InlineStats.u64NumOfUpstreamLostPackets[i] = 0;
         sRFDCCard_InlineStats.EndTime[i] = time(NULL);
         sRFDCCard_InlineStats.StartTime[i] = time(NULL);
     }
+    memset(&sRFDCCard_LatencyStats, 0, sizeof(strRFDCCard_LatencyStats));
+    memset(&sRFDCCard_PatternStats, 0, sizeof(strRFDCCard_PatternStats));
+
+    /** Timers are started by the first packet and the start response */
+    objCaptureTimers.reset();
+
+    /** Socket threads keep running till the disconnect, they are started
+     *  by the first record process of the connection only               */
+    if (!objUdpConfigRecv.getThreadStatus())
+    {
+        objUdpConfigRecv.setSocketOpen();
+        std::thread tConfigData([&]
+                                { objUdpConfigRecv.readConfigDatagrams(); });
+        tConfigData.detach();
+    }
 
     /** Start thread to record data into file for ADC data port */
-    objUdpConfigRecv.setSocketOpen();
-    std::thread tConfigData([&]
-                            { objUdpConfigRecv.readConfigDatagrams(); });
-    tConfigData.detach();
-    objUdpDataRecv.setSocketOpen();
-    std::thread tRawData([&]
-                         { objUdpDataRecv.readData(); });
-    tRawData.detach();
+    if (!objUdpDataRecv.getSocketStatus())
+    {
+        objUdpDataRecv.setSocketOpen();
+        std::thread tRawData([&]
+                             { objUdpDataRecv.readData(); });
+        tRawData.detach();
+    }
     objUdpDataRecv.setThreadStart();
 #ifndef POST_PROCESSING
     /** Start thread for writing data into file from buffer for ADC port (inline processing) */
@@ -1836,46 +2497,174 @@ STATUS StartRecordData(strStartRecConfigMode sStartRecConfigMode)
     tRawData2.detach();
 #endif
 
+    /** Other systems of a shared data port, read by the ADC data port
+     *  thread and written by threads of their own                     */
+    objSharedPortDemux.setThreadStart();
+
     if (sStartRecConfigMode.eConfigLogMode == MULTI_MODE)
     {
-        /** Start thread to record data into file for each of the data ports */
-        objUdpCpDataRecv.setSocketOpen();
-        std::thread tCpData([&]
-                            { objUdpCpDataRecv.readData(); });
-        tCpData.detach();
-        objUdpCqDataRecv.setSocketOpen();
-        std::thread tCqData([&]
-                            { objUdpCqDataRecv.readData(); });
-        tCqData.detach();
-        objUdpR4fDataRecv.setSocketOpen();
-        std::thread tR4fData([&]
-                             { objUdpR4fDataRecv.readData(); });
-        tR4fData.detach();
-        objUdpDspDataRecv.setSocketOpen();
-        std::thread tDspData([&]
-                             { objUdpDspDataRecv.readData(); });
-        tDspData.detach();
-        objUdpCpDataRecv.setThreadStart();
-        objUdpCqDataRecv.setThreadStart();
-        objUdpR4fDataRecv.setThreadStart();
-        objUdpDspDataRecv.setThreadStart();
-#ifndef POST_PROCESSING
-        /** Start thread for writing data into file from buffer for each of the
-         * data ports (Inline processing)
-         */
-        std::thread tCpData2([&]
-                             { objUdpCpDataRecv.Thread_WriteDataToFile(); });
-        tCpData2.detach();
-        std::thread tCqData2([&]
-                             { objUdpCqDataRecv.Thread_WriteDataToFile(); });
-        tCqData2.detach();
-        std::thread tR4fData2([&]
-                              { objUdpR4fDataRecv.Thread_WriteDataToFile(); });
-        tR4fData2.detach();
-        std::thread tDspData2([&]
-                              { objUdpDspDataRecv.Thread_WriteDataToFile(); });
-        tDspData2.detach();
+        /** Start one thread to record data into file for the CP, CQ, R4F
+         *  and DSP data ports, it writes their small buffers itself      */
+        if (!objUdpMultiPortRecv.getSocketStatus())
+        {
+            objUdpMultiPortRecv.setSocketOpen();
+            std::thread tMultiPortData([&]
+                                       { objUdpMultiPortRecv.readData(); });
+            tMultiPortData.detach();
+        }
+        objUdpMultiPortRecv.setThreadStart();
+    }
+
+    return (STS_RFDCCARD_SUCCESS);
+}
+
+/** @fn void StopRecordReceivers(void)
+ * @brief This function is to stop the record threads of a record <!--
+ * --> process which failed to start. Sockets stay open for the next one
+ */
+void StopRecordReceivers(void)
+{
+    objUdpDataRecv.setThreadStop();
+    objSharedPortDemux.setThreadStop();
+    if (sRFDCCard_StartRecConfig.eConfigLogMode == MULTI_MODE)
+    {
+        objUdpMultiPortRecv.setThreadStop();
+    }
+}
+
+/** @fn STATUS ConfigureDataSockRecv(UINT8 u8DataTypeId)
+ * @brief This function is to read the receive buffer size granted to a <!--
+ * --> data socket and to enable its drop counter (packets dropped on <!--
+ * --> receive buffer overflow), where the OS has one
+ * @param [in] u8DataTypeId [UINT8] - Data type index of the socket
+ * @return SINT32 value
+ */
+STATUS ConfigureDataSockRecv(UINT8 u8DataTypeId)
+{
+    SINT32 s32DataSock = sRFDCCard_SockInfo.s32DataSock[u8DataTypeId];
+    socklen_t s32OptLen = sizeof(SINT32);
+
+    /** The OS caps the requested size (2 GB) at its own maximum         */
+    sRFDCCard_SockInfo.s32DataSockRecvBuf[u8DataTypeId] = 0;
+    if (getsockopt(s32DataSock, SOL_SOCKET, SO_RCVBUF,
+                   (char *)&sRFDCCard_SockInfo.s32DataSockRecvBuf[u8DataTypeId],
+                   &s32OptLen) == -1)
+    {
+        THROW_ERROR_STATUS("ConfigureDataSockRecv(): "
+                           "getsockopt receive buffer failed");
+        return (STS_RFDCCARD_OS_ERR);
+    }
+
+#ifdef SO_RXQ_OVFL
+    /** Every packet received brings the count of packets dropped by the
+     *  socket so far in a control message                              */
+    SINT32 s32DropCount = 1;
+    if (setsockopt(s32DataSock, SOL_SOCKET, SO_RXQ_OVFL,
+                   (char *)&s32DropCount, sizeof(SINT32)) == -1)
+    {
+        sRFDCCard_SockInfo.bSockDropCount = false;
+    }
+#else
+    sRFDCCard_SockInfo.bSockDropCount = false;
 #endif
+
+#ifdef ENABLE_DEBUG
+    sprintf(s8DebugMsg, "\nData port %d receive buffer : %d bytes",
+            u8DataTypeId, sRFDCCard_SockInfo.s32DataSockRecvBuf[u8DataTypeId]);
+    DEBUG_FILE_WRITE(s8DebugMsg);
+#endif
+
+    return (STS_RFDCCARD_SUCCESS);
+}
+
+/** @fn STATUS StartSharedPortSystems(void)
+ * @brief This function is to send the start record command to the other <!--
+ * --> systems of a shared data port, the systems started are stopped <!--
+ * --> again if one of them fails
+ * @return SINT32 value
+ */
+STATUS StartSharedPortSystems(void)
+{
+    SINT8 s8Data[sizeof(DATA_CAPTURE_REQ)];
+    UINT16 u16PacketLen = 0;
+    STATUS s32Status = STS_RFDCCARD_SUCCESS;
+
+    if (objSharedPortDemux.getNumOfSystems() == 0)
+        return (STS_RFDCCARD_SUCCESS);
+
+    u16PacketLen = objCmdsProto.startRecordCommand(s8Data);
+    if (!objSharedPortDemux.sendCommand(s8Data, u16PacketLen,
+                                        CMD_CODE_START_RECORD,
+                                        &ethConf_ServAddr))
+    {
+        THROW_ERROR_STATUS("StartSharedPortSystems(): UDP write failed");
+        s32Status = STS_RFDCCARD_UDP_WRITE_ERR;
+    }
+    else
+    {
+        s32Status = objSharedPortDemux.waitResponses();
+    }
+
+    /** Systems started already record till they are stopped */
+    if (s32Status != STS_RFDCCARD_SUCCESS)
+        StopSharedPortSystems();
+
+    return s32Status;
+}
+
+/** @fn STATUS StopSharedPortSystems(void)
+ * @brief This function is to send the stop record command to the other <!--
+ * --> systems of a shared data port
+ * @return SINT32 value
+ */
+STATUS StopSharedPortSystems(void)
+{
+    SINT8 s8Data[sizeof(DATA_CAPTURE_REQ)];
+    UINT16 u16PacketLen = 0;
+
+    if (objSharedPortDemux.getNumOfSystems() == 0)
+        return (STS_RFDCCARD_SUCCESS);
+
+    u16PacketLen = objCmdsProto.stopRecordCommand(s8Data);
+    if (!objSharedPortDemux.sendCommand(s8Data, u16PacketLen,
+                                        CMD_CODE_STOP_RECORD,
+                                        &ethConf_ServAddr))
+    {
+        THROW_ERROR_STATUS("StopSharedPortSystems(): UDP write failed");
+        return (STS_RFDCCARD_UDP_WRITE_ERR);
+    }
+
+    return objSharedPortDemux.waitResponses();
+}
+
+/** @fn STATUS StartRecordData(strStartRecConfigMode sStartRecConfigMode)
+ * @brief This function is to start recording the data streamed over <!--
+ * --> Ethernet from the DCA1000EVM system with the \ref <!--
+ * --> strStartRecConfigMode structure configuration
+ * @param [in] sStartRecConfigMode [strStartRecConfigMode] - <!--
+ * --> Structure filled with record config data
+ * @pre Application should be connected to DCA1000EVM system and <!--
+ * --> FPGA and record packet delay should be configured
+ * @return SINT32 value
+ */
+STATUS StartRecordData(strStartRecConfigMode sStartRecConfigMode)
+{
+#ifdef ENABLE_DEBUG
+    DebugStartRecordConfig(sStartRecConfigMode);
+#endif
+
+    /** Validate the config and start the record threads              */
+    STATUS s32Status = PrepareRecordProcess(sStartRecConfigMode);
+    if (s32Status != STS_RFDCCARD_SUCCESS)
+        return s32Status;
+
+    /** Other systems of a shared data port are recording ahead of the
+     *  connected system                                                */
+    s32Status = StartSharedPortSystems();
+    if (s32Status != STS_RFDCCARD_SUCCESS)
+    {
+        StopRecordReceivers();
+        return s32Status;
     }
 
     /** Copy the start record mode info to Command packet                    */
@@ -1889,50 +2678,43 @@ STATUS StartRecordData(strStartRecConfigMode sStartRecConfigMode)
     /** Verifies the start record command sent status */
     if (s32BytesSent <= SOCKET_ERROR)
     {
-        objUdpDataRecv.setThreadStop();
-        if (sStartRecConfigMode.eConfigLogMode == MULTI_MODE)
-        {
-            objUdpCpDataRecv.setThreadStop();
-            objUdpCqDataRecv.setThreadStop();
-            objUdpR4fDataRecv.setThreadStop();
-            objUdpDspDataRecv.setThreadStop();
-        }
+        StopRecordReceivers();
+        StopSharedPortSystems();
 
         THROW_ERROR_STATUS("StartRecordData(): UDP write failed");
         return (STS_RFDCCARD_UDP_WRITE_ERR);
     }
     else
     {
-        /** Start duration stop mode timer if enabled */
-        if (sRFDCCard_StartRecConfig.eRecordStopMode == DURATION)
-        {
-            std::thread tTimerToStopRecCp([&]
-                                          { startDurationStopModeTimer(); });
-            tTimerToStopRecCp.detach();
-        }
-
         /** Wait for the start record command response  */
         if (STS_RFDCCARD_EVENT_TIMEOUT_ERR == osalObj_api.WaitForSignal(
                                                   &sgnCmdTimeoutWaitEvent, CMD_TIMEOUT_DURATION_SEC))
         {
-            /** Exit from the duration stop mode timer on unsuccessful start */
-            if (sRFDCCard_StartRecConfig.eRecordStopMode == DURATION)
-            {
-                sRFDCCard_StartRecConfig.u32DurationToCapture = 1;
-                osalObj_api.SignalEvent(&sgnDurationStopModeWaitEvent);
-            }
+            /** Stop the duration stop mode timer on unsuccessful start */
+            objCaptureTimers.reset();
+
+            /** Receivers stay connected for the next record process */
+            StopRecordReceivers();
+            StopSharedPortSystems();
 
             return STS_RFDCCARD_TIMEOUT_ERR;
         }
         else
         {
-            /** Start a timer to handle data capture timeout(if system disconnected) */
-            std::thread tToHandleCaptureTimeout([&]
-                                                { handleCaptureThreadTimeout(); });
-            tToHandleCaptureTimeout.detach();
+            /** Receivers are stopped by the config port thread on failure */
+            UINT16 u16Status = configResp.u16Status;
+            if (u16Status != SUCCESS_STATUS)
+            {
+                StopSharedPortSystems();
+                return u16Status;
+            }
+
+            /** Start the timer to handle data capture timeout (if system
+             *  disconnected) in the capture event loop                  */
+            StartCaptureTimeout();
 
             /** Return the command response to the calling application */
-            return configResp.u16Status;
+            return u16Status;
         }
     }
 
@@ -1944,42 +2726,129 @@ STATUS StartRecordData(strStartRecConfigMode sStartRecConfigMode)
     return (STS_RFDCCARD_SUCCESS);
 }
 
-/** @fn void startDurationStopModeTimer()
- * @brief This function is to initiate timer to handle duration stop mode <!--
- * --> of data recording
+/** @fn STATUS ConfigureAndStartRecordData(strFpgaConfigMode sFpgaConfigMode, <!--
+ * --> strRecConfigMode sRecConfigMode, strStartRecConfigMode sStartRecConfigMode)
+ * @brief This function is to configure the FPGA and the record packet <!--
+ * --> delay and start recording the data with the commands sent back to <!--
+ * --> back. Responses are matched by command code and a config command <!--
+ * --> is sent again on its response timeout
+ * @param [in] sFpgaConfigMode [strFpgaConfigMode] - <!--
+ * --> Structure filled with FPGA config data
+ * @param [in] sRecConfigMode [strRecConfigMode] - <!--
+ * --> Structure filled with record delay config data
+ * @param [in] sStartRecConfigMode [strStartRecConfigMode] - <!--
+ * --> Structure filled with record config data
+ * @pre Application should be connected to DCA1000EVM system using <!--
+ * --> \ref ConnectRFDCCard_RecordMode API
+ * @return SINT32 value (status of the first failed command)
  */
-void startDurationStopModeTimer()
+STATUS ConfigureAndStartRecordData(strFpgaConfigMode sFpgaConfigMode,
+                                   strRecConfigMode sRecConfigMode,
+                                   strStartRecConfigMode sStartRecConfigMode)
 {
-    /** Wait for the first data packet to be received in any of the data ports*/
-    osalObj_api.WaitForSignal(&sgnDurationStopModeWaitEvent, NON_STOP);
+    SINT8 s8FpgaData[sizeof(DATA_CAPTURE_REQ)];
+    SINT8 s8RecData[sizeof(DATA_CAPTURE_REQ)];
+    SINT8 s8StartData[sizeof(DATA_CAPTURE_REQ)];
+    UINT16 u16FpgaPacketLen = 0;
 
-    /** Timer to wait for the specified duration stop mode config   */
-    osalObj_api.SleepInMilliSec(sRFDCCard_StartRecConfig.u32DurationToCapture);
+#ifdef ENABLE_DEBUG
+    sprintf(s8DebugMsg, "\n\nConfigureAndStartRecordData : ");
+    DEBUG_FILE_WRITE(s8DebugMsg);
+    DebugStartRecordConfig(sStartRecConfigMode);
+#endif
 
-    /** Send the record completed status unless stop command is not sent */
-    if (!gbRecStopCmdSent)
-        RFDCARD_Callback(CMD_CODE_SYSTEM_ASYNC_STATUS,
-                         STS_REC_COMPLETED);
-}
+    /** Validate the config and fill all the command packets ahead        */
+    STATUS s32Status = FpgaConfigCmdPacket(sFpgaConfigMode, s8FpgaData,
+                                           &u16FpgaPacketLen);
+    if (s32Status != STS_RFDCCARD_SUCCESS)
+        return s32Status;
 
-/** @fn  void handleCaptureThreadTimeout()
- * @brief This function is to handle capture timeout when the system is  <!--
- * --> disconnected during capture process
- */
-void handleCaptureThreadTimeout()
-{
-    while (!gbRecStopCmdSent)
+    UINT16 u16RecPacketLen = RecordConfigCmdPacket(sRecConfigMode, s8RecData);
+    UINT16 u16StartPacketLen = objCmdsProto.startRecordCommand(s8StartData);
+
+    /** Record settings are logged with the packet delay of this record */
+    u16RecPktDelayUs = sRecConfigMode.u16RecDelay;
+
+    /** Validate the config and start the record threads              */
+    s32Status = PrepareRecordProcess(sStartRecConfigMode);
+    if (s32Status != STS_RFDCCARD_SUCCESS)
+        return s32Status;
+
+    /** Other systems of a shared data port are configured ahead, they
+     *  are recording before the pipeline starts the connected system  */
+    s32Status = StartSharedPortSystems();
+    if (s32Status != STS_RFDCCARD_SUCCESS)
     {
-        if (STS_RFDCCARD_EVENT_TIMEOUT_ERR == osalObj_api.WaitForSignal(
-                                                  &sgnCaptureTimeoutWaitEvent, CAPTURE_TIMEOUT_DURATION_SEC))
+        StopRecordReceivers();
+        return s32Status;
+    }
+
+    /** FPGA executes the commands in order, hence the record threads
+     *  are ready before the start record command is executed          */
+    objCmdPipeline.reset();
+    objCmdPipeline.addCommand(CMD_CODE_CONFIG_FPGA, s8FpgaData,
+                              u16FpgaPacketLen, PIPELINE_CMD_RESP_TIMEOUT_MS,
+                              PIPELINE_CMD_MAX_RETRIES);
+    objCmdPipeline.addCommand(CMD_CODE_CONFIG_RECORD, s8RecData,
+                              u16RecPacketLen, PIPELINE_CMD_RESP_TIMEOUT_MS,
+                              PIPELINE_CMD_MAX_RETRIES);
+    /** Start record is not sent again, FPGA may be recording already
+     *  when only its response is lost                                  */
+    objCmdPipeline.addCommand(CMD_CODE_START_RECORD, s8StartData,
+                              u16StartPacketLen, PIPELINE_CMD_RESP_TIMEOUT_MS,
+                              0);
+
+    s32Status = objCmdPipeline.execute();
+    if (s32Status != STS_RFDCCARD_SUCCESS)
+    {
+        /** FPGA records with the earlier config when only the start
+         *  record command succeeded, and may record when its response
+         *  timed out, stop it                                         */
+        STATUS s32StartStatus = objCmdPipeline.getStatus(CMD_CODE_START_RECORD);
+        if ((s32StartStatus == SUCCESS_STATUS) ||
+            (s32StartStatus == STS_RFDCCARD_TIMEOUT_ERR))
         {
-            /** Callback when Timeout occurs */
-            if (!gbRecStopCmdSent)
-            {
-                RFDCARD_Callback(STS_CAPTURE_THREAD_TIMEOUT, 0);
-            }
+            gbRecStopCmdSent = true;
+            UINT16 u16StopPacketLen = objCmdsProto.stopRecordCommand(s8StartData);
+            objCmdPipeline.reset();
+            objCmdPipeline.addCommand(CMD_CODE_STOP_RECORD, s8StartData,
+                                      u16StopPacketLen,
+                                      PIPELINE_CMD_RESP_TIMEOUT_MS,
+                                      PIPELINE_CMD_MAX_RETRIES);
+            objCmdPipeline.execute();
         }
+
+        /** Receivers stay connected for the next record process */
+        StopRecordReceivers();
+        StopSharedPortSystems();
+
+        return s32Status;
     }
+
+    /** Start the timer to handle data capture timeout (if system
+     *  disconnected) in the capture event loop                      */
+    StartCaptureTimeout();
+
+#ifdef ENABLE_DEBUG
+    sprintf(s8DebugMsg, "\n\nConfigureAndStartRecordData: Sent successfully");
+    DEBUG_FILE_WRITE(s8DebugMsg);
+#endif
+
+    return (STS_RFDCCARD_SUCCESS);
+}
+
+/** @fn void StartCaptureTimeout()
+ * @brief This function is to start the capture timeout of the record <!--
+ * --> process, the duration stop mode timer is started by the first packet
+ */
+void StartCaptureTimeout()
+{
+    UINT32 u32TimeoutMs = sRFDCCard_StartRecConfig.u32CaptureTimeout;
+
+    if (u32TimeoutMs == 0)
+        u32TimeoutMs = CAPTURE_TIMEOUT_DURATION_SEC * SEC_TO_MILLI_SEC_CONVERSION;
+
+    objCaptureTimers.startTimeout(u32TimeoutMs);
 }
 
 /** @fn STATUS StopRecordAsyncCmd(void)
@@ -2029,21 +2898,23 @@ STATUS StopRecordData(void)
     /** Resetting record global status    */
     gbRecStopCmdSent = true;
 
-    osalObj_api.SignalEvent(&sgnCaptureTimeoutWaitEvent);
+    objCaptureTimers.reset();
 
     /** Copy the start record mode info to Command packet                    */
     SINT8 s8Data[sizeof(DATA_CAPTURE_REQ)];
     UINT16 u16PacketLen = objCmdsProto.stopRecordCommand(s8Data);
 
     objUdpDataRecv.setThreadStop();
+    objSharedPortDemux.setThreadStop();
     if (sRFDCCard_StartRecConfig.eConfigLogMode == MULTI_MODE)
     {
-        objUdpCpDataRecv.setThreadStop();
-        objUdpCqDataRecv.setThreadStop();
-        objUdpR4fDataRecv.setThreadStop();
-        objUdpDspDataRecv.setThreadStop();
+        objUdpMultiPortRecv.setThreadStop();
     }
 
+    /** Other systems of a shared data port, the response of the
+     *  connected system is returned                                 */
+    StopSharedPortSystems();
+
     /** Verifies the stop record command sent status */
     std::cout << "Stop record data" << std::endl;
     if (SendConfigCmdRequest(s8Data, u16PacketLen) <= SOCKET_ERROR)
@@ -2214,6 +3085,291 @@ STATUS RecInlineProcStats_EventRegister(INLINE_PROC_HANDLER RecordStats_Callback
     return STS_RFDCCARD_SUCCESS;
 }
 
+/** @fn STATUS ReadRFDCCard_LatencyStats(strRFDCCard_LatencyStats *psLatencyStats)
+ * @brief This function is to read the latency histograms of the running <!--
+ * --> or last record process (inline processing)
+ * @param [out] psLatencyStats [strRFDCCard_LatencyStats *] - <!--
+ * --> Structure filled with the latency histograms
+ * @return SINT32 value
+ */
+STATUS ReadRFDCCard_LatencyStats(strRFDCCard_LatencyStats *psLatencyStats)
+{
+    if (NULL == psLatencyStats)
+    {
+#ifdef ENABLE_DEBUG
+        sprintf(s8DebugMsg,
+                "\n\nReadRFDCCard_LatencyStats(psLatencyStats is null)");
+        DEBUG_FILE_WRITE(s8DebugMsg);
+#endif
+        return (STS_RFDCCARD_INVALID_INPUT_PARAMS);
+    }
+
+    /** Histograms are updated by the record threads without a lock, a
+     *  copy taken while recording can be off by the samples in flight */
+    memcpy(psLatencyStats, &sRFDCCard_LatencyStats,
+           sizeof(strRFDCCard_LatencyStats));
+
+    return STS_RFDCCARD_SUCCESS;
+}
+
+/** @fn STATUS ReadRFDCCard_PatternStats(strRFDCCard_PatternStats *psPatternStats)
+ * @brief This function is to read the test pattern verification <!--
+ * --> statistics of the running or last record process
+ * @param [out] psPatternStats [strRFDCCard_PatternStats *] - <!--
+ * --> Structure filled with the verification statistics
+ * @return SINT32 value
+ */
+STATUS ReadRFDCCard_PatternStats(strRFDCCard_PatternStats *psPatternStats)
+{
+    if (NULL == psPatternStats)
+    {
+#ifdef ENABLE_DEBUG
+        sprintf(s8DebugMsg,
+                "\n\nReadRFDCCard_PatternStats(psPatternStats is null)");
+        DEBUG_FILE_WRITE(s8DebugMsg);
+#endif
+        return (STS_RFDCCARD_INVALID_INPUT_PARAMS);
+    }
+
+    memcpy(psPatternStats, &sRFDCCard_PatternStats,
+           sizeof(strRFDCCard_PatternStats));
+
+    return STS_RFDCCARD_SUCCESS;
+}
+
+/** @fn ULONG64 ReadRFDCCard_LatencyPercentile(const strRFDCCard_LatencyHist *psHist, DOUBLE dPercentile)
+ * @brief This function is to get the latency below which the given <!--
+ * --> percentage of the samples in a histogram fall
+ * @param [in] psHist [const strRFDCCard_LatencyHist *] - Latency histogram
+ * @param [in] dPercentile [DOUBLE] - Percentile (0 - 100)
+ * @return ULONG64 value - Latency in micro seconds
+ */
+ULONG64 ReadRFDCCard_LatencyPercentile(const strRFDCCard_LatencyHist *psHist,
+                                       DOUBLE dPercentile)
+{
+    return LatencyHistPercentile(psHist, dPercentile);
+}
+
+/** @fn STATUS OpenRecordStripes(SINT8 *s8ManifestFile, <!--
+ * -->                          STRIPE_READER_HANDLE *phReader)
+ * @brief This function is to open a record striped across several <!--
+ * --> base paths for reading it as one data stream
+ * @param [in] s8ManifestFile [SINT8 *] - Stripe manifest file of the record
+ * @param [out] phReader [STRIPE_READER_HANDLE *] - Reader handle
+ * @return SINT32 value
+ */
+STATUS OpenRecordStripes(SINT8 *s8ManifestFile, STRIPE_READER_HANDLE *phReader)
+{
+    STATUS s32Status = STS_RFDCCARD_SUCCESS;
+
+    if ((NULL == s8ManifestFile) || (NULL == phReader))
+        return (STS_RFDCCARD_INVALID_INPUT_PARAMS);
+
+    cStripeReader *pReader = new cStripeReader();
+    s32Status = pReader->openManifest(s8ManifestFile);
+    if (s32Status != STS_RFDCCARD_SUCCESS)
+    {
+#ifdef ENABLE_DEBUG
+        sprintf(s8DebugMsg, "\n\nOpenRecordStripes(%s) failed : %d",
+                s8ManifestFile, s32Status);
+        DEBUG_FILE_WRITE(s8DebugMsg);
+#endif
+        delete pReader;
+        return s32Status;
+    }
+
+    *phReader = pReader;
+    return STS_RFDCCARD_SUCCESS;
+}
+
+/** @fn SINT32 ReadRecordStripes(STRIPE_READER_HANDLE hReader, <!--
+ * -->                          SINT8 *s8Buffer, UINT32 u32Size)
+ * @brief This function is to read the next bytes of the data stream <!--
+ * --> of a striped record, the stripes are read in the recorded order
+ * @param [in] hReader [STRIPE_READER_HANDLE] - Reader handle
+ * @param [out] s8Buffer [SINT8 *] - Buffer filled with the data
+ * @param [in] u32Size [UINT32] - Size of buffer
+ * @return SINT32 value - Bytes read, 0 at the end of the record or <!--
+ * --> error status
+ */
+SINT32 ReadRecordStripes(STRIPE_READER_HANDLE hReader, SINT8 *s8Buffer,
+                         UINT32 u32Size)
+{
+    if ((NULL == hReader) || (NULL == s8Buffer))
+        return (STS_RFDCCARD_INVALID_INPUT_PARAMS);
+
+    return ((cStripeReader *)hReader)->readData(s8Buffer, u32Size);
+}
+
+/** @fn STATUS CloseRecordStripes(STRIPE_READER_HANDLE hReader)
+ * @brief This function is to close a striped record opened for reading
+ * @param [in] hReader [STRIPE_READER_HANDLE] - Reader handle
+ * @return SINT32 value
+ */
+STATUS CloseRecordStripes(STRIPE_READER_HANDLE hReader)
+{
+    if (NULL == hReader)
+        return (STS_RFDCCARD_INVALID_INPUT_PARAMS);
+
+    delete (cStripeReader *)hReader;
+    return STS_RFDCCARD_SUCCESS;
+}
+
+/** @fn STATUS OpenRecordTail(SINT8 *s8WatermarkFile, UINT32 u32FrameSize, <!--
+ * -->                       bool bFromLatest, RECORD_TAIL_HANDLE *phReader)
+ * @brief This function is to open a record in progress by its <!--
+ * --> watermark file for reading its committed frames
+ * @param [in] s8WatermarkFile [SINT8 *] - Watermark file of the record
+ * @param [in] u32FrameSize [UINT32] - Bytes of a frame, 0 for the <!--
+ * --> frame size of the watermark file
+ * @param [in] bFromLatest [bool] - Read from the first frame of the <!--
+ * --> record file written last, else from the oldest record file kept
+ * @param [out] phReader [RECORD_TAIL_HANDLE *] - Reader handle
+ * @return SINT32 value
+ */
+STATUS OpenRecordTail(SINT8 *s8WatermarkFile, UINT32 u32FrameSize,
+                      bool bFromLatest, RECORD_TAIL_HANDLE *phReader)
+{
+    STATUS s32Status = STS_RFDCCARD_SUCCESS;
+
+    if ((NULL == s8WatermarkFile) || (NULL == phReader))
+        return (STS_RFDCCARD_INVALID_INPUT_PARAMS);
+
+    cRecordTailReader *pReader = new cRecordTailReader();
+    s32Status = pReader->openWatermark(s8WatermarkFile, u32FrameSize,
+                                       bFromLatest);
+    if (s32Status != STS_RFDCCARD_SUCCESS)
+    {
+#ifdef ENABLE_DEBUG
+        sprintf(s8DebugMsg, "\n\nOpenRecordTail(%s) failed : %d",
+                s8WatermarkFile, s32Status);
+        DEBUG_FILE_WRITE(s8DebugMsg);
+#endif
+        delete pReader;
+        return s32Status;
+    }
+
+    *phReader = pReader;
+    return STS_RFDCCARD_SUCCESS;
+}
+
+/** @fn SINT32 ReadRecordTail(RECORD_TAIL_HANDLE hReader, SINT8 *s8Buffer, <!--
+ * -->                       UINT32 u32Size, UINT32 u32TimeoutMs, <!--
+ * -->                       ULONG64 *pu64Offset)
+ * @brief This function is to read the next whole frames committed in <!--
+ * --> the record, the watermark is polled till they are committed
+ * @param [in] hReader [RECORD_TAIL_HANDLE] - Reader handle
+ * @param [out] s8Buffer [SINT8 *] - Buffer filled with the data
+ * @param [in] u32Size [UINT32] - Size of buffer, one frame at least
+ * @param [in] u32TimeoutMs [UINT32] - Wait for the data in millisec
+ * @param [out] pu64Offset [ULONG64 *] - Record data offset of the <!--
+ * --> data read, NULL if not needed
+ * @return SINT32 value - Bytes read, 0 at the end of a stopped <!--
+ * --> record or error status (STS_RFDCCARD_TIMEOUT_ERR if nothing is <!--
+ * --> committed in time)
+ */
+SINT32 ReadRecordTail(RECORD_TAIL_HANDLE hReader, SINT8 *s8Buffer,
+                      UINT32 u32Size, UINT32 u32TimeoutMs, ULONG64 *pu64Offset)
+{
+    if ((NULL == hReader) || (NULL == s8Buffer))
+        return (STS_RFDCCARD_INVALID_INPUT_PARAMS);
+
+    return ((cRecordTailReader *)hReader)->readData(s8Buffer, u32Size,
+                                                    u32TimeoutMs, pu64Offset);
+}
+
+/** @fn STATUS CloseRecordTail(RECORD_TAIL_HANDLE hReader)
+ * @brief This function is to close a record opened by its watermark
+ * @param [in] hReader [RECORD_TAIL_HANDLE] - Reader handle
+ * @return SINT32 value
+ */
+STATUS CloseRecordTail(RECORD_TAIL_HANDLE hReader)
+{
+    if (NULL == hReader)
+        return (STS_RFDCCARD_INVALID_INPUT_PARAMS);
+
+    delete (cRecordTailReader *)hReader;
+    return STS_RFDCCARD_SUCCESS;
+}
+
+/** @fn STATUS VerifyRecordCrc(SINT8 *s8CrcLogFile, UINT32 u32NumOfThreads, <!--
+ * -->                        strRecordVerifyStatus *psVerifyStatus)
+ * @brief This function is to check the record data against the <!--
+ * --> CRC32C tags of its chunks. The record is read once, the chunks <!--
+ * --> read are checked by the worker threads while the next are read
+ * @param [in] s8CrcLogFile [SINT8 *] - CRC32C log file of the record
+ * @param [in] u32NumOfThreads [UINT32] - Worker threads, 0 for one <!--
+ * --> per processor core
+ * @param [out] psVerifyStatus [strRecordVerifyStatus *] - Verification <!--
+ * --> status
+ * @return SINT32 value
+ */
+STATUS VerifyRecordCrc(SINT8 *s8CrcLogFile, UINT32 u32NumOfThreads,
+                       strRecordVerifyStatus *psVerifyStatus)
+{
+    STATUS s32Status = STS_RFDCCARD_SUCCESS;
+    cRecordVerifier oVerifier;
+
+    if ((NULL == s8CrcLogFile) || (NULL == psVerifyStatus))
+        return (STS_RFDCCARD_INVALID_INPUT_PARAMS);
+
+    s32Status = oVerifier.openCrcLog(s8CrcLogFile);
+    if (s32Status == STS_RFDCCARD_SUCCESS)
+        s32Status = oVerifier.verifyRecord(u32NumOfThreads, psVerifyStatus);
+
+#ifdef ENABLE_DEBUG
+    if (s32Status != STS_RFDCCARD_SUCCESS)
+    {
+        sprintf(s8DebugMsg, "\n\nVerifyRecordCrc(%s) failed : %d",
+                s8CrcLogFile, s32Status);
+        DEBUG_FILE_WRITE(s8DebugMsg);
+    }
+#endif
+    return s32Status;
+}
+
+/** @fn STATUS TriggerRecordDump(void)
+ * @brief This function is to trigger a dump of the pre-trigger ring <!--
+ * --> in the record file (event trigger mode). The data from the <!--
+ * --> pre-trigger duration before the trigger till the post-trigger <!--
+ * --> duration after it is recorded. It only latches the trigger <!--
+ * --> time, hence it can be called from a signal handler
+ * @pre Record process should be running using \ref StartRecordData API
+ * @return SINT32 value
+ */
+STATUS TriggerRecordDump(void)
+{
+    /** No debug log here, the function is called from signal handlers */
+    if ((!objUdpDataRecv.getThreadStatus()) || (!objUdpDataRecv.setTrigger()))
+        return (STS_RFDCCARD_REC_NOT_TRIGGERED_MODE);
+
+    /** All the systems of a shared data port dump the same period */
+    objSharedPortDemux.setTrigger();
+
+    return STS_RFDCCARD_SUCCESS;
+}
+
+/** @fn STATUS RecordTrigger_EventRegister(RECORD_TRIGGER_HANDLER TriggerDetect_Callback)
+ * @brief This function is to register user callback for detecting <!--
+ * --> triggers in the ADC data (event trigger mode). It is called by <!--
+ * --> the file writer thread with each record buffer, NULL unregisters it
+ * @param [in] TriggerDetect_Callback [RECORD_TRIGGER_HANDLER] - <!--
+ * --> Callback function
+ * @return SINT32 value
+ */
+STATUS RecordTrigger_EventRegister(RECORD_TRIGGER_HANDLER TriggerDetect_Callback)
+{
+    RecordTrigger_Callback = TriggerDetect_Callback;
+
+#ifdef ENABLE_DEBUG
+    sprintf(s8DebugMsg, "\n\nRecordTrigger_EventRegister: %s",
+            (NULL == TriggerDetect_Callback) ? "Unregistered" : "Registered");
+    DEBUG_FILE_WRITE(s8DebugMsg);
+#endif
+
+    return STS_RFDCCARD_SUCCESS;
+}
+
 /** @fn STATUS ConfigureRFDCCard_Record(strRecConfigMode sRecConfigMode)
  * @brief This function is to configure record data packet delay <!--
  * --> in data recording with the following configuration @n <!--
@@ -2234,29 +3390,8 @@ STATUS ConfigureRFDCCard_Record(strRecConfigMode sRecConfigMode)
 #endif
 
     /** Copy the configuration mode info to Command packet                   */
-    UINT16 u16DataSize = 0;
-    UINT16 u16Data = 0;
-    UINT8 u8PacketData[MAX_DATA_BYTES];
-
-    u16Data = MAX_BYTES_PER_PACKET;
-    memcpy(&u8PacketData[u16DataSize], &u16Data,
-           sizeof(UINT16));
-    u16DataSize += UINT16_DATA_SIZE;
-
-    u16Data = ((UINT16)sRecConfigMode.u16RecDelay *
-               FPGA_CLK_CONVERSION_FACTOR /
-               FPGA_CLK_PERIOD_IN_NANO_SEC);
-    memcpy(&u8PacketData[u16DataSize], &u16Data,
-           sizeof(UINT16));
-    u16DataSize += UINT16_DATA_SIZE;
-    u16Data = 0;
-    memcpy(&u8PacketData[u16DataSize], &u16Data,
-           sizeof(UINT16));
-    u16DataSize += UINT16_DATA_SIZE;
-
     SINT8 s8Data[sizeof(DATA_CAPTURE_REQ)];
-    UINT16 u16PacketLen = objCmdsProto.configDataPacketCommand(s8Data,
-                                                               u8PacketData, u16DataSize);
+    UINT16 u16PacketLen = RecordConfigCmdPacket(sRecConfigMode, s8Data);
 
     /** Send the command packet to FPGA                                      */
     std::cout << "Configure_rdfcard_record sendt!" << std::endl;
@@ -2270,7 +3405,10 @@ STATUS ConfigureRFDCCard_Record(strRecConfigMode sRecConfigMode)
     else
     {
         /** Receive the command response        */
-        return GetConfigCmdResponse("ConfigureRFDCCard_Record");
+        STATUS s32Status = GetConfigCmdResponse("ConfigureRFDCCard_Record");
+        if (s32Status == STS_RFDCCARD_SUCCESS)
+            u16RecPktDelayUs = sRecConfigMode.u16RecDelay;
+        return s32Status;
     }
 
 #ifdef ENABLE_DEBUG
@@ -2281,6 +3419,40 @@ STATUS ConfigureRFDCCard_Record(strRecConfigMode sRecConfigMode)
     return (STS_RFDCCARD_SUCCESS);
 }
 
+/** @fn UINT16 RecordConfigCmdPacket(strRecConfigMode sRecConfigMode, SINT8 *s8Data)
+ * @brief This function is to fill the configure record packet delay <!--
+ * --> command packet
+ * @param [in] sRecConfigMode [strRecConfigMode] - <!--
+ * --> Structure filled with config data
+ * @param [out] s8Data [SINT8 *] - Command packet
+ * @return UINT16 value (command packet size)
+ */
+UINT16 RecordConfigCmdPacket(strRecConfigMode sRecConfigMode, SINT8 *s8Data)
+{
+    UINT16 u16DataSize = 0;
+    UINT16 u16Data = 0;
+    UINT8 u8PacketData[MAX_DATA_BYTES];
+
+    u16Data = MAX_BYTES_PER_PACKET;
+    memcpy(&u8PacketData[u16DataSize], &u16Data,
+           sizeof(UINT16));
+    u16DataSize += UINT16_DATA_SIZE;
+
+    u16Data = ((UINT16)sRecConfigMode.u16RecDelay *
+               FPGA_CLK_CONVERSION_FACTOR /
+               FPGA_CLK_PERIOD_IN_NANO_SEC);
+    memcpy(&u8PacketData[u16DataSize], &u16Data,
+           sizeof(UINT16));
+    u16DataSize += UINT16_DATA_SIZE;
+    u16Data = 0;
+    memcpy(&u8PacketData[u16DataSize], &u16Data,
+           sizeof(UINT16));
+    u16DataSize += UINT16_DATA_SIZE;
+
+    return objCmdsProto.configDataPacketCommand(s8Data, u8PacketData,
+                                                u16DataSize);
+}
+
 /** @fn STATUS ReadRFDCCard_DllVersion(SINT8 *s8DllVersion)
  * @brief This function is to read API DLL version
  * @param [out] s8DllVersion [SINT8 *] - Array filled with version
@@ -2450,12 +3622,167 @@ void WriteRecordSettingsInLogFile()
             sprintf(s8LogMsg2, "\nDuration mode : Duration (%d)",
                     sRFDCCard_StartRecConfig.u32DurationToCapture);
         strcat(s8LogMsg, s8LogMsg2);
+        /** Receive buffer against the peak data rate of the packet delay,
+         *  the OS counts its own overhead per packet in the buffer too   */
+        sprintf(s8LogMsg2, "\nSocket receive buffer (bytes) : %d",
+                sRFDCCard_SockInfo.s32DataSockRecvBuf[RAW_DATA_INDEX]);
+        strcat(s8LogMsg, s8LogMsg2);
+        if (u16RecPktDelayUs > 0)
+        {
+            DOUBLE dPktPeriodNs = (DOUBLE)u16RecPktDelayUs *
+                                  FPGA_CLK_CONVERSION_FACTOR +
+                                  REC_PKT_WIRE_TIME_NS;
+            DOUBLE dBufDurationMs =
+                (DOUBLE)sRFDCCard_SockInfo.s32DataSockRecvBuf[RAW_DATA_INDEX] /
+                MAX_BYTES_PER_PACKET * dPktPeriodNs / 1000000;
+            sprintf(s8LogMsg2, "\nSocket receive buffer holds : %.1f ms at "
+                    "%.2f MB/s (packet delay %d us)%s", dBufDurationMs,
+                    (MAX_BYTES_PER_PACKET - RECORD_DATA_BUF_INDEX) * 1000 /
+                    dPktPeriodNs, u16RecPktDelayUs,
+                    (dBufDurationMs < MIN_SOCK_RECV_BUF_DURATION_MS) ?
+                    " - too small, raise the OS maximum (net.core.rmem_max)" :
+                    "");
+            strcat(s8LogMsg, s8LogMsg2);
+        }
+        sprintf(s8LogMsg2, "\nSocket drop counter : %s",
+                sRFDCCard_SockInfo.bSockDropCount ? "Enabled" :
+                "Not supported");
+        strcat(s8LogMsg, s8LogMsg2);
+        if (sRFDCCard_SockInfo.bUdpGro)
+            sprintf(s8LogMsg2, "\nUDP GRO : Enabled");
+        else if (sRFDCCard_StartRecConfig.bUdpGroEnable)
+            sprintf(s8LogMsg2, "\nUDP GRO : Not supported");
+        else
+            sprintf(s8LogMsg2, "\nUDP GRO : Disabled");
+        strcat(s8LogMsg, s8LogMsg2);
+        sprintf(s8LogMsg2, "\nCapture timeout (ms) : %u",
+                (sRFDCCard_StartRecConfig.u32CaptureTimeout == 0) ?
+                (CAPTURE_TIMEOUT_DURATION_SEC * SEC_TO_MILLI_SEC_CONVERSION) :
+                sRFDCCard_StartRecConfig.u32CaptureTimeout);
+        strcat(s8LogMsg, s8LogMsg2);
+        strSharedPortConfig *psShared = &sRFDCCard_StartRecConfig.sSharedPort;
+        if (psShared->u8NumOfSystems > 1)
+        {
+            sprintf(s8LogMsg2, "\nShared data port systems : %d",
+                    psShared->u8NumOfSystems);
+            strcat(s8LogMsg, s8LogMsg2);
+            for (int i = 0; i < psShared->u8NumOfSystems; i++)
+            {
+                sprintf(s8LogMsg2, "\nShared data port system %d : "
+                        "%d.%d.%d.%d", i, psShared->au8IpAddr[i][0],
+                        psShared->au8IpAddr[i][1], psShared->au8IpAddr[i][2],
+                        psShared->au8IpAddr[i][3]);
+                strcat(s8LogMsg, s8LogMsg2);
+            }
+        }
 #ifdef POST_PROCESSING
         if (sRFDCCard_StartRecConfig.bSequenceNumberEnable)
             sprintf(s8LogMsg2, "\nSequence number : true");
         else
             sprintf(s8LogMsg2, "\nSequence number : false");
         strcat(s8LogMsg, s8LogMsg2);
+#else
+        sprintf(s8LogMsg2, "\nWriter spill (MB) : %d",
+                sRFDCCard_StartRecConfig.u16WriterSpillSize);
+        strcat(s8LogMsg, s8LogMsg2);
+        if (sRFDCCard_StartRecConfig.u8NumOfStripePaths > 1)
+        {
+            sprintf(s8LogMsg2, "\nStripe paths : %d",
+                    sRFDCCard_StartRecConfig.u8NumOfStripePaths);
+            strcat(s8LogMsg, s8LogMsg2);
+        }
+        if (sRFDCCard_StartRecConfig.eWriterOverflowPolicy ==
+                WRITER_OVERFLOW_DROP_FRAMES)
+            sprintf(s8LogMsg2, "\nWriter overflow policy : Drop frames");
+        else
+            sprintf(s8LogMsg2, "\nWriter overflow policy : Pause");
+        strcat(s8LogMsg, s8LogMsg2);
+        if (sRFDCCard_StartRecConfig.eWriterBackend == WRITER_BACKEND_MMAP)
+            sprintf(s8LogMsg2, "\nWriter backend : mmap");
+        else
+            sprintf(s8LogMsg2, "\nWriter backend : fwrite");
+        strcat(s8LogMsg, s8LogMsg2);
+        if ((sRFDCCard_StartRecConfig.u32RetentionSize > 0) ||
+            (sRFDCCard_StartRecConfig.u32RetentionAge > 0))
+            sprintf(s8LogMsg2, "\nRetention size (MB) : %u\nRetention age "
+                    "(s) : %u", sRFDCCard_StartRecConfig.u32RetentionSize,
+                    sRFDCCard_StartRecConfig.u32RetentionAge);
+        else
+            sprintf(s8LogMsg2, "\nRetention : Disabled");
+        strcat(s8LogMsg, s8LogMsg2);
+        sprintf(s8LogMsg2, "\nWatermark : %s",
+                sRFDCCard_StartRecConfig.bWatermarkEnable ? "Enabled" :
+                                                            "Disabled");
+        strcat(s8LogMsg, s8LogMsg2);
+        if (sRFDCCard_StartRecConfig.u32FramesPerFile > 0)
+            sprintf(s8LogMsg2, "\nFile rollover : %u frames",
+                    sRFDCCard_StartRecConfig.u32FramesPerFile);
+        else if (sRFDCCard_StartRecConfig.u32FileDuration > 0)
+            sprintf(s8LogMsg2, "\nFile rollover : %u ms",
+                    sRFDCCard_StartRecConfig.u32FileDuration);
+        else
+            sprintf(s8LogMsg2, "\nFile rollover : Size");
+        strcat(s8LogMsg, s8LogMsg2);
+        if (sRFDCCard_StartRecConfig.eRecordTriggerMode == RECORD_TRIGGER_EVENT)
+        {
+            sprintf(s8LogMsg2, "\nTrigger mode : Event\nPre-trigger (ms) : %u"
+                    "\nPost-trigger (ms) : %u\nTrigger ring (MB) : %d",
+                    sRFDCCard_StartRecConfig.u32PreTriggerDuration,
+                    sRFDCCard_StartRecConfig.u32PostTriggerDuration,
+                    sRFDCCard_StartRecConfig.u16TriggerRingSize);
+        }
+        else
+            sprintf(s8LogMsg2, "\nTrigger mode : Continuous");
+        strcat(s8LogMsg, s8LogMsg2);
+
+        /** Data dropped by the capture filter is known from its config */
+        strCaptureFilterConfig *psFilter =
+                                &sRFDCCard_StartRecConfig.sCaptureFilter;
+        if (psFilter->bFilterEnable)
+        {
+            sprintf(s8LogMsg2, "\nCapture filter ADC layout : %d samples %s,"
+                    " RX channels 0x%X, %d chirps per frame",
+                    psFilter->u16NumAdcSamples,
+                    (psFilter->u8AdcFmt == 0) ? "real" : "complex",
+                    psFilter->u8RxChanEn, psFilter->u16NumChirpsPerFrame);
+            strcat(s8LogMsg, s8LogMsg2);
+            sprintf(s8LogMsg2, "\nCapture filter frames kept : every %u "
+                    "from %u to %u", psFilter->u32FrameDecimation,
+                    psFilter->u32FrameStartIdx, psFilter->u32FrameEndIdx);
+            strcat(s8LogMsg, s8LogMsg2);
+            sprintf(s8LogMsg2, "\nCapture filter RX channels kept : 0x%X"
+                    "\nCapture filter chirps kept : %d to %d",
+                    psFilter->u8RxChanSel, psFilter->u16ChirpStartIdx,
+                    psFilter->u16ChirpEndIdx);
+        }
+        else
+            sprintf(s8LogMsg2, "\nCapture filter : Disabled");
+        strcat(s8LogMsg, s8LogMsg2);
+        if (sRFDCCard_StartRecConfig.u16CrcChunkSize > 0)
+            sprintf(s8LogMsg2, "\nCRC32C chunk size (KB) : %d",
+                    sRFDCCard_StartRecConfig.u16CrcChunkSize);
+        else
+            sprintf(s8LogMsg2, "\nCRC32C : Disabled");
+        strcat(s8LogMsg, s8LogMsg2);
+        strTestPatternConfig *psPattern =
+                                &sRFDCCard_StartRecConfig.sTestPattern;
+        if (psPattern->bVerifyEnable)
+        {
+            sprintf(s8LogMsg2, "\nTest pattern verification : %s, "
+                    "packet size %d samples, no record files",
+                    (psPattern->u8AdcFmt == 0) ? "real" : "complex",
+                    psPattern->u16PktSize);
+            strcat(s8LogMsg, s8LogMsg2);
+            for (int i = 0; i < MAX_PATTERN_SLOTS; i++)
+            {
+                sprintf(s8LogMsg2, "\nTest pattern lane %d %s (offset, "
+                        "increment) : 0x%04X, 0x%04X", i % MAX_PATTERN_LANES,
+                        (i < MAX_PATTERN_LANES) ? "I" : "Q",
+                        psPattern->au32LaneCfg[i] & 0xFFFF,
+                        psPattern->au32LaneCfg[i] >> 16);
+                strcat(s8LogMsg, s8LogMsg2);
+            }
+        }
 #endif
         sprintf(s8LogMsg2, "\nMax file size (MB) : %d,",
                 sRFDCCard_StartRecConfig.u16MaxRecFileSize);
@@ -2487,12 +3814,18 @@ void WriteInlineProcSummaryInLogFile()
     SINT8 s8LogMsg[MAX_FILE_UPDATE_LEN];
     SINT8 s8LogMsg2[MAX_NAME_LEN];
     UINT8 u8NumDataTypes = NUM_DATA_TYPES;
+#if !defined(POST_PROCESSING) && defined(LATENCY_HISTOGRAMS)
+    const SINT8 *s8LatencyHistName[NUM_LATENCY_HISTS] = LATENCY_HIST_NAMES;
+#endif
 
     if (pInlineLogFile != NULL)
     {
+        /** Raw mode - one entry per system of a shared data port */
+        strSharedPortConfig *psShared = &sRFDCCard_StartRecConfig.sSharedPort;
         if (sRFDCCard_StartRecConfig.eConfigLogMode == RAW_MODE)
         {
-            u8NumDataTypes = 1;
+            u8NumDataTypes = (psShared->u8NumOfSystems > 1) ?
+                             psShared->u8NumOfSystems : 1;
         }
 
         for (int i = 0; i < u8NumDataTypes; i++)
@@ -2501,6 +3834,12 @@ void WriteInlineProcSummaryInLogFile()
             {
                 sprintf(s8LogMsg2, "\nRaw Data :");
             }
+            else if (sRFDCCard_StartRecConfig.eConfigLogMode == RAW_MODE)
+            {
+                sprintf(s8LogMsg2, "\nRaw Data (System %d - %d.%d.%d.%d) :",
+                        i, psShared->au8IpAddr[i][0], psShared->au8IpAddr[i][1],
+                        psShared->au8IpAddr[i][2], psShared->au8IpAddr[i][3]);
+            }
             else
             {
                 if (strcmp(sRFDCCard_InlineStats.s8HeaderId[i],
@@ -2541,7 +3880,39 @@ void WriteInlineProcSummaryInLogFile()
             sprintf(s8LogMsg2, "\nNumber of zero filled bytes - %llu",
                     sRFDCCard_InlineStats.u64NumOfZeroFilledBytes[i]);
             strcat(s8LogMsg, s8LogMsg2);
+            if (sRFDCCard_SockInfo.bSockDropCount)
+                sprintf(s8LogMsg2, "\nLost packets - %llu socket overflow, "
+                        "%llu upstream",
+                        sRFDCCard_InlineStats.u64NumOfSockDroppedPackets[i],
+                        sRFDCCard_InlineStats.u64NumOfUpstreamLostPackets[i]);
+            else
+                sprintf(s8LogMsg2, "\nLost packets - not attributed (no "
+                        "socket drop counter)");
+            strcat(s8LogMsg, s8LogMsg2);
+            sprintf(s8LogMsg2, "\nWriter busy at buffer swap - %llu of %llu",
+                    sRFDCCard_InlineStats.u64NumOfWriterWaits[i],
+                    sRFDCCard_InlineStats.u64NumOfBufSwaps[i]);
+            strcat(s8LogMsg, s8LogMsg2);
+            sprintf(s8LogMsg2, "\nBuffers spilled to RAM for busy writer - %llu",
+                    sRFDCCard_InlineStats.u64NumOfSpilledBufs[i]);
+            strcat(s8LogMsg, s8LogMsg2);
+            sprintf(s8LogMsg2, "\nPaused for busy writer - %llu",
+                    sRFDCCard_InlineStats.u64NumOfWriterPauses[i]);
+            strcat(s8LogMsg, s8LogMsg2);
+            sprintf(s8LogMsg2, "\nDropped for busy writer - %llu frames, %llu bytes",
+                    sRFDCCard_InlineStats.u64NumOfDroppedFrames[i],
+                    sRFDCCard_InlineStats.u64NumOfDroppedBytes[i]);
+            strcat(s8LogMsg, s8LogMsg2);
+            sprintf(s8LogMsg2, "\nPre-trigger ring dumps - %llu",
+                    sRFDCCard_InlineStats.u64NumOfTriggerDumps[i]);
+            strcat(s8LogMsg, s8LogMsg2);
+            sprintf(s8LogMsg2, "\nBytes dropped by capture filter - %llu",
+                    sRFDCCard_InlineStats.u64NumOfFilteredBytes[i]);
+            strcat(s8LogMsg, s8LogMsg2);
 #endif
+            sprintf(s8LogMsg2, "\nPackets recovered by socket drain - %llu",
+                    sRFDCCard_InlineStats.u64NumOfDrainedPackets[i]);
+            strcat(s8LogMsg, s8LogMsg2);
             sprintf(s8LogMsg2, "\nCapture start time - %s",
                     ctime(&sRFDCCard_InlineStats.StartTime[i]));
             strcat(s8LogMsg, s8LogMsg2);
@@ -2552,6 +3923,48 @@ void WriteInlineProcSummaryInLogFile()
                                        sRFDCCard_InlineStats.StartTime[i]);
             sprintf(s8LogMsg2, "Duration(sec) - %llu", seconds);
             strcat(s8LogMsg, s8LogMsg2);
+#if !defined(POST_PROCESSING) && defined(LATENCY_HISTOGRAMS)
+            for (int j = 0; j < NUM_LATENCY_HISTS; j++)
+            {
+                strRFDCCard_LatencyHist *psHist =
+                        &sRFDCCard_LatencyStats.sHist[i][j];
+
+                if (psHist->u64TotalCount == 0)
+                    continue;
+
+                sprintf(s8LogMsg2, "\n%s latency(us) - count %llu, mean %llu, "
+                        "p50 %llu, p99 %llu, p99.9 %llu, max %llu",
+                        s8LatencyHistName[j], psHist->u64TotalCount,
+                        psHist->u64TotalUs / psHist->u64TotalCount,
+                        LatencyHistPercentile(psHist, 50),
+                        LatencyHistPercentile(psHist, 99),
+                        LatencyHistPercentile(psHist, 99.9),
+                        psHist->u64MaxUs);
+                strcat(s8LogMsg, s8LogMsg2);
+            }
+#endif
+#ifndef POST_PROCESSING
+            if (sRFDCCard_StartRecConfig.sTestPattern.bVerifyEnable)
+            {
+                sprintf(s8LogMsg2, "\nTest pattern checked - %llu packets, "
+                        "%llu words, %llu bad packets",
+                        sRFDCCard_PatternStats.u64NumOfCheckedPackets,
+                        sRFDCCard_PatternStats.u64NumOfCheckedWords,
+                        sRFDCCard_PatternStats.u64NumOfBadPackets);
+                strcat(s8LogMsg, s8LogMsg2);
+                for (int j = 0; j < u8LaneNumber; j++)
+                {
+                    sprintf(s8LogMsg2, "\nTest pattern lane %d - bit errors "
+                            "%llu in %llu words, lane swaps %llu, "
+                            "misaligned %llu", j,
+                            sRFDCCard_PatternStats.u64NumOfBitErrors[j],
+                            sRFDCCard_PatternStats.u64NumOfBadWords[j],
+                            sRFDCCard_PatternStats.u64NumOfLaneSwaps[j],
+                            sRFDCCard_PatternStats.u64NumOfMisalignedWords[j]);
+                    strcat(s8LogMsg, s8LogMsg2);
+                }
+            }
+#endif
 
             fprintf(pInlineLogFile, "\n%s", s8LogMsg);
         }
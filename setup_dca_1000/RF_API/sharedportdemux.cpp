@@ -0,0 +1,349 @@
+/**
+ * @file sharedportdemux.cpp
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains the shared data port demultiplexing of several
+ * DCA1000EVM systems recorded by one record process
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+///****************
+/// Includes
+///****************
+
+#include "sharedportdemux.h"
+#include "extern.h"
+
+#include <thread>
+
+/** @fn cSharedPortDemux::cSharedPortDemux(cUdpDataReceiver *pConnectedDataRecv)
+ * @brief This constructor function is to initialize the class member <!--
+ * --> variables with the data port receiver of the connected system
+ * @param [in] pConnectedDataRecv [cUdpDataReceiver *] - Data port <!--
+ * --> receiver of the connected system
+ */
+cSharedPortDemux::cSharedPortDemux(cUdpDataReceiver *pConnectedDataRecv)
+{
+    u8NumOfSystems = 0;
+    u8LastSystem = 0;
+    memset(au32IpAddr, 0, sizeof(au32IpAddr));
+    pDataRecv[0] = pConnectedDataRecv;
+    for(UINT8 i = 1; i < MAX_SHARED_PORT_SYSTEMS; i ++)
+        pDataRecv[i] = NULL;
+    u32CompletedMask = 0;
+    u32PendingRespMask = 0;
+    u32RespCmdCode = 0;
+    s32RespStatus = SUCCESS_STATUS;
+}
+
+/** @fn bool cSharedPortDemux::setSystems(const strSharedPortConfig *psConfig)
+ * @brief This function is to set the systems of the next record <!--
+ * --> process. The receivers of the other systems are kept across <!--
+ * --> record processes of the same connection
+ * @param [in] psConfig [const strSharedPortConfig *] - Systems
+ * @return boolean value
+ */
+bool cSharedPortDemux::setSystems(const strSharedPortConfig *psConfig)
+{
+    /** A single system records the data port as before */
+    u8NumOfSystems = 0;
+    u8LastSystem = 0;
+    if(psConfig->u8NumOfSystems <= 1)
+        return true;
+
+    for(UINT8 i = 0; i < psConfig->u8NumOfSystems; i ++)
+    {
+        memcpy(&au32IpAddr[i], psConfig->au8IpAddr[i], UINT32_DATA_SIZE);
+        if((i > 0) && (pDataRecv[i] == NULL))
+        {
+            pDataRecv[i] = new (std::nothrow) cUdpDataReceiver(RAW_DATA_INDEX,
+                                                               i);
+            if(pDataRecv[i] == NULL)
+                return false;
+
+            /** Packets of all the systems are dropped by the one socket */
+            pDataRecv[i]->shareSockDrops(pDataRecv[0]);
+        }
+    }
+
+    u8NumOfSystems = psConfig->u8NumOfSystems;
+    return true;
+}
+
+/** @fn UINT8 cSharedPortDemux::getNumOfSystems()
+ * @brief This function is to get the number of systems sharing the <!--
+ * --> data port
+ * @return UINT8 value, 0 if the data port is not shared
+ */
+UINT8 cSharedPortDemux::getNumOfSystems()
+{
+    return u8NumOfSystems;
+}
+
+/** @fn cUdpDataReceiver *cSharedPortDemux::getReceiver(UINT32 u32IpAddr)
+ * @brief This function is to get the receiver of the system a packet <!--
+ * --> of the shared data port is received from
+ * @param [in] u32IpAddr [UINT32] - Source IP address (network byte order)
+ * @return cUdpDataReceiver pointer, NULL if not from one of the systems
+ */
+cUdpDataReceiver *cSharedPortDemux::getReceiver(UINT32 u32IpAddr)
+{
+    if(au32IpAddr[u8LastSystem] == u32IpAddr)
+        return pDataRecv[u8LastSystem];
+
+    for(UINT8 i = 0; i < u8NumOfSystems; i ++)
+    {
+        if(au32IpAddr[i] == u32IpAddr)
+        {
+            u8LastSystem = i;
+            return pDataRecv[i];
+        }
+    }
+
+    return NULL;
+}
+
+/** @fn UINT8 cSharedPortDemux::getSystemIndex(UINT32 u32IpAddr)
+ * @brief This function is to get the system index of an IP address
+ * @param [in] u32IpAddr [UINT32] - IP address (network byte order)
+ * @return UINT8 value, 0 (connected system) if not one of the systems
+ */
+UINT8 cSharedPortDemux::getSystemIndex(UINT32 u32IpAddr)
+{
+    for(UINT8 i = 1; i < u8NumOfSystems; i ++)
+    {
+        if(au32IpAddr[i] == u32IpAddr)
+            return i;
+    }
+
+    return 0;
+}
+
+/** @fn void cSharedPortDemux::setThreadStart()
+ * @brief This function is to start recording the other systems, their <!--
+ * --> file writer threads are started here
+ */
+void cSharedPortDemux::setThreadStart()
+{
+    u32CompletedMask = 0;
+
+    for(UINT8 i = 1; i < u8NumOfSystems; i ++)
+    {
+        pDataRecv[i]->setThreadStart();
+#ifndef POST_PROCESSING
+        cUdpDataReceiver *pRecv = pDataRecv[i];
+        std::thread tWriter([pRecv] { pRecv->Thread_WriteDataToFile(); });
+        tWriter.detach();
+#endif
+    }
+}
+
+/** @fn void cSharedPortDemux::setThreadStop()
+ * @brief This function is to stop recording the other systems and <!--
+ * --> close their record files
+ */
+void cSharedPortDemux::setThreadStop()
+{
+    for(UINT8 i = 1; i < u8NumOfSystems; i ++)
+        pDataRecv[i]->setThreadStop();
+}
+
+/** @fn bool cSharedPortDemux::setTrigger()
+ * @brief This function is to latch a trigger of the pre-trigger ring <!--
+ * --> dump of the other systems, it is safe to call from a signal handler
+ * @return boolean value, false if not recording in event trigger mode
+ */
+bool cSharedPortDemux::setTrigger()
+{
+    bool bTriggered = true;
+
+    for(UINT8 i = 1; i < u8NumOfSystems; i ++)
+    {
+        if((!pDataRecv[i]->getThreadStatus()) || (!pDataRecv[i]->setTrigger()))
+            bTriggered = false;
+    }
+
+    return bTriggered;
+}
+
+/** @fn void cSharedPortDemux::releaseBuffers()
+ * @brief This function is to free the receivers of the other systems
+ */
+void cSharedPortDemux::releaseBuffers()
+{
+    for(UINT8 i = 1; i < MAX_SHARED_PORT_SYSTEMS; i ++)
+    {
+        if(pDataRecv[i] != NULL)
+        {
+            pDataRecv[i]->releaseBuffers();
+            delete pDataRecv[i];
+            pDataRecv[i] = NULL;
+        }
+    }
+    u8NumOfSystems = 0;
+    u8LastSystem = 0;
+}
+
+/** @fn bool cSharedPortDemux::setCompleted(UINT8 u8System)
+ * @brief This function is to mark a system as done with the record
+ * @param [in] u8System [UINT8] - System index
+ * @return boolean value, true once for the last system done (always <!--
+ * --> true if the data port is not shared)
+ */
+bool cSharedPortDemux::setCompleted(UINT8 u8System)
+{
+    UINT32 u32AllMask = 0;
+    UINT32 u32PrevMask = 0;
+
+    if(u8NumOfSystems == 0)
+        return true;
+
+    u32AllMask = (1U << u8NumOfSystems) - 1;
+    u32PrevMask = u32CompletedMask.fetch_or(1U << u8System);
+
+    /** Only the system completing the set reports it */
+    return ((u32PrevMask != u32AllMask) &&
+            ((u32PrevMask | (1U << u8System)) == u32AllMask));
+}
+
+/** @fn bool cSharedPortDemux::sendCommand(const SINT8 *s8Data, UINT16 u16PacketLen, <!--
+ * --> UINT16 u16CmdCode, const struct sockaddr_in *psConfigAddr)
+ * @brief This function is to send a command to the other systems <!--
+ * --> through the config port, the responses are awaited by <!--
+ * --> \ref waitResponses
+ * @param [in] s8Data [const SINT8 *] - Command data buffer
+ * @param [in] u16PacketLen [UINT16] - Command data buffer size
+ * @param [in] u16CmdCode [UINT16] - Command code
+ * @param [in] psConfigAddr [const struct sockaddr_in *] - Config port <!--
+ * --> address of the connected system
+ * @return boolean value, false if a command could not be sent
+ */
+bool cSharedPortDemux::sendCommand(const SINT8 *s8Data, UINT16 u16PacketLen,
+                                   UINT16 u16CmdCode,
+                                   const struct sockaddr_in *psConfigAddr)
+{
+    struct sockaddr_in sAddr;
+    UINT32 u32Mask = 0;
+    bool bSent = true;
+
+    /** Clear a response signal left by the previous command          */
+    osalObj_api.WaitForSignalInMilliSec(&sgnSharedPortWaitEvent, 0);
+    s32RespStatus = SUCCESS_STATUS;
+    u32RespCmdCode = u16CmdCode;
+
+    for(UINT8 i = 1; i < u8NumOfSystems; i ++)
+        u32Mask |= (1U << i);
+    u32PendingRespMask = u32Mask;
+
+    /** The other systems listen on the config port of the connected one */
+    memcpy(&sAddr, psConfigAddr, sizeof(sAddr));
+    for(UINT8 i = 1; i < u8NumOfSystems; i ++)
+    {
+        sAddr.sin_addr.s_addr = au32IpAddr[i];
+        if(sendto(sRFDCCard_SockInfo.s32EthConfSock, s8Data, u16PacketLen, 0,
+                  (struct sockaddr *)&sAddr, sizeof(sAddr)) < u16PacketLen)
+        {
+            u32PendingRespMask &= ~(1U << i);
+            bSent = false;
+        }
+    }
+
+    return bSent;
+}
+
+/** @fn STATUS cSharedPortDemux::waitResponses()
+ * @brief This function is to wait for the command responses of the <!--
+ * --> other systems, \ref sgnSharedPortWaitEvent should be initialized
+ * @return SINT32 value, first failure status of the responses
+ */
+STATUS cSharedPortDemux::waitResponses()
+{
+    if((u32PendingRespMask != 0) &&
+       (STS_RFDCCARD_EVENT_TIMEOUT_ERR == osalObj_api.WaitForSignal(
+                        &sgnSharedPortWaitEvent, CMD_TIMEOUT_DURATION_SEC)) &&
+       (u32PendingRespMask != 0))
+    {
+        u32PendingRespMask = 0;
+        return STS_RFDCCARD_TIMEOUT_ERR;
+    }
+
+    return s32RespStatus;
+}
+
+/** @fn bool cSharedPortDemux::setResponse(UINT32 u32IpAddr, UINT16 u16CmdCode, UINT16 u16Status)
+ * @brief This function is to hand a command response received on the <!--
+ * --> config port over, if it is of one of the other systems
+ * @param [in] u32IpAddr [UINT32] - Source IP address (network byte order)
+ * @param [in] u16CmdCode [UINT16] - Command code
+ * @param [in] u16Status [UINT16] - Command status
+ * @return boolean value, true if taken as response of another system
+ */
+bool cSharedPortDemux::setResponse(UINT32 u32IpAddr, UINT16 u16CmdCode,
+                                   UINT16 u16Status)
+{
+    UINT8 u8System = 0;
+    UINT32 u32PrevMask = 0;
+    SINT32 s32NoFailure = SUCCESS_STATUS;
+
+    /** Async status of the other systems is handled as of the connected
+     *  one, their start and stop record responses are taken here       */
+    if((u16CmdCode != CMD_CODE_START_RECORD) &&
+       (u16CmdCode != CMD_CODE_STOP_RECORD))
+        return false;
+
+    u8System = getSystemIndex(u32IpAddr);
+    if(u8System == 0)
+        return false;
+
+    if(u16CmdCode != u32RespCmdCode)
+        return true;
+
+    if(u16Status != SUCCESS_STATUS)
+        s32RespStatus.compare_exchange_strong(s32NoFailure, u16Status);
+
+    u32PrevMask = u32PendingRespMask.fetch_and(~(1U << u8System));
+    if(u32PrevMask == (1U << u8System))
+        osalObj_api.SignalEvent(&sgnSharedPortWaitEvent);
+
+    return true;
+}
@@ -0,0 +1,209 @@
+/**
+ * @file sharedportdemux.h
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains the shared data port demultiplexing of several
+ * DCA1000EVM systems recorded by one record process
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+#ifndef SHAREDPORTDEMUX_H
+#define SHAREDPORTDEMUX_H
+
+///****************
+/// Includes
+///****************
+
+#include <atomic>
+
+#include "recorddatarecv.h"
+
+/** The response and completion masks are shared by the config port thread,
+ *  the capture event loop and the API calls, hence keep them aligned for
+ *  the atomic access                                                    */
+#pragma pack(push, 8)
+
+/** @class cSharedPortDemux
+ * @brief This class provides support APIs to record several DCA1000EVM <!--
+ * --> systems streaming to one data port (Raw mode). The capture event <!--
+ * --> loop of the data port hands each packet to the \ref <!--
+ * --> cUdpDataReceiver of its source IP address, hence every system has <!--
+ * --> its own sequence tracking, buffers, file writer and record files <!--
+ * --> while the socket and the receive thread stay shared. The start and <!--
+ * --> stop record commands are sent to the other systems as well and <!--
+ * --> their responses are collected here
+ */
+class cSharedPortDemux
+{
+    /** Number of systems, 0 if the data port is not shared             */
+    UINT8 u8NumOfSystems;
+
+    /** IP address of each system (network byte order)                  */
+    UINT32 au32IpAddr[MAX_SHARED_PORT_SYSTEMS];
+
+    /** Receiver of each system, the connected system first            */
+    cUdpDataReceiver *pDataRecv[MAX_SHARED_PORT_SYSTEMS];
+
+    /** System of the last packet, packets come in bursts of a system   */
+    UINT8 u8LastSystem;
+
+    /** Systems done with the record, bit per system                   */
+    std::atomic<UINT32> u32CompletedMask;
+
+    /** Systems whose command response is awaited, bit per system      */
+    std::atomic<UINT32> u32PendingRespMask;
+
+    /** Command code of the awaited responses                          */
+    std::atomic<UINT32> u32RespCmdCode;
+
+    /** First failure status of the awaited responses                  */
+    std::atomic<SINT32> s32RespStatus;
+
+public:
+
+    /** @fn cSharedPortDemux(cUdpDataReceiver *pConnectedDataRecv)
+     * @brief This constructor function is to initialize the class member <!--
+     * --> variables with the data port receiver of the connected system
+     * @param [in] pConnectedDataRecv [cUdpDataReceiver *] - Data port <!--
+     * --> receiver of the connected system
+     */
+    cSharedPortDemux(cUdpDataReceiver *pConnectedDataRecv);
+
+    /** @fn bool setSystems(const strSharedPortConfig *psConfig)
+     * @brief This function is to set the systems of the next record <!--
+     * --> process. The receivers of the other systems are kept across <!--
+     * --> record processes of the same connection
+     * @param [in] psConfig [const strSharedPortConfig *] - Systems
+     * @return boolean value
+     */
+    bool setSystems(const strSharedPortConfig *psConfig);
+
+    /** @fn UINT8 getNumOfSystems()
+     * @brief This function is to get the number of systems sharing the <!--
+     * --> data port
+     * @return UINT8 value, 0 if the data port is not shared
+     */
+    UINT8 getNumOfSystems();
+
+    /** @fn cUdpDataReceiver *getReceiver(UINT32 u32IpAddr)
+     * @brief This function is to get the receiver of the system a packet <!--
+     * --> of the shared data port is received from
+     * @param [in] u32IpAddr [UINT32] - Source IP address (network byte order)
+     * @return cUdpDataReceiver pointer, NULL if not from one of the systems
+     */
+    cUdpDataReceiver *getReceiver(UINT32 u32IpAddr);
+
+    /** @fn UINT8 getSystemIndex(UINT32 u32IpAddr)
+     * @brief This function is to get the system index of an IP address
+     * @param [in] u32IpAddr [UINT32] - IP address (network byte order)
+     * @return UINT8 value, 0 (connected system) if not one of the systems
+     */
+    UINT8 getSystemIndex(UINT32 u32IpAddr);
+
+    /** @fn void setThreadStart()
+     * @brief This function is to start recording the other systems, their <!--
+     * --> file writer threads are started here
+     */
+    void setThreadStart();
+
+    /** @fn void setThreadStop()
+     * @brief This function is to stop recording the other systems and <!--
+     * --> close their record files
+     */
+    void setThreadStop();
+
+    /** @fn bool setTrigger()
+     * @brief This function is to latch a trigger of the pre-trigger ring <!--
+     * --> dump of the other systems, it is safe to call from a signal handler
+     * @return boolean value, false if not recording in event trigger mode
+     */
+    bool setTrigger();
+
+    /** @fn void releaseBuffers()
+     * @brief This function is to free the receivers of the other systems
+     */
+    void releaseBuffers();
+
+    /** @fn bool setCompleted(UINT8 u8System)
+     * @brief This function is to mark a system as done with the record
+     * @param [in] u8System [UINT8] - System index
+     * @return boolean value, true once for the last system done (always <!--
+     * --> true if the data port is not shared)
+     */
+    bool setCompleted(UINT8 u8System);
+
+    /** @fn bool sendCommand(const SINT8 *s8Data, UINT16 u16PacketLen, UINT16 u16CmdCode, const struct sockaddr_in *psConfigAddr)
+     * @brief This function is to send a command to the other systems <!--
+     * --> through the config port, the responses are awaited by <!--
+     * --> \ref waitResponses
+     * @param [in] s8Data [const SINT8 *] - Command data buffer
+     * @param [in] u16PacketLen [UINT16] - Command data buffer size
+     * @param [in] u16CmdCode [UINT16] - Command code
+     * @param [in] psConfigAddr [const struct sockaddr_in *] - Config port <!--
+     * --> address of the connected system
+     * @return boolean value, false if a command could not be sent
+     */
+    bool sendCommand(const SINT8 *s8Data, UINT16 u16PacketLen,
+                     UINT16 u16CmdCode, const struct sockaddr_in *psConfigAddr);
+
+    /** @fn STATUS waitResponses()
+     * @brief This function is to wait for the command responses of the <!--
+     * --> other systems, \ref sgnSharedPortWaitEvent should be initialized
+     * @return SINT32 value, first failure status of the responses
+     */
+    STATUS waitResponses();
+
+    /** @fn bool setResponse(UINT32 u32IpAddr, UINT16 u16CmdCode, UINT16 u16Status)
+     * @brief This function is to hand a command response received on the <!--
+     * --> config port over, if it is of one of the other systems
+     * @param [in] u32IpAddr [UINT32] - Source IP address (network byte order)
+     * @param [in] u16CmdCode [UINT16] - Command code
+     * @param [in] u16Status [UINT16] - Command status
+     * @return boolean value, true if taken as response of another system
+     */
+    bool setResponse(UINT32 u32IpAddr, UINT16 u16CmdCode, UINT16 u16Status);
+};
+
+#pragma pack(pop)
+
+#endif // SHAREDPORTDEMUX_H
@@ -0,0 +1,166 @@
+/**
+ * @file sockrecv.cpp
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains the data socket receive with the socket drop
+ * counter and the coalesced receive (UDP GRO). It is kept clear of the
+ * packed API structures, the message header of recvmsg needs the layout
+ * of the OS
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+///****************
+/// Includes
+///****************
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/udp.h>
+#endif
+
+#include <string.h>
+
+#include "sockrecv.h"
+
+/** @fn SINT32 SockRecvPacket(SINT32 s32Sock, SINT8 *s8Buf, UINT32 u32BufSize, SINT32 s32Flags, void *pSenderAddr, UINT32 *pu32SockDropCount, UINT32 *pu32SegSize)
+ * @brief This function is to receive a packet from a data socket with <!--
+ * --> the count of packets dropped by the socket so far (receive buffer <!--
+ * --> overflow). The count is read where the OS has a drop counter <!--
+ * --> enabled on the socket, it is left as is otherwise. A coalesced <!--
+ * --> receive returns same sized packets back to back, the last one <!--
+ * --> can be shorter
+ * @param [in] s32Sock [SINT32] - Data socket
+ * @param [out] s8Buf [SINT8 *] - Received packet
+ * @param [in] u32BufSize [UINT32] - Packet buffer size
+ * @param [in] s32Flags [SINT32] - Receive flags
+ * @param [out] pSenderAddr [void *] - Source address (sockaddr_in)
+ * @param [in,out] pu32SockDropCount [UINT32 *] - Packets dropped by the <!--
+ * --> socket over its life (wraps around at 32 bits)
+ * @param [out] pu32SegSize [UINT32 *] - Size of the coalesced packets, <!--
+ * --> 0 if a single packet is received
+ * @return SINT32 value (received size)
+ */
+SINT32 SockRecvPacket(SINT32 s32Sock, SINT8 *s8Buf, UINT32 u32BufSize,
+                      SINT32 s32Flags, void *pSenderAddr,
+                      UINT32 *pu32SockDropCount, UINT32 *pu32SegSize)
+{
+    *pu32SegSize = 0;
+
+#ifdef _WIN32
+    socklen_t   s32SenderAddrSize = sizeof(struct sockaddr_in);
+
+    return recvfrom(s32Sock, s8Buf, u32BufSize, s32Flags,
+                    (struct sockaddr *)pSenderAddr, &s32SenderAddrSize);
+#else
+    struct iovec sIov;
+    struct msghdr sMsg;
+    SINT32      s32RecvSize = 0;
+    /** Control message buffer, aligned for the headers in it        */
+    union
+    {
+        struct cmsghdr sAlign;
+        SINT8   s8Buf[CMSG_SPACE(sizeof(UINT32)) + CMSG_SPACE(sizeof(SINT32))];
+    } uCtrlBuf;
+
+    sIov.iov_base = s8Buf;
+    sIov.iov_len = u32BufSize;
+    memset(&sMsg, 0, sizeof(sMsg));
+    sMsg.msg_name = pSenderAddr;
+    sMsg.msg_namelen = sizeof(struct sockaddr_in);
+    sMsg.msg_iov = &sIov;
+    sMsg.msg_iovlen = 1;
+    sMsg.msg_control = uCtrlBuf.s8Buf;
+    sMsg.msg_controllen = sizeof(uCtrlBuf.s8Buf);
+
+    s32RecvSize = recvmsg(s32Sock, &sMsg, s32Flags);
+    if(s32RecvSize <= 0)
+        return s32RecvSize;
+
+    for(struct cmsghdr *pCmsg = CMSG_FIRSTHDR(&sMsg); pCmsg != NULL;
+        pCmsg = CMSG_NXTHDR(&sMsg, pCmsg))
+    {
+#ifdef SO_RXQ_OVFL
+        /** The drop counter comes once the socket has dropped a packet  */
+        if((pCmsg->cmsg_level == SOL_SOCKET) &&
+           (pCmsg->cmsg_type == SO_RXQ_OVFL))
+        {
+            memcpy(pu32SockDropCount, CMSG_DATA(pCmsg), sizeof(UINT32));
+        }
+#endif
+#ifdef UDP_GRO
+        /** The packet size comes with the coalesced packets only        */
+        if((pCmsg->cmsg_level == SOL_UDP) && (pCmsg->cmsg_type == UDP_GRO))
+        {
+            SINT32 s32SegSize = 0;
+            memcpy(&s32SegSize, CMSG_DATA(pCmsg), sizeof(SINT32));
+            *pu32SegSize = (UINT32)s32SegSize;
+        }
+#endif
+    }
+
+    return s32RecvSize;
+#endif
+}
+
+/** @fn SINT32 SockSetUdpGro(SINT32 s32Sock, bool bEnable)
+ * @brief This function is to enable or disable the coalesced receive <!--
+ * --> (UDP GRO) of a data socket
+ * @param [in] s32Sock [SINT32] - Data socket
+ * @param [in] bEnable [bool] - Coalesced receive enable
+ * @return SINT32 value, -1 if the OS does not have it
+ */
+SINT32 SockSetUdpGro(SINT32 s32Sock, bool bEnable)
+{
+#if !defined(_WIN32) && defined(UDP_GRO)
+    SINT32 s32Enable = bEnable ? 1 : 0;
+
+    return setsockopt(s32Sock, SOL_UDP, UDP_GRO, &s32Enable, sizeof(SINT32));
+#else
+    (void)s32Sock;
+    return bEnable ? -1 : 0;
+#endif
+}
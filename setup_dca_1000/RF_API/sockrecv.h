@@ -0,0 +1,96 @@
+/**
+ * @file sockrecv.h
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains the data socket receive with the socket drop
+ * counter and the coalesced receive (UDP GRO). It is kept clear of the
+ * packed API structures, the message header of recvmsg needs the layout
+ * of the OS
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+#ifndef SOCKRECV_H
+#define SOCKRECV_H
+
+///****************
+/// Includes
+///****************
+
+#include "../Common/DCA1000_API/dca_types.h"
+
+///*****************
+/// API Declarations
+///*****************
+
+/** @fn SINT32 SockRecvPacket(SINT32 s32Sock, SINT8 *s8Buf, UINT32 u32BufSize, SINT32 s32Flags, void *pSenderAddr, UINT32 *pu32SockDropCount, UINT32 *pu32SegSize)
+ * @brief This function is to receive a packet from a data socket with <!--
+ * --> the count of packets dropped by the socket so far (receive buffer <!--
+ * --> overflow). The count is read where the OS has a drop counter <!--
+ * --> enabled on the socket, it is left as is otherwise. A coalesced <!--
+ * --> receive returns same sized packets back to back, the last one <!--
+ * --> can be shorter
+ * @param [in] s32Sock [SINT32] - Data socket
+ * @param [out] s8Buf [SINT8 *] - Received packet
+ * @param [in] u32BufSize [UINT32] - Packet buffer size
+ * @param [in] s32Flags [SINT32] - Receive flags
+ * @param [out] pSenderAddr [void *] - Source address (sockaddr_in)
+ * @param [in,out] pu32SockDropCount [UINT32 *] - Packets dropped by the <!--
+ * --> socket over its life (wraps around at 32 bits)
+ * @param [out] pu32SegSize [UINT32 *] - Size of the coalesced packets, <!--
+ * --> 0 if a single packet is received
+ * @return SINT32 value (received size)
+ */
+SINT32 SockRecvPacket(SINT32 s32Sock, SINT8 *s8Buf, UINT32 u32BufSize,
+                      SINT32 s32Flags, void *pSenderAddr,
+                      UINT32 *pu32SockDropCount, UINT32 *pu32SegSize);
+
+/** @fn SINT32 SockSetUdpGro(SINT32 s32Sock, bool bEnable)
+ * @brief This function is to enable or disable the coalesced receive <!--
+ * --> (UDP GRO) of a data socket
+ * @param [in] s32Sock [SINT32] - Data socket
+ * @param [in] bEnable [bool] - Coalesced receive enable
+ * @return SINT32 value, -1 if the OS does not have it
+ */
+SINT32 SockSetUdpGro(SINT32 s32Sock, bool bEnable);
+
+#endif // SOCKRECV_H
@@ -0,0 +1,335 @@
+/**
+ * @file stripereader.cpp
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains the reader of a record striped across several paths
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+///****************
+/// Includes
+///****************
+
+#include "stripereader.h"
+
+/** @fn cStripeReader::cStripeReader()
+ * @brief This constructor function is to initialize the class member variables
+ */
+cStripeReader::cStripeReader()
+{
+    pManifestFile = NULL;
+    u8NumOfPaths = 0;
+    for(UINT8 i = 0; i < MAX_STRIPE_PATHS; i ++)
+    {
+        strPathFilePath[i][0] = '\0';
+        pPathFile[i] = NULL;
+        u32PathFileCount[i] = 0;
+    }
+    u8StripePath = 0;
+    u64StripeBytesLeft = 0;
+    u64StreamOffset = 0;
+    bRecordFiles = false;
+}
+
+/** @fn cStripeReader::~cStripeReader()
+ * @brief This destructor function is to close the files of the record
+ */
+cStripeReader::~cStripeReader()
+{
+    closeManifest();
+}
+
+/** @fn STATUS cStripeReader::openManifest(const SINT8 *s8ManifestFile)
+ * @brief This function is to open a striped record by its manifest
+ * @param [in] s8ManifestFile [const SINT8 *] - Stripe manifest file
+ * @return SINT32 value
+ */
+STATUS cStripeReader::openManifest(const SINT8 *s8ManifestFile)
+{
+    SINT8 s8Line[MAX_NAME_LEN * 2];
+    SINT8 s8FileName[MAX_NAME_LEN];
+    SINT8 *s8Value = NULL;
+    UINT32 u32NumOfPaths = 0;
+    UINT32 u32PathIndex = 0;
+
+    closeManifest();
+
+    pManifestFile = fopen(s8ManifestFile, "r");
+    if(NULL == pManifestFile)
+        return STS_RFDCCARD_OS_ERR;
+
+    /** Header - title, file name, stripe paths and column names */
+    if((NULL == fgets(s8Line, sizeof(s8Line), pManifestFile)) ||
+       (strncmp(s8Line, STRIPE_MANIFEST_TITLE, strlen(STRIPE_MANIFEST_TITLE)) != 0))
+        return STS_RFDCCARD_INVALID_INPUT_PARAMS;
+
+    if((NULL == fgets(s8Line, sizeof(s8Line), pManifestFile)) ||
+       (NULL == (s8Value = strchr(s8Line, ','))))
+        return STS_RFDCCARD_INVALID_INPUT_PARAMS;
+    s8Value[strcspn(s8Value, "\r\n")] = '\0';
+    strcpy(s8FileName, &s8Value[1]);
+
+    if((NULL == fgets(s8Line, sizeof(s8Line), pManifestFile)) ||
+       (sscanf(s8Line, "Stripe paths,%u", &u32NumOfPaths) != 1) ||
+       (u32NumOfPaths < 1) || (u32NumOfPaths > MAX_STRIPE_PATHS))
+        return STS_RFDCCARD_INVALID_INPUT_PARAMS;
+
+    for(u8NumOfPaths = 0; u8NumOfPaths < u32NumOfPaths; u8NumOfPaths ++)
+    {
+        if((NULL == fgets(s8Line, sizeof(s8Line), pManifestFile)) ||
+           (sscanf(s8Line, "Path %u,", &u32PathIndex) != 1) ||
+           (u32PathIndex != u8NumOfPaths) ||
+           (NULL == (s8Value = strchr(s8Line, ','))))
+            return STS_RFDCCARD_INVALID_INPUT_PARAMS;
+        s8Value[strcspn(s8Value, "\r\n")] = '\0';
+
+        strcpy(strPathFilePath[u8NumOfPaths], &s8Value[1]);
+#ifdef _WIN32
+        strcat(strPathFilePath[u8NumOfPaths], "\\");
+#else
+        strcat(strPathFilePath[u8NumOfPaths], "/");
+#endif
+        strcat(strPathFilePath[u8NumOfPaths], s8FileName);
+    }
+
+    if(NULL == fgets(s8Line, sizeof(s8Line), pManifestFile))
+        return STS_RFDCCARD_INVALID_INPUT_PARAMS;
+
+    return STS_RFDCCARD_SUCCESS;
+}
+
+/** @fn STATUS cStripeReader::openRecordFiles(const SINT8 *s8FilePath)
+ * @brief This function is to open the record files of a single <!--
+ * --> base path, they are read till the last one
+ * @param [in] s8FilePath [const SINT8 *] - Record data file path <!--
+ * --> without the file count
+ * @return SINT32 value
+ */
+STATUS cStripeReader::openRecordFiles(const SINT8 *s8FilePath)
+{
+    SINT8 s8FileName[MAX_NAME_LEN * 3];
+
+    closeManifest();
+
+    if(strlen(s8FilePath) >= sizeof(strPathFilePath[0]))
+        return STS_RFDCCARD_INVALID_INPUT_PARAMS;
+    strcpy(strPathFilePath[0], s8FilePath);
+
+    strcpy(s8FileName, strPathFilePath[0]);
+    strcat(s8FileName, "0");
+    strcat(s8FileName, REC_DATA_FILE_EXTENSION);
+    pPathFile[0] = fopen(s8FileName, "rb");
+    if(NULL == pPathFile[0])
+        return STS_RFDCCARD_OS_ERR;
+
+    /** One stripe of the whole record */
+    u8NumOfPaths = 1;
+    u8StripePath = 0;
+    u64StripeBytesLeft = ULLONG_MAX;
+    bRecordFiles = true;
+
+    return STS_RFDCCARD_SUCCESS;
+}
+
+/** @fn SINT32 cStripeReader::readData(SINT8 *s8Buffer, UINT32 u32Size)
+ * @brief This function is to read the next bytes of the data stream
+ * @param [out] s8Buffer [SINT8 *] - Buffer filled with the data
+ * @param [in] u32Size [UINT32] - Size of buffer
+ * @return SINT32 value - Bytes read, 0 at the end of the record or <!--
+ * --> error status
+ */
+SINT32 cStripeReader::readData(SINT8 *s8Buffer, UINT32 u32Size)
+{
+    UINT32 u32BytesRead = 0;
+    UINT32 u32Chunk = 0;
+    UINT32 u32PathBytes = 0;
+    STATUS s32Status = STS_RFDCCARD_SUCCESS;
+
+    if(((NULL == pManifestFile) && (!bRecordFiles)) ||
+       (u32Size > 0x7FFFFFFF))
+        return STS_RFDCCARD_INVALID_INPUT_PARAMS;
+
+    while(u32BytesRead < u32Size)
+    {
+        if(u64StripeBytesLeft == 0)
+        {
+            s32Status = readNextStripe();
+            if(s32Status < 0)
+                return s32Status;
+
+            /** End of the manifest */
+            if(s32Status > 0)
+                break;
+            continue;
+        }
+
+        u32Chunk = u32Size - u32BytesRead;
+        if(u32Chunk > u64StripeBytesLeft)
+            u32Chunk = (UINT32)u64StripeBytesLeft;
+
+        u32PathBytes = readPathData(u8StripePath, &s8Buffer[u32BytesRead],
+                                    u32Chunk);
+
+        /** The last record file of a single base path is read */
+        if(bRecordFiles && (u32PathBytes < u32Chunk))
+        {
+            u32BytesRead += u32PathBytes;
+            u64StreamOffset += u32PathBytes;
+            u64StripeBytesLeft = 0;
+            break;
+        }
+
+        /** A stripe in the manifest is missing in the record files */
+        if(u32PathBytes != u32Chunk)
+            return STS_RFDCCARD_OS_ERR;
+
+        u32BytesRead += u32Chunk;
+        u64StripeBytesLeft -= u32Chunk;
+        u64StreamOffset += u32Chunk;
+    }
+
+    return (SINT32)u32BytesRead;
+}
+
+/** @fn void cStripeReader::closeManifest()
+ * @brief This function is to close the files of the record
+ */
+void cStripeReader::closeManifest()
+{
+    for(UINT8 i = 0; i < MAX_STRIPE_PATHS; i ++)
+    {
+        if(NULL != pPathFile[i])
+        {
+            fclose(pPathFile[i]);
+            pPathFile[i] = NULL;
+        }
+        u32PathFileCount[i] = 0;
+    }
+
+    if(NULL != pManifestFile)
+    {
+        fclose(pManifestFile);
+        pManifestFile = NULL;
+    }
+    u8NumOfPaths = 0;
+    u64StripeBytesLeft = 0;
+    u64StreamOffset = 0;
+    bRecordFiles = false;
+}
+
+/** @fn STATUS cStripeReader::readNextStripe()
+ * @brief This function is to read the next stripe of the manifest
+ * @return SINT32 value - STS_RFDCCARD_SUCCESS, 1 at the end of the <!--
+ * --> manifest or error status
+ */
+STATUS cStripeReader::readNextStripe()
+{
+    SINT8 s8Line[MAX_NAME_LEN];
+    UINT32 u32StripeNum = 0;
+    UINT32 u32Path = 0;
+    ULONG64 u64Offset = 0;
+    ULONG64 u64Bytes = 0;
+
+    /** Record files of a single base path end with the last file */
+    if(bRecordFiles)
+        return 1;
+
+    if(NULL == fgets(s8Line, sizeof(s8Line), pManifestFile))
+        return 1;
+
+    if((sscanf(s8Line, "%u,%u,%llu,%llu", &u32StripeNum, &u32Path,
+               &u64Offset, &u64Bytes) != 4) ||
+       (u32Path >= u8NumOfPaths))
+        return STS_RFDCCARD_INVALID_INPUT_PARAMS;
+
+    /** Stripes are listed in the order of the data stream */
+    if(u64Offset != u64StreamOffset)
+        return STS_RFDCCARD_INVALID_INPUT_PARAMS;
+
+    u8StripePath = (UINT8)u32Path;
+    u64StripeBytesLeft = u64Bytes;
+
+    return STS_RFDCCARD_SUCCESS;
+}
+
+/** @fn UINT32 cStripeReader::readPathData(UINT8 u8Path, SINT8 *s8Buffer, UINT32 u32Size)
+ * @brief This function is to read the next bytes of a stripe path, <!--
+ * --> continuing in the next record file of the path
+ * @param [in] u8Path [UINT8] - Stripe path index
+ * @param [out] s8Buffer [SINT8 *] - Buffer filled with the data
+ * @param [in] u32Size [UINT32] - Bytes to read
+ * @return UINT32 value - Bytes read
+ */
+UINT32 cStripeReader::readPathData(UINT8 u8Path, SINT8 *s8Buffer, UINT32 u32Size)
+{
+    SINT8 s8FileName[MAX_NAME_LEN * 3];
+    UINT32 u32BytesRead = 0;
+
+    while(u32BytesRead < u32Size)
+    {
+        if(NULL == pPathFile[u8Path])
+        {
+            strcpy(s8FileName, strPathFilePath[u8Path]);
+            strcat(s8FileName,
+                   std::to_string(u32PathFileCount[u8Path]).c_str());
+            strcat(s8FileName, REC_DATA_FILE_EXTENSION);
+
+            pPathFile[u8Path] = fopen(s8FileName, "rb");
+            if(NULL == pPathFile[u8Path])
+                break;
+        }
+
+        u32BytesRead += fread(&s8Buffer[u32BytesRead], 1,
+                              u32Size - u32BytesRead, pPathFile[u8Path]);
+
+        /** Files of the path are split at the maximum file size */
+        if(u32BytesRead < u32Size)
+        {
+            fclose(pPathFile[u8Path]);
+            pPathFile[u8Path] = NULL;
+            u32PathFileCount[u8Path] ++;
+        }
+    }
+
+    return u32BytesRead;
+}
@@ -0,0 +1,155 @@
+/**
+ * @file stripereader.h
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains the reader of a record striped across several paths
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+#ifndef STRIPEREADER_H
+#define STRIPEREADER_H
+
+///****************
+/// Includes
+///****************
+
+#include "../Common/rf_api_internal.h"
+
+#include "defines.h"
+
+/** @class cStripeReader
+ * @brief This class provides support APIs to read a record striped across <!--
+ * --> several base paths as one data stream. The stripes of a path follow <!--
+ * --> each other in its record files, the manifest gives their order. <!--
+ * --> The record files of a single base path are read as one stripe
+ */
+class cStripeReader
+{
+    /** Stripe manifest file pointer                        */
+    FILE *pManifestFile;
+
+    /** Number of stripe paths                              */
+    UINT8 u8NumOfPaths;
+
+    /** Record data file path without the file count per stripe path */
+    SINT8 strPathFilePath[MAX_STRIPE_PATHS][MAX_NAME_LEN * 2];
+
+    /** Record data file pointer per stripe path            */
+    FILE *pPathFile[MAX_STRIPE_PATHS];
+
+    /** Data file count per stripe path                     */
+    UINT32 u32PathFileCount[MAX_STRIPE_PATHS];
+
+    /** Stripe path of the stripe being read                */
+    UINT8 u8StripePath;
+
+    /** Bytes left in the stripe being read                 */
+    ULONG64 u64StripeBytesLeft;
+
+    /** Data stream offset of the next byte read            */
+    ULONG64 u64StreamOffset;
+
+    /** Record files of a single base path are read, no manifest */
+    bool bRecordFiles;
+
+public:
+    /** @fn cStripeReader()
+     * @brief This constructor function is to initialize the class member variables
+     */
+    cStripeReader();
+
+    /** @fn ~cStripeReader()
+     * @brief This destructor function is to close the files of the record
+     */
+    ~cStripeReader();
+
+    /** @fn STATUS openManifest(const SINT8 *s8ManifestFile)
+     * @brief This function is to open a striped record by its manifest
+     * @param [in] s8ManifestFile [const SINT8 *] - Stripe manifest file
+     * @return SINT32 value
+     */
+    STATUS openManifest(const SINT8 *s8ManifestFile);
+
+    /** @fn STATUS openRecordFiles(const SINT8 *s8FilePath)
+     * @brief This function is to open the record files of a single <!--
+     * --> base path, they are read till the last one
+     * @param [in] s8FilePath [const SINT8 *] - Record data file path <!--
+     * --> without the file count
+     * @return SINT32 value
+     */
+    STATUS openRecordFiles(const SINT8 *s8FilePath);
+
+    /** @fn SINT32 readData(SINT8 *s8Buffer, UINT32 u32Size)
+     * @brief This function is to read the next bytes of the data stream
+     * @param [out] s8Buffer [SINT8 *] - Buffer filled with the data
+     * @param [in] u32Size [UINT32] - Size of buffer
+     * @return SINT32 value - Bytes read, 0 at the end of the record or <!--
+     * --> error status
+     */
+    SINT32 readData(SINT8 *s8Buffer, UINT32 u32Size);
+
+    /** @fn void closeManifest()
+     * @brief This function is to close the files of the record
+     */
+    void closeManifest();
+
+private:
+    /** @fn STATUS readNextStripe()
+     * @brief This function is to read the next stripe of the manifest
+     * @return SINT32 value - STS_RFDCCARD_SUCCESS, 1 at the end of the <!--
+     * --> manifest or error status
+     */
+    STATUS readNextStripe();
+
+    /** @fn UINT32 readPathData(UINT8 u8Path, SINT8 *s8Buffer, UINT32 u32Size)
+     * @brief This function is to read the next bytes of a stripe path, <!--
+     * --> continuing in the next record file of the path
+     * @param [in] u8Path [UINT8] - Stripe path index
+     * @param [out] s8Buffer [SINT8 *] - Buffer filled with the data
+     * @param [in] u32Size [UINT32] - Bytes to read
+     * @return UINT32 value - Bytes read
+     */
+    UINT32 readPathData(UINT8 u8Path, SINT8 *s8Buffer, UINT32 u32Size);
+};
+
+#endif // STRIPEREADER_H
@@ -0,0 +1,370 @@
+/**
+ * @file stripewriter.cpp
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains the file writer of one record stripe path
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+///****************
+/// Includes
+///****************
+
+#include "stripewriter.h"
+
+#include "extern.h"
+
+/** @fn cStripeWriter::cStripeWriter(UINT8 u8PathIndexArg)
+ * @brief This constructor function is to initialize the class member <!--
+ * --> variables and assign the stripe path index
+ * @param [in] u8PathIndexArg [UINT8] - Stripe path index
+ */
+cStripeWriter::cStripeWriter(UINT8 u8PathIndexArg)
+{
+    u8PathIndex = u8PathIndexArg;
+    s8StripeBuf = NULL;
+    u32StripeSize = 0;
+    u32StripeHoleIndex = 0;
+    u64StripeHoleBytes = 0;
+    pStripeFile = NULL;
+    strStripeFilePath[0] = '\0';
+    strStripeFileName[0] = '\0';
+    u32DataCount = 0;
+    u32DataFileCount = 0;
+    u32MaxFileSize = MAX_BYTES_PER_REC_DATA_FILE;
+    bFileHolePending = false;
+    bFileError = false;
+    bWriterActive = false;
+    bBusy = false;
+}
+
+/** @fn cStripeWriter::~cStripeWriter()
+ * @brief This destructor function is to free the stripe buffer
+ */
+cStripeWriter::~cStripeWriter()
+{
+    if(s8StripeBuf != NULL)
+    {
+        free(s8StripeBuf);
+        s8StripeBuf = NULL;
+    }
+}
+
+/** @fn bool cStripeWriter::allocateBuffer(UINT32 u32BufSize)
+ * @brief This function is to allocate the stripe buffer
+ * @param [in] u32BufSize [UINT32] - Record buffer size
+ * @return boolean value
+ */
+bool cStripeWriter::allocateBuffer(UINT32 u32BufSize)
+{
+    if(s8StripeBuf == NULL)
+        s8StripeBuf = (SINT8 *)malloc(u32BufSize * sizeof(SINT8));
+
+    return (s8StripeBuf != NULL);
+}
+
+/** @fn void cStripeWriter::setThreadStart(UINT32 u32MaxFileSizeArg)
+ * @brief This function is to start the stripe writer thread
+ * @param [in] u32MaxFileSizeArg [UINT32] - Maximum file size
+ */
+void cStripeWriter::setThreadStart(UINT32 u32MaxFileSizeArg)
+{
+    u32MaxFileSize = u32MaxFileSizeArg;
+    u32DataCount = 0;
+    u32DataFileCount = 0;
+    bFileHolePending = false;
+    bFileError = false;
+    bBusy = false;
+    bWriterActive = true;
+    osalObj_api.InitEvent(&sgnStripeWriteInitWaitEvent);
+    osalObj_api.InitEvent(&sgnStripeWriteCompletionWaitEvent);
+
+    std::thread tStripeData([this] { Thread_WriteStripe(); });
+    tStripeData.detach();
+}
+
+/** @fn void cStripeWriter::setThreadStop()
+ * @brief This function is to wait for the stripe handed over last, <!--
+ * --> stop the stripe writer thread and close the record file
+ */
+void cStripeWriter::setThreadStop()
+{
+    if(!bWriterActive)
+        return;
+
+    waitForIdle();
+
+    /** Let the writer thread exit before its events are released */
+    bWriterActive = false;
+    osalObj_api.SignalEvent(&sgnStripeWriteInitWaitEvent);
+    osalObj_api.WaitForSignal(&sgnStripeWriteCompletionWaitEvent, NON_STOP);
+
+    osalObj_api.DeInitEvent(&sgnStripeWriteCompletionWaitEvent);
+    osalObj_api.DeInitEvent(&sgnStripeWriteInitWaitEvent);
+
+    closeFile();
+}
+
+/** @fn bool cStripeWriter::setFileName(const SINT8 *s8FilePath)
+ * @brief This function is to set the record data file path of the <!--
+ * --> stripes and create the first file. The file count and extension <!--
+ * --> are appended to the path
+ * @param [in] s8FilePath [const SINT8 *] - File path without the count
+ * @return boolean value
+ */
+bool cStripeWriter::setFileName(const SINT8 *s8FilePath)
+{
+    strcpy(strStripeFilePath, s8FilePath);
+
+    return openNextFile();
+}
+
+/** @fn bool cStripeWriter::isIdle()
+ * @brief This function is to check if the last stripe is written
+ * @return boolean value
+ */
+bool cStripeWriter::isIdle()
+{
+    return !bBusy;
+}
+
+/** @fn void cStripeWriter::waitForIdle()
+ * @brief This function is to wait till the last stripe is written
+ */
+void cStripeWriter::waitForIdle()
+{
+    /** Completion of a stripe which was not waited for is still signalled */
+    while(bBusy)
+        osalObj_api.WaitForSignal(&sgnStripeWriteCompletionWaitEvent, NON_STOP);
+}
+
+/** @fn bool cStripeWriter::getFileStatus()
+ * @brief This function is to check if the record files of the path <!--
+ * --> could be created, stripes are not handed over to a failed path
+ * @return boolean value
+ */
+bool cStripeWriter::getFileStatus()
+{
+    return !bFileError;
+}
+
+/** @fn void cStripeWriter::writeStripe(SINT8 **pps8Buffer, UINT32 u32Size, <!--
+ * -->                                 UINT32 u32HoleIndex, ULONG64 u64HoleBytes)
+ * @brief This function is to hand a record buffer over to the stripe <!--
+ * --> writer thread. The buffer is exchanged with the idle stripe <!--
+ * --> buffer, hence the writer should be idle
+ * @param [in, out] pps8Buffer [SINT8 **] - Record buffer, returns <!--
+ * --> the empty stripe buffer
+ * @param [in] u32Size  [UINT32] - Size of buffer
+ * @param [in] u32HoleIndex [UINT32] - Buffer index of the dropped frames
+ * @param [in] u64HoleBytes [ULONG64] - Dropped bytes
+ */
+void cStripeWriter::writeStripe(SINT8 **pps8Buffer, UINT32 u32Size,
+                                UINT32 u32HoleIndex, ULONG64 u64HoleBytes)
+{
+    SINT8 *s8FullBuf = *pps8Buffer;
+
+    *pps8Buffer = s8StripeBuf;
+    s8StripeBuf = s8FullBuf;
+    u32StripeSize = u32Size;
+    u32StripeHoleIndex = u32HoleIndex;
+    u64StripeHoleBytes = u64HoleBytes;
+
+    bBusy = true;
+    osalObj_api.SignalEvent(&sgnStripeWriteInitWaitEvent);
+}
+
+/** @fn void cStripeWriter::Thread_WriteStripe()
+ * @brief This thread function is to write the stripes handed over in files
+ */
+void cStripeWriter::Thread_WriteStripe()
+{
+    ULONG64 u64HoleBytes = 0;
+    UINT32 u32HoleChunk = 0;
+
+    while(true)
+    {
+        /** Wait for a stripe to write      */
+        osalObj_api.WaitForSignal(&sgnStripeWriteInitWaitEvent, NON_STOP);
+
+        /** Record is stopped */
+        if(!bWriterActive)
+            break;
+
+        if(!bBusy)
+            continue;
+
+        /** Dropped frames are seeked over, which keeps the stripe size */
+        u64HoleBytes = u64StripeHoleBytes;
+        if(writeBytesToFile(s8StripeBuf, u32StripeHoleIndex))
+        {
+            while(u64HoleBytes > 0)
+            {
+                u32HoleChunk = (u64HoleBytes > MAX_BYTES_PER_REC_DATA_FILE) ?
+                               MAX_BYTES_PER_REC_DATA_FILE : (UINT32)u64HoleBytes;
+                if(!writeBytesToFile(NULL, u32HoleChunk))
+                    break;
+                u64HoleBytes -= u32HoleChunk;
+            }
+            writeBytesToFile(&s8StripeBuf[u32StripeHoleIndex],
+                             u32StripeSize - u32StripeHoleIndex);
+        }
+
+        bBusy = false;
+
+        /** Signal ready for the next stripe */
+        osalObj_api.SignalEvent(&sgnStripeWriteCompletionWaitEvent);
+    }
+
+    /** Signal the exit to the record stop */
+    osalObj_api.SignalEvent(&sgnStripeWriteCompletionWaitEvent);
+}
+
+/** @fn bool cStripeWriter::writeBytesToFile(SINT8 *s8Buffer, UINT32 u32Size)
+ * @brief This function is to write bytes in files of the maximum file <!--
+ * --> size. A NULL buffer seeks over the bytes, which leaves a hole
+ * @param [in] s8Buffer [SINT8 *] - Buffer to write in file or NULL
+ * @param [in] u32Size  [UINT32] - Size of buffer
+ * @return boolean value
+ */
+bool cStripeWriter::writeBytesToFile(SINT8 *s8Buffer, UINT32 u32Size)
+{
+    UINT32 u32ByteIndex = 0;
+    UINT32 u32Chunk = 0;
+
+    /** File creation failed, error is already reported */
+    if(NULL == pStripeFile)
+        return false;
+
+    while(u32Size > 0)
+    {
+        /** Verifies for maximum file size */
+        if((u32DataCount + u32Size) <= u32MaxFileSize)
+        {
+            u32Chunk = u32Size;
+        }
+        else
+        {
+            /** Write chunk of packets in multiples of PAYLOAD_BYTES_PER_PACKET
+             * to avoid i,q conflicts in multiple files
+             */
+            u32Chunk = ((u32MaxFileSize - u32DataCount) /
+                        PAYLOAD_BYTES_PER_PACKET) * PAYLOAD_BYTES_PER_PACKET;
+        }
+
+        if(u32Chunk > 0)
+        {
+            if(s8Buffer != NULL)
+            {
+                fwrite((const SINT8 *)&s8Buffer[u32ByteIndex], 1, u32Chunk,
+                       pStripeFile);
+                bFileHolePending = false;
+            }
+            else
+            {
+                fseek(pStripeFile, u32Chunk, SEEK_CUR);
+                bFileHolePending = true;
+            }
+            u32DataCount += u32Chunk;
+            u32Size -= u32Chunk;
+            u32ByteIndex += u32Chunk;
+        }
+
+        /** Closes and open another file if maximum file size exceeds */
+        if((u32Size > 0) && (!openNextFile()))
+            return false;
+    }
+
+    return true;
+}
+
+/** @fn bool cStripeWriter::openNextFile()
+ * @brief This function is to close the record file and create the next one
+ * @return boolean value
+ */
+bool cStripeWriter::openNextFile()
+{
+    if(NULL != pStripeFile)
+    {
+        closeFile();
+        u32DataFileCount ++;
+    }
+
+    strcpy(strStripeFileName, strStripeFilePath);
+    strcat(strStripeFileName, std::to_string(u32DataFileCount).c_str());
+    strcat(strStripeFileName, REC_DATA_FILE_EXTENSION);
+
+    u32DataCount = 0;
+    pStripeFile = fopen(strStripeFileName, "wb+");
+    if (NULL == pStripeFile)
+    {
+        /** The stripes go to the other paths from now on */
+        bFileError = true;
+        RFDCARD_Callback(CMD_CODE_SYSTEM_ASYNC_STATUS,
+                         STS_REC_FILE_CREATION_ERR);
+        return false;
+    }
+
+    return true;
+}
+
+/** @fn void cStripeWriter::closeFile()
+ * @brief This function is to close the record file, a hole at the end <!--
+ * --> of the file is written out to keep the file size
+ */
+void cStripeWriter::closeFile()
+{
+    if(pStripeFile == NULL)
+        return;
+
+    /** Seeking past the end does not extend the file till a write */
+    if(bFileHolePending)
+    {
+        fseek(pStripeFile, -1, SEEK_CUR);
+        fputc(0, pStripeFile);
+        bFileHolePending = false;
+    }
+
+    fclose(pStripeFile);
+    pStripeFile = NULL;
+}
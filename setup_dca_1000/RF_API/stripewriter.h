@@ -0,0 +1,227 @@
+/**
+ * @file stripewriter.h
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains the file writer of one record stripe path
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+#ifndef STRIPEWRITER_H
+#define STRIPEWRITER_H
+
+///****************
+/// Includes
+///****************
+
+#include "../Common/rf_api_internal.h"
+#include "../Common/Osal_Utils/osal.h"
+
+#include "defines.h"
+
+/** The busy flag is shared by the file writer thread and the stripe
+ *  writer thread, hence keep the class aligned for the atomic access      */
+#pragma pack(push, 8)
+
+/** @class cStripeWriter
+ * @brief This class provides support APIs to write the record buffers <!--
+ * --> striped to one base path in files of defined size. Each path has <!--
+ * --> its own thread, hence the stripes of several disks are written <!--
+ * --> concurrently (inline processing)
+ */
+class cStripeWriter
+{
+    /** Stripe path index                                   */
+    UINT8 u8PathIndex;
+
+    /** Stripe buffer, exchanged with the record buffer     */
+    SINT8 *s8StripeBuf;
+
+    /** Bytes filled in the stripe buffer                   */
+    UINT32 u32StripeSize;
+
+    /** Buffer index of the dropped frames in the stripe    */
+    UINT32 u32StripeHoleIndex;
+
+    /** Dropped bytes in the stripe                         */
+    ULONG64 u64StripeHoleBytes;
+
+    /** Record data file pointer                            */
+    FILE *pStripeFile;
+
+    /** Record data file path without the file count        */
+    SINT8 strStripeFilePath[MAX_NAME_LEN * 2];
+
+    /** Record data file name                               */
+    SINT8 strStripeFileName[MAX_NAME_LEN * 3];
+
+    /** File Data count                                     */
+    UINT32 u32DataCount;
+
+    /** Data file count                                     */
+    UINT32 u32DataFileCount;
+
+    /** Maximum file size to capture                        */
+    UINT32 u32MaxFileSize;
+
+    /** Seek past the end of the file is not written yet    */
+    bool bFileHolePending;
+
+    /** File creation failed on the path                    */
+    bool bFileError;
+
+    /** Writer thread runs till the record stops            */
+    bool bWriterActive;
+
+    /** Stripe handed over and not written yet              */
+    std::atomic<bool> bBusy;
+
+    /** Stripe handed over event                            */
+    alignas(8) OSAL_SIGNAL_HANDLE_TYPE sgnStripeWriteInitWaitEvent;
+
+    /** Stripe written event                                */
+    alignas(8) OSAL_SIGNAL_HANDLE_TYPE sgnStripeWriteCompletionWaitEvent;
+
+public:
+    /** @fn cStripeWriter(UINT8 u8PathIndexArg)
+     * @brief This constructor function is to initialize the class member <!--
+     * --> variables and assign the stripe path index
+     * @param [in] u8PathIndexArg [UINT8] - Stripe path index
+     */
+    cStripeWriter(UINT8 u8PathIndexArg);
+
+    /** @fn ~cStripeWriter()
+     * @brief This destructor function is to free the stripe buffer
+     */
+    ~cStripeWriter();
+
+    /** @fn bool allocateBuffer(UINT32 u32BufSize)
+     * @brief This function is to allocate the stripe buffer
+     * @param [in] u32BufSize [UINT32] - Record buffer size
+     * @return boolean value
+     */
+    bool allocateBuffer(UINT32 u32BufSize);
+
+    /** @fn void setThreadStart(UINT32 u32MaxFileSizeArg)
+     * @brief This function is to start the stripe writer thread
+     * @param [in] u32MaxFileSizeArg [UINT32] - Maximum file size
+     */
+    void setThreadStart(UINT32 u32MaxFileSizeArg);
+
+    /** @fn void setThreadStop()
+     * @brief This function is to wait for the stripe handed over last, <!--
+     * --> stop the stripe writer thread and close the record file
+     */
+    void setThreadStop();
+
+    /** @fn bool setFileName(const SINT8 *s8FilePath)
+     * @brief This function is to set the record data file path of the <!--
+     * --> stripes and create the first file. The file count and extension <!--
+     * --> are appended to the path
+     * @param [in] s8FilePath [const SINT8 *] - File path without the count
+     * @return boolean value
+     */
+    bool setFileName(const SINT8 *s8FilePath);
+
+    /** @fn bool isIdle()
+     * @brief This function is to check if the last stripe is written
+     * @return boolean value
+     */
+    bool isIdle();
+
+    /** @fn void waitForIdle()
+     * @brief This function is to wait till the last stripe is written
+     */
+    void waitForIdle();
+
+    /** @fn bool getFileStatus()
+     * @brief This function is to check if the record files of the path <!--
+     * --> could be created, stripes are not handed over to a failed path
+     * @return boolean value
+     */
+    bool getFileStatus();
+
+    /** @fn void writeStripe(SINT8 **pps8Buffer, UINT32 u32Size, <!--
+     * -->                  UINT32 u32HoleIndex, ULONG64 u64HoleBytes)
+     * @brief This function is to hand a record buffer over to the stripe <!--
+     * --> writer thread. The buffer is exchanged with the idle stripe <!--
+     * --> buffer, hence the writer should be idle
+     * @param [in, out] pps8Buffer [SINT8 **] - Record buffer, returns <!--
+     * --> the empty stripe buffer
+     * @param [in] u32Size  [UINT32] - Size of buffer
+     * @param [in] u32HoleIndex [UINT32] - Buffer index of the dropped frames
+     * @param [in] u64HoleBytes [ULONG64] - Dropped bytes
+     */
+    void writeStripe(SINT8 **pps8Buffer, UINT32 u32Size,
+                     UINT32 u32HoleIndex, ULONG64 u64HoleBytes);
+
+private:
+    /** @fn void Thread_WriteStripe()
+     * @brief This thread function is to write the stripes handed over in files
+     */
+    void Thread_WriteStripe();
+
+    /** @fn bool writeBytesToFile(SINT8 *s8Buffer, UINT32 u32Size)
+     * @brief This function is to write bytes in files of the maximum file <!--
+     * --> size. A NULL buffer seeks over the bytes, which leaves a hole
+     * @param [in] s8Buffer [SINT8 *] - Buffer to write in file or NULL
+     * @param [in] u32Size  [UINT32] - Size of buffer
+     * @return boolean value
+     */
+    bool writeBytesToFile(SINT8 *s8Buffer, UINT32 u32Size);
+
+    /** @fn bool openNextFile()
+     * @brief This function is to close the record file and create the next one
+     * @return boolean value
+     */
+    bool openNextFile();
+
+    /** @fn void closeFile()
+     * @brief This function is to close the record file, a hole at the end <!--
+     * --> of the file is written out to keep the file size
+     */
+    void closeFile();
+};
+
+#pragma pack(pop)
+
+#endif // STRIPEWRITER_H
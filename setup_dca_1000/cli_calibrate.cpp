@@ -0,0 +1,587 @@
+/**
+ * @file cli_calibrate.cpp
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains the packet delay calibration of the CLI control
+ * tool
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+///****************
+/// Includes
+///****************
+
+#include <stdio.h>
+#include <string>
+#include <fstream>
+#include <sstream>
+
+#include "cli_calibrate.h"
+#include "Common/errcodes.h"
+#include "Common/Validate_Utils/validate_params.h"
+#include "Common/Json_Utils/dist/json/json.h"
+
+///****************
+/// Variable declarations
+///****************
+
+/** Record of the calibration step is completed or timed out            */
+static volatile bool gbCalibStepDone = false;
+
+/** FPGA DDR or LVDS buffer full status seen in the calibration step     */
+static volatile bool gbCalibBufFull = false;
+
+/** Packets a calibration step has to receive at least, half of the ADC
+ *  data of the radar config in the step duration                        */
+static ULONG64 gu64CalibMinPackets = 0;
+
+/** Received packets of the calibration step                            */
+static volatile ULONG64 gu64CalibRecvdPackets = 0;
+
+/** Out of sequence packets of the calibration step                     */
+static volatile ULONG64 gu64CalibOutOfSeqCount = 0;
+
+/** Zero filled packets of the calibration step                         */
+static volatile ULONG64 gu64CalibZeroFilledPackets = 0;
+
+/** @fn void CalibEventCallback(UINT16 u16CmdCode, UINT16 u16Status)
+ * @brief This function is the record API event callback of the <!--
+ * --> calibration. It flags the end of the step record and the FPGA <!--
+ * --> buffer overflows
+ * @param [in] u16CmdCode [UINT16] - Command code
+ * @param [in] u16Status [UINT16] - Command status
+ */
+static void CalibEventCallback(UINT16 u16CmdCode, UINT16 u16Status)
+{
+    switch (u16CmdCode)
+    {
+    case CMD_CODE_SYSTEM_ASYNC_STATUS:
+        if ((u16Status == STS_DDR_FULL) || (u16Status == STS_LVDS_BUFFER_FULL))
+            gbCalibBufFull = true;
+        else if (u16Status == STS_REC_COMPLETED)
+            gbCalibStepDone = true;
+        break;
+    case STS_CAPTURE_THREAD_TIMEOUT:
+        gbCalibStepDone = true;
+        break;
+    default:
+        break;
+    }
+}
+
+/** @fn void CalibInlineStatsCallback(strRFDCCard_InlineProcStats <!--
+ * -->                 strInlineProcStats, bool bOutOfSeqFlag, UINT8 u8DataIndex)
+ * @brief This function is the inline processing callback of the <!--
+ * --> calibration. It keeps the loss counters of the step record
+ * @param [in] strInlineProcStats [strRFDCCard_InlineProcStats] - Statistics
+ * @param [in] bOutOfSeqFlag [bool] - Out of sequence set flag
+ * @param [in] u8DataIndex [UINT8] - Data type index
+ */
+static void CalibInlineStatsCallback(strRFDCCard_InlineProcStats strInlineProcStats,
+                                     bool bOutOfSeqFlag, UINT8 u8DataIndex)
+{
+    (void)bOutOfSeqFlag;
+    gu64CalibRecvdPackets =
+                    strInlineProcStats.u64NumOfRecvdPackets[u8DataIndex];
+    gu64CalibOutOfSeqCount =
+                    strInlineProcStats.u64OutOfSeqCount[u8DataIndex];
+    gu64CalibZeroFilledPackets =
+                    strInlineProcStats.u64NumOfZeroFilledPackets[u8DataIndex];
+}
+
+/** @fn SINT32 CalibReadConfig(SINT8 *s8JsonFile, strCalibrationConfig *psConfig)
+ * @brief This function is to read the packet delay calibration config <!--
+ * --> (packetDelayCalibration node) of the JSON file
+ * @param [in] s8JsonFile [SINT8 *] - JSON config file
+ * @param [out] psConfig [strCalibrationConfig *] - Calibration config
+ * @return SINT32 value
+ */
+static SINT32 CalibReadConfig(SINT8 *s8JsonFile, strCalibrationConfig *psConfig)
+{
+    SINT8 s8DebugMsg[MAX_NAME_LEN * 2];
+    SINT8 nodeData[MAX_PARAMS_LEN];
+    Json::CharReaderBuilder reader;
+    Json::Value obj;
+    Json::Value node;
+    std::string errs = "";
+
+    const SINT8 *s8CalibParam[CALIBRATION_NUM_OF_PARAMS] = {
+        "numAdcSamples", "adcFmt", "rxChanEn", "numChirpsPerFrame",
+        "framePeriodicity_us", "stepDuration_ms", "delayMargin_us" };
+    ULONG64 u64CalibMin[CALIBRATION_NUM_OF_PARAMS] = {
+        1, 0, 1, 1, 1, MIN_CALIBRATION_STEP_DURATION, 0 };
+    ULONG64 u64CalibMax[CALIBRATION_NUM_OF_PARAMS] = {
+        MAX_CAPTURE_FILTER_ADC_SAMPLES, MAX_CAPTURE_FILTER_ADC_FMT,
+        CAPTURE_FILTER_RX_CHAN_MASK, MAX_CAPTURE_FILTER_CHIRPS,
+        MAX_CALIBRATION_FRAME_PERIOD, MAX_CALIBRATION_STEP_DURATION,
+        MAX_RECORD_DELAY - MIN_RECORD_DELAY };
+
+    /** Complex data of all RX channels by default                          */
+    ULONG64 u64CalibValue[CALIBRATION_NUM_OF_PARAMS] = {
+        0, 1, CAPTURE_FILTER_RX_CHAN_MASK, 0, 0,
+        DEFAULT_CALIBRATION_STEP_DURATION, 0 };
+
+    std::ifstream jsonFile(s8JsonFile);
+    if ((!jsonFile.is_open()) ||
+        (!Json::parseFromStream(reader, jsonFile, &obj, &errs)))
+    {
+        sprintf(s8DebugMsg, "Invalid JSON config file. [error %d]",
+                CLI_INVALID_JSON_FILE_ERR);
+        WRITE_TO_CONSOLE(s8DebugMsg);
+        return CLI_INVALID_JSON_FILE_ERR;
+    }
+
+    node = obj["DCA1000Config"].get("packetDelayCalibration", 0);
+    if ((node.size() == 0) || (!node.isMember("numAdcSamples")) ||
+        (!node.isMember("numChirpsPerFrame")) ||
+        (!node.isMember("framePeriodicity_us")))
+    {
+        sprintf(s8DebugMsg, "Invalid packetDelayCalibration - numAdcSamples, "
+                "numChirpsPerFrame and framePeriodicity_us are needed. [error %d]",
+                CLI_JSON_INVALID_CALIBRATION_ERR);
+        WRITE_TO_CONSOLE(s8DebugMsg);
+        return CLI_JSON_INVALID_CALIBRATION_ERR;
+    }
+
+    for (SINT32 i = 0; i < CALIBRATION_NUM_OF_PARAMS; i++)
+    {
+        if (!node.isMember(s8CalibParam[i]))
+            continue;
+
+        memset(nodeData, '\0', MAX_PARAMS_LEN);
+        strncpy(nodeData, node[s8CalibParam[i]].asString().c_str(),
+                MAX_PARAMS_LEN - 1);
+        if (SUCCESS_STATUS != validateCaptureFilterParam(nodeData,
+                                u64CalibMin[i], u64CalibMax[i]))
+        {
+            sprintf(s8DebugMsg, "Invalid %s value (%s). [error %d]",
+                    s8CalibParam[i], nodeData,
+                    CLI_JSON_INVALID_CALIBRATION_ERR);
+            WRITE_TO_CONSOLE(s8DebugMsg);
+            return CLI_JSON_INVALID_CALIBRATION_ERR;
+        }
+        u64CalibValue[i] = strtoull(nodeData, NULL, 10);
+    }
+
+    psConfig->u16NumAdcSamples = (UINT16)u64CalibValue[0];
+    psConfig->u8AdcFmt = (UINT8)u64CalibValue[1];
+    psConfig->u8RxChanEn = (UINT8)u64CalibValue[2];
+    psConfig->u16NumChirpsPerFrame = (UINT16)u64CalibValue[3];
+    psConfig->u32FramePeriodicity = (UINT32)u64CalibValue[4];
+    psConfig->u32StepDuration = (UINT32)u64CalibValue[5];
+    psConfig->u16DelayMargin = (UINT16)u64CalibValue[6];
+
+    return SUCCESS_STATUS;
+}
+
+/** @fn SINT32 CalibWriteDelay(SINT8 *s8JsonFile, UINT16 u16Delay)
+ * @brief This function is to save the calibrated packet delay in <!--
+ * --> packetDelay_us of the JSON file. Only the value is replaced, the <!--
+ * --> layout of the file is kept
+ * @param [in] s8JsonFile [SINT8 *] - JSON config file
+ * @param [in] u16Delay [UINT16] - Packet delay in micro seconds
+ * @return SINT32 value
+ */
+static SINT32 CalibWriteDelay(SINT8 *s8JsonFile, UINT16 u16Delay)
+{
+    std::stringstream fileText;
+    std::ifstream inFile(s8JsonFile);
+    if (!inFile.is_open())
+        return CLI_CALIBRATION_JSON_UPDATE_ERR;
+    fileText << inFile.rdbuf();
+    inFile.close();
+
+    std::string text = fileText.str();
+    size_t keyPos = text.find("\"packetDelay_us\"");
+    if (keyPos == std::string::npos)
+        return CLI_CALIBRATION_JSON_UPDATE_ERR;
+    size_t valPos = text.find(':', keyPos);
+    if (valPos == std::string::npos)
+        return CLI_CALIBRATION_JSON_UPDATE_ERR;
+    valPos = text.find_first_not_of(" \t\r\n", valPos + 1);
+    if (valPos == std::string::npos)
+        return CLI_CALIBRATION_JSON_UPDATE_ERR;
+
+    /** Value may be a number or a string of digits                         */
+    size_t valEnd = 0;
+    if (text[valPos] == '"')
+    {
+        valPos ++;
+        valEnd = text.find('"', valPos);
+    }
+    else
+    {
+        valEnd = text.find_first_not_of("0123456789", valPos);
+    }
+    if ((valEnd == std::string::npos) || (valEnd == valPos))
+        return CLI_CALIBRATION_JSON_UPDATE_ERR;
+    text.replace(valPos, valEnd - valPos, std::to_string(u16Delay));
+
+    /** Replace the file at once, a failed write keeps the old file         */
+    std::string tmpName = std::string(s8JsonFile) + ".tmp";
+    FILE *pFile = fopen(tmpName.c_str(), "w");
+    if (NULL == pFile)
+        return CLI_CALIBRATION_JSON_UPDATE_ERR;
+    size_t written = fwrite(text.c_str(), 1, text.size(), pFile);
+    if ((fclose(pFile) != 0) || (written != text.size()) ||
+        (rename(tmpName.c_str(), s8JsonFile) != 0))
+    {
+        remove(tmpName.c_str());
+        return CLI_CALIBRATION_JSON_UPDATE_ERR;
+    }
+
+    return SUCCESS_STATUS;
+}
+
+/** @fn SINT32 CalibRunStep(strStartRecConfigMode *psStepConfig, <!--
+ * -->                  UINT16 u16Delay, bool *pbLossFree)
+ * @brief This function is to record the ADC data for a step duration <!--
+ * --> at a packet delay and check the record for loss. The record files <!--
+ * --> of the step are deleted
+ * @param [in] psStepConfig [strStartRecConfigMode *] - Step record config
+ * @param [in] u16Delay [UINT16] - Packet delay in micro seconds
+ * @param [out] pbLossFree [bool *] - No packet loss and FPGA buffer full
+ * @return SINT32 value
+ */
+static SINT32 CalibRunStep(strStartRecConfigMode *psStepConfig,
+                           UINT16 u16Delay, bool *pbLossFree)
+{
+    SINT8 s8DebugMsg[MAX_NAME_LEN * 3];
+    ULONG64 u64StartTimeUs = 0;
+    ULONG64 u64TimeoutUs = ((ULONG64)psStepConfig->u32DurationToCapture +
+                            CLI_CMD_TIMEOUT_DURATION) *
+                           MILLI_TO_MICRO_SEC_CONVERSION;
+    SINT32 s32Status = SUCCESS_STATUS;
+    UINT32 u32FileIdx = 0;
+
+    gbCalibStepDone = false;
+    gbCalibBufFull = false;
+    gu64CalibRecvdPackets = 0;
+    gu64CalibOutOfSeqCount = 0;
+    gu64CalibZeroFilledPackets = 0;
+
+    /** API Call - Configure Record                                         */
+    gsRecConfigMode.u16RecDelay = u16Delay;
+    s32Status = ConfigureRFDCCard_Record(gsRecConfigMode);
+    if (s32Status != SUCCESS_STATUS)
+    {
+        DecodeCommandStatus(s32Status, "Configure Record");
+        return s32Status;
+    }
+
+    /** API Call - Start Record, stopped by the duration                    */
+    s32Status = StartRecordData(*psStepConfig);
+    if (s32Status != SUCCESS_STATUS)
+    {
+        DecodeCommandStatus(s32Status, "Start Record");
+        return s32Status;
+    }
+
+    u64StartTimeUs = osalObj.GetTimeInMicroSec();
+    while ((!gbCalibStepDone) &&
+           ((osalObj.GetTimeInMicroSec() - u64StartTimeUs) < u64TimeoutUs))
+    {
+        osalObj.SleepInMilliSec(CALIBRATION_POLL_INTERVAL_MS);
+    }
+
+    /** API Call - Stop Record, the inline callback has the final counts    */
+    StopRecordData();
+
+    do
+    {
+        sprintf(s8DebugMsg, CALIBRATION_FILE_NAME_FMT,
+                psStepConfig->s8FileBasePath, u32FileIdx ++);
+    } while (remove(s8DebugMsg) == 0);
+
+    /** Radar stopped streaming, the loss counters tell nothing            */
+    if ((gu64CalibRecvdPackets + gu64CalibZeroFilledPackets) <
+        gu64CalibMinPackets)
+    {
+        sprintf(s8DebugMsg, "ADC data received at packet delay %u us is below "
+                "the radar config (%llu packets), the radar has to stream "
+                "during the calibration. [error %d]", u16Delay,
+                (ULONG64)gu64CalibRecvdPackets, CLI_CALIBRATION_NO_DATA_ERR);
+        WRITE_TO_CONSOLE(s8DebugMsg);
+        WRITE_TO_LOG_FILE(s8DebugMsg);
+        return CLI_CALIBRATION_NO_DATA_ERR;
+    }
+
+    *pbLossFree = (gu64CalibOutOfSeqCount == 0) &&
+                  (gu64CalibZeroFilledPackets == 0) && (!gbCalibBufFull);
+
+    sprintf(s8DebugMsg, "Packet delay %3u us : %llu packets, %llu out of "
+            "sequence, %llu zero filled%s - %s", u16Delay,
+            (ULONG64)gu64CalibRecvdPackets, (ULONG64)gu64CalibOutOfSeqCount,
+            (ULONG64)gu64CalibZeroFilledPackets,
+            gbCalibBufFull ? ", FPGA buffer full" : "",
+            *pbLossFree ? "loss-free" : "loss");
+    WRITE_TO_CONSOLE(s8DebugMsg);
+    WRITE_TO_LOG_FILE(s8DebugMsg);
+
+    return SUCCESS_STATUS;
+}
+
+/** @fn SINT32 CalibSearchDelay(strStartRecConfigMode *psStepConfig, <!--
+ * -->                  UINT16 u16MaxDelay, UINT16 *pu16Delay)
+ * @brief This function is to search the lowest loss-free packet delay. <!--
+ * --> Loss is expected to go down with the packet delay, hence the delay <!--
+ * --> range is halved at every step
+ * @param [in] psStepConfig [strStartRecConfigMode *] - Step record config
+ * @param [in] u16MaxDelay [UINT16] - Highest delay carrying the throughput
+ * @param [out] pu16Delay [UINT16 *] - Lowest loss-free packet delay
+ * @return SINT32 value
+ */
+static SINT32 CalibSearchDelay(strStartRecConfigMode *psStepConfig,
+                               UINT16 u16MaxDelay, UINT16 *pu16Delay)
+{
+    SINT8 s8DebugMsg[MAX_NAME_LEN * 2];
+    UINT16 u16LowDelay = MIN_RECORD_DELAY;
+    UINT16 u16HighDelay = u16MaxDelay;
+    bool bLossFree = false;
+
+    SINT32 s32Status = CalibRunStep(psStepConfig, u16LowDelay, &bLossFree);
+    if ((s32Status != SUCCESS_STATUS) || bLossFree)
+    {
+        *pu16Delay = u16LowDelay;
+        return s32Status;
+    }
+
+    if (u16HighDelay > u16LowDelay)
+    {
+        s32Status = CalibRunStep(psStepConfig, u16HighDelay, &bLossFree);
+        if (s32Status != SUCCESS_STATUS)
+            return s32Status;
+    }
+
+    if (!bLossFree)
+    {
+        /** FPGA is not able to send the data at the highest delay either, or
+         *  the host drops packets at any rate the data needs               */
+        s32Status = gbCalibBufFull ? CLI_CALIBRATION_THROUGHPUT_ERR :
+                                     CLI_CALIBRATION_PKT_LOSS_ERR;
+        sprintf(s8DebugMsg, "No loss-free packet delay from %u to %u us "
+                "for the ADC data throughput. [error %d]", u16LowDelay,
+                u16HighDelay, s32Status);
+        WRITE_TO_CONSOLE(s8DebugMsg);
+        WRITE_TO_LOG_FILE(s8DebugMsg);
+        return s32Status;
+    }
+
+    /** Loss at the low delay, loss-free at the high delay                  */
+    while ((u16HighDelay - u16LowDelay) > 1)
+    {
+        UINT16 u16Delay = (u16LowDelay + u16HighDelay) / 2;
+
+        s32Status = CalibRunStep(psStepConfig, u16Delay, &bLossFree);
+        if (s32Status != SUCCESS_STATUS)
+            return s32Status;
+
+        if (bLossFree)
+            u16HighDelay = u16Delay;
+        else
+            u16LowDelay = u16Delay;
+    }
+
+    *pu16Delay = u16HighDelay;
+    return SUCCESS_STATUS;
+}
+
+/** @fn SINT32 RunPacketDelayCalibration(SINT8 *s8JsonFile)
+ * @brief This function is to find the lowest record packet delay the <!--
+ * --> host receives the radar ADC data at without loss. The packet delay <!--
+ * --> is searched between the minimum and the highest delay that still <!--
+ * --> carries the ADC data throughput, with a record of a few seconds per <!--
+ * --> step. The result is saved in packetDelay_us of the JSON file
+ * @param [in] s8JsonFile [SINT8 *] - JSON config file
+ * @return SINT32 value
+ */
+SINT32 RunPacketDelayCalibration(SINT8 *s8JsonFile)
+{
+    SINT8 s8DebugMsg[MAX_NAME_LEN * 2];
+    strCalibrationConfig sCalibConfig;
+    strStartRecConfigMode sStepConfig;
+    UINT16 u16Delay = 0;
+    UINT8 u8NumOfRx = 0;
+
+    memset(&sCalibConfig, 0, sizeof(strCalibrationConfig));
+    SINT32 s32Status = ValidateJsonFileData(s8JsonFile, CMD_CODE_START_RECORD);
+    if (s32Status >= 0)
+        s32Status = ValidateJsonFileData(s8JsonFile, CMD_CODE_CONFIG_FPGA);
+    if (s32Status >= 0)
+        s32Status = ValidateJsonFileData(s8JsonFile, CMD_CODE_CONFIG_RECORD);
+    if (s32Status >= 0)
+        s32Status = CalibReadConfig(s8JsonFile, &sCalibConfig);
+    if (s32Status < 0)
+        return s32Status;
+
+    if (gsStartRecConfigMode.eConfigLogMode != RAW_MODE)
+    {
+        sprintf(s8DebugMsg, "Packet delay calibration needs the raw data "
+                "logging mode. [error %d]", CLI_JSON_INVALID_CALIBRATION_ERR);
+        WRITE_TO_CONSOLE(s8DebugMsg);
+        return CLI_JSON_INVALID_CALIBRATION_ERR;
+    }
+
+    /** ADC data throughput of the radar config in bytes per micro second
+     *  (2 bytes a real, 4 bytes a complex sample), a packet has to be sent
+     *  within its share of the frame period                               */
+    for (UINT8 u8Rx = sCalibConfig.u8RxChanEn; u8Rx != 0; u8Rx >>= 1)
+        u8NumOfRx += (u8Rx & 1);
+    ULONG64 u64FrameBytes = (ULONG64)sCalibConfig.u16NumAdcSamples *
+                            ((sCalibConfig.u8AdcFmt == 0) ? 2 : 4) *
+                            u8NumOfRx * sCalibConfig.u16NumChirpsPerFrame;
+    ULONG64 u64PktPeriodNs = (ULONG64)CALIBRATION_PKT_DATA_BYTES *
+                             sCalibConfig.u32FramePeriodicity * 1000 /
+                             u64FrameBytes;
+
+    sprintf(s8DebugMsg, "ADC data throughput : %.2f MB/s",
+            (DOUBLE)u64FrameBytes / sCalibConfig.u32FramePeriodicity);
+    WRITE_TO_CONSOLE(s8DebugMsg);
+    WRITE_TO_LOG_FILE(s8DebugMsg);
+
+    if (u64PktPeriodNs < ((ULONG64)CALIBRATION_PKT_WIRE_TIME_NS +
+                          (MIN_RECORD_DELAY * 1000)))
+    {
+        sprintf(s8DebugMsg, "ADC data throughput is beyond the link at the "
+                "minimum packet delay (%u us). [error %d]", MIN_RECORD_DELAY,
+                CLI_CALIBRATION_THROUGHPUT_ERR);
+        WRITE_TO_CONSOLE(s8DebugMsg);
+        WRITE_TO_LOG_FILE(s8DebugMsg);
+        return CLI_CALIBRATION_THROUGHPUT_ERR;
+    }
+    ULONG64 u64MaxDelay = (u64PktPeriodNs - CALIBRATION_PKT_WIRE_TIME_NS) /
+                          1000;
+    gu64CalibMinPackets = (ULONG64)sCalibConfig.u32StepDuration *
+                          MILLI_TO_MICRO_SEC_CONVERSION * 1000 /
+                          u64PktPeriodNs / 2;
+    if (gu64CalibMinPackets == 0)
+        gu64CalibMinPackets = 1;
+    if (u64MaxDelay > MAX_RECORD_DELAY)
+        u64MaxDelay = MAX_RECORD_DELAY;
+
+    /** Step records - plain Raw mode record stopped by the duration        */
+    sStepConfig = gsStartRecConfigMode;
+    strcpy(sStepConfig.s8FilePrefix, CALIBRATION_FILE_PREFIX);
+    sStepConfig.eRecordStopMode = DURATION;
+    sStepConfig.u32DurationToCapture = sCalibConfig.u32StepDuration;
+    sStepConfig.u8NumOfStripePaths = 0;
+    sStepConfig.eRecordTriggerMode = RECORD_TRIGGER_CONTINUOUS;
+    sStepConfig.u16CrcChunkSize = 0;
+    memset(&sStepConfig.sCaptureFilter, 0, sizeof(strCaptureFilterConfig));
+    sStepConfig.eWriterBackend = WRITER_BACKEND_FWRITE;
+    sStepConfig.u32RetentionSize = 0;
+    sStepConfig.u32RetentionAge = 0;
+    sStepConfig.bWatermarkEnable = false;
+    sStepConfig.u32FramesPerFile = 0;
+    sStepConfig.u32FileDuration = 0;
+
+    /** API Call - Ethernet connection held for all the steps              */
+    s32Status = ConnectRFDCCard_RecordMode(gsEthConfigMode);
+    if (s32Status != SUCCESS_STATUS)
+    {
+        sprintf(s8DebugMsg, "Ethernet connection failed. [error %d]",
+                CLI_ETH_CONNECT_FAIL_ERR);
+        WRITE_TO_CONSOLE(s8DebugMsg);
+        WRITE_TO_LOG_FILE(s8DebugMsg);
+        DisconnectRFDCCard_RecordMode();
+        return CLI_ETH_CONNECT_FAIL_ERR;
+    }
+
+    if (StatusRFDCCard_EventRegister(CalibEventCallback) != SUCCESS_STATUS)
+        s32Status = CLI_CMD_CALLBACK_REG_FAILED_ERR;
+    else if (RecInlineProcStats_EventRegister(CalibInlineStatsCallback) !=
+             SUCCESS_STATUS)
+        s32Status = CLI_INLINE_CALLBACK_REG_FAILED_ERR;
+    else
+    {
+        /** API Call - Configure FPGA                                       */
+        s32Status = ConfigureRFDCCard_Fpga(gsFpgaConfigMode);
+        if (s32Status != SUCCESS_STATUS)
+            DecodeCommandStatus(s32Status, "FPGA Configuration");
+    }
+
+    if (s32Status == SUCCESS_STATUS)
+    {
+        sprintf(s8DebugMsg, "Packet delay calibration : %u to %llu us, "
+                "%u ms per step", MIN_RECORD_DELAY, u64MaxDelay,
+                sCalibConfig.u32StepDuration);
+        WRITE_TO_CONSOLE(s8DebugMsg);
+        WRITE_TO_LOG_FILE(s8DebugMsg);
+
+        s32Status = CalibSearchDelay(&sStepConfig, (UINT16)u64MaxDelay,
+                                     &u16Delay);
+    }
+
+    if (s32Status == SUCCESS_STATUS)
+    {
+        u16Delay += sCalibConfig.u16DelayMargin;
+        if (u16Delay > u64MaxDelay)
+            u16Delay = (UINT16)u64MaxDelay;
+
+        /** API Call - Configure Record, the system is left calibrated       */
+        gsRecConfigMode.u16RecDelay = u16Delay;
+        s32Status = ConfigureRFDCCard_Record(gsRecConfigMode);
+        if (s32Status != SUCCESS_STATUS)
+            DecodeCommandStatus(s32Status, "Configure Record");
+    }
+    DisconnectRFDCCard_RecordMode();
+
+    if (s32Status != SUCCESS_STATUS)
+        return s32Status;
+
+    if (CalibWriteDelay(s8JsonFile, u16Delay) != SUCCESS_STATUS)
+    {
+        sprintf(s8DebugMsg, "Calibrated packet delay %u us not saved in the "
+                "JSON file (%s). [error %d]", u16Delay, s8JsonFile,
+                CLI_CALIBRATION_JSON_UPDATE_ERR);
+        WRITE_TO_CONSOLE(s8DebugMsg);
+        WRITE_TO_LOG_FILE(s8DebugMsg);
+        return CLI_CALIBRATION_JSON_UPDATE_ERR;
+    }
+
+    sprintf(s8DebugMsg, "Calibrated packet delay : %u us (saved in %s)",
+            u16Delay, s8JsonFile);
+    WRITE_TO_CONSOLE(s8DebugMsg);
+    WRITE_TO_LOG_FILE(s8DebugMsg);
+    return SUCCESS_STATUS;
+}
@@ -0,0 +1,136 @@
+/**
+ * @file cli_calibrate.h
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains the packet delay calibration of the CLI control
+ * tool
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+#ifndef CLI_CALIBRATE_H
+#define CLI_CALIBRATE_H
+
+///****************
+/// Includes
+///****************
+
+#include "Common/globals.h"
+#include "Common/Osal_Utils/osal.h"
+
+///****************
+/// Structure declarations
+///****************
+
+/** Packet delay calibration config - ADC data layout of the radar frames
+ *  and the record duration of a step                                       */
+typedef struct CALIBRATION_CONFIG
+{
+    /** ADC samples per chirp                           */
+    UINT16 u16NumAdcSamples;
+
+    /** ADC output format (0 - real, 1 - complex, 2 - complex 2x) */
+    UINT8 u8AdcFmt;
+
+    /** Enabled RX channels bit mask                    */
+    UINT8 u8RxChanEn;
+
+    /** Chirps per frame                                */
+    UINT16 u16NumChirpsPerFrame;
+
+    /** Frame periodicity in micro seconds              */
+    UINT32 u32FramePeriodicity;
+
+    /** Record duration in millisec of a step           */
+    UINT32 u32StepDuration;
+
+    /** Packet delay in micro seconds added to the lowest loss-free one */
+    UINT16 u16DelayMargin;
+} strCalibrationConfig;
+
+///****************
+/// Externs - CLI control tool
+///****************
+
+/** Osal class object                           */
+extern osal osalObj;
+
+/** FPGA config mode stucture object            */
+extern strFpgaConfigMode gsFpgaConfigMode;
+
+/** Ethernet config mode stucture object        */
+extern strEthConfigMode gsEthConfigMode;
+
+/** Record config mode stucture object          */
+extern strRecConfigMode gsRecConfigMode;
+
+/** Start record config mode stucture object    */
+extern strStartRecConfigMode gsStartRecConfigMode;
+
+/** CLI message in the console                 */
+void WRITE_TO_CONSOLE(const SINT8 *msg);
+
+/** CLI message in the logfile                  */
+void WRITE_TO_LOG_FILE(const SINT8 *s8Msg);
+
+/** Command status in the console and logfile   */
+void DecodeCommandStatus(SINT32 s32Status, const SINT8 *strCommand);
+
+/** JSON file validation for a command          */
+SINT32 ValidateJsonFileData(SINT8 *configFile, UINT16 u16CmdCode);
+
+///****************
+/// Function declarations
+///****************
+
+/** @fn SINT32 RunPacketDelayCalibration(SINT8 *s8JsonFile)
+ * @brief This function is to find the lowest record packet delay the <!--
+ * --> host receives the radar ADC data at without loss. The packet delay <!--
+ * --> is searched between the minimum and the highest delay that still <!--
+ * --> carries the ADC data throughput, with a record of a few seconds per <!--
+ * --> step. The result is saved in packetDelay_us of the JSON file
+ * @param [in] s8JsonFile [SINT8 *] - JSON config file
+ * @return SINT32 value
+ */
+SINT32 RunPacketDelayCalibration(SINT8 *s8JsonFile);
+
+#endif // CLI_CALIBRATE_H
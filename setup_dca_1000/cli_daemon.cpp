@@ -0,0 +1,845 @@
+/**
+ * @file cli_daemon.cpp
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains the capture daemon which holds the record mode
+ * connection (sockets, receiver threads and inline buffers) across record
+ * processes and serves the CLI commands over a local control socket
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+///****************
+/// Includes
+///****************
+
+#include <signal.h>
+#include <limits.h>
+#include <poll.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/un.h>
+
+#include "cli_daemon.h"
+#include "Common/errcodes.h"
+
+///****************
+/// Variable declarations
+///****************
+
+/** JSON config file the daemon is started with         */
+static SINT8 s8DaemonJsonFile[PATH_MAX];
+
+/** Ethernet config of the record mode connection       */
+static strEthConfigMode gsDaemonEthConfig;
+
+/** Record process started or running in the daemon, set before the
+ *  start record API is called                                          */
+static volatile bool gbDaemonRecording = false;
+
+/** Record process completed, timed out or stopped by the callbacks,
+ *  guarded by gsDaemonShmLock                                          */
+static bool gbDaemonRecEnded = false;
+
+/** Shared memory is created again for every record process while the
+ *  record API callbacks write it from their threads                    */
+static pthread_mutex_t gsDaemonShmLock = PTHREAD_MUTEX_INITIALIZER;
+
+/** Daemon runs till shutdown command or signal         */
+static volatile sig_atomic_t gbDaemonRunning = 0;
+
+/** Pipe to hand the record stop over to the daemon loop, written by
+ *  the record API callbacks (config port and capture timeout threads)   */
+static SINT32 s32DaemonStopPipe[2] = {-1, -1};
+
+/** @fn void DaemonSignalHandler(SINT32 s32Signal)
+ * @brief This function is to stop the daemon on Ctrl+C or SIGTERM
+ * @param [in] s32Signal [SINT32] - Signal number
+ */
+static void DaemonSignalHandler(SINT32 s32Signal)
+{
+    (void)s32Signal;
+    gbDaemonRunning = 0;
+}
+
+/** @fn void DaemonTriggerSignalHandler(SINT32 s32Signal)
+ * @brief This function is to dump the pre-trigger ring on SIGUSR1, the <!--
+ * --> trigger API only latches the trigger time
+ * @param [in] s32Signal [SINT32] - Signal number
+ */
+static void DaemonTriggerSignalHandler(SINT32 s32Signal)
+{
+    (void)s32Signal;
+    TriggerRecordDump();
+}
+
+/** @fn void DaemonSockPath(UINT32 u32ConfigPort, SINT8 *s8Path)
+ * @brief This function is to get the control socket path of the daemon <!--
+ * --> serving the config port
+ * @param [in] u32ConfigPort [UINT32] - Config port
+ * @param [out] s8Path [SINT8 *] - Control socket path
+ */
+static void DaemonSockPath(UINT32 u32ConfigPort, SINT8 *s8Path)
+{
+    sprintf(s8Path, "%s%u.sock", CLI_DAEMON_SOCK_PREFIX_NAME, u32ConfigPort);
+}
+
+/** @fn void DaemonSockAddr(const SINT8 *s8Path, struct sockaddr_un *psAddr)
+ * @brief This function is to fill the control socket address, the path <!--
+ * --> is cut to the address size
+ * @param [in] s8Path [const SINT8 *] - Control socket path
+ * @param [out] psAddr [struct sockaddr_un *] - Control socket address
+ */
+static void DaemonSockAddr(const SINT8 *s8Path, struct sockaddr_un *psAddr)
+{
+    UINT32 u32Len = (UINT32)strnlen(s8Path, sizeof(psAddr->sun_path) - 1);
+
+    memset(psAddr, 0, sizeof(*psAddr));
+    psAddr->sun_family = AF_UNIX;
+    memcpy(psAddr->sun_path, s8Path, u32Len);
+    psAddr->sun_path[u32Len] = '\0';
+}
+
+/** @fn void DaemonRequestStop()
+ * @brief This function is to request the daemon loop to stop the record <!--
+ * --> process. StopRecordData waits for the config port thread, hence it <!--
+ * --> can not be called from the record API callbacks. The request is <!--
+ * --> queued even while the record is starting, the daemon loop drops <!--
+ * --> it if no record process is running
+ */
+static void DaemonRequestStop()
+{
+    SINT8 s8Req = 1;
+
+    if (write(s32DaemonStopPipe[1], &s8Req, 1) < 0)
+    {
+        WRITE_TO_LOG_FILE("Daemon: record stop request failed");
+    }
+}
+
+/** @fn void DaemonEventCallback(UINT16 u16CmdCode, UINT16 u16Status)
+ * @brief This function is the record API event callback of the daemon. <!--
+ * --> It updates the record process status in the shared memory
+ * @param [in] u16CmdCode [UINT16] - Command code
+ * @param [in] u16Status [UINT16] - Command status
+ */
+static void DaemonEventCallback(UINT16 u16CmdCode, UINT16 u16Status)
+{
+    UINT16 u16Port = (UINT16)gsDaemonEthConfig.u32ConfigPortNo;
+    bool bStop = false;
+
+    pthread_mutex_lock(&gsDaemonShmLock);
+    switch (u16CmdCode)
+    {
+    case CMD_CODE_CLI_ASYNC_RECORD_STOP:
+        /** stop_record command of the CLI control tool */
+        osalObj.WriteRecordProcStatus(u16Port, STS_CLI_REC_PROC_STOP_INIT);
+        bStop = true;
+        break;
+    case CMD_CODE_SYSTEM_ASYNC_STATUS:
+        osalObj.WriteRecAsyncStatus(u16Port, (1 << u16Status));
+        if (u16Status == STS_REC_COMPLETED)
+            bStop = true;
+        break;
+    case STS_CAPTURE_THREAD_TIMEOUT:
+        osalObj.WriteRecAsyncStatus(u16Port, (1 << STS_REC_PROC_TIMEOUT));
+        bStop = true;
+        break;
+    case STS_CLI_REC_PROC_STOPPED:
+    case STS_CLI_REC_PROC_STOP_FAILED:
+        osalObj.WriteRecordProcStatus(u16Port, u16CmdCode);
+        gbDaemonRecEnded = true;
+        break;
+    default:
+        break;
+    }
+    if (bStop)
+        gbDaemonRecEnded = true;
+    pthread_mutex_unlock(&gsDaemonShmLock);
+
+    if (bStop)
+        DaemonRequestStop();
+}
+
+/** @fn void DaemonInlineStatsCallback(strRFDCCard_InlineProcStats <!--
+ * -->                 strInlineProcStats, bool bOutOfSeqFlag, UINT8 u8DataIndex)
+ * @brief This function is the inline processing callback of the daemon. <!--
+ * --> It keeps the inline summary of the shared memory up to date
+ * @param [in] strInlineProcStats [strRFDCCard_InlineProcStats] - Statistics
+ * @param [in] bOutOfSeqFlag [bool] - Out of sequence set flag
+ * @param [in] u8DataIndex [UINT8] - Data type index
+ */
+static void DaemonInlineStatsCallback(strRFDCCard_InlineProcStats strInlineProcStats,
+                                      bool bOutOfSeqFlag, UINT8 u8DataIndex)
+{
+    UINT16 u16Port = (UINT16)gsDaemonEthConfig.u32ConfigPortNo;
+
+    pthread_mutex_lock(&gsDaemonShmLock);
+    osalObj.WriteRecProcInlineStats(u16Port, &strInlineProcStats,
+                                    bOutOfSeqFlag, u8DataIndex);
+    if (bOutOfSeqFlag)
+        osalObj.WriteRecAsyncStatus(u16Port, (1 << STS_REC_PKT_OUT_OF_SEQ));
+    pthread_mutex_unlock(&gsDaemonShmLock);
+}
+
+/** @fn SINT32 DaemonValidateJson(SINT8 *s8JsonFile, UINT16 u16CmdCode)
+ * @brief This function is to read the JSON file of a request. The <!--
+ * --> ethernet config has to match the connection held by the daemon
+ * @param [in] s8JsonFile [SINT8 *] - JSON config file
+ * @param [in] u16CmdCode [UINT16] - Command code
+ * @return SINT32 value
+ */
+static SINT32 DaemonValidateJson(SINT8 *s8JsonFile, UINT16 u16CmdCode)
+{
+    SINT32 s32Status = ValidateJsonFileData(s8JsonFile, u16CmdCode);
+    if (s32Status < 0)
+        return s32Status;
+
+    if ((memcmp(gsEthConfigMode.au8Dca1000IpAddr,
+                gsDaemonEthConfig.au8Dca1000IpAddr,
+                sizeof(gsEthConfigMode.au8Dca1000IpAddr)) != 0) ||
+        (gsEthConfigMode.u32ConfigPortNo != gsDaemonEthConfig.u32ConfigPortNo) ||
+        (gsEthConfigMode.u32RecordPortNo != gsDaemonEthConfig.u32RecordPortNo))
+    {
+        gsEthConfigMode = gsDaemonEthConfig;
+        return CLI_DAEMON_ETH_CONFIG_MISMATCH_ERR;
+    }
+
+    return SUCCESS_STATUS;
+}
+
+/** @fn SINT32 DaemonStartRecord(SINT8 *s8JsonFile, SINT8 *s8Reply, bool bConfigure)
+ * @brief This function is to start a record process on the connection <!--
+ * --> held by the daemon
+ * @param [in] s8JsonFile [SINT8 *] - JSON config file
+ * @param [out] s8Reply [SINT8 *] - Response message of <!--
+ * --> CLI_DAEMON_MAX_MSG_LEN bytes
+ * @param [in] bConfigure [bool] - FPGA and record delay config commands <!--
+ * --> are pipelined with the start record command
+ * @return SINT32 value
+ */
+static SINT32 DaemonStartRecord(SINT8 *s8JsonFile, SINT8 *s8Reply,
+                                bool bConfigure)
+{
+    UINT16 u16Port = (UINT16)gsDaemonEthConfig.u32ConfigPortNo;
+
+    if (gbDaemonRecording)
+    {
+        snprintf(s8Reply, CLI_DAEMON_MAX_MSG_LEN,
+                 "Stop the already running process.");
+        return CLI_SHM_REC_PROC_RUNNING_STS;
+    }
+
+    SINT32 s32Status = DaemonValidateJson(s8JsonFile, CMD_CODE_START_RECORD);
+    if ((s32Status >= 0) && bConfigure)
+        s32Status = DaemonValidateJson(s8JsonFile, CMD_CODE_CONFIG_FPGA);
+    if ((s32Status >= 0) && bConfigure)
+        s32Status = DaemonValidateJson(s8JsonFile, CMD_CODE_CONFIG_RECORD);
+    if (s32Status < 0)
+    {
+        snprintf(s8Reply, CLI_DAEMON_MAX_MSG_LEN,
+                 "Invalid JSON config file (%.*s).",
+                 CLI_DAEMON_MAX_TOKEN_LEN, s8JsonFile);
+        return s32Status;
+    }
+
+    /** stop_record command destroys the shared memory once the stop is
+     *  confirmed, hence create it again for every record process       */
+    pthread_mutex_lock(&gsDaemonShmLock);
+    osalObj.UnmapShm();
+    osalObj.DestroyShm(u16Port);
+    osalObj.CreateShm(u16Port);
+    osalObj.WriteRecordProcStatus(u16Port, STS_CLI_REC_PROC_START_INIT);
+    gbDaemonRecEnded = false;
+    pthread_mutex_unlock(&gsDaemonShmLock);
+
+    /** Record may complete or time out before the start record API
+     *  returns, the stop it requests is served once the start is done */
+    gbDaemonRecording = true;
+
+    /** API Call - Start Record, the config commands are sent back to
+     *  back with the start record command on bring up                  */
+    if (bConfigure)
+        s32Status = ConfigureAndStartRecordData(gsFpgaConfigMode,
+                                                gsRecConfigMode,
+                                                gsStartRecConfigMode);
+    else
+        s32Status = StartRecordData(gsStartRecConfigMode);
+    if (s32Status == SUCCESS_STATUS)
+    {
+        /** Final status of a record already ended is kept             */
+        pthread_mutex_lock(&gsDaemonShmLock);
+        if (!gbDaemonRecEnded)
+            osalObj.WriteRecordProcStatus(u16Port, STS_CLI_REC_PROC_IS_IN_PROG);
+        pthread_mutex_unlock(&gsDaemonShmLock);
+        snprintf(s8Reply, CLI_DAEMON_MAX_MSG_LEN, "%s command : Success",
+                 bConfigure ? "Bring up" : "Start Record");
+    }
+    else
+    {
+        gbDaemonRecording = false;
+        osalObj.WriteRecordProcStatus(u16Port, STS_CLI_REC_PROC_START_FAILED);
+        snprintf(s8Reply, CLI_DAEMON_MAX_MSG_LEN, "%s command : Failed",
+                 bConfigure ? "Bring up" : "Start Record");
+    }
+
+    return s32Status;
+}
+
+/** @fn SINT32 DaemonStopRecord(SINT8 *s8Reply)
+ * @brief This function is to stop the record process of the daemon. <!--
+ * --> Sockets, receiver threads and buffers are kept for the next one
+ * @param [out] s8Reply [SINT8 *] - Response message of <!--
+ * --> CLI_DAEMON_MAX_MSG_LEN bytes
+ * @return SINT32 value
+ */
+static SINT32 DaemonStopRecord(SINT8 *s8Reply)
+{
+    UINT16 u16Port = (UINT16)gsDaemonEthConfig.u32ConfigPortNo;
+    strRFDCCard_LatencyStats sLatencyStats;
+
+    if (!gbDaemonRecording)
+    {
+        snprintf(s8Reply, CLI_DAEMON_MAX_MSG_LEN,
+                 "No record process is running.");
+        return CLI_SHM_REC_PROC_NOT_RUNNING_STS;
+    }
+
+    osalObj.WriteRecordProcStatus(u16Port, STS_CLI_REC_PROC_STOP_INIT);
+
+    /** API Call - Stop Record, the callback writes the final status     */
+    SINT32 s32Status = StopRecordData();
+    gbDaemonRecording = false;
+
+    if (ReadRFDCCard_LatencyStats(&sLatencyStats) == STS_RFDCCARD_SUCCESS)
+        osalObj.WriteRecProcLatencyStats(u16Port, &sLatencyStats);
+
+    if (s32Status == SUCCESS_STATUS)
+        snprintf(s8Reply, CLI_DAEMON_MAX_MSG_LEN,
+                 "Stop Record command : Success");
+    else
+        snprintf(s8Reply, CLI_DAEMON_MAX_MSG_LEN,
+                 "Stop Record command : Failed");
+
+    return s32Status;
+}
+
+/** @fn SINT32 DaemonHandleRequest(SINT8 *s8Request, SINT8 *s8Reply)
+ * @brief This function is to execute a control request, <!--
+ * --> "<command> [jsonFile]"
+ * @param [in] s8Request [SINT8 *] - Request line
+ * @param [out] s8Reply [SINT8 *] - Response message of <!--
+ * --> CLI_DAEMON_MAX_MSG_LEN bytes
+ * @return SINT32 value
+ */
+static SINT32 DaemonHandleRequest(SINT8 *s8Request, SINT8 *s8Reply)
+{
+    SINT8 *s8SavePtr = NULL;
+    SINT8 s8Version[MAX_NAME_LEN];
+    SINT32 s32Status = SUCCESS_STATUS;
+
+    SINT8 *s8Command = strtok_r(s8Request, " \r\n", &s8SavePtr);
+    SINT8 *s8JsonFile = strtok_r(NULL, "\r\n", &s8SavePtr);
+
+    if (s8Command == NULL)
+    {
+        snprintf(s8Reply, CLI_DAEMON_MAX_MSG_LEN, "Invalid Command ().");
+        return CLI_INVALID_CMD_ARG_ERR;
+    }
+    if ((strlen(s8Command) > CLI_DAEMON_MAX_TOKEN_LEN) ||
+        ((s8JsonFile != NULL) &&
+         (strlen(s8JsonFile) > CLI_DAEMON_MAX_TOKEN_LEN)))
+    {
+        snprintf(s8Reply, CLI_DAEMON_MAX_MSG_LEN,
+                 "Invalid Command (argument longer than %d bytes).",
+                 CLI_DAEMON_MAX_TOKEN_LEN);
+        return CLI_INVALID_CMD_ARG_ERR;
+    }
+    if (s8JsonFile == NULL)
+        s8JsonFile = s8DaemonJsonFile;
+
+    WRITE_TO_LOG_FILE(s8Command);
+
+    if (strcmp(s8Command, CMD_START_RECORD) == 0)
+    {
+        return DaemonStartRecord(s8JsonFile, s8Reply, false);
+    }
+    else if (strcmp(s8Command, CMD_DAEMON_BRINGUP) == 0)
+    {
+        return DaemonStartRecord(s8JsonFile, s8Reply, true);
+    }
+    else if (strcmp(s8Command, CMD_STOP_RECORD) == 0)
+    {
+        return DaemonStopRecord(s8Reply);
+    }
+    else if (strcmp(s8Command, CMD_QUERY_CLI_PROC_STATUS) == 0)
+    {
+        if (gbDaemonRecording)
+        {
+            snprintf(s8Reply, CLI_DAEMON_MAX_MSG_LEN, "Record is in progress.");
+            return CLI_SHM_REC_IN_PROG_STS;
+        }
+        snprintf(s8Reply, CLI_DAEMON_MAX_MSG_LEN, "Record process is stopped.");
+        return CLI_SHM_REC_STOPPED_STS;
+    }
+    else if (strcmp(s8Command, CMD_QUERY_SYSTEM_ALIVENESS) == 0)
+    {
+        /** API Call - System aliveness                                  */
+        s32Status = HandshakeRFDCCard();
+        if (s32Status != SUCCESS_STATUS)
+            snprintf(s8Reply, CLI_DAEMON_MAX_MSG_LEN,
+                     "System is disconnected.");
+        else
+            snprintf(s8Reply, CLI_DAEMON_MAX_MSG_LEN, "System is connected.");
+        return s32Status;
+    }
+    else if (strcmp(s8Command, CMD_READ_FPGA_VER) == 0)
+    {
+        /** API Call - Read FPGA version                                 */
+        memset(s8Version, '\0', MAX_NAME_LEN);
+        s32Status = ReadRFDCCard_FpgaVersion(s8Version);
+        SINT8 *s8Token = strtok_r(s8Version, "\n", &s8SavePtr);
+        snprintf(s8Reply, CLI_DAEMON_MAX_MSG_LEN,
+                 "%s", (s8Token != NULL) ? s8Token : "");
+        return s32Status;
+    }
+    else if (strcmp(s8Command, CMD_DAEMON_TRIGGER) == 0)
+    {
+        /** API Call - Dump the pre-trigger ring                         */
+        s32Status = TriggerRecordDump();
+        if (s32Status == SUCCESS_STATUS)
+            snprintf(s8Reply, CLI_DAEMON_MAX_MSG_LEN,
+                     "Trigger command : Success");
+        else
+            snprintf(s8Reply, CLI_DAEMON_MAX_MSG_LEN,
+                     "Record is not running in event trigger mode.");
+        return s32Status;
+    }
+    else if (strcmp(s8Command, CMD_DAEMON_SHUTDOWN) == 0)
+    {
+        gbDaemonRunning = 0;
+        snprintf(s8Reply, CLI_DAEMON_MAX_MSG_LEN, "Daemon is shutting down.");
+        return SUCCESS_STATUS;
+    }
+    else if ((strcmp(s8Command, CMD_CONFIG_FPGA) != 0) &&
+             (strcmp(s8Command, CMD_CONFIG_RECORD) != 0) &&
+             (strcmp(s8Command, CMD_RESET_FPGA) != 0) &&
+             (strcmp(s8Command, CMD_RESET_AR_DEV) != 0))
+    {
+        snprintf(s8Reply, CLI_DAEMON_MAX_MSG_LEN,
+                 "Invalid Command (%s).", s8Command);
+        return CLI_INVALID_CMD_ARG_ERR;
+    }
+
+    /** Configuration commands are not allowed while recording           */
+    if (gbDaemonRecording)
+    {
+        snprintf(s8Reply, CLI_DAEMON_MAX_MSG_LEN,
+                 "Stop the already running process.");
+        return CLI_SHM_REC_PROC_RUNNING_STS;
+    }
+
+    if (strcmp(s8Command, CMD_CONFIG_FPGA) == 0)
+    {
+        s32Status = DaemonValidateJson(s8JsonFile, CMD_CODE_CONFIG_FPGA);
+        if (s32Status < 0)
+        {
+            snprintf(s8Reply, CLI_DAEMON_MAX_MSG_LEN,
+                     "Invalid JSON config file (%.*s).",
+                     CLI_DAEMON_MAX_TOKEN_LEN, s8JsonFile);
+            return s32Status;
+        }
+
+        /** API Call - Configure FPGA                                    */
+        s32Status = ConfigureRFDCCard_Fpga(gsFpgaConfigMode);
+        snprintf(s8Reply, CLI_DAEMON_MAX_MSG_LEN,
+                 "FPGA Configuration command : %s",
+                 (s32Status == SUCCESS_STATUS) ? "Success" : "Failed");
+    }
+    else if (strcmp(s8Command, CMD_CONFIG_RECORD) == 0)
+    {
+        s32Status = DaemonValidateJson(s8JsonFile, CMD_CODE_CONFIG_RECORD);
+        if (s32Status < 0)
+        {
+            snprintf(s8Reply, CLI_DAEMON_MAX_MSG_LEN,
+                     "Invalid JSON config file (%.*s).",
+                     CLI_DAEMON_MAX_TOKEN_LEN, s8JsonFile);
+            return s32Status;
+        }
+
+        /** API Call - Configure Record                                  */
+        s32Status = ConfigureRFDCCard_Record(gsRecConfigMode);
+        snprintf(s8Reply, CLI_DAEMON_MAX_MSG_LEN,
+                 "Configure Record command : %s",
+                 (s32Status == SUCCESS_STATUS) ? "Success" : "Failed");
+    }
+    else if (strcmp(s8Command, CMD_RESET_FPGA) == 0)
+    {
+        /** API Call - Reset FPGA                                        */
+        s32Status = ResetRFDCCard_FPGA();
+        snprintf(s8Reply, CLI_DAEMON_MAX_MSG_LEN, "Reset FPGA command : %s",
+                 (s32Status == SUCCESS_STATUS) ? "Success" : "Failed");
+    }
+    else
+    {
+        /** API Call - Reset AR Device                                   */
+        s32Status = ResetRadarEVM();
+        snprintf(s8Reply, CLI_DAEMON_MAX_MSG_LEN,
+                 "Reset AR Device command : %s",
+                 (s32Status == SUCCESS_STATUS) ? "Success" : "Failed");
+    }
+
+    return s32Status;
+}
+
+/** @fn void DaemonServeClient(SINT32 s32ListenSock)
+ * @brief This function is to accept a control client, execute its <!--
+ * --> request and send the response "<status> <message>"
+ * @param [in] s32ListenSock [SINT32] - Control socket
+ */
+static void DaemonServeClient(SINT32 s32ListenSock)
+{
+    SINT8 s8Request[CLI_DAEMON_MAX_MSG_LEN];
+    SINT8 s8Reply[CLI_DAEMON_MAX_MSG_LEN];
+    SINT8 s8Msg[CLI_DAEMON_MAX_MSG_LEN + MAX_NAME_LEN];
+    UINT32 u32Size = 0;
+    struct timeval timeout;
+
+    SINT32 s32ClientSock = accept(s32ListenSock, NULL, NULL);
+    if (s32ClientSock < 0)
+        return;
+
+    /** A stalled client must not hold the daemon loop                   */
+    timeout.tv_sec = CLI_DAEMON_CLIENT_TIMEOUT_MS / 1000;
+    timeout.tv_usec = (CLI_DAEMON_CLIENT_TIMEOUT_MS % 1000) * 1000;
+    setsockopt(s32ClientSock, SOL_SOCKET, SO_RCVTIMEO, (char *)&timeout,
+               sizeof(timeout));
+
+    while (u32Size < (CLI_DAEMON_MAX_MSG_LEN - 1))
+    {
+        ssize_t s32Recvd = recv(s32ClientSock, &s8Request[u32Size],
+                                CLI_DAEMON_MAX_MSG_LEN - 1 - u32Size, 0);
+        if (s32Recvd <= 0)
+            break;
+        u32Size += s32Recvd;
+        if (memchr(s8Request, '\n', u32Size) != NULL)
+            break;
+    }
+    s8Request[u32Size] = '\0';
+
+    memset(s8Reply, '\0', CLI_DAEMON_MAX_MSG_LEN);
+    SINT32 s32Status = DaemonHandleRequest(s8Request, s8Reply);
+
+    snprintf(s8Msg, sizeof(s8Msg), "%d %s\n", s32Status, s8Reply);
+    if (send(s32ClientSock, s8Msg, strlen(s8Msg), MSG_NOSIGNAL) < 0)
+        WRITE_TO_LOG_FILE("Daemon: unable to send the command response");
+
+    WRITE_TO_CONSOLE(s8Reply);
+    WRITE_TO_LOG_FILE(s8Reply);
+    close(s32ClientSock);
+}
+
+/** @fn SINT32 DaemonOpenCtrlSock(const SINT8 *s8Path)
+ * @brief This function is to create the control socket of the daemon. <!--
+ * --> A stale socket file of a terminated daemon is replaced
+ * @param [in] s8Path [const SINT8 *] - Control socket path
+ * @return SINT32 value (socket or error code)
+ */
+static SINT32 DaemonOpenCtrlSock(const SINT8 *s8Path)
+{
+    struct sockaddr_un ctrlAddr;
+
+    DaemonSockAddr(s8Path, &ctrlAddr);
+
+    SINT32 s32Sock = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (s32Sock < 0)
+        return CLI_DAEMON_SOCK_ERR;
+
+    /** Another daemon is serving the same config port                   */
+    if (connect(s32Sock, (struct sockaddr *)&ctrlAddr, sizeof(ctrlAddr)) == 0)
+    {
+        close(s32Sock);
+        return CLI_SHM_REC_PROC_RUNNING_STS;
+    }
+    close(s32Sock);
+    unlink(s8Path);
+
+    s32Sock = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (s32Sock < 0)
+        return CLI_DAEMON_SOCK_ERR;
+
+    if ((bind(s32Sock, (struct sockaddr *)&ctrlAddr, sizeof(ctrlAddr)) < 0) ||
+        (listen(s32Sock, SOMAXCONN) < 0))
+    {
+        close(s32Sock);
+        return CLI_DAEMON_SOCK_ERR;
+    }
+
+    return s32Sock;
+}
+
+/** @fn SINT32 RunCliDaemon(SINT8 *s8JsonFile)
+ * @brief This function is to run the capture daemon. It connects to the <!--
+ * --> DCA1000EVM system in record mode once and serves the commands <!--
+ * --> received over the control socket till shutdown
+ * @param [in] s8JsonFile [SINT8 *] - JSON config file
+ * @return SINT32 value
+ */
+SINT32 RunCliDaemon(SINT8 *s8JsonFile)
+{
+    SINT8 s8DebugMsg[MAX_NAME_LEN + PATH_MAX];
+    SINT8 s8SockPath[MAX_NAME_LEN];
+    SINT8 s8Reply[CLI_DAEMON_MAX_MSG_LEN];
+    SINT8 s8Req[MAX_NAME_LEN];
+    struct pollfd sPollFds[2];
+
+    if (realpath(s8JsonFile, s8DaemonJsonFile) == NULL)
+        snprintf(s8DaemonJsonFile, PATH_MAX, "%s", s8JsonFile);
+
+    SINT32 s32Status = ValidateJsonFileData(s8DaemonJsonFile,
+                                            CMD_CODE_START_RECORD);
+    if (s32Status < 0)
+        return s32Status;
+    gsDaemonEthConfig = gsEthConfigMode;
+    UINT16 u16Port = (UINT16)gsDaemonEthConfig.u32ConfigPortNo;
+
+    DaemonSockPath(gsDaemonEthConfig.u32ConfigPortNo, s8SockPath);
+    SINT32 s32ListenSock = DaemonOpenCtrlSock(s8SockPath);
+    if (s32ListenSock < 0)
+    {
+        sprintf(s8DebugMsg, "Unable to open the daemon control socket (%s). [error %d]",
+                s8SockPath, s32ListenSock);
+        WRITE_TO_CONSOLE(s8DebugMsg);
+        WRITE_TO_LOG_FILE(s8DebugMsg);
+        return s32ListenSock;
+    }
+
+    /** API Call - Ethernet connection held till shutdown                */
+    s32Status = ConnectRFDCCard_RecordMode(gsDaemonEthConfig);
+    if (s32Status != SUCCESS_STATUS)
+    {
+        sprintf(s8DebugMsg, "Ethernet connection failed. [error %d]",
+                CLI_ETH_CONNECT_FAIL_ERR);
+        WRITE_TO_CONSOLE(s8DebugMsg);
+        WRITE_TO_LOG_FILE(s8DebugMsg);
+        DisconnectRFDCCard_RecordMode();
+        close(s32ListenSock);
+        unlink(s8SockPath);
+        return CLI_ETH_CONNECT_FAIL_ERR;
+    }
+
+    if (StatusRFDCCard_EventRegister(DaemonEventCallback) != SUCCESS_STATUS)
+        s32Status = CLI_CMD_CALLBACK_REG_FAILED_ERR;
+    else if (RecInlineProcStats_EventRegister(DaemonInlineStatsCallback) !=
+             SUCCESS_STATUS)
+        s32Status = CLI_INLINE_CALLBACK_REG_FAILED_ERR;
+    else if (pipe(s32DaemonStopPipe) < 0)
+        s32Status = CLI_DAEMON_SOCK_ERR;
+    else
+        s32Status = osalObj.CreateShm(u16Port);
+
+    if (s32Status != SUCCESS_STATUS)
+    {
+        sprintf(s8DebugMsg, "Unable to start the daemon. [error %d]", s32Status);
+        WRITE_TO_CONSOLE(s8DebugMsg);
+        WRITE_TO_LOG_FILE(s8DebugMsg);
+        DisconnectRFDCCard_RecordMode();
+        close(s32ListenSock);
+        unlink(s8SockPath);
+        return s32Status;
+    }
+
+    signal(SIGINT, DaemonSignalHandler);
+    signal(SIGTERM, DaemonSignalHandler);
+    signal(SIGUSR1, DaemonTriggerSignalHandler);
+    signal(SIGPIPE, SIG_IGN);
+
+    sprintf(s8DebugMsg, "Daemon is listening on %s", s8SockPath);
+    WRITE_TO_CONSOLE(s8DebugMsg);
+    WRITE_TO_LOG_FILE(s8DebugMsg);
+
+    gbDaemonRunning = 1;
+    while (gbDaemonRunning)
+    {
+        sPollFds[0].fd = s32DaemonStopPipe[0];
+        sPollFds[0].events = POLLIN;
+        sPollFds[1].fd = s32ListenSock;
+        sPollFds[1].events = POLLIN;
+
+        if (poll(sPollFds, 2, -1) <= 0)
+            continue;
+
+        /** Stop requested by async status or stop_record of the CLI     */
+        if (sPollFds[0].revents & POLLIN)
+        {
+            if (read(s32DaemonStopPipe[0], s8Req, sizeof(s8Req)) > 0)
+            {
+                if (gbDaemonRecording)
+                {
+                    s32Status = DaemonStopRecord(s8Reply);
+                    WRITE_TO_CONSOLE(s8Reply);
+                    WRITE_TO_LOG_FILE(s8Reply);
+                }
+            }
+        }
+
+        if (sPollFds[1].revents & POLLIN)
+            DaemonServeClient(s32ListenSock);
+    }
+
+    if (gbDaemonRecording)
+    {
+        DaemonStopRecord(s8Reply);
+        WRITE_TO_CONSOLE(s8Reply);
+        WRITE_TO_LOG_FILE(s8Reply);
+    }
+
+    DisconnectRFDCCard_RecordMode();
+    pthread_mutex_lock(&gsDaemonShmLock);
+    osalObj.DestroyShm(u16Port);
+    pthread_mutex_unlock(&gsDaemonShmLock);
+    close(s32ListenSock);
+    unlink(s8SockPath);
+    close(s32DaemonStopPipe[0]);
+    close(s32DaemonStopPipe[1]);
+
+    return SUCCESS_STATUS;
+}
+
+/** @fn SINT32 SendCliDaemonCmd(SINT8 *s8Command, SINT8 *s8JsonFile)
+ * @brief This function is to send a command to the capture daemon and <!--
+ * --> display its response
+ * @param [in] s8Command [SINT8 *] - Command name
+ * @param [in] s8JsonFile [SINT8 *] - JSON config file
+ * @return SINT32 value
+ */
+SINT32 SendCliDaemonCmd(SINT8 *s8Command, SINT8 *s8JsonFile)
+{
+    SINT8 s8DebugMsg[MAX_NAME_LEN];
+    SINT8 s8JsonPath[PATH_MAX];
+    SINT8 s8Msg[CLI_DAEMON_MAX_MSG_LEN];
+    SINT8 *s8Reply = NULL;
+    struct sockaddr_un ctrlAddr;
+    struct timeval timeout;
+    UINT32 u32Size = 0;
+
+    /** Config port of the JSON file selects the daemon                  */
+    SINT32 s32Status = ValidateJsonFileData(s8JsonFile, 0);
+    if (s32Status < 0)
+        return s32Status;
+
+    /** The daemon may run from another directory                        */
+    if (realpath(s8JsonFile, s8JsonPath) == NULL)
+        snprintf(s8JsonPath, sizeof(s8JsonPath), "%s", s8JsonFile);
+
+    DaemonSockPath(gsEthConfigMode.u32ConfigPortNo, s8Msg);
+    DaemonSockAddr(s8Msg, &ctrlAddr);
+
+    SINT32 s32Sock = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (s32Sock < 0)
+        return CLI_DAEMON_SOCK_ERR;
+
+    if (connect(s32Sock, (struct sockaddr *)&ctrlAddr, sizeof(ctrlAddr)) < 0)
+    {
+        sprintf(s8DebugMsg, "Daemon is not running (%s). [error %d]",
+                ctrlAddr.sun_path, CLI_DAEMON_NOT_RUNNING_ERR);
+        WRITE_TO_CONSOLE(s8DebugMsg);
+        WRITE_TO_LOG_FILE(s8DebugMsg);
+        close(s32Sock);
+        return CLI_DAEMON_NOT_RUNNING_ERR;
+    }
+
+    timeout.tv_sec = CLI_DAEMON_REPLY_TIMEOUT_MS / 1000;
+    timeout.tv_usec = (CLI_DAEMON_REPLY_TIMEOUT_MS % 1000) * 1000;
+    setsockopt(s32Sock, SOL_SOCKET, SO_RCVTIMEO, (char *)&timeout,
+               sizeof(timeout));
+
+    if ((strlen(s8JsonPath) > CLI_DAEMON_MAX_TOKEN_LEN) ||
+        (snprintf(s8Msg, CLI_DAEMON_MAX_MSG_LEN, "%s %s\n", s8Command,
+                  s8JsonPath) >= CLI_DAEMON_MAX_MSG_LEN))
+    {
+        snprintf(s8DebugMsg, sizeof(s8DebugMsg), "JSON file path is longer "
+                 "than %d bytes. [error %d]", CLI_DAEMON_MAX_TOKEN_LEN,
+                 CLI_INVALID_CMD_ARG_ERR);
+        WRITE_TO_CONSOLE(s8DebugMsg);
+        WRITE_TO_LOG_FILE(s8DebugMsg);
+        close(s32Sock);
+        return CLI_INVALID_CMD_ARG_ERR;
+    }
+    if (send(s32Sock, s8Msg, strlen(s8Msg), MSG_NOSIGNAL) < 0)
+    {
+        close(s32Sock);
+        return CLI_DAEMON_SOCK_ERR;
+    }
+
+    while (u32Size < (CLI_DAEMON_MAX_MSG_LEN - 1))
+    {
+        ssize_t s32Recvd = recv(s32Sock, &s8Msg[u32Size],
+                                CLI_DAEMON_MAX_MSG_LEN - 1 - u32Size, 0);
+        if (s32Recvd <= 0)
+            break;
+        u32Size += s32Recvd;
+    }
+    s8Msg[u32Size] = '\0';
+    close(s32Sock);
+
+    /** Response - "<status> <message>"                                  */
+    s32Status = (SINT32)strtol(s8Msg, &s8Reply, 10);
+    if ((u32Size == 0) || (s8Reply == s8Msg))
+    {
+        sprintf(s8DebugMsg, "No response from the daemon. [error %d]",
+                CLI_DAEMON_SOCK_ERR);
+        WRITE_TO_CONSOLE(s8DebugMsg);
+        WRITE_TO_LOG_FILE(s8DebugMsg);
+        return CLI_DAEMON_SOCK_ERR;
+    }
+
+    s8Reply[strcspn(s8Reply, "\n")] = '\0';
+    if (*s8Reply == ' ')
+        s8Reply++;
+    WRITE_TO_CONSOLE(s8Reply);
+    WRITE_TO_LOG_FILE(s8Reply);
+    sprintf(s8DebugMsg, "Return status : %d", s32Status);
+    WRITE_TO_LOG_FILE(s8DebugMsg);
+
+    return s32Status;
+}
@@ -0,0 +1,144 @@
+/**
+ * @file cli_daemon.h
+ *
+ * @author JP
+ *
+ * @version 0.1
+ *
+ * @brief This file contains the declarations of the capture daemon which
+ * holds the record mode connection and serves the CLI commands over a
+ * local control socket
+ *
+ * @par
+ * NOTE:
+ *     (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+///*****************************************************************************
+/// HISTORY :
+/// VERSION        DATE              AUTHOR      CHANGE DESCRIPTION
+/// 0.1            19 Oct 2026       JP          Created
+///*****************************************************************************
+
+#ifndef CLI_DAEMON_H
+#define CLI_DAEMON_H
+
+///****************
+/// Includes
+///****************
+
+#include "Common/globals.h"
+#include "Common/Osal_Utils/osal.h"
+
+///****************
+/// Defines
+///****************
+
+/** Control socket path prefix followed by config port                      */
+#define CLI_DAEMON_SOCK_PREFIX_NAME "/tmp/dca1000_daemon_"
+
+/** Maximum size of a control request or response line                      */
+#define CLI_DAEMON_MAX_MSG_LEN 1024
+
+/** Maximum length of the command or JSON file of a control request, the
+ *  JSON file is quoted in the fixed size messages of the config parser    */
+#define CLI_DAEMON_MAX_TOKEN_LEN 192
+
+/** Control socket receive timeout in millisec for a connected client       */
+#define CLI_DAEMON_CLIENT_TIMEOUT_MS 1000
+
+/** Control client reply timeout in millisec, exceeds the FPGA command
+ *  response timeout of the daemon                                          */
+#define CLI_DAEMON_REPLY_TIMEOUT_MS 15000
+
+/** Command - Stop the capture daemon                                       */
+#define CMD_DAEMON_SHUTDOWN "shutdown"
+
+/** Command - Configure FPGA, record delay and start record, pipelined      */
+#define CMD_DAEMON_BRINGUP "bringup"
+
+/** Command - Dump the pre-trigger ring of the record (event trigger mode)  */
+#define CMD_DAEMON_TRIGGER "trigger"
+
+///****************
+/// Externs - CLI control tool
+///****************
+
+/** Osal class object                           */
+extern osal osalObj;
+
+/** Quiet mode enable/disable                   */
+extern bool gbCliQuietMode;
+
+/** FPGA config mode stucture object            */
+extern strFpgaConfigMode gsFpgaConfigMode;
+
+/** Ethernet config mode stucture object        */
+extern strEthConfigMode gsEthConfigMode;
+
+/** Record config mode stucture object          */
+extern strRecConfigMode gsRecConfigMode;
+
+/** Start record config mode stucture object    */
+extern strStartRecConfigMode gsStartRecConfigMode;
+
+/** CLI message in the console                 */
+void WRITE_TO_CONSOLE(const SINT8 *msg);
+
+/** CLI message in the logfile                  */
+void WRITE_TO_LOG_FILE(const SINT8 *s8Msg);
+
+/** JSON file validation for a command          */
+SINT32 ValidateJsonFileData(SINT8 *configFile, UINT16 u16CmdCode);
+
+///****************
+/// Function declarations
+///****************
+
+/** @fn SINT32 RunCliDaemon(SINT8 *s8JsonFile)
+ * @brief This function is to run the capture daemon. It connects to the <!--
+ * --> DCA1000EVM system in record mode once and serves the commands <!--
+ * --> received over the control socket till shutdown
+ * @param [in] s8JsonFile [SINT8 *] - JSON config file
+ * @return SINT32 value
+ */
+SINT32 RunCliDaemon(SINT8 *s8JsonFile);
+
+/** @fn SINT32 SendCliDaemonCmd(SINT8 *s8Command, SINT8 *s8JsonFile)
+ * @brief This function is to send a command to the capture daemon and <!--
+ * --> display its response
+ * @param [in] s8Command [SINT8 *] - Command name
+ * @param [in] s8JsonFile [SINT8 *] - JSON config file
+ * @return SINT32 value
+ */
+SINT32 SendCliDaemonCmd(SINT8 *s8Command, SINT8 *s8JsonFile);
+
+#endif // CLI_DAEMON_H
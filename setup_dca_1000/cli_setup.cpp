@@ -74,6 +74,8 @@
 #include "Common/errcodes.h"
 #include "Common/Json_Utils/dist/json/json.h"
 #include "Common/Json_Utils/dist/json/json-forwards.h"
+#include "cli_daemon.h"
+#include "cli_calibrate.h"
 
 ///****************
 /// Variable declarations
@@ -162,7 +164,21 @@ void ListOfCmds()
            "Read status of record process");
     printf("\n%s\t%s", CMD_QUERY_SYSTEM_ALIVENESS,
            "DCA1000EVM System aliveness");
+    printf("\n%s [num of IPs]\t%s", CMD_DISCOVER,
+           "Find DCA1000EVM systems from the JSON file IP address");
+    printf("\n%s <json> <json>...\t%s", CMD_CONFIG_EEPROM,
+           "Update EEPROM of several systems at once");
+    printf("\n%s <manifest> <file>\t%s", CMD_REASSEMBLE,
+           "Join the stripes of a striped record in one file");
+    printf("\n%s <crc log> [threads]\t%s", CMD_VERIFY,
+           "Verify a record against its CRC32C log");
+    printf("\n%s\t\t%s", CMD_CALIBRATE,
+           "Find the lowest loss-free packet delay, saved in the JSON file");
     printf("\n\n%s\t\t\t%s", CMD_RUN_TASK, "run custom task");
+    printf("\n%s\t\t\t%s", CMD_DAEMON,
+           "Capture daemon holding the record connection");
+    printf("\n%s <command>\t\t%s", CMD_DAEMON_CTL,
+           "Send a command to the capture daemon");
 }
 
 /** @fn void cli_DisconnectRFDCCard(UINT16 u16CmdCode)
@@ -715,15 +731,71 @@ SINT32 ValidateJsonFileData(SINT8 *configFile, UINT16 u16CmdCode)
             s16Status = CLI_JSON_REC_FILE_BASE_PATH_NODE_ERR;
             return s16Status;
         }
-        strcpy(gsStartRecConfigMode.s8FileBasePath,
-               root["captureConfig"]["fileBasePath"].asString().c_str());
+        /** A list of paths stripes the record across them, the first one
+         *  gets the log files and the stripe manifest                   */
+        gsStartRecConfigMode.u8NumOfStripePaths = 0;
+        if (root["captureConfig"]["fileBasePath"].isArray())
+        {
+            Json::Value pathNode = root["captureConfig"]["fileBasePath"];
+            if ((pathNode.size() < 1) || (pathNode.size() > MAX_STRIPE_PATHS))
+            {
+                sprintf(s8DebugMsg, "Invalid number of fileBasePath values (%u). [error %d]",
+                        pathNode.size(), CLI_JSON_REC_INVALID_STRIPE_PATHS_ERR);
+                WRITE_TO_CONSOLE(s8DebugMsg);
+                return CLI_JSON_REC_INVALID_STRIPE_PATHS_ERR;
+            }
 
-        if (!osalObj.IsValidDir(gsStartRecConfigMode.s8FileBasePath))
+            for (UINT8 i = 0; i < pathNode.size(); i++)
+            {
+                snprintf(gsStartRecConfigMode.s8StripeBasePath[i],
+                         sizeof(gsStartRecConfigMode.s8StripeBasePath[i]), "%s",
+                         pathNode[i].asString().c_str());
+                if (!osalObj.IsValidDir(gsStartRecConfigMode.s8StripeBasePath[i]))
+                {
+                    snprintf(s8DebugMsg, sizeof(s8DebugMsg),
+                             "Invalid fileBasePath value (%.*s). [error %d]",
+                             MAX_NAME_LEN - 64,
+                             gsStartRecConfigMode.s8StripeBasePath[i],
+                             CLI_JSON_REC_INVALID_FILE_BASE_PATH_ERR);
+                    WRITE_TO_CONSOLE(s8DebugMsg);
+                    return CLI_JSON_REC_INVALID_FILE_BASE_PATH_ERR;
+                }
+
+                /** Stripe files of a path are named as the record files */
+                for (UINT8 j = 0; j < i; j++)
+                {
+                    if (strcmp(gsStartRecConfigMode.s8StripeBasePath[i],
+                               gsStartRecConfigMode.s8StripeBasePath[j]) == 0)
+                    {
+                        snprintf(s8DebugMsg, sizeof(s8DebugMsg),
+                                 "Duplicate fileBasePath value (%.*s). [error %d]",
+                                 MAX_NAME_LEN - 64,
+                                 gsStartRecConfigMode.s8StripeBasePath[i],
+                                 CLI_JSON_REC_INVALID_STRIPE_PATHS_ERR);
+                        WRITE_TO_CONSOLE(s8DebugMsg);
+                        return CLI_JSON_REC_INVALID_STRIPE_PATHS_ERR;
+                    }
+                }
+            }
+            gsStartRecConfigMode.u8NumOfStripePaths = (UINT8)pathNode.size();
+            strcpy(gsStartRecConfigMode.s8FileBasePath,
+                   gsStartRecConfigMode.s8StripeBasePath[0]);
+        }
+        else
         {
-            sprintf(s8DebugMsg, "Invalid fileBasePath value (%s). [error %d]",
-                    gsStartRecConfigMode.s8FileBasePath, CLI_JSON_REC_INVALID_FILE_BASE_PATH_ERR);
-            WRITE_TO_CONSOLE(s8DebugMsg);
-            return CLI_JSON_REC_INVALID_FILE_BASE_PATH_ERR;
+            snprintf(gsStartRecConfigMode.s8FileBasePath,
+                     sizeof(gsStartRecConfigMode.s8FileBasePath), "%s",
+                     root["captureConfig"]["fileBasePath"].asString().c_str());
+
+            if (!osalObj.IsValidDir(gsStartRecConfigMode.s8FileBasePath))
+            {
+                snprintf(s8DebugMsg, sizeof(s8DebugMsg),
+                         "Invalid fileBasePath value (%.*s). [error %d]",
+                         MAX_NAME_LEN - 64, gsStartRecConfigMode.s8FileBasePath,
+                         CLI_JSON_REC_INVALID_FILE_BASE_PATH_ERR);
+                WRITE_TO_CONSOLE(s8DebugMsg);
+                return CLI_JSON_REC_INVALID_FILE_BASE_PATH_ERR;
+            }
         }
 
         if (!node.isMember("filePrefix"))
@@ -897,6 +969,354 @@ SINT32 ValidateJsonFileData(SINT8 *configFile, UINT16 u16CmdCode)
             return s16Status;
         }
 
+        /** Socket drain quiet period on record completion is optional */
+        gsStartRecConfigMode.u16DrainQuietPeriod = 0;
+        if (node.isMember("drainQuietPeriod_ms"))
+        {
+            memset(nodeData, '\0', MAX_PARAMS_LEN);
+            strcpy(nodeData,
+                   root["captureConfig"]["drainQuietPeriod_ms"].asString().c_str());
+            s16Status = validateDrainQuietPeriod(nodeData);
+            if (s16Status != SUCCESS_STATUS)
+            {
+                sprintf(s8DebugMsg, "Invalid drainQuietPeriod_ms value (%s). [error %d]",
+                        nodeData, CLI_JSON_REC_INVALID_DRAIN_QUIET_PERIOD_ERR);
+                WRITE_TO_CONSOLE(s8DebugMsg);
+                s16Status = CLI_JSON_REC_INVALID_DRAIN_QUIET_PERIOD_ERR;
+                return s16Status;
+            }
+            gsStartRecConfigMode.u16DrainQuietPeriod = atoi(nodeData);
+        }
+
+        /** Capture timeout of a stream stopped while recording is optional */
+        gsStartRecConfigMode.u32CaptureTimeout = 0;
+        if (node.isMember("captureTimeout_ms"))
+        {
+            memset(nodeData, '\0', MAX_PARAMS_LEN);
+            strcpy(nodeData,
+                   root["captureConfig"]["captureTimeout_ms"].asString().c_str());
+            s16Status = validateCaptureTimeout(nodeData);
+            if (s16Status != SUCCESS_STATUS)
+            {
+                sprintf(s8DebugMsg, "Invalid captureTimeout_ms value (%s). [error %d]",
+                        nodeData, CLI_JSON_REC_INVALID_CAPTURE_TIMEOUT_ERR);
+                WRITE_TO_CONSOLE(s8DebugMsg);
+                s16Status = CLI_JSON_REC_INVALID_CAPTURE_TIMEOUT_ERR;
+                return s16Status;
+            }
+            gsStartRecConfigMode.u32CaptureTimeout = atol(nodeData);
+        }
+
+        /** File writer spill capacity and overflow policy are optional */
+        gsStartRecConfigMode.u16WriterSpillSize = 0;
+        if (node.isMember("writerSpill_MB"))
+        {
+            memset(nodeData, '\0', MAX_PARAMS_LEN);
+            strcpy(nodeData,
+                   root["captureConfig"]["writerSpill_MB"].asString().c_str());
+            s16Status = validateWriterSpillSize(nodeData);
+            if (s16Status != SUCCESS_STATUS)
+            {
+                sprintf(s8DebugMsg, "Invalid writerSpill_MB value (%s). [error %d]",
+                        nodeData, CLI_JSON_REC_INVALID_WRITER_SPILL_SIZE_ERR);
+                WRITE_TO_CONSOLE(s8DebugMsg);
+                s16Status = CLI_JSON_REC_INVALID_WRITER_SPILL_SIZE_ERR;
+                return s16Status;
+            }
+            gsStartRecConfigMode.u16WriterSpillSize = atoi(nodeData);
+        }
+        gsStartRecConfigMode.eWriterOverflowPolicy = WRITER_OVERFLOW_PAUSE;
+        if (node.isMember("writerOverflowPolicy"))
+        {
+            memset(nodeData, '\0', MAX_PARAMS_LEN);
+            strcpy(nodeData,
+                   root["captureConfig"]["writerOverflowPolicy"].asString().c_str());
+            if (strcmp(nodeData, "drop") == 0)
+            {
+                gsStartRecConfigMode.eWriterOverflowPolicy =
+                        WRITER_OVERFLOW_DROP_FRAMES;
+            }
+            else if (strcmp(nodeData, "pause") != 0)
+            {
+                sprintf(s8DebugMsg, "Invalid writerOverflowPolicy value (%s). [error %d]",
+                        nodeData, CLI_JSON_REC_INVALID_WRITER_POLICY_ERR);
+                WRITE_TO_CONSOLE(s8DebugMsg);
+                s16Status = CLI_JSON_REC_INVALID_WRITER_POLICY_ERR;
+                return s16Status;
+            }
+        }
+
+        /** File writer backend is optional, memory mapped record files
+         *  are not available on Windows                                 */
+        gsStartRecConfigMode.eWriterBackend = WRITER_BACKEND_FWRITE;
+        if (node.isMember("writerBackend"))
+        {
+            memset(nodeData, '\0', MAX_PARAMS_LEN);
+            strcpy(nodeData,
+                   root["captureConfig"]["writerBackend"].asString().c_str());
+#ifndef _WIN32
+            if (strcmp(nodeData, "mmap") == 0)
+            {
+                gsStartRecConfigMode.eWriterBackend = WRITER_BACKEND_MMAP;
+            }
+            else
+#endif
+            if (strcmp(nodeData, "fwrite") != 0)
+            {
+                sprintf(s8DebugMsg, "Invalid writerBackend value (%s). [error %d]",
+                        nodeData, CLI_JSON_REC_INVALID_WRITER_BACKEND_ERR);
+                WRITE_TO_CONSOLE(s8DebugMsg);
+                s16Status = CLI_JSON_REC_INVALID_WRITER_BACKEND_ERR;
+                return s16Status;
+            }
+        }
+
+        /** Event trigger mode and its pre-trigger ring are optional */
+        gsStartRecConfigMode.eRecordTriggerMode = RECORD_TRIGGER_CONTINUOUS;
+        gsStartRecConfigMode.u16TriggerRingSize = DEFAULT_RECORD_TRIGGER_RING_SIZE;
+        gsStartRecConfigMode.u32PreTriggerDuration =
+                                        DEFAULT_RECORD_PRE_TRIGGER_DURATION;
+        gsStartRecConfigMode.u32PostTriggerDuration =
+                                        DEFAULT_RECORD_POST_TRIGGER_DURATION;
+        if (node.isMember("triggerMode"))
+        {
+            memset(nodeData, '\0', MAX_PARAMS_LEN);
+            strcpy(nodeData,
+                   root["captureConfig"]["triggerMode"].asString().c_str());
+            if (strcmp(nodeData, "event") == 0)
+            {
+                gsStartRecConfigMode.eRecordTriggerMode = RECORD_TRIGGER_EVENT;
+            }
+            else if (strcmp(nodeData, "continuous") != 0)
+            {
+                sprintf(s8DebugMsg, "Invalid triggerMode value (%s). [error %d]",
+                        nodeData, CLI_JSON_REC_INVALID_TRIGGER_MODE_ERR);
+                WRITE_TO_CONSOLE(s8DebugMsg);
+                s16Status = CLI_JSON_REC_INVALID_TRIGGER_MODE_ERR;
+                return s16Status;
+            }
+        }
+        if (node.isMember("triggerRing_MB"))
+        {
+            memset(nodeData, '\0', MAX_PARAMS_LEN);
+            strcpy(nodeData,
+                   root["captureConfig"]["triggerRing_MB"].asString().c_str());
+            s16Status = validateTriggerRingSize(nodeData);
+            if (s16Status != SUCCESS_STATUS)
+            {
+                sprintf(s8DebugMsg, "Invalid triggerRing_MB value (%s). [error %d]",
+                        nodeData, CLI_JSON_REC_INVALID_TRIGGER_RING_SIZE_ERR);
+                WRITE_TO_CONSOLE(s8DebugMsg);
+                s16Status = CLI_JSON_REC_INVALID_TRIGGER_RING_SIZE_ERR;
+                return s16Status;
+            }
+            gsStartRecConfigMode.u16TriggerRingSize = atoi(nodeData);
+        }
+        if (node.isMember("preTrigger_ms"))
+        {
+            memset(nodeData, '\0', MAX_PARAMS_LEN);
+            strcpy(nodeData,
+                   root["captureConfig"]["preTrigger_ms"].asString().c_str());
+            s16Status = validateTriggerDuration(nodeData,
+                                        MAX_RECORD_PRE_TRIGGER_DURATION);
+            if (s16Status != SUCCESS_STATUS)
+            {
+                sprintf(s8DebugMsg, "Invalid preTrigger_ms value (%s). [error %d]",
+                        nodeData, CLI_JSON_REC_INVALID_TRIGGER_DURATION_ERR);
+                WRITE_TO_CONSOLE(s8DebugMsg);
+                s16Status = CLI_JSON_REC_INVALID_TRIGGER_DURATION_ERR;
+                return s16Status;
+            }
+            gsStartRecConfigMode.u32PreTriggerDuration = atol(nodeData);
+        }
+        if (node.isMember("postTrigger_ms"))
+        {
+            memset(nodeData, '\0', MAX_PARAMS_LEN);
+            strcpy(nodeData,
+                   root["captureConfig"]["postTrigger_ms"].asString().c_str());
+            s16Status = validateTriggerDuration(nodeData,
+                                        MAX_RECORD_POST_TRIGGER_DURATION);
+            if (s16Status != SUCCESS_STATUS)
+            {
+                sprintf(s8DebugMsg, "Invalid postTrigger_ms value (%s). [error %d]",
+                        nodeData, CLI_JSON_REC_INVALID_TRIGGER_DURATION_ERR);
+                WRITE_TO_CONSOLE(s8DebugMsg);
+                s16Status = CLI_JSON_REC_INVALID_TRIGGER_DURATION_ERR;
+                return s16Status;
+            }
+            gsStartRecConfigMode.u32PostTriggerDuration = atol(nodeData);
+        }
+
+        /** CRC32C integrity tags of the record data are optional */
+        gsStartRecConfigMode.u16CrcChunkSize = 0;
+        if (node.isMember("crcChunk_KB"))
+        {
+            memset(nodeData, '\0', MAX_PARAMS_LEN);
+            strcpy(nodeData,
+                   root["captureConfig"]["crcChunk_KB"].asString().c_str());
+            s16Status = validateCrcChunkSize(nodeData);
+            if (s16Status != SUCCESS_STATUS)
+            {
+                sprintf(s8DebugMsg, "Invalid crcChunk_KB value (%s). [error %d]",
+                        nodeData, CLI_JSON_REC_INVALID_CRC_CHUNK_SIZE_ERR);
+                WRITE_TO_CONSOLE(s8DebugMsg);
+                s16Status = CLI_JSON_REC_INVALID_CRC_CHUNK_SIZE_ERR;
+                return s16Status;
+            }
+            gsStartRecConfigMode.u16CrcChunkSize = atoi(nodeData);
+        }
+
+        /** Coalesced receive of the ADC data port is optional */
+        gsStartRecConfigMode.bUdpGroEnable = false;
+        if (node.isMember("udpGroEnable"))
+        {
+            memset(nodeData, '\0', MAX_PARAMS_LEN);
+            strcpy(nodeData,
+                   root["captureConfig"]["udpGroEnable"].asString().c_str());
+            if (strcmp(nodeData, "1") == 0)
+            {
+                gsStartRecConfigMode.bUdpGroEnable = true;
+            }
+            else if (strcmp(nodeData, "0") != 0)
+            {
+                sprintf(s8DebugMsg, "Invalid udpGroEnable value (%s). [error %d]",
+                        nodeData, CLI_JSON_REC_INVALID_UDP_GRO_ERR);
+                WRITE_TO_CONSOLE(s8DebugMsg);
+                s16Status = CLI_JSON_REC_INVALID_UDP_GRO_ERR;
+                return s16Status;
+            }
+        }
+
+        /** Total size and age of the record files kept are optional */
+        gsStartRecConfigMode.u32RetentionSize = 0;
+        gsStartRecConfigMode.u32RetentionAge = 0;
+        if (node.isMember("retentionSize_MB"))
+        {
+            memset(nodeData, '\0', MAX_PARAMS_LEN);
+            strcpy(nodeData,
+                   root["captureConfig"]["retentionSize_MB"].asString().c_str());
+            if (SUCCESS_STATUS != validateCaptureFilterParam(nodeData, 0,
+                                        MAX_RECORD_RETENTION_SIZE))
+            {
+                sprintf(s8DebugMsg, "Invalid retentionSize_MB value (%s). [error %d]",
+                        nodeData, CLI_JSON_REC_INVALID_RETENTION_ERR);
+                WRITE_TO_CONSOLE(s8DebugMsg);
+                s16Status = CLI_JSON_REC_INVALID_RETENTION_ERR;
+                return s16Status;
+            }
+            gsStartRecConfigMode.u32RetentionSize =
+                                    (UINT32)strtoull(nodeData, NULL, 10);
+        }
+        if (node.isMember("retentionAge_s"))
+        {
+            memset(nodeData, '\0', MAX_PARAMS_LEN);
+            strcpy(nodeData,
+                   root["captureConfig"]["retentionAge_s"].asString().c_str());
+            if (SUCCESS_STATUS != validateCaptureFilterParam(nodeData, 0,
+                                        MAX_RECORD_RETENTION_AGE))
+            {
+                sprintf(s8DebugMsg, "Invalid retentionAge_s value (%s). [error %d]",
+                        nodeData, CLI_JSON_REC_INVALID_RETENTION_ERR);
+                WRITE_TO_CONSOLE(s8DebugMsg);
+                s16Status = CLI_JSON_REC_INVALID_RETENTION_ERR;
+                return s16Status;
+            }
+            gsStartRecConfigMode.u32RetentionAge =
+                                    (UINT32)strtoull(nodeData, NULL, 10);
+        }
+
+        /** Record files are written over in place by the file writer of
+         *  the raw mode, the total size holds two record files at least  */
+        if (((gsStartRecConfigMode.u32RetentionSize > 0) ||
+             (gsStartRecConfigMode.u32RetentionAge > 0)) &&
+            ((gsStartRecConfigMode.eConfigLogMode != RAW_MODE) ||
+             (gsStartRecConfigMode.u8NumOfStripePaths > 1) ||
+             (gsStartRecConfigMode.eWriterBackend == WRITER_BACKEND_MMAP) ||
+             ((gsStartRecConfigMode.u32RetentionSize > 0) &&
+              (gsStartRecConfigMode.u32RetentionSize <
+               (UINT32)gsStartRecConfigMode.u16MaxRecFileSize *
+                                            MIN_RECORD_RETENTION_FILES))))
+        {
+            sprintf(s8DebugMsg, "Invalid retention config - it is supported "
+                    "in raw mode with the fwrite backend and one path, and "
+                    "retentionSize_MB holds two record files at least. "
+                    "[error %d]", CLI_JSON_REC_INVALID_RETENTION_ERR);
+            WRITE_TO_CONSOLE(s8DebugMsg);
+            s16Status = CLI_JSON_REC_INVALID_RETENTION_ERR;
+            return s16Status;
+        }
+
+        /** Watermark of the record files read in progress is optional,
+         *  the stripes are written in several base paths               */
+        gsStartRecConfigMode.bWatermarkEnable = false;
+        if (node.isMember("watermarkEnable"))
+        {
+            memset(nodeData, '\0', MAX_PARAMS_LEN);
+            strcpy(nodeData,
+                   root["captureConfig"]["watermarkEnable"].asString().c_str());
+            if (strcmp(nodeData, "1") == 0)
+            {
+                gsStartRecConfigMode.bWatermarkEnable = true;
+            }
+            else if (strcmp(nodeData, "0") != 0)
+            {
+                sprintf(s8DebugMsg, "Invalid watermarkEnable value (%s). [error %d]",
+                        nodeData, CLI_JSON_REC_INVALID_WATERMARK_ERR);
+                WRITE_TO_CONSOLE(s8DebugMsg);
+                s16Status = CLI_JSON_REC_INVALID_WATERMARK_ERR;
+                return s16Status;
+            }
+        }
+        if (gsStartRecConfigMode.bWatermarkEnable &&
+            (gsStartRecConfigMode.u8NumOfStripePaths > 1))
+        {
+            sprintf(s8DebugMsg, "Invalid watermark config - it is not supported "
+                    "with stripe paths. [error %d]",
+                    CLI_JSON_REC_INVALID_WATERMARK_ERR);
+            WRITE_TO_CONSOLE(s8DebugMsg);
+            s16Status = CLI_JSON_REC_INVALID_WATERMARK_ERR;
+            return s16Status;
+        }
+
+        /** Record files ending at whole frames, by count or by duration,
+         *  are optional. The frames are checked with the capture filter  */
+        gsStartRecConfigMode.u32FramesPerFile = 0;
+        gsStartRecConfigMode.u32FileDuration = 0;
+        if (node.isMember("framesPerFile"))
+        {
+            memset(nodeData, '\0', MAX_PARAMS_LEN);
+            strcpy(nodeData,
+                   root["captureConfig"]["framesPerFile"].asString().c_str());
+            if (SUCCESS_STATUS != validateCaptureFilterParam(nodeData, 1,
+                                        MAX_RECORD_FRAMES_PER_FILE))
+            {
+                sprintf(s8DebugMsg, "Invalid framesPerFile value (%s). [error %d]",
+                        nodeData, CLI_JSON_REC_INVALID_FILE_ROLLOVER_ERR);
+                WRITE_TO_CONSOLE(s8DebugMsg);
+                s16Status = CLI_JSON_REC_INVALID_FILE_ROLLOVER_ERR;
+                return s16Status;
+            }
+            gsStartRecConfigMode.u32FramesPerFile =
+                                    (UINT32)strtoull(nodeData, NULL, 10);
+        }
+        if (node.isMember("fileDuration_ms"))
+        {
+            memset(nodeData, '\0', MAX_PARAMS_LEN);
+            strcpy(nodeData,
+                   root["captureConfig"]["fileDuration_ms"].asString().c_str());
+            if (SUCCESS_STATUS != validateCaptureFilterParam(nodeData, 1,
+                                        MAX_RECORD_FILE_DURATION))
+            {
+                sprintf(s8DebugMsg, "Invalid fileDuration_ms value (%s). [error %d]",
+                        nodeData, CLI_JSON_REC_INVALID_FILE_ROLLOVER_ERR);
+                WRITE_TO_CONSOLE(s8DebugMsg);
+                s16Status = CLI_JSON_REC_INVALID_FILE_ROLLOVER_ERR;
+                return s16Status;
+            }
+            gsStartRecConfigMode.u32FileDuration =
+                                    (UINT32)strtoull(nodeData, NULL, 10);
+        }
+
         /** Read MSB togglig and reordering enable/disable status */
         node = root.get("dataFormatConfig", 0);
         if (node.size() < 1)
@@ -960,6 +1380,239 @@ SINT32 ValidateJsonFileData(SINT8 *configFile, UINT16 u16CmdCode)
             }
         }
 
+        /** Capture filter of the ADC data is optional, the ADC data
+         *  layout (samples and chirps) is needed to enable it           */
+        memset(&gsStartRecConfigMode.sCaptureFilter, 0,
+               sizeof(strCaptureFilterConfig));
+        node = root.get("captureFilterConfig", 0);
+        if (node.size() > 0)
+        {
+            const SINT8 *s8FilterParam[CAPTURE_FILTER_NUM_OF_PARAMS] = {
+                "numAdcSamples", "adcFmt", "rxChanEn", "numChirpsPerFrame",
+                "frameDecimation", "frameStartIdx", "frameEndIdx",
+                "rxChanSel", "chirpStartIdx", "chirpEndIdx" };
+            ULONG64 u64FilterMin[CAPTURE_FILTER_NUM_OF_PARAMS] = {
+                1, 0, 1, 1, 1, 0, 0, 1, 0, 0 };
+            ULONG64 u64FilterMax[CAPTURE_FILTER_NUM_OF_PARAMS] = {
+                MAX_CAPTURE_FILTER_ADC_SAMPLES, MAX_CAPTURE_FILTER_ADC_FMT,
+                CAPTURE_FILTER_RX_CHAN_MASK, MAX_CAPTURE_FILTER_CHIRPS,
+                MAX_CAPTURE_FILTER_FRAME_IDX, MAX_CAPTURE_FILTER_FRAME_IDX,
+                MAX_CAPTURE_FILTER_FRAME_IDX, CAPTURE_FILTER_RX_CHAN_MASK,
+                MAX_CAPTURE_FILTER_CHIRPS - 1, MAX_CAPTURE_FILTER_CHIRPS - 1 };
+
+            /** Complex data of all RX channels and all frames and chirps
+             *  are kept by default                                        */
+            ULONG64 u64FilterValue[CAPTURE_FILTER_NUM_OF_PARAMS] = {
+                0, 1, CAPTURE_FILTER_RX_CHAN_MASK, 0, 1, 0,
+                MAX_CAPTURE_FILTER_FRAME_IDX, 0, 0, 0 };
+
+            if ((!node.isMember("numAdcSamples")) ||
+                (!node.isMember("numChirpsPerFrame")))
+            {
+                sprintf(s8DebugMsg, "Invalid captureFilterConfig - numAdcSamples "
+                        "and numChirpsPerFrame are needed. [error %d]",
+                        CLI_JSON_REC_INVALID_CAPTURE_FILTER_ERR);
+                WRITE_TO_CONSOLE(s8DebugMsg);
+                s16Status = CLI_JSON_REC_INVALID_CAPTURE_FILTER_ERR;
+                return s16Status;
+            }
+            for (SINT32 i = 0; i < CAPTURE_FILTER_NUM_OF_PARAMS; i++)
+            {
+                if (!node.isMember(s8FilterParam[i]))
+                    continue;
+
+                memset(nodeData, '\0', MAX_PARAMS_LEN);
+                strcpy(nodeData, node[s8FilterParam[i]].asString().c_str());
+                if (SUCCESS_STATUS != validateCaptureFilterParam(nodeData,
+                                        u64FilterMin[i], u64FilterMax[i]))
+                {
+                    sprintf(s8DebugMsg, "Invalid %s value (%s). [error %d]",
+                            s8FilterParam[i], nodeData,
+                            CLI_JSON_REC_INVALID_CAPTURE_FILTER_ERR);
+                    WRITE_TO_CONSOLE(s8DebugMsg);
+                    s16Status = CLI_JSON_REC_INVALID_CAPTURE_FILTER_ERR;
+                    return s16Status;
+                }
+                u64FilterValue[i] = strtoull(nodeData, NULL, 10);
+            }
+
+            strCaptureFilterConfig *psFilter =
+                                    &gsStartRecConfigMode.sCaptureFilter;
+            psFilter->bFilterEnable = true;
+            psFilter->u16NumAdcSamples = (UINT16)u64FilterValue[0];
+            psFilter->u8AdcFmt = (UINT8)u64FilterValue[1];
+            psFilter->u8RxChanEn = (UINT8)u64FilterValue[2];
+            psFilter->u16NumChirpsPerFrame = (UINT16)u64FilterValue[3];
+            psFilter->u32FrameDecimation = (UINT32)u64FilterValue[4];
+            psFilter->u32FrameStartIdx = (UINT32)u64FilterValue[5];
+            psFilter->u32FrameEndIdx = (UINT32)u64FilterValue[6];
+            psFilter->u8RxChanSel = node.isMember("rxChanSel") ?
+                        (UINT8)u64FilterValue[7] : psFilter->u8RxChanEn;
+            psFilter->u16ChirpStartIdx = (UINT16)u64FilterValue[8];
+            psFilter->u16ChirpEndIdx = node.isMember("chirpEndIdx") ?
+                        (UINT16)u64FilterValue[9] :
+                        (UINT16)(psFilter->u16NumChirpsPerFrame - 1);
+
+            /** Frames, chirps and RX channels are sliced in the layout of
+             *  the reordered data                                         */
+            if (!gsStartRecConfigMode.bReorderEnable)
+            {
+                sprintf(s8DebugMsg, "Invalid captureFilterConfig - reorderEnable "
+                        "is needed. [error %d]",
+                        CLI_JSON_REC_INVALID_CAPTURE_FILTER_ERR);
+                WRITE_TO_CONSOLE(s8DebugMsg);
+                s16Status = CLI_JSON_REC_INVALID_CAPTURE_FILTER_ERR;
+                return s16Status;
+            }
+        }
+
+        /** Memory mapped record files get the packets as received, the
+         *  record buffers are not there to stripe, ring, tag or filter  */
+        if ((gsStartRecConfigMode.eWriterBackend == WRITER_BACKEND_MMAP) &&
+            ((gsStartRecConfigMode.u8NumOfStripePaths > 1) ||
+             (gsStartRecConfigMode.eRecordTriggerMode == RECORD_TRIGGER_EVENT) ||
+             (gsStartRecConfigMode.u16CrcChunkSize > 0) ||
+             gsStartRecConfigMode.sCaptureFilter.bFilterEnable))
+        {
+            sprintf(s8DebugMsg, "Invalid writerBackend config - mmap is not "
+                    "supported with stripe paths, event trigger mode, CRC32C "
+                    "tags or the capture filter. [error %d]",
+                    CLI_JSON_REC_INVALID_WRITER_BACKEND_ERR);
+            WRITE_TO_CONSOLE(s8DebugMsg);
+            s16Status = CLI_JSON_REC_INVALID_WRITER_BACKEND_ERR;
+            return s16Status;
+        }
+
+        /** Record files end at whole frames of the capture filter layout,
+         *  the frames are contiguous in the record files of one path     */
+        if (((gsStartRecConfigMode.u32FramesPerFile > 0) ||
+             (gsStartRecConfigMode.u32FileDuration > 0)) &&
+            (((gsStartRecConfigMode.u32FramesPerFile > 0) &&
+              (gsStartRecConfigMode.u32FileDuration > 0)) ||
+             (gsStartRecConfigMode.eConfigLogMode != RAW_MODE) ||
+             (!gsStartRecConfigMode.sCaptureFilter.bFilterEnable) ||
+             (gsStartRecConfigMode.u8NumOfStripePaths > 1) ||
+             (gsStartRecConfigMode.eRecordTriggerMode == RECORD_TRIGGER_EVENT)))
+        {
+            sprintf(s8DebugMsg, "Invalid file rollover config - framesPerFile "
+                    "or fileDuration_ms is supported in raw mode with the "
+                    "capture filter and one path, without the event trigger "
+                    "mode. [error %d]", CLI_JSON_REC_INVALID_FILE_ROLLOVER_ERR);
+            WRITE_TO_CONSOLE(s8DebugMsg);
+            s16Status = CLI_JSON_REC_INVALID_FILE_ROLLOVER_ERR;
+            return s16Status;
+        }
+
+        /** Test pattern verification is optional, the ADC data is
+         *  checked against the LVDS test pattern and not recorded      */
+        memset(&gsStartRecConfigMode.sTestPattern, 0,
+               sizeof(strTestPatternConfig));
+        node = root.get("testPatternConfig", 0);
+        if (node.size() > 0)
+        {
+            const SINT8 *s8PatternParam[TEST_PATTERN_NUM_OF_PARAMS] = {
+                "adcFmt", "pktSize",
+                "lane0Icfg", "lane1Icfg", "lane2Icfg", "lane3Icfg",
+                "lane0Qcfg", "lane1Qcfg", "lane2Qcfg", "lane3Qcfg" };
+            ULONG64 u64PatternMax[TEST_PATTERN_NUM_OF_PARAMS] = {
+                MAX_CAPTURE_FILTER_ADC_FMT, MAX_TEST_PATTERN_PKT_SIZE,
+                MAX_TEST_PATTERN_LANE_CFG, MAX_TEST_PATTERN_LANE_CFG,
+                MAX_TEST_PATTERN_LANE_CFG, MAX_TEST_PATTERN_LANE_CFG,
+                MAX_TEST_PATTERN_LANE_CFG, MAX_TEST_PATTERN_LANE_CFG,
+                MAX_TEST_PATTERN_LANE_CFG, MAX_TEST_PATTERN_LANE_CFG };
+            ULONG64 u64PatternValue[TEST_PATTERN_NUM_OF_PARAMS] = { 1, 0 };
+
+            /** A lane ramps over the 16 bit words of the data stream by
+             *  default (offset of the word in a sample, increment of a
+             *  sample of all the lanes)                                  */
+            UINT32 u32NumOfLanes =
+                (gsStartRecConfigMode.eLvdsMode == TWO_LANE) ? 2 : 4;
+            for (SINT32 i = 0; i < TEST_PATTERN_NUM_OF_PARAMS; i++)
+            {
+                if (!node.isMember(s8PatternParam[i]))
+                    continue;
+
+                memset(nodeData, '\0', MAX_PARAMS_LEN);
+                strcpy(nodeData, node[s8PatternParam[i]].asString().c_str());
+                if (SUCCESS_STATUS != validateCaptureFilterParam(nodeData,
+                                        0, u64PatternMax[i]))
+                {
+                    sprintf(s8DebugMsg, "Invalid %s value (%s). [error %d]",
+                            s8PatternParam[i], nodeData,
+                            CLI_JSON_REC_INVALID_TEST_PATTERN_ERR);
+                    WRITE_TO_CONSOLE(s8DebugMsg);
+                    s16Status = CLI_JSON_REC_INVALID_TEST_PATTERN_ERR;
+                    return s16Status;
+                }
+                u64PatternValue[i] = strtoull(nodeData, NULL, 10);
+            }
+
+            strTestPatternConfig *psPattern =
+                                    &gsStartRecConfigMode.sTestPattern;
+            psPattern->bVerifyEnable = true;
+            psPattern->u8AdcFmt = (UINT8)u64PatternValue[0];
+            psPattern->u16PktSize = (UINT16)u64PatternValue[1];
+            UINT32 u32SampleWords = u32NumOfLanes *
+                                    ((psPattern->u8AdcFmt == 0) ? 1 : 2);
+            for (UINT32 i = 0; i < MAX_PATTERN_SLOTS; i++)
+            {
+                UINT32 u32Slot = (i < MAX_PATTERN_LANES) ? i :
+                                 (i - MAX_PATTERN_LANES + u32NumOfLanes);
+                if (node.isMember(s8PatternParam[2 + i]))
+                    psPattern->au32LaneCfg[i] =
+                                    (UINT32)u64PatternValue[2 + i];
+                else
+                    psPattern->au32LaneCfg[i] = (u32SampleWords << 16) |
+                                                u32Slot;
+            }
+        }
+
+        /** Other systems streaming to the data port of the connected one
+         *  are optional (raw mode), packets are told apart by source IP  */
+        memset(&gsStartRecConfigMode.sSharedPort, 0,
+               sizeof(strSharedPortConfig));
+        if (root["ethernetConfig"].isMember("sharedDataPortIPAddresses"))
+        {
+            Json::Value ipNode =
+                        root["ethernetConfig"]["sharedDataPortIPAddresses"];
+            if ((!ipNode.isArray()) || (ipNode.size() < 1) ||
+                (ipNode.size() >= MAX_SHARED_PORT_SYSTEMS) ||
+                (gsStartRecConfigMode.eConfigLogMode != RAW_MODE))
+            {
+                sprintf(s8DebugMsg, "Invalid sharedDataPortIPAddresses config "
+                        "(list of up to %d systems, raw mode only). [error %d]",
+                        MAX_SHARED_PORT_SYSTEMS - 1,
+                        CLI_JSON_REC_INVALID_SHARED_PORT_ERR);
+                WRITE_TO_CONSOLE(s8DebugMsg);
+                return CLI_JSON_REC_INVALID_SHARED_PORT_ERR;
+            }
+
+            strSharedPortConfig *psShared = &gsStartRecConfigMode.sSharedPort;
+            memcpy(psShared->au8IpAddr[0], gsEthConfigMode.au8Dca1000IpAddr,
+                   sizeof(psShared->au8IpAddr[0]));
+            for (UINT8 i = 0; i < ipNode.size(); i++)
+            {
+                memset(nodeData, '\0', MAX_PARAMS_LEN);
+                strcpy(nodeData, ipNode[i].asString().c_str());
+                if (SUCCESS_STATUS != validateIpAddress(nodeData))
+                {
+                    sprintf(s8DebugMsg, "Invalid sharedDataPortIPAddresses "
+                            "value (%s). [error %d]", ipNode[i].asString().c_str(),
+                            CLI_JSON_REC_INVALID_SHARED_PORT_ERR);
+                    WRITE_TO_CONSOLE(s8DebugMsg);
+                    return CLI_JSON_REC_INVALID_SHARED_PORT_ERR;
+                }
+                token = strtok(nodeData, ".");
+                k = 0;
+                while (token != NULL)
+                {
+                    psShared->au8IpAddr[i + 1][k++] = atoi(token);
+                    token = strtok(NULL, ".");
+                }
+            }
+            psShared->u8NumOfSystems = (UINT8)(ipNode.size() + 1);
+        }
+
         break;
     case CMD_CODE_CLI_PROC_STATUS_SHM:
         if (!root.isMember("dataLoggingMode"))
@@ -988,17 +1641,20 @@ SINT32 ValidateJsonFileData(SINT8 *configFile, UINT16 u16CmdCode)
     return s16Status;
 }
 
-/** @fn bool IsRecordProcStopped()
+/** @fn bool IsRecordProcStopped(UINT32 *pu32StateSeq)
  * @brief This function is to check whether the record process is stopped
+ * @param [out] pu32StateSeq [UINT32 *] - State sequence read with the status
  * @return boolean value
  */
-bool IsRecordProcStopped()
+bool IsRecordProcStopped(UINT32 *pu32StateSeq)
 {
     SHM_PROC_STATES procStates;
     SINT32 s32Status = osalObj.QueryRecordProcStatus(
         gsEthConfigMode.u32ConfigPortNo, &procStates);
     if (SUCCESS_STATUS == s32Status)
     {
+        *pu32StateSeq = procStates.u32StateSeq;
+
         /** Parse the command status */
         if (procStates.s32CommandStatus == STS_CLI_REC_PROC_STOPPED)
         {
@@ -1193,15 +1849,25 @@ SINT32 ReadShmForQueryStatusCmd()
                 memset(s8LogBuf, '\0', MAX_FILE_UPDATE_LEN);
                 ULONG64 seconds = 0;
 
+                /** Raw mode - an entry per system of a shared data port,
+                 *  the other systems are listed once they sent data       */
                 if (gsStartRecConfigMode.eConfigLogMode == RAW_MODE)
                 {
-                    u8NumDataTypes = 1;
+                    u8NumDataTypes = NUM_REC_STATS_ENTRIES;
                 }
 
                 for (int i = 0; i < u8NumDataTypes; i++)
                 {
-                    if (u8NumDataTypes == 1)
-                        sprintf(s8LogMsg, "Raw Data :");
+                    if (gsStartRecConfigMode.eConfigLogMode == RAW_MODE)
+                    {
+                        if ((i > 0) && (procStates.strInlineProcStats.
+                                            u64NumOfRecvdPackets[i] == 0))
+                            continue;
+                        if (i == 0)
+                            sprintf(s8LogMsg, "Raw Data :");
+                        else
+                            sprintf(s8LogMsg, "Raw Data (System %d) :", i);
+                    }
                     else
                     {
                         if (strcmp(procStates.strInlineProcStats.s8HeaderId[i],
@@ -1242,6 +1908,31 @@ SINT32 ReadShmForQueryStatusCmd()
                     sprintf(s8LogMsg, "\nNumber of zero filled bytes - %llu",
                             procStates.strInlineProcStats.u64NumOfZeroFilledBytes[i]);
                     strcat(s8LogBuf, s8LogMsg);
+                    sprintf(s8LogMsg, "\nLost packets - %llu socket overflow, "
+                            "%llu upstream",
+                            procStates.strInlineProcStats.u64NumOfSockDroppedPackets[i],
+                            procStates.strInlineProcStats.u64NumOfUpstreamLostPackets[i]);
+                    strcat(s8LogBuf, s8LogMsg);
+                    sprintf(s8LogMsg, "\nWriter busy at buffer swap - %llu of %llu",
+                            procStates.strInlineProcStats.u64NumOfWriterWaits[i],
+                            procStates.strInlineProcStats.u64NumOfBufSwaps[i]);
+                    strcat(s8LogBuf, s8LogMsg);
+                    sprintf(s8LogMsg, "\nBuffers spilled to RAM for busy writer - %llu",
+                            procStates.strInlineProcStats.u64NumOfSpilledBufs[i]);
+                    strcat(s8LogBuf, s8LogMsg);
+                    sprintf(s8LogMsg, "\nPaused for busy writer - %llu",
+                            procStates.strInlineProcStats.u64NumOfWriterPauses[i]);
+                    strcat(s8LogBuf, s8LogMsg);
+                    sprintf(s8LogMsg, "\nDropped for busy writer - %llu frames, %llu bytes",
+                            procStates.strInlineProcStats.u64NumOfDroppedFrames[i],
+                            procStates.strInlineProcStats.u64NumOfDroppedBytes[i]);
+                    strcat(s8LogBuf, s8LogMsg);
+                    sprintf(s8LogMsg, "\nPre-trigger ring dumps - %llu",
+                            procStates.strInlineProcStats.u64NumOfTriggerDumps[i]);
+                    strcat(s8LogBuf, s8LogMsg);
+                    sprintf(s8LogMsg, "\nBytes dropped by capture filter - %llu",
+                            procStates.strInlineProcStats.u64NumOfFilteredBytes[i]);
+                    strcat(s8LogBuf, s8LogMsg);
 #endif
                     sprintf(s8LogMsg, "\nCapture start time - %s",
                             ctime(&procStates.strInlineProcStats.StartTime[i]));
@@ -1291,6 +1982,45 @@ SINT32 ReadShmForQueryStatusCmd()
                 WRITE_TO_LOG_FILE(
                     "Record process - Inline buffer allocation error");
             }
+            // STS_REC_RETENTION_AGE_ERR
+            if ((procStates.u32AsyncStatus &
+                 (1 << STS_REC_RETENTION_AGE_ERR)) ==
+                (1 << STS_REC_RETENTION_AGE_ERR))
+            {
+                WRITE_TO_CONSOLE(
+                    "Record process - Record files dropped before the retention age");
+                WRITE_TO_LOG_FILE(
+                    "Record process - Record files dropped before the retention age");
+            }
+#if !defined(POST_PROCESSING) && defined(LATENCY_HISTOGRAMS)
+            // Latency histograms of the record process
+            const SINT8 *s8LatencyHistName[NUM_LATENCY_HISTS] = LATENCY_HIST_NAMES;
+            SINT8 s8LatencyMsg[MAX_NAME_LEN];
+            bool bRawMode = (gsStartRecConfigMode.eConfigLogMode == RAW_MODE);
+            for (int i = 0; i < NUM_REC_STATS_ENTRIES; i++)
+            {
+                for (int j = 0; j < NUM_LATENCY_HISTS; j++)
+                {
+                    strRFDCCard_LatencyHist *psHist =
+                            &procStates.strLatencyStats.sHist[i][j];
+
+                    if (psHist->u64TotalCount == 0)
+                        continue;
+
+                    /** Raw mode - entries of the shared data port systems */
+                    sprintf(s8LatencyMsg, "%s %d %s latency(us) - p50 %llu, "
+                            "p99 %llu, p99.9 %llu, max %llu",
+                            bRawMode ? "System" : "DT", bRawMode ? i : i + 1,
+                            s8LatencyHistName[j],
+                            ReadRFDCCard_LatencyPercentile(psHist, 50),
+                            ReadRFDCCard_LatencyPercentile(psHist, 99),
+                            ReadRFDCCard_LatencyPercentile(psHist, 99.9),
+                            psHist->u64MaxUs);
+                    WRITE_TO_CONSOLE(s8LatencyMsg);
+                    WRITE_TO_LOG_FILE(s8LatencyMsg);
+                }
+            }
+#endif
         }
         else /** invalid command set */
         {
@@ -1372,6 +2102,283 @@ void DecodeCommandStatus(SINT32 s32Status, const SINT8 *strCommand)
     WRITE_TO_LOG_FILE(msgData);
 }
 
+/** @fn SINT32 RunDiscovery(SINT8 *s8JsonFile, SINT32 s32NumOfIps)
+ * @brief This function is to find the DCA1000EVM systems in a range of <!--
+ * --> IP addresses starting from the DCA1000EVM IP address of the JSON <!--
+ * --> file. All the addresses are probed at once
+ * @param [in] s8JsonFile [SINT8 *] - JSON file name
+ * @param [in] s32NumOfIps [SINT32] - Number of IP addresses to probe
+ * @return SINT32 value
+ */
+SINT32 RunDiscovery(SINT8 *s8JsonFile, SINT32 s32NumOfIps)
+{
+    SINT8 s8DebugMsg[MAX_NAME_LEN];
+    SINT32 s32CliStatus = SUCCESS_STATUS;
+    strRFDCCard_DiscoveryInfo sCards[MAX_DISCOVERY_IPS];
+    UINT16 u16NumOfCards = 0;
+    UINT16 i = 0;
+
+    if ((s32NumOfIps < 1) || (s32NumOfIps > MAX_DISCOVERY_IPS))
+    {
+        sprintf(s8DebugMsg, "Invalid number of IP addresses (%d). [error %d]",
+                s32NumOfIps, CLI_INVALID_DISCOVERY_NUM_OF_IPS_ERR);
+        WRITE_TO_CONSOLE(s8DebugMsg);
+        WRITE_TO_LOG_FILE(s8DebugMsg);
+        return CLI_INVALID_DISCOVERY_NUM_OF_IPS_ERR;
+    }
+
+    s32CliStatus = ValidateJsonFileData(s8JsonFile, CMD_CODE_SYSTEM_ALIVENESS);
+    if (s32CliStatus < 0)
+        return s32CliStatus;
+
+    /* API Call - Ethernet connection */
+    s32CliStatus = ConnectRFDCCard_ConfigMode(gsEthConfigMode);
+    if (s32CliStatus != SUCCESS_STATUS)
+    {
+        WRITE_TO_LOG_FILE("Ethernet connection");
+        sprintf(s8DebugMsg, "Ethernet connection failed. [error %d]",
+                CLI_ETH_CONNECT_FAIL_ERR);
+        WRITE_TO_CONSOLE(s8DebugMsg);
+        WRITE_TO_LOG_FILE(s8DebugMsg);
+        DisconnectRFDCCard_ConfigMode();
+        return CLI_ETH_CONNECT_FAIL_ERR;
+    }
+
+    WRITE_TO_LOG_FILE("Discover Command (req)");
+
+    /** API Call - Discover DCA1000EVM systems                               */
+    s32CliStatus = DiscoverRFDCCards(gsEthConfigMode.au8Dca1000IpAddr,
+                                     (UINT16)s32NumOfIps, DISCOVERY_TIMEOUT_MS,
+                                     sCards, &u16NumOfCards);
+    DisconnectRFDCCard_ConfigMode();
+    if (s32CliStatus != SUCCESS_STATUS)
+    {
+        DecodeCommandStatus(s32CliStatus, "Discover");
+        return s32CliStatus;
+    }
+
+    for (i = 0; i < u16NumOfCards; i++)
+    {
+        sprintf(s8DebugMsg, "DCA1000EVM found : %d.%d.%d.%d (FPGA Version : %s)",
+                sCards[i].au8Dca1000IpAddr[0], sCards[i].au8Dca1000IpAddr[1],
+                sCards[i].au8Dca1000IpAddr[2], sCards[i].au8Dca1000IpAddr[3],
+                (sCards[i].s8FpgaVersion[0] != '\0') ?
+                    sCards[i].s8FpgaVersion : "Unknown");
+        WRITE_TO_CONSOLE(s8DebugMsg);
+        WRITE_TO_LOG_FILE(s8DebugMsg);
+    }
+
+    if (u16NumOfCards == 0)
+    {
+        sprintf(s8DebugMsg, "No DCA1000EVM system found. [error %d]",
+                CLI_DISCOVERY_NO_SYSTEM_FOUND_ERR);
+        WRITE_TO_CONSOLE(s8DebugMsg);
+        WRITE_TO_LOG_FILE(s8DebugMsg);
+        return CLI_DISCOVERY_NO_SYSTEM_FOUND_ERR;
+    }
+
+    return SUCCESS_STATUS;
+}
+
+/** @fn SINT32 RunParallelEepromUpdate(SINT32 s32NumOfFiles, SINT8 *s8JsonFiles[])
+ * @brief This function is to update the EEPROM of one DCA1000EVM system <!--
+ * --> per JSON file. The systems are addressed by the DCA1000EVM IP <!--
+ * --> address of each file and updated at once
+ * @param [in] s32NumOfFiles [SINT32] - Number of JSON files
+ * @param [in] s8JsonFiles [SINT8 *[]] - JSON file names
+ * @return SINT32 value
+ */
+SINT32 RunParallelEepromUpdate(SINT32 s32NumOfFiles, SINT8 *s8JsonFiles[])
+{
+    SINT8 s8DebugMsg[MAX_NAME_LEN];
+    SINT32 s32CliStatus = SUCCESS_STATUS;
+    strEthConfigMode sCurEthConfig[MAX_DISCOVERY_IPS];
+    strEthConfigMode sNewEthConfig[MAX_DISCOVERY_IPS];
+    STATUS s32Status[MAX_DISCOVERY_IPS];
+    SINT32 i = 0;
+
+    if ((s32NumOfFiles < 1) || (s32NumOfFiles > MAX_DISCOVERY_IPS))
+    {
+        sprintf(s8DebugMsg, "Invalid number of JSON files (%d). [error %d]",
+                s32NumOfFiles, CLI_INVALID_CMD_ARG_ERR);
+        WRITE_TO_CONSOLE(s8DebugMsg);
+        return CLI_INVALID_CMD_ARG_ERR;
+    }
+
+    for (i = 0; i < s32NumOfFiles; i++)
+    {
+        s32CliStatus = ValidateJsonFileData(s8JsonFiles[i],
+                                            CMD_CODE_CONFIG_EEPROM);
+        if (s32CliStatus < 0)
+            return s32CliStatus;
+        memcpy(&sCurEthConfig[i], &gsEthConfigMode, sizeof(strEthConfigMode));
+        memcpy(&sNewEthConfig[i], &gsEthUpdateMode, sizeof(strEthConfigMode));
+    }
+
+    /* API Call - Ethernet connection, config port of the first file */
+    s32CliStatus = ConnectRFDCCard_ConfigMode(sCurEthConfig[0]);
+    if (s32CliStatus != SUCCESS_STATUS)
+    {
+        WRITE_TO_LOG_FILE("Ethernet connection");
+        sprintf(s8DebugMsg, "Ethernet connection failed. [error %d]",
+                CLI_ETH_CONNECT_FAIL_ERR);
+        WRITE_TO_CONSOLE(s8DebugMsg);
+        WRITE_TO_LOG_FILE(s8DebugMsg);
+        DisconnectRFDCCard_ConfigMode();
+        return CLI_ETH_CONNECT_FAIL_ERR;
+    }
+
+    WRITE_TO_LOG_FILE("EEPROM Configuration Command (req)");
+
+    /** API Call - Configure EEPROM of all the systems                       */
+    s32CliStatus = ConfigureRFDCCards_Eeprom(sCurEthConfig, sNewEthConfig,
+                                             (UINT16)s32NumOfFiles, s32Status);
+    DisconnectRFDCCard_ConfigMode();
+    if (s32CliStatus == STS_RFDCCARD_INVALID_INPUT_PARAMS)
+    {
+        DecodeCommandStatus(s32CliStatus, "EEPROM Configuration");
+        return s32CliStatus;
+    }
+
+    /** Handling command response of each system                             */
+    for (i = 0; i < s32NumOfFiles; i++)
+    {
+        sprintf(s8DebugMsg, "EEPROM Configuration (%d.%d.%d.%d)",
+                sCurEthConfig[i].au8Dca1000IpAddr[0],
+                sCurEthConfig[i].au8Dca1000IpAddr[1],
+                sCurEthConfig[i].au8Dca1000IpAddr[2],
+                sCurEthConfig[i].au8Dca1000IpAddr[3]);
+        DecodeCommandStatus(s32Status[i], s8DebugMsg);
+    }
+
+    return s32CliStatus;
+}
+
+/** @fn SINT32 RunReassemble(SINT8 *s8ManifestFile, SINT8 *s8OutFile)
+ * @brief This function is to join the stripes of a record striped <!--
+ * --> across several base paths in one record file
+ * @param [in] s8ManifestFile [SINT8 *] - Stripe manifest file of the record
+ * @param [in] s8OutFile [SINT8 *] - Record file to create
+ * @return SINT32 value
+ */
+SINT32 RunReassemble(SINT8 *s8ManifestFile, SINT8 *s8OutFile)
+{
+    SINT8 s8DebugMsg[MAX_NAME_LEN * 3];
+    STRIPE_READER_HANDLE hReader = NULL;
+    SINT32 s32BytesRead = 0;
+    ULONG64 u64TotalBytes = 0;
+    FILE *pOutFile = NULL;
+    SINT8 *s8Buf = NULL;
+
+    /** API Call - Open the striped record                                  */
+    s32BytesRead = OpenRecordStripes(s8ManifestFile, &hReader);
+    if (s32BytesRead != STS_RFDCCARD_SUCCESS)
+    {
+        sprintf(s8DebugMsg, "Invalid stripe manifest (%s). [error %d]",
+                s8ManifestFile, CLI_REASSEMBLE_MANIFEST_ERR);
+        WRITE_TO_CONSOLE(s8DebugMsg);
+        WRITE_TO_LOG_FILE(s8DebugMsg);
+        return CLI_REASSEMBLE_MANIFEST_ERR;
+    }
+
+    s8Buf = (SINT8 *)malloc(REASSEMBLE_BUF_SIZE);
+    pOutFile = fopen(s8OutFile, "wb");
+    if ((NULL == s8Buf) || (NULL == pOutFile))
+    {
+        sprintf(s8DebugMsg, "Not able to create the record file (%s). [error %d]",
+                s8OutFile, CLI_REASSEMBLE_FILE_ERR);
+        WRITE_TO_CONSOLE(s8DebugMsg);
+        WRITE_TO_LOG_FILE(s8DebugMsg);
+        if (NULL != pOutFile)
+            fclose(pOutFile);
+        free(s8Buf);
+        CloseRecordStripes(hReader);
+        return CLI_REASSEMBLE_FILE_ERR;
+    }
+
+    /** API Call - Read the stripes in the recorded order                   */
+    while ((s32BytesRead = ReadRecordStripes(hReader, s8Buf,
+                                             REASSEMBLE_BUF_SIZE)) > 0)
+    {
+        fwrite(s8Buf, 1, s32BytesRead, pOutFile);
+        u64TotalBytes += s32BytesRead;
+    }
+
+    fclose(pOutFile);
+    free(s8Buf);
+    CloseRecordStripes(hReader);
+
+    if (s32BytesRead < 0)
+    {
+        sprintf(s8DebugMsg, "Stripe missing in the record files after %llu bytes. [error %d]",
+                u64TotalBytes, CLI_REASSEMBLE_FILE_ERR);
+        WRITE_TO_CONSOLE(s8DebugMsg);
+        WRITE_TO_LOG_FILE(s8DebugMsg);
+        return CLI_REASSEMBLE_FILE_ERR;
+    }
+
+    sprintf(s8DebugMsg, "Striped record joined : %s (%llu bytes)",
+            s8OutFile, u64TotalBytes);
+    WRITE_TO_CONSOLE(s8DebugMsg);
+    WRITE_TO_LOG_FILE(s8DebugMsg);
+    return SUCCESS_STATUS;
+}
+
+/** @fn SINT32 RunVerify(SINT8 *s8CrcLogFile, UINT32 u32NumOfThreads)
+ * @brief This function is to verify a record against the CRC32C tags <!--
+ * --> of its chunks
+ * @param [in] s8CrcLogFile [SINT8 *] - CRC32C log file of the record
+ * @param [in] u32NumOfThreads [UINT32] - Worker threads, 0 for one per <!--
+ * --> processor core
+ * @return SINT32 value
+ */
+SINT32 RunVerify(SINT8 *s8CrcLogFile, UINT32 u32NumOfThreads)
+{
+    SINT8 s8DebugMsg[MAX_NAME_LEN * 3];
+    strRecordVerifyStatus sVerifyStatus;
+    SINT32 s32Status = SUCCESS_STATUS;
+
+    /** API Call - Read the record and check its chunks                     */
+    s32Status = VerifyRecordCrc(s8CrcLogFile, u32NumOfThreads, &sVerifyStatus);
+    if (s32Status != STS_RFDCCARD_SUCCESS)
+    {
+        sprintf(s8DebugMsg, "Invalid CRC32C log or record files missing (%s). [error %d]",
+                s8CrcLogFile, CLI_VERIFY_CRC_LOG_ERR);
+        WRITE_TO_CONSOLE(s8DebugMsg);
+        WRITE_TO_LOG_FILE(s8DebugMsg);
+        return CLI_VERIFY_CRC_LOG_ERR;
+    }
+
+    if ((sVerifyStatus.u32NumOfBadChunks > 0) ||
+        (sVerifyStatus.u32NumOfMissingChunks > 0))
+    {
+        sprintf(s8DebugMsg, "Record check failed : %u of %u chunks corrupted, "
+                "%u missing, first at chunk %u. [error %d]",
+                sVerifyStatus.u32NumOfBadChunks, sVerifyStatus.u32NumOfChunks,
+                sVerifyStatus.u32NumOfMissingChunks,
+                sVerifyStatus.u32FirstFailedChunk, CLI_VERIFY_RECORD_ERR);
+        WRITE_TO_CONSOLE(s8DebugMsg);
+        WRITE_TO_LOG_FILE(s8DebugMsg);
+        return CLI_VERIFY_RECORD_ERR;
+    }
+
+    if (sVerifyStatus.u64UnloggedBytes > 0)
+    {
+        sprintf(s8DebugMsg, "Record check failed : %llu bytes after the last "
+                "chunk of the log. [error %d]", sVerifyStatus.u64UnloggedBytes,
+                CLI_VERIFY_RECORD_ERR);
+        WRITE_TO_CONSOLE(s8DebugMsg);
+        WRITE_TO_LOG_FILE(s8DebugMsg);
+        return CLI_VERIFY_RECORD_ERR;
+    }
+
+    sprintf(s8DebugMsg, "Record verified : %u chunks (%llu bytes)",
+            sVerifyStatus.u32NumOfChunks, sVerifyStatus.u64VerifiedBytes);
+    WRITE_TO_CONSOLE(s8DebugMsg);
+    WRITE_TO_LOG_FILE(s8DebugMsg);
+    return SUCCESS_STATUS;
+}
+
 /** @fn SINT32 do_command(SINT32 argc, SINT8* argv[])
  * @brief This function is the main function to handle configuration <!--
  * --> commands to be executed, validation of JSON file and command line  <!--
@@ -1395,6 +2402,7 @@ SINT32 do_command(SINT8 s8Command[], SINT8 s8CommandArg[])
     UINT16 u16CmdCode = 0;
     strcpy(s8CliVersion, CLI_CTRL_VERSION);
     bool bValue = false;
+    ULONG64 u64StopReqTimeUs = 0;
 
     u16CmdCode = 0;
 
@@ -1492,6 +2500,8 @@ SINT32 do_command(SINT8 s8Command[], SINT8 s8CommandArg[])
         //        bValue = IsRecordProcRunning();
         if (u16CmdCode == CMD_CODE_CLI_ASYNC_RECORD_STOP)
         {
+            /** Capture daemon publishes the record state in shared memory */
+            bValue = IsRecordProcRunning();
             if (!bValue)
             {
                 WRITE_TO_LOG_FILE(s8Command);
@@ -1699,6 +2709,7 @@ SINT32 do_command(SINT8 s8Command[], SINT8 s8CommandArg[])
         WRITE_TO_LOG_FILE("Stop Record Command (req)");
 
         /** API Call - Stop Record                                           */
+        u64StopReqTimeUs = osalObj.GetTimeInMicroSec();
         s32CliStatus = StopRecordAsyncCmd();
 
         if (s32CliStatus != SUCCESS_STATUS)
@@ -1708,19 +2719,32 @@ SINT32 do_command(SINT8 s8Command[], SINT8 s8CommandArg[])
         }
         else
         {
-            int timeoutCount = CLI_CMD_TIMEOUT_DURATION / MILLI_SEC_TO_READ_SHM;
+            UINT32 u32StateSeq = 0;
+            ULONG64 u64ElapsedUs = 0;
+            ULONG64 u64TimeoutUs = (ULONG64)CLI_CMD_TIMEOUT_DURATION *
+                                   MILLI_TO_MICRO_SEC_CONVERSION;
+            bool bStopped = false;
 
-            int iLoop = 0;
-            do
+            /** Record process publishes every state change in the shared
+             *  memory, wait for the change instead of polling the status */
+            while (!(bStopped = IsRecordProcStopped(&u32StateSeq)))
             {
-                if (IsRecordProcStopped())
+                u64ElapsedUs = osalObj.GetTimeInMicroSec() - u64StopReqTimeUs;
+                if (u64ElapsedUs >= u64TimeoutUs)
                     break;
-                else
+
+                if (osalObj.WaitForRecProcStateChange(
+                        gsEthConfigMode.u32ConfigPortNo, u32StateSeq,
+                        (u64TimeoutUs - u64ElapsedUs) /
+                        MILLI_TO_MICRO_SEC_CONVERSION) ==
+                    CLI_SHM_NOT_AVAIL_ERR)
+                {
+                    /** Record process is not created the shared memory yet */
                     osalObj.SleepInMilliSec(MILLI_SEC_TO_READ_SHM);
-                iLoop++;
-            } while (iLoop <= timeoutCount);
+                }
+            }
 
-            if (iLoop > timeoutCount)
+            if (!bStopped)
             {
                 sprintf(s8DebugMsg,
                         "Stop Record command : Timeout Error! Could not read the record process status. [error %d]",
@@ -1732,10 +2756,19 @@ SINT32 do_command(SINT8 s8Command[], SINT8 s8CommandArg[])
             }
             else
             {
+                u64StopReqTimeUs = osalObj.GetTimeInMicroSec() -
+                                   u64StopReqTimeUs;
                 sprintf(s8DebugMsg, "Stop Record command : Success");
                 osalObj.DestroyShm(gsEthConfigMode.u32ConfigPortNo);
                 WRITE_TO_LOG_FILE(s8DebugMsg);
                 WRITE_TO_CONSOLE(s8DebugMsg);
+
+                /** Stop request to record process stopped confirmation */
+                sprintf(s8DebugMsg, "Stop to confirm latency : %.3f ms",
+                        u64StopReqTimeUs /
+                        (DOUBLE)MILLI_TO_MICRO_SEC_CONVERSION);
+                WRITE_TO_LOG_FILE(s8DebugMsg);
+                WRITE_TO_CONSOLE(s8DebugMsg);
                 return SUCCESS_STATUS;
             }
         }
@@ -1793,7 +2826,44 @@ void stopRecording(SINT8 *json)
 SINT32 main(SINT32 argc, SINT8 *argv[])
 {
     jsonFile = "../cf_0.json";
-    if (argc == 2)
+    if ((argc >= 2) && (strcmp(argv[1], CMD_DAEMON) == 0))
+    {
+        if (argc >= 3)
+            jsonFile = argv[2];
+        return RunCliDaemon(jsonFile);
+    }
+    else if ((argc >= 3) && (strcmp(argv[1], CMD_DAEMON_CTL) == 0))
+    {
+        if (argc >= 4)
+            jsonFile = argv[3];
+        return SendCliDaemonCmd(argv[2], jsonFile);
+    }
+    else if ((argc >= 2) && (strcmp(argv[1], CMD_DISCOVER) == 0))
+    {
+        if (argc >= 3)
+            jsonFile = argv[2];
+        return RunDiscovery(jsonFile, (argc >= 4) ? atoi(argv[3]) :
+                                      DEFAULT_DISCOVERY_NUM_OF_IPS);
+    }
+    else if ((argc >= 4) && (strcmp(argv[1], CMD_CONFIG_EEPROM) == 0))
+    {
+        return RunParallelEepromUpdate(argc - 2, &argv[2]);
+    }
+    else if ((argc == 4) && (strcmp(argv[1], CMD_REASSEMBLE) == 0))
+    {
+        return RunReassemble(argv[2], argv[3]);
+    }
+    else if ((argc >= 3) && (argc <= 4) && (strcmp(argv[1], CMD_VERIFY) == 0))
+    {
+        return RunVerify(argv[2], (argc == 4) ? atoi(argv[3]) : 0);
+    }
+    else if ((argc >= 2) && (strcmp(argv[1], CMD_CALIBRATE) == 0))
+    {
+        if (argc >= 3)
+            jsonFile = argv[2];
+        return RunPacketDelayCalibration(jsonFile);
+    }
+    else if (argc == 2)
     {
         do_command(argv[1], jsonFile);
     }